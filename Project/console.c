@@ -0,0 +1,506 @@
+#include "console.h"
+
+// Commands with more than one line of output are written out one line per
+// poll by console_next_line()
+typedef enum {
+	CONSOLE_OUTPUT_NONE = 0,
+	CONSOLE_OUTPUT_HELP,
+	CONSOLE_OUTPUT_LIST,
+	CONSOLE_OUTPUT_STATS,
+	CONSOLE_OUTPUT_HISTORY,
+	CONSOLE_OUTPUT_PROFILE_WAIT,
+	CONSOLE_OUTPUT_PROFILE,
+	CONSOLE_OUTPUT_ZONES
+} console_output_t;
+
+static const char *const helpLines[] = {
+	"help | list | get <name> | set <name> <value> | save",
+	"stats | history | profile | zones [reset] | telemetry on|off | spi",
+};
+
+// Devices on I2C1 reported by the stats command
+static const struct {
+	const char *name;
+	uint8_t addr;
+} i2cDevices[] = {
+	{ "touch", FT6X06_DEV_ID },
+	{ "eeprom", MCP24LC32AT_DEV_ID },
+	{ "expander", MCP23017_DEV_ID },
+};
+
+static const char *const phaseNames[TELEMETRY_NUM_PHASES] = {
+	"input", "physics", "render", "persist", "idle"
+};
+
+static char line[CONSOLE_LINE_MAX + 1];
+static uint8_t lineLen;
+static bool lineTooLong;
+
+static char out[CONSOLE_OUT_MAX + 3];
+static uint8_t outLen;
+
+static console_output_t output;
+static uint8_t outputStep;
+static telemetry_profile_t profile;
+static profile_zone_stats_t zone;
+static match_record_t history[CONSOLE_HISTORY_MATCHES];
+static uint8_t historyCount;
+static spi_benchmark_t spiBench;
+
+//*****************************************************************************
+// Builds a line of output in out[], anything past CONSOLE_OUT_MAX is cut.
+//*****************************************************************************
+static void console_str(const char *s)
+{
+	while (*s && outLen < CONSOLE_OUT_MAX)
+		out[outLen++] = *s++;
+}
+
+static void console_int(int32_t value)
+{
+	char digits[11];
+	uint32_t magnitude = value < 0 ? -(uint32_t)value : (uint32_t)value;
+	int n = 0;
+
+	if (value < 0)
+		console_str("-");
+	do {
+		digits[n++] = '0' + (magnitude % 10);
+		magnitude /= 10;
+	} while (magnitude > 0);
+	while (n > 0 && outLen < CONSOLE_OUT_MAX)
+		out[outLen++] = digits[--n];
+}
+
+static void console_uint(uint32_t value)
+{
+	char digits[10];
+	int n = 0;
+
+	do {
+		digits[n++] = '0' + (value % 10);
+		value /= 10;
+	} while (value > 0);
+	while (n > 0 && outLen < CONSOLE_OUT_MAX)
+		out[outLen++] = digits[--n];
+}
+
+//*****************************************************************************
+// Queues the line in out[].  If the UART has no room it is kept and sent
+// again on the next poll.
+//*****************************************************************************
+static bool console_send(void)
+{
+	out[outLen] = '\r';
+	out[outLen + 1] = '\n';
+	if (!serial_debug_write((const uint8_t *)out, outLen + 2))
+		return false;
+	outLen = 0;
+	return true;
+}
+
+//*****************************************************************************
+// Throughput of cycles spent moving bytes, in kB/s
+//*****************************************************************************
+static void console_kbps(uint32_t bytes, uint32_t cycles)
+{
+	if (cycles == 0)
+		cycles = 1;
+	console_uint((uint32_t)((uint64_t)bytes * SystemCoreClock / 1000 / cycles));
+	console_str(" kB/s");
+}
+
+static void console_tunable(const tunable_t *tunable, bool range)
+{
+	console_str(tunable->name);
+	console_str(" = ");
+	console_int(*tunable->value);
+	if (range) {
+		console_str("  [");
+		console_int(tunable->min);
+		console_str("..");
+		console_int(tunable->max);
+		console_str("]");
+	}
+}
+
+//*****************************************************************************
+// Builds the next line of a multi line command in out[].  Returns false
+// when the command has no more output.
+//*****************************************************************************
+static bool console_next_line(void)
+{
+	serial_debug_stats_t serial;
+	telemetry_stats_t telemetry;
+	debug_log_stats_t log;
+	settings_stats_t settings;
+	tunables_stats_t tunables;
+	match_db_stats_t matchDb;
+	accel_stats_t accel;
+	i2c_timing_t timing;
+	i2c_device_stats_t device;
+	profile_zone_t id;
+	uint8_t i;
+	uint8_t step = outputStep++;
+
+	switch (output) {
+		case CONSOLE_OUTPUT_HELP:
+			if (step >= sizeof(helpLines) / sizeof(helpLines[0]))
+				return false;
+			console_str(helpLines[step]);
+			return true;
+
+		case CONSOLE_OUTPUT_LIST:
+			if (step >= tunables_count())
+				return false;
+			console_tunable(tunables_get(step), true);
+			return true;
+
+		case CONSOLE_OUTPUT_STATS:
+			switch (step) {
+				case 0:
+					serial_debug_get_stats(&serial);
+					console_str("serial: queued ");
+					console_uint(serial.bytesQueued);
+					console_str(" dropped ");
+					console_uint(serial.droppedBytes);
+					console_str(" chunks ");
+					console_uint(serial.chunks);
+					return true;
+				case 1:
+					telemetry_get_stats(&telemetry);
+					console_str("frames: sent ");
+					console_uint(telemetry.sent);
+					console_str(" dropped ");
+					console_uint(telemetry.dropped);
+					return true;
+				case 2:
+					debug_log_get_stats(&log);
+					console_str("log: records ");
+					console_uint(log.logged);
+					console_str(" dropped ");
+					console_uint(log.dropped);
+					return true;
+				case 3:
+					settings_get_stats(&settings);
+					console_str("settings: flushes ");
+					console_uint(settings.flushCount);
+					console_str(" deferred ");
+					console_uint(settings.deferredCount);
+					console_str(" failed ");
+					console_uint(settings.failedCount);
+					console_str(" max block ");
+					console_uint(settings.maxBlockCycles);
+					return true;
+				case 4:
+					tunables_get_stats(&tunables);
+					console_str("tunables: flushes ");
+					console_uint(tunables.flushCount);
+					console_str(" failed ");
+					console_uint(tunables.failedCount);
+					console_str(tunables.dirty ? " (save pending)" : "");
+					return true;
+				case 5:
+					accel_get_stats(&accel);
+					console_str("accel: reads ");
+					console_uint(accel.samples);
+					console_str(" avg ");
+					console_uint(accel.samples ? (uint32_t)(accel.totalCycles / accel.samples) : 0);
+					console_str(" max ");
+					console_uint(accel.maxCycles);
+					return true;
+				case 6:
+					accel_get_stats(&accel);
+					console_str("accel fifo: irqs ");
+					console_uint(accel.fifoIrqs);
+					console_str(" samples ");
+					console_uint(accel.fifoSamples);
+					console_str(" dropped ");
+					console_uint(accel.fifoDropped);
+					console_str(" overruns ");
+					console_uint(accel.fifoOverruns);
+					return true;
+				case 7:
+					if (i2cGetBusSpeed(I2C1_BASE, &timing) != I2C_OK)
+						return true;
+					console_str("i2c1: scl ");
+					console_uint(timing.scl_hz);
+					console_str(" tpr ");
+					console_uint(timing.tpr);
+					return true;
+				default:
+					// then one line per I2C device
+					i = step - 8;
+					if (i >= sizeof(i2cDevices) / sizeof(i2cDevices[0]))
+						return false;
+					if (i2cGetDeviceStats(I2C1_BASE, i2cDevices[i].addr, &device) != I2C_OK)
+						return true;
+					console_str(i2cDevices[i].name);
+					console_str(": n ");
+					console_uint(device.transactions);
+					console_str(" errors ");
+					console_uint(device.errors);
+					console_str(" nacks ");
+					console_uint(device.nacks);
+					console_str(" avg ");
+					console_uint(device.transactions ? (uint32_t)(device.totalCycles / device.transactions) : 0);
+					console_str(" max ");
+					console_uint(device.maxCycles);
+					return true;
+			}
+
+		case CONSOLE_OUTPUT_HISTORY:
+			if (step == 0) {
+				match_db_get_stats(&matchDb);
+				console_str("matches ");
+				console_uint(match_db_total());
+				console_str(" pending ");
+				console_uint(matchDb.pending);
+				console_str(" failed ");
+				console_uint(matchDb.failedCount);
+				console_str(" dropped ");
+				console_uint(matchDb.droppedCount);
+				return true;
+			}
+			if (step > historyCount)
+				return false;
+			console_str("#");
+			console_uint(history[step - 1].number);
+			console_str(" mode ");
+			console_uint(history[step - 1].mode);
+			console_str(history[step - 1].winner ? " p2 won " : " p1 won ");
+			console_uint(history[step - 1].score1);
+			console_str("-");
+			console_uint(history[step - 1].score2);
+			console_str(" rally ");
+			console_uint(history[step - 1].rally);
+			console_str(" ticks ");
+			console_uint(history[step - 1].duration);
+			return true;
+
+		case CONSOLE_OUTPUT_PROFILE_WAIT:
+			// nothing to send until the capture is done
+			outputStep = 0;
+			if (telemetry_profile_done(&profile))
+				output = CONSOLE_OUTPUT_PROFILE;
+			return true;
+
+		case CONSOLE_OUTPUT_PROFILE:
+			if (step >= TELEMETRY_NUM_PHASES || profile.records == 0)
+				return false;
+			console_str(phaseNames[step]);
+			console_str(": min ");
+			console_uint(profile.min[step]);
+			console_str(" avg ");
+			console_uint(profile.total[step] / profile.records);
+			console_str(" max ");
+			console_uint(profile.max[step]);
+			return true;
+
+		case CONSOLE_OUTPUT_ZONES:
+			// a header, then two lines per zone from one copy of its statistics
+			if (step == 0) {
+				console_str("zones in cycles, errors ");
+				console_uint(profile_zones_errors());
+				return true;
+			}
+			id = (profile_zone_t)((step - 1) / 2);
+			if (id >= PROFILE_NUM_ZONES)
+				return false;
+			if ((step - 1) % 2 == 0) {
+				if (!profile_zones_get(id, &zone))
+					return false;
+				if (zone.count == 0)
+					return true;
+				console_str(profile_zones_name(id));
+				console_str(": n ");
+				console_uint(zone.count);
+				console_str(" min ");
+				console_uint(zone.min);
+				console_str(" avg ");
+				console_uint((uint32_t)(zone.total / zone.count));
+				console_str(" max ");
+				console_uint(zone.max);
+				console_str(" self ");
+				console_uint((uint32_t)(zone.self / zone.count));
+			}
+			else if (zone.count > 0) {
+				console_str(" ");
+				for (i = 0; i < PROFILE_ZONES_BUCKETS; i++) {
+					if (zone.histogram[i] == 0)
+						continue;
+					console_str(" ");
+					console_uint(i);
+					console_str(":");
+					console_uint(zone.histogram[i]);
+				}
+			}
+			return true;
+
+		default:
+			return false;
+	}
+}
+
+//*****************************************************************************
+// Runs a complete command line.
+//*****************************************************************************
+static void console_execute(void)
+{
+	char *command = strtok(line, " ");
+	char *name = strtok(NULL, " ");
+	char *value = strtok(NULL, " ");
+	const tunable_t *tunable = NULL;
+	char *end;
+	long number;
+
+	if (command == NULL)
+		return;
+
+	if (strcmp(command, "help") == 0) {
+		output = CONSOLE_OUTPUT_HELP;
+	}
+	else if (strcmp(command, "list") == 0) {
+		output = CONSOLE_OUTPUT_LIST;
+	}
+	else if (strcmp(command, "stats") == 0) {
+		output = CONSOLE_OUTPUT_STATS;
+	}
+	else if (strcmp(command, "history") == 0) {
+		// one blocking read of the newest records, the lines follow from RAM
+		historyCount = match_db_history(history, CONSOLE_HISTORY_MATCHES);
+		output = CONSOLE_OUTPUT_HISTORY;
+	}
+	else if (strcmp(command, "profile") == 0) {
+		telemetry_profile_start(CONSOLE_PROFILE_TICKS);
+		output = CONSOLE_OUTPUT_PROFILE_WAIT;
+		console_str("profiling ");
+		console_uint(CONSOLE_PROFILE_TICKS);
+		console_str(" ticks, cycles per tick");
+	}
+	else if (strcmp(command, "zones") == 0 && name == NULL) {
+		output = CONSOLE_OUTPUT_ZONES;
+	}
+	else if (strcmp(command, "zones") == 0 && strcmp(name, "reset") == 0) {
+		profile_zones_reset();
+		console_str("zones cleared");
+	}
+	else if (strcmp(command, "spi") == 0) {
+		// blocks for the two transfers, well under a millisecond
+		if (!accel_spi_benchmark(&spiBench)) {
+			console_str("spi in use by the radio");
+		}
+		else {
+			console_str("spi ");
+			console_uint(spiBench.bytes);
+			console_str(" B: polled ");
+			console_uint(spiBench.polledCycles);
+			console_str(" cyc ");
+			console_kbps(spiBench.bytes, spiBench.polledCycles);
+			console_str(", dma ");
+			console_uint(spiBench.dmaCycles);
+			console_str(" cyc ");
+			console_kbps(spiBench.bytes, spiBench.dmaCycles);
+		}
+	}
+	else if (strcmp(command, "save") == 0) {
+		tunables_save();
+		console_str("saving at the next idle time");
+	}
+	else if (strcmp(command, "telemetry") == 0 && name != NULL &&
+	         (strcmp(name, "on") == 0 || strcmp(name, "off") == 0)) {
+		telemetry_enable(strcmp(name, "on") == 0);
+		console_str("telemetry ");
+		console_str(name);
+	}
+	else if (strcmp(command, "get") == 0 || strcmp(command, "set") == 0) {
+		if (name != NULL)
+			tunable = tunables_find(name);
+		if (tunable == NULL) {
+			console_str("unknown tunable, try list");
+		}
+		else if (command[0] == 'g') {
+			console_tunable(tunable, true);
+		}
+		else {
+			number = value ? strtol(value, &end, 0) : 0;
+			if (value == NULL || *end != '\0' || !tunables_set(tunable, number)) {
+				console_str("bad value, ");
+				console_tunable(tunable, true);
+			}
+			else {
+				console_tunable(tunable, false);
+			}
+		}
+	}
+	else {
+		console_str("unknown command, try help");
+	}
+	outputStep = 0;
+}
+
+//*****************************************************************************
+// Clears the command line and sends the prompt.
+//*****************************************************************************
+void console_init(void)
+{
+	lineLen = 0;
+	lineTooLong = false;
+	output = CONSOLE_OUTPUT_NONE;
+	outLen = 0;
+	console_str("console ready, type help");
+	console_send();
+}
+
+//*****************************************************************************
+// Handles one received byte and sends one line of pending output.  Call
+// every pass of the main loop.
+//*****************************************************************************
+void console_poll(void)
+{
+	int c;
+
+	// finish sending what the last call could not
+	if (outLen > 0 && !console_send())
+		return;
+
+	// a command that is still printing takes priority over new input,
+	// received bytes wait in the UART ring
+	if (output != CONSOLE_OUTPUT_NONE) {
+		if (!console_next_line())
+			output = CONSOLE_OUTPUT_NONE;
+		else if (outLen > 0)
+			console_send();
+		return;
+	}
+
+	c = serial_debug_rx(&UART0_Rx_Buffer, false);
+	if (c < 0)
+		return;
+
+	if (c == '\r' || c == '\n') {
+		serial_debug_write((const uint8_t *)"\r\n", 2);
+		line[lineLen] = '\0';
+		if (lineTooLong)
+			console_str("line too long");
+		else
+			console_execute();
+		lineLen = 0;
+		lineTooLong = false;
+		if (outLen > 0)
+			console_send();
+	}
+	else if (c == '\b' || c == 0x7F) {
+		if (lineLen > 0) {
+			lineLen--;
+			serial_debug_write((const uint8_t *)"\b \b", 3);
+		}
+	}
+	else if (lineLen < CONSOLE_LINE_MAX) {
+		line[lineLen++] = c;
+		serial_debug_tx(c);
+	}
+	else {
+		lineTooLong = true;
+	}
+}
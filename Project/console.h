@@ -0,0 +1,66 @@
+#ifndef __CONSOLE_H__
+#define __CONSOLE_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include "serial_debug.h"
+#include "tunables.h"
+#include "telemetry.h"
+#include "debug_log.h"
+#include "settings.h"
+#include "match_db.h"
+#include "eeprom.h"
+#include "ft6x06.h"
+#include "io_expander.h"
+#include "accel.h"
+#include "profile_zones.h"
+
+//*****************************************************************************
+// Line command console on the serial debug port.  console_poll() takes at
+// most one received byte and sends at most one line of output per call, so
+// it can run every pass of the main loop without holding up a game tick.
+//
+//    help                  lists the commands
+//    list                  every tunable with its value and range
+//    get <name>            one tunable
+//    set <name> <value>    changes a tunable right away
+//    save                  writes the tunables to the EEPROM at idle time
+//    stats                 serial, telemetry, log and EEPROM counters, the
+//                          accelerometer reads and FIFO, the I2C1 rate and
+//                          the time of each device's transactions in cycles
+//    history               the last CONSOLE_HISTORY_MATCHES matches
+//    profile               phase cycles over the next CONSOLE_PROFILE_TICKS
+//    zones                 cycles of every profiling zone and a histogram,
+//                          b:n is n times of 2^b to 2^(b+1) - 1 cycles
+//    zones reset           clears the zone statistics
+//    telemetry on|off      stops the binary records while typing
+//
+// Receive needs the UART0 RX interrupt, init_serial_debug(true, true).
+//*****************************************************************************
+
+// Longest command line, longer lines are discarded
+#define CONSOLE_LINE_MAX          40
+
+// Longest line of output
+#define CONSOLE_OUT_MAX           72
+
+// Game ticks covered by the profile command, 5 seconds at 50Hz
+#define CONSOLE_PROFILE_TICKS     250
+
+// Matches listed by the history command, newest first
+#define CONSOLE_HISTORY_MATCHES   8
+
+//*****************************************************************************
+// Clears the command line and sends the prompt.
+//*****************************************************************************
+void console_init(void);
+
+//*****************************************************************************
+// Handles one received byte and sends one line of pending output.  Call
+// every pass of the main loop.
+//*****************************************************************************
+void console_poll(void);
+
+#endif
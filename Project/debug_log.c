@@ -0,0 +1,153 @@
+#include "debug_log.h"
+
+// Word aligned so records, which are whole words, can be stored with
+// word writes
+static uint32_t logStorage[SPSC_RING_CHECK_SIZE(LOG_RING_SIZE) / 4];
+static spsc_ring_t logRing = { (uint8_t *)logStorage, LOG_RING_SIZE - 1, 0, 0 };
+
+static volatile uint32_t droppedUnreported;
+static debug_log_stats_t logStats;
+
+//*****************************************************************************
+// Empties the ring and clears the statistics.
+//*****************************************************************************
+void debug_log_init(void)
+{
+	cycle_counter_init();
+
+	logRing.head = 0;
+	logRing.tail = 0;
+	droppedUnreported = 0;
+	memset(&logStats, 0, sizeof(logStats));
+}
+
+//*****************************************************************************
+// Stores a record.  Safe to call from the main loop and from interrupt
+// handlers, it takes a few dozen cycles and never waits.  If the ring is
+// full the record is dropped and counted.
+//*****************************************************************************
+void debug_log_write(log_id_t id, uint32_t num_args, const uint32_t *args)
+{
+	uint32_t record[LOG_HEADER_WORDS + LOG_MAX_ARGS];
+	uint32_t size;
+	uint32_t *span;
+	uint32_t primask;
+	uint32_t i;
+
+	if (num_args > LOG_MAX_ARGS)
+		num_args = LOG_MAX_ARGS;
+	size = (LOG_HEADER_WORDS + num_args) * 4;
+
+	// interrupt handlers log too, so the ring has more than one producer
+	primask = __get_PRIMASK();
+	__disable_irq();
+
+	if (spsc_ring_space(&logRing) < size) {
+		droppedUnreported++;
+		logStats.dropped++;
+		__set_PRIMASK(primask);
+		return;
+	}
+
+	// records are whole words, so one is only split where the ring wraps
+	if (spsc_ring_write_span(&logRing, (uint8_t **)&span) >= size) {
+		span[0] = id | (num_args << LOG_ARGS_SHIFT);
+		span[1] = cycle_counter_read();
+		for (i = 0; i < num_args; i++)
+			span[LOG_HEADER_WORDS + i] = args[i];
+		spsc_ring_commit(&logRing, size);
+	}
+	else {
+		record[0] = id | (num_args << LOG_ARGS_SHIFT);
+		record[1] = cycle_counter_read();
+		for (i = 0; i < num_args; i++)
+			record[LOG_HEADER_WORDS + i] = args[i];
+		spsc_ring_write(&logRing, (uint8_t *)record, size);
+	}
+	logStats.logged++;
+
+	__set_PRIMASK(primask);
+}
+
+//*****************************************************************************
+// Sends a frame, records that don't fit on the UART are counted as dropped.
+//*****************************************************************************
+static void debug_log_send(const uint8_t *frame, uint32_t length, uint32_t records)
+{
+	uint32_t primask;
+
+	if (telemetry_write_frame(frame, length)) {
+		logStats.frames++;
+		return;
+	}
+
+	primask = __get_PRIMASK();
+	__disable_irq();
+	droppedUnreported += records;
+	logStats.dropped += records;
+	__set_PRIMASK(primask);
+}
+
+//*****************************************************************************
+// Sends the stored records.  Only call this from the main loop, it is the
+// only reader of the ring.
+//*****************************************************************************
+void debug_log_flush(void)
+{
+	uint8_t frame[1 + LOG_FRAME_BYTES];
+	uint32_t length = 1;
+	uint32_t records = 0;
+	uint32_t header;
+	uint32_t size;
+	uint32_t dropped;
+	uint32_t primask;
+
+	frame[0] = TELEMETRY_RECORD_LOG;
+
+	// a record for the drops goes in ahead of the rest, it needs no space
+	// in the ring
+	primask = __get_PRIMASK();
+	__disable_irq();
+	dropped = droppedUnreported;
+	droppedUnreported = 0;
+	__set_PRIMASK(primask);
+	if (dropped > 0) {
+		header = LOG_DROPPED | (1 << LOG_ARGS_SHIFT);
+		memcpy(&frame[1], &header, 4);
+		header = cycle_counter_read();
+		memcpy(&frame[5], &header, 4);
+		memcpy(&frame[9], &dropped, 4);
+		length = 13;
+		records = 1;
+	}
+
+	// writers store a whole record before returning and this only runs in
+	// the main loop, so the rest of a record is there once its header is
+	while (spsc_ring_read(&logRing, (uint8_t *)&header, 4) == 4) {
+		size = (LOG_HEADER_WORDS + (header >> LOG_ARGS_SHIFT)) * 4;
+		if (length + size > sizeof(frame)) {
+			debug_log_send(frame, length, records);
+			length = 1;
+			records = 0;
+		}
+		memcpy(&frame[length], &header, 4);
+		spsc_ring_read(&logRing, &frame[length + 4], size - 4);
+		length += size;
+		records++;
+	}
+
+	if (records > 0)
+		debug_log_send(frame, length, records);
+}
+
+//*****************************************************************************
+// Returns the logging statistics.
+//*****************************************************************************
+void debug_log_get_stats(debug_log_stats_t *stats)
+{
+	uint32_t primask = __get_PRIMASK();
+
+	__disable_irq();
+	*stats = logStats;
+	__set_PRIMASK(primask);
+}
@@ -0,0 +1,79 @@
+#ifndef __DEBUG_LOG_H__
+#define __DEBUG_LOG_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "spsc_ring.h"
+#include "cycle_counter.h"
+#include "telemetry.h"
+#include "log_messages.h"
+
+//*****************************************************************************
+// Tokenized logging.  A call site stores a message ID, a cycle count and
+// its argument words in a ring, no text is formatted on the target.
+// debug_log_flush() later sends the records as TELEMETRY_RECORD_LOG frames
+// and tools/log_decode.c prints them with the formats in log_messages.h.
+//
+// Each record is a header word (ID in the low 16 bits, argument count
+// above), the cycle counter when it was logged, then the arguments.
+//*****************************************************************************
+
+typedef enum {
+#define LOG_MESSAGE_ID(id, format)  id,
+	LOG_MESSAGES(LOG_MESSAGE_ID)
+#undef LOG_MESSAGE_ID
+	LOG_NUM_MESSAGES
+} log_id_t;
+
+// Bytes of records waiting to be sent, must be a power of two
+#define LOG_RING_SIZE         1024
+
+#define LOG_MAX_ARGS          4
+#define LOG_HEADER_WORDS      2
+#define LOG_ARGS_SHIFT        16
+
+// Up to this many bytes of records go in one frame
+#define LOG_FRAME_BYTES       128
+
+typedef struct {
+	uint32_t logged;          // records stored
+	uint32_t dropped;         // records lost because the ring or UART was full
+	uint32_t frames;          // frames sent
+} debug_log_stats_t;
+
+//*****************************************************************************
+// Empties the ring and clears the statistics.
+//*****************************************************************************
+void debug_log_init(void);
+
+//*****************************************************************************
+// Stores a record.  Safe to call from the main loop and from interrupt
+// handlers, it takes a few dozen cycles and never waits.  If the ring is
+// full the record is dropped and counted.  Use the LOGn macros instead of
+// calling this directly.
+//*****************************************************************************
+void debug_log_write(log_id_t id, uint32_t num_args, const uint32_t *args);
+
+#define LOG0(id) \
+	debug_log_write((id), 0, 0)
+#define LOG1(id, a) \
+	do { uint32_t _log_args[1] = { (uint32_t)(a) }; debug_log_write((id), 1, _log_args); } while (0)
+#define LOG2(id, a, b) \
+	do { uint32_t _log_args[2] = { (uint32_t)(a), (uint32_t)(b) }; debug_log_write((id), 2, _log_args); } while (0)
+#define LOG3(id, a, b, c) \
+	do { uint32_t _log_args[3] = { (uint32_t)(a), (uint32_t)(b), (uint32_t)(c) }; debug_log_write((id), 3, _log_args); } while (0)
+#define LOG4(id, a, b, c, d) \
+	do { uint32_t _log_args[4] = { (uint32_t)(a), (uint32_t)(b), (uint32_t)(c), (uint32_t)(d) }; debug_log_write((id), 4, _log_args); } while (0)
+
+//*****************************************************************************
+// Sends the stored records.  Only call this from the main loop, it is the
+// only reader of the ring.
+//*****************************************************************************
+void debug_log_flush(void);
+
+//*****************************************************************************
+// Returns the logging statistics.
+//*****************************************************************************
+void debug_log_get_stats(debug_log_stats_t *stats);
+
+#endif
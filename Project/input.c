@@ -0,0 +1,155 @@
+#include "input.h"
+
+typedef struct {
+	uint16_t centre;
+	bool invert;
+	int16_t residual;     // INPUT_FRAC_BITS fraction carried to the next tick
+	int16_t step;         // whole pixels for this tick
+} input_axis_t;
+
+// velocity for each deflection step, INPUT_FRAC_BITS fractional bits
+static uint8_t responseLut[INPUT_LUT_SIZE];
+
+static input_axis_t axisX = { INPUT_FULL_SCALE, INPUT_X_INVERT, 0, 0 };
+static input_axis_t axisY = { INPUT_FULL_SCALE, INPUT_Y_INVERT, 0, 0 };
+
+static uint32_t sampleAgeUs;
+
+//*****************************************************************************
+// Returns the measured centre, or mid scale if the stick was held
+//*****************************************************************************
+static uint16_t input_check_centre(uint32_t sum)
+{
+	uint16_t centre = sum / INPUT_CAL_SAMPLES;
+	
+	if (centre > INPUT_FULL_SCALE + INPUT_CAL_MAX_OFFSET || 
+			centre < INPUT_FULL_SCALE - INPUT_CAL_MAX_OFFSET)
+		return INPUT_FULL_SCALE;
+	return centre;
+}
+
+//*****************************************************************************
+// Averages INPUT_CAL_SAMPLES new joystick samples for the centre of each axis
+//*****************************************************************************
+static void input_calibrate(void)
+{
+	adc_sample_t sample;
+	uint32_t lastSequence;
+	uint32_t sumX = 0;
+	uint32_t sumY = 0;
+	int i;
+	
+	ps2_get_sample(&sample);
+	lastSequence = sample.sequence;
+	
+	for (i = 0; i < INPUT_CAL_SAMPLES; i++) {
+		// wait for the next background conversion
+		do {
+			ps2_get_sample(&sample);
+		} while (sample.sequence == lastSequence);
+		lastSequence = sample.sequence;
+		
+		sumX += sample.value[PS2_X_AXIS];
+		sumY += sample.value[PS2_Y_AXIS];
+	}
+	
+	axisX.centre = input_check_centre(sumX);
+	axisY.centre = input_check_centre(sumY);
+}
+
+//*****************************************************************************
+// Builds the response curve.  Past the dead zone the deflection t runs from
+// 0 to 256 and the velocity is a blend of t and t^2.
+//*****************************************************************************
+void input_set_response(uint16_t dead_zone, uint8_t curve_percent, uint8_t max_speed)
+{
+	uint32_t deflection;
+	uint32_t t;
+	uint32_t shape;
+	int i;
+	
+	if (dead_zone >= INPUT_FULL_SCALE)
+		dead_zone = INPUT_FULL_SCALE - 1;
+	if (curve_percent > 100)
+		curve_percent = 100;
+	
+	for (i = 0; i < INPUT_LUT_SIZE; i++) {
+		// middle of the step
+		deflection = (i << INPUT_LUT_SHIFT) + (1 << (INPUT_LUT_SHIFT - 1));
+		if (deflection <= dead_zone) {
+			responseLut[i] = 0;
+			continue;
+		}
+		
+		t = ((deflection - dead_zone) << 8) / (INPUT_FULL_SCALE - dead_zone);
+		shape = (t * (100 - curve_percent) + ((t * t) >> 8) * curve_percent) / 100;
+		t = (shape * max_speed << INPUT_FRAC_BITS) >> 8;
+		responseLut[i] = (t > 0xFF) ? 0xFF : t;
+	}
+}
+
+//*****************************************************************************
+// Calibrates and builds the default curve
+//*****************************************************************************
+void input_init(uint8_t max_speed)
+{
+	input_calibrate();
+	input_set_response(INPUT_DEAD_ZONE, INPUT_CURVE_PERCENT, max_speed);
+}
+
+//*****************************************************************************
+// One table lookup per axis, the fraction of a pixel is carried over
+//*****************************************************************************
+static void input_update_axis(input_axis_t *axis, uint16_t reading)
+{
+	int32_t offset = (int32_t)reading - axis->centre;
+	uint32_t index = (offset < 0 ? -offset : offset) >> INPUT_LUT_SHIFT;
+	int32_t velocity;
+	
+	if (index >= INPUT_LUT_SIZE)
+		index = INPUT_LUT_SIZE - 1;
+	velocity = responseLut[index];
+	if ((offset < 0) != axis->invert)
+		velocity = -velocity;
+	
+	if (velocity == 0) {
+		// back at the centre, drop the leftover fraction
+		axis->residual = 0;
+		axis->step = 0;
+		return;
+	}
+	
+	velocity += axis->residual;
+	// arithmetic shift rounds toward minus infinity, the residual is never
+	// negative so it carries correctly in both directions
+	axis->step = velocity >> INPUT_FRAC_BITS;
+	axis->residual = velocity - (axis->step << INPUT_FRAC_BITS);
+}
+
+//*****************************************************************************
+// Reads the joystick
+//*****************************************************************************
+void input_update(void)
+{
+	adc_sample_t sample;
+	
+	ps2_get_sample(&sample);
+	sampleAgeUs = timebase_cycles_to_us(timebase_cycles_since(sample.timestamp));
+	input_update_axis(&axisX, sample.value[PS2_X_AXIS]);
+	input_update_axis(&axisY, sample.value[PS2_Y_AXIS]);
+}
+
+int16_t input_step_x(void)
+{
+	return axisX.step;
+}
+
+int16_t input_step_y(void)
+{
+	return axisY.step;
+}
+
+uint32_t input_sample_age_us(void)
+{
+	return sampleAgeUs;
+}
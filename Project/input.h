@@ -0,0 +1,74 @@
+#ifndef __INPUT_H__
+#define __INPUT_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "ps2.h"
+#include "timebase.h"
+
+//*****************************************************************************
+// Proportional joystick input.  The centre of each axis is measured at boot
+// and every deflection is mapped through a response curve to a velocity in
+// pixels per game tick.  Fractions of a pixel are carried to the next tick 
+// so slow movement stays smooth.
+//*****************************************************************************
+
+// Samples averaged to find the centre of each axis at boot
+#define INPUT_CAL_SAMPLES       32
+
+// A centre further than this from mid scale means the stick was held at 
+// boot, mid scale is used instead
+#define INPUT_CAL_MAX_OFFSET    512
+
+// Deflection of each axis is 0 to INPUT_FULL_SCALE ADC counts
+#define INPUT_FULL_SCALE        2048
+
+// Response curve defaults: deflection ignored around the centre, and the 
+// share of the curve that is quadratic (0 linear, 100 fully quadratic)
+#define INPUT_DEAD_ZONE         200
+#define INPUT_CURVE_PERCENT     50
+
+// The curve is a table of INPUT_LUT_SIZE steps over the deflection range
+#define INPUT_LUT_SHIFT         6
+#define INPUT_LUT_SIZE          (INPUT_FULL_SCALE >> INPUT_LUT_SHIFT)
+
+// Fractional bits of the velocities in the table
+#define INPUT_FRAC_BITS         4
+
+// Set when a higher ADC reading means moving toward a lower screen 
+// coordinate (left or up)
+#define INPUT_X_INVERT          true
+#define INPUT_Y_INVERT          true
+
+//*****************************************************************************
+// Measures the centre of both axes and builds the response curve with the 
+// defaults above.  The stick must be released, this takes 
+// INPUT_CAL_SAMPLES joystick sample periods.
+//*****************************************************************************
+void input_init(uint8_t max_speed);
+
+//*****************************************************************************
+// Rebuilds the response curve.  max_speed is the velocity at full 
+// deflection in pixels per tick.
+//*****************************************************************************
+void input_set_response(uint16_t dead_zone, uint8_t curve_percent, uint8_t max_speed);
+
+//*****************************************************************************
+// Reads the joystick and computes this tick's movement.  Call once per game 
+// tick.
+//*****************************************************************************
+void input_update(void);
+
+//*****************************************************************************
+// Pixels to move along each screen axis this tick, negative is left or up
+//*****************************************************************************
+int16_t input_step_x(void);
+int16_t input_step_y(void);
+
+//*****************************************************************************
+// Microseconds from the ADC interrupt that stored the joystick sample to the
+// input_update() that used it
+//*****************************************************************************
+uint32_t input_sample_age_us(void);
+
+#endif
@@ -1,223 +1,535 @@
-#include "eeprom.h"
-#include "io_expander.h"
-
-int32_t i2c_base = IO_EXPANDER_I2C_BASE;
-
-static i2c_status_t io_expander_wait_for_write () 
-{
-	
-	i2c_status_t status;
-  
-  if( !i2cVerifyBaseAddr(i2c_base) )
-  {
-    return  I2C_INVALID_BASE;
-  }
-
-  // Set the I2C address to be the IO Expander and in Write Mode
-  status = i2cSetSlaveAddr(i2c_base, MCP23017_DEV_ID, I2C_WRITE);
-
-  // Poll while the device is busy.  The  MCP23017_DEV_ID will not ACK
-  // writing an address while the write has not finished.
-  do 
-  {
-    // The data we send does not matter.  This has been set to 0x00, but could
-    // be set to anything
-    status = i2cSendByte( i2c_base, 0x00, I2C_MCS_START | I2C_MCS_RUN | I2C_MCS_STOP);
-    
-    // Wait for the address to finish transmitting
-    while ( I2CMasterBusy(i2c_base)) {};
-    
-    // If the address was not ACKed, try again.
-  } while (I2CMasterAdrAck(i2c_base) == false);
-
-  return  status;
-}
-
-
-bool io_expander_init(void) 
-{
-	
-  if(gpio_enable_port(IO_EXPANDER_GPIO_BASE) == false)
-  {
-    return false;
-  }
-  
-  // Configure SCL 
-  if(gpio_config_digital_enable(IO_EXPANDER_GPIO_BASE, IO_EXPANDER_I2C_SCL_PIN)== false)
-  {
-    return false;
-  }
-    
-  if(gpio_config_alternate_function(IO_EXPANDER_GPIO_BASE, IO_EXPANDER_I2C_SCL_PIN)== false)
-  {
-    return false;
-  }
-    
-  if(gpio_config_port_control(IO_EXPANDER_GPIO_BASE, IO_EXPANDER_I2C_SCL_PCTL_M, IO_EXPANDER_I2C_SCL_PIN_PCTL)== false)
-  {
-    return false;
-  }
-    
-
-  
-  // Configure SDA 
-  if(gpio_config_digital_enable(IO_EXPANDER_GPIO_BASE, IO_EXPANDER_I2C_SDA_PIN)== false)
-  {
-    return false;
-  }
-    
-  if(gpio_config_open_drain(IO_EXPANDER_GPIO_BASE, IO_EXPANDER_I2C_SDA_PIN)== false)
-  {
-    return false;
-  }
-    
-  if(gpio_config_alternate_function(IO_EXPANDER_GPIO_BASE, IO_EXPANDER_I2C_SDA_PIN)== false)
-  {
-    return false;
-  }
-    
-  if(gpio_config_port_control(IO_EXPANDER_GPIO_BASE, IO_EXPANDER_I2C_SDA_PCTL_M, IO_EXPANDER_I2C_SDA_PIN_PCTL)== false)
-  {
-    return false;
-  }
-	
-	
-	// Push buttons input and pull up
-	io_expander_write_reg(MCP23017_IODIRB_R, 0xF); // 1 for input
-	io_expander_write_reg(MCP23017_DEFVALB_R, 0xF); // set default 
-	io_expander_write_reg(MCP23017_GPPUB_R, 0xF); // pull ups
-	io_expander_write_reg(MCP23017_GPINTENB_R, 0xF); // interrupts
-	
-	// Configure LEDS output
-	io_expander_write_reg(MCP23017_IODIRA_R, 0x00); // 0 for Output
-	
-    
-  //  Initialize the I2C peripGPIOheral
-  if( initializeI2CMaster(IO_EXPANDER_I2C_BASE)!= I2C_OK)
-  {
-    return false;
-  }
-  
-  return true;
-	
-}
-
-void io_expander_write_reg(uint8_t reg, uint8_t data) 
-{
-	i2c_status_t status;
-  
-  // Before doing anything, make sure the I2C device is idle
-  while ( I2CMasterBusy(i2c_base)) {};
-
-  //==============================================================
-  // Set the I2C address to be the IO Expander
-  //==============================================================
-	status = i2cSetSlaveAddr(i2c_base, MCP23017_DEV_ID, I2C_WRITE);
-	if ( status != I2C_OK )
-  {
-    // return status;
-  }
-  
-  // If the IO Expander is still writing the last byte written, wait
-  io_expander_wait_for_write();
-  
-  //==============================================================
-  // Send the Upper byte of the address
-  //==============================================================
-	// Also sends control 
-	i2cSendByte(
-     i2c_base,                   // Device OP
-     reg,                        // ADDR
-     I2C_MCS_START | I2C_MCS_RUN // S
-	);	                           // run? (write sent above) 
-	
-	
-  //==============================================================
-  // Send the Lower byte of the address
-  //==============================================================
-  /*
-	i2cSendByte(
-     i2c_base,
-     address & 0xFF,
-     I2C_MCS_RUN
-  );
-	*/
-	
-	
-  //==============================================================
-  // Send the Byte of data to write
-  //==============================================================
-	i2cSendByte(
-     i2c_base,
-     data,
-     I2C_MCS_RUN | I2C_MCS_STOP
-	);
-
-
-  //return status;
-}
-
-
-uint8_t io_expander_read_reg(uint8_t reg) 
-{
-	 i2c_status_t status;
-	 uint8_t data;
-  
-  // Before doing anything, make sure the I2C device is idle
-  while ( I2CMasterBusy(i2c_base)) {};
-
-  // If the IO Expander is still writing the last byte written, wait
-  io_expander_wait_for_write();
-
-  //==============================================================
-  // Set the I2C slave address to be the IO Expander and in Write Mode
-  //==============================================================	
-	status = i2cSetSlaveAddr(i2c_base, MCP23017_DEV_ID, I2C_WRITE);
-	if ( status != I2C_OK )
-  {
-    return status;
-  }
-	
-  //==============================================================
-  // Send the Upper byte of the address
-  //==============================================================
-	i2cSendByte(
-     i2c_base,
-     reg,
-     I2C_MCS_START | I2C_MCS_RUN
-	);	
-	
-	
-  //==============================================================
-  // Send the Lower byte of the address
-  //==============================================================
-	/*
-	i2cSendByte(
-			 i2c_base,
-			 address & 0xFF,
-			 I2C_MCS_RUN
-		);
-	*/
-
-  //==============================================================
-  // Set the I2C slave address to be the IO Expander and in Read Mode
-  //==============================================================
-	status = i2cSetSlaveAddr(i2c_base, MCP23017_DEV_ID, I2C_READ);
-	if ( status != I2C_OK )
-  {
-    return status;
-  }
-
-  //==============================================================
-  // Read the data returned by the IO Expander
-  //==============================================================
-  
-	i2cGetByte( 
-     i2c_base,
-     &data,
-     I2C_MCS_START | I2C_MCS_RUN | I2C_MCS_STOP
-	);
-	
-	
-  return data;
-}
+#include "eeprom.h"
+#include "io_expander.h"
+#include "i2c_bus.h"
+#include "ft6x06.h"
+
+int32_t i2c_base = IO_EXPANDER_I2C_BASE;
+
+#include "timebase.h"
+
+// The MCP23017 has no internal write cycle, it ACKs every byte as soon as it
+// arrives.  The old acknowledge poll before each access has been removed.
+
+// Shadow copies of the output and configuration registers.  A write that
+// would not change a register is skipped.  IOCONA and IOCONB are the same 
+// register, writes to GPIOA/GPIOB land in OLATA/OLATB.
+#define IO_EXPANDER_NUM_REGS    (MCP23017_OLATB_R + 1)
+static uint8_t shadowRegs[IO_EXPANDER_NUM_REGS];
+static uint32_t shadowValid = 0;
+
+static io_expander_stats_t expanderStats;
+
+// Debounce state of every button pin
+typedef enum {
+  BTN_RELEASED,
+  BTN_PRESS_WAIT,       // raw level went low, waiting for it to settle
+  BTN_PRESSED,
+  BTN_RELEASE_WAIT      // raw level went high, waiting for it to settle
+} btn_state_t;
+
+typedef struct {
+  btn_state_t state;
+  uint32_t    edgeTime;     // timebase cycles at the edge that left a stable state
+  uint32_t    lastChange;   // timebase cycles at the latest raw change
+} btn_t;
+
+static volatile btn_t buttons[IO_EXPANDER_NUM_BUTTONS];
+static volatile uint8_t rawButtons = 0;      // 1 for a pressed button
+static volatile uint8_t debouncedButtons = 0;
+
+// Button events, written by io_expander_poll() and read by the game
+static io_expander_event_t events[IO_EXPANDER_EVENT_QUEUE_LEN];
+static uint8_t eventHead = 0;
+static uint8_t eventTail = 0;
+
+static void io_expander_irq_job(void);
+
+//*****************************************************************************
+// Maps a register to its slot in the shadow copy, -1 if it is not cached
+//*****************************************************************************
+static int8_t io_expander_shadow_index(uint8_t reg)
+{
+  switch (reg)
+  {
+    case MCP23017_IOCONB_R:   return MCP23017_IOCONA_R;
+    case MCP23017_INTFA_R:
+    case MCP23017_INTFB_R:
+    case MCP23017_INTCAPA_R:
+    case MCP23017_INTCAPB_R:  return -1;
+    case MCP23017_GPIOA_R:    return MCP23017_OLATA_R;
+    case MCP23017_GPIOB_R:    return MCP23017_OLATB_R;
+    default:
+      return (reg < IO_EXPANDER_NUM_REGS) ? reg : -1;
+  }
+}
+
+bool io_expander_init(void) 
+{
+	
+  if(gpio_enable_port(IO_EXPANDER_GPIO_BASE) == false)
+  {
+    return false;
+  }
+  
+  // Configure SCL 
+  if(gpio_config_digital_enable(IO_EXPANDER_GPIO_BASE, IO_EXPANDER_I2C_SCL_PIN)== false)
+  {
+    return false;
+  }
+    
+  if(gpio_config_alternate_function(IO_EXPANDER_GPIO_BASE, IO_EXPANDER_I2C_SCL_PIN)== false)
+  {
+    return false;
+  }
+    
+  if(gpio_config_port_control(IO_EXPANDER_GPIO_BASE, IO_EXPANDER_I2C_SCL_PCTL_M, IO_EXPANDER_I2C_SCL_PIN_PCTL)== false)
+  {
+    return false;
+  }
+    
+
+  
+  // Configure SDA 
+  if(gpio_config_digital_enable(IO_EXPANDER_GPIO_BASE, IO_EXPANDER_I2C_SDA_PIN)== false)
+  {
+    return false;
+  }
+    
+  if(gpio_config_open_drain(IO_EXPANDER_GPIO_BASE, IO_EXPANDER_I2C_SDA_PIN)== false)
+  {
+    return false;
+  }
+    
+  if(gpio_config_alternate_function(IO_EXPANDER_GPIO_BASE, IO_EXPANDER_I2C_SDA_PIN)== false)
+  {
+    return false;
+  }
+    
+  if(gpio_config_port_control(IO_EXPANDER_GPIO_BASE, IO_EXPANDER_I2C_SDA_PCTL_M, IO_EXPANDER_I2C_SDA_PIN_PCTL)== false)
+  {
+    return false;
+  }
+	
+	
+  //  Initialize the I2C peripGPIOheral
+  if( initializeI2CMaster(IO_EXPANDER_I2C_BASE)!= I2C_OK)
+  {
+    return false;
+  }
+  
+  // Run the bus as fast as the MCP23017 and the other devices on it allow
+  if( i2cRegisterDevice(IO_EXPANDER_I2C_BASE, MCP23017_DEV_ID, MCP23017_MAX_SCL_HZ)!= I2C_OK)
+  {
+    return false;
+  }
+  
+  // Button debounce and event timestamps use the timebase
+  timebase_init();
+  
+	// INTA and INTB both signal changes on either port, so it does not matter
+	// which one is wired to PF0
+	io_expander_write_reg(MCP23017_IOCONA_R, MCP23017_IOCON_MIRROR);
+	
+	// Push buttons input and pull up
+	io_expander_write_reg(MCP23017_IODIRB_R, 0xF); // 1 for input
+	io_expander_write_reg(MCP23017_DEFVALB_R, 0xF); // set default 
+	io_expander_write_reg(MCP23017_GPPUB_R, 0xF); // pull ups
+	io_expander_write_reg(MCP23017_INTCONB_R, 0x0); // interrupt on any change
+	io_expander_write_reg(MCP23017_GPINTENB_R, 0xF); // interrupts
+	
+	// Configure LEDS output
+	io_expander_write_reg(MCP23017_IODIRA_R, 0x00); // 0 for Output
+	
+	// Start from the current button levels, this also clears any pending 
+	// interrupt
+	io_expander_irq_job();
+	debouncedButtons = rawButtons;
+	
+	// INTA/INTB is active low on PF0
+	gpio_enable_port(IO_EXPANDER_IRQ_GPIO_BASE);
+	gpio_config_digital_enable(IO_EXPANDER_IRQ_GPIO_BASE, IO_EXPANDER_IRQ_PIN_NUM);
+	gpio_config_enable_input(IO_EXPANDER_IRQ_GPIO_BASE, IO_EXPANDER_IRQ_PIN_NUM);
+	gpio_config_falling_edge_irq(IO_EXPANDER_IRQ_GPIO_BASE, IO_EXPANDER_IRQ_PIN_NUM);
+	NVIC_SetPriority(IO_EXPANDER_IRQ_NUM, IO_EXPANDER_IRQ_PRIORITY);
+	NVIC_EnableIRQ(IO_EXPANDER_IRQ_NUM);
+  
+  return true;
+	
+}
+
+void io_expander_write_reg(uint8_t reg, uint8_t data) 
+{
+	i2c_status_t status;
+	int8_t shadow = io_expander_shadow_index(reg);
+	
+	// Skip writes that would not change anything
+	if (shadow >= 0 && (shadowValid & (1 << shadow)) && shadowRegs[shadow] == data) {
+		expanderStats.skippedWrites++;
+		return;
+	}
+  
+  // Called from a handler while the bus is held, the write is lost
+  if (!i2c_bus_acquire(I2C_BUS_LED)) {
+    expanderStats.busy++;
+    return;
+  }
+  
+  // Before doing anything, make sure the I2C device is idle
+  while ( I2CMasterBusy(i2c_base)) {};
+
+  //==============================================================
+  // Set the I2C address to be the IO Expander
+  //==============================================================
+	status = i2cSetSlaveAddr(i2c_base, MCP23017_DEV_ID, I2C_WRITE);
+	if ( status != I2C_OK )
+  {
+    // return status;
+  }
+  
+  //==============================================================
+  // Send the Upper byte of the address
+  //==============================================================
+	// Also sends control 
+	i2cSendByte(
+     i2c_base,                   // Device OP
+     reg,                        // ADDR
+     I2C_MCS_START | I2C_MCS_RUN // S
+	);	                           // run? (write sent above) 
+	
+	
+  //==============================================================
+  // Send the Lower byte of the address
+  //==============================================================
+  /*
+	i2cSendByte(
+     i2c_base,
+     address & 0xFF,
+     I2C_MCS_RUN
+  );
+	*/
+	
+	
+  //==============================================================
+  // Send the Byte of data to write
+  //==============================================================
+	status = i2cSendByte(
+     i2c_base,
+     data,
+     I2C_MCS_RUN | I2C_MCS_STOP
+	);
+	
+	i2c_bus_release(I2C_BUS_LED);
+	
+	expanderStats.writes++;
+	if (shadow >= 0) {
+		if (status == I2C_OK) {
+			shadowRegs[shadow] = data;
+			shadowValid |= (1 << shadow);
+		}
+		else {
+			// the register is in an unknown state, write it next time
+			shadowValid &= ~(1 << shadow);
+		}
+	}
+
+  //return status;
+}
+
+
+uint8_t io_expander_read_reg(uint8_t reg) 
+{
+	 i2c_status_t status;
+	 uint8_t data;
+  
+  // Called from a handler while the bus is held
+  if (!i2c_bus_acquire(I2C_BUS_LED)) {
+    expanderStats.busy++;
+    return 0;
+  }
+  
+  // Before doing anything, make sure the I2C device is idle
+  while ( I2CMasterBusy(i2c_base)) {};
+
+  //==============================================================
+  // Set the I2C slave address to be the IO Expander and in Write Mode
+  //==============================================================	
+	status = i2cSetSlaveAddr(i2c_base, MCP23017_DEV_ID, I2C_WRITE);
+	if ( status != I2C_OK )
+  {
+    i2c_bus_release(I2C_BUS_LED);
+    return status;
+  }
+	
+  //==============================================================
+  // Send the Upper byte of the address
+  //==============================================================
+	i2cSendByte(
+     i2c_base,
+     reg,
+     I2C_MCS_START | I2C_MCS_RUN
+	);	
+	
+	
+  //==============================================================
+  // Send the Lower byte of the address
+  //==============================================================
+	/*
+	i2cSendByte(
+			 i2c_base,
+			 address & 0xFF,
+			 I2C_MCS_RUN
+		);
+	*/
+
+  //==============================================================
+  // Set the I2C slave address to be the IO Expander and in Read Mode
+  //==============================================================
+	status = i2cSetSlaveAddr(i2c_base, MCP23017_DEV_ID, I2C_READ);
+	if ( status != I2C_OK )
+  {
+    i2c_bus_release(I2C_BUS_LED);
+    return status;
+  }
+
+  //==============================================================
+  // Read the data returned by the IO Expander
+  //==============================================================
+  
+	i2cGetByte( 
+     i2c_base,
+     &data,
+     I2C_MCS_START | I2C_MCS_RUN | I2C_MCS_STOP
+	);
+	
+	i2c_bus_release(I2C_BUS_LED);
+	
+  return data;
+}
+
+
+//*****************************************************************************
+// Reads consecutive registers in one transaction.  Relies on IOCON.SEQOP 
+// being 0 so the register address increments after every byte.
+//*****************************************************************************
+static i2c_status_t io_expander_read_regs(uint8_t reg, uint8_t *data, uint8_t num_regs)
+{
+	i2c_status_t status;
+	uint8_t mcs;
+	uint8_t i;
+	
+	if (!i2c_bus_acquire(I2C_BUS_LED)) {
+		expanderStats.busy++;
+		return I2C_BUS_BUSY;
+	}
+	
+	while ( I2CMasterBusy(i2c_base)) {};
+	
+	status = i2cSetSlaveAddr(i2c_base, MCP23017_DEV_ID, I2C_WRITE);
+	if ( status == I2C_OK )
+		status = i2cSendByte( i2c_base, reg, I2C_MCS_START | I2C_MCS_RUN);
+	if ( status == I2C_OK )
+		status = i2cSetSlaveAddr(i2c_base, MCP23017_DEV_ID, I2C_READ);
+	
+	// ACK every byte but the last one
+	for (i = 0; i < num_regs && status == I2C_OK; i++) {
+		mcs = I2C_MCS_RUN;
+		if (i == 0)
+			mcs |= I2C_MCS_START;
+		if (i == num_regs - 1)
+			mcs |= I2C_MCS_STOP;
+		else
+			mcs |= I2C_MCS_ACK;
+		status = i2cGetByte( i2c_base, &data[i], mcs);
+	}
+	
+	i2c_bus_release(I2C_BUS_LED);
+	
+	return status;
+}
+
+//*****************************************************************************
+// Moves a button through its debounce states after a raw level change
+//*****************************************************************************
+static void io_expander_button_edge(uint8_t pin, bool pressed, uint32_t now)
+{
+	volatile btn_t *btn = &buttons[pin];
+	
+	btn->lastChange = now;
+	switch (btn->state) {
+		case BTN_RELEASED:
+			if (pressed) {
+				btn->state = BTN_PRESS_WAIT;
+				btn->edgeTime = now;
+			}
+			break;
+		case BTN_PRESS_WAIT:
+			if (!pressed)
+				btn->state = BTN_RELEASED;  // bounce
+			break;
+		case BTN_PRESSED:
+			if (!pressed) {
+				btn->state = BTN_RELEASE_WAIT;
+				btn->edgeTime = now;
+			}
+			break;
+		case BTN_RELEASE_WAIT:
+			if (pressed)
+				btn->state = BTN_PRESSED;   // bounce
+			break;
+	}
+}
+
+//*****************************************************************************
+// Reads INTFB, INTCAPA, INTCAPB, GPIOA and GPIOB in one burst.  INTCAPB holds
+// the levels when the interrupt fired and GPIOB the levels now.  If they 
+// differ the button bounced in between and both edges are fed to the 
+// debounce state machine.  Reading INTCAPB clears the interrupt.
+//*****************************************************************************
+static void io_expander_irq_job(void)
+{
+	uint8_t regs[MCP23017_GPIOB_R - MCP23017_INTFB_R + 1];
+	uint8_t captured;
+	uint8_t current;
+	uint8_t changed;
+	uint32_t now;
+	uint32_t primask;
+	uint8_t pin;
+	
+	if (io_expander_read_regs(MCP23017_INTFB_R, regs, sizeof(regs)) != I2C_OK)
+		return;
+	
+	now = timebase_cycles();
+	expanderStats.interrupts++;
+	
+	// buttons are active low
+	captured = ~regs[MCP23017_INTCAPB_R - MCP23017_INTFB_R] & IO_EXPANDER_BUTTON_MASK;
+	current = ~regs[MCP23017_GPIOB_R - MCP23017_INTFB_R] & IO_EXPANDER_BUTTON_MASK;
+	
+	primask = __get_PRIMASK();
+	__disable_irq();
+	for (pin = 0; pin < IO_EXPANDER_NUM_BUTTONS; pin++) {
+		changed = (rawButtons ^ captured) | (captured ^ current);
+		if (changed & (1 << pin)) {
+			if ((rawButtons ^ captured) & (1 << pin))
+				io_expander_button_edge(pin, captured & (1 << pin), now);
+			if ((captured ^ current) & (1 << pin))
+				io_expander_button_edge(pin, current & (1 << pin), now);
+		}
+	}
+	rawButtons = current;
+	__set_PRIMASK(primask);
+}
+
+//*****************************************************************************
+// Called by io_expander_gpiof_service() when PF0 (the MCP23017 interrupt)
+// fires.  The registers are read right away if the I2C bus is free, 
+// otherwise once the main loop releases it.
+//*****************************************************************************
+void io_expander_irq_service(void)
+{
+	i2c_bus_post(I2C_BUS_LED, io_expander_irq_job);
+}
+
+//*****************************************************************************
+// Port F carries the MCP23017 interrupt on PF0 and the FT6x06 interrupt on
+// PF4.  Neither device is read here, both post their reads to the I2C bus.
+// GPIOF_Handler in project_interrupts.c calls this.
+//*****************************************************************************
+void io_expander_gpiof_service(void)
+{
+	uint32_t status = GPIOF->MIS;
+	
+	GPIOF->ICR = status;
+	if (status & IO_EXPANDER_IRQ_PIN_NUM)
+		io_expander_irq_service();
+	if (status & FT6X06_IRQ_PIN_NUM)
+		ft6x06_irq_service();
+}
+
+//*****************************************************************************
+// Adds an event to the queue, dropping it if the queue is full
+//*****************************************************************************
+static void io_expander_publish(uint8_t pin, bool pressed, uint32_t timestamp)
+{
+	uint8_t next = (eventHead + 1) % IO_EXPANDER_EVENT_QUEUE_LEN;
+	
+	if (next == eventTail) {
+		expanderStats.droppedEvents++;
+		return;
+	}
+	
+	events[eventHead].timestamp = timestamp;
+	events[eventHead].pin = pin;
+	events[eventHead].pressed = pressed;
+	eventHead = next;
+}
+
+//*****************************************************************************
+// Confirms button changes that have been stable for the debounce time and
+// publishes them as events.  Call from the main loop.  Does not use the 
+// I2C bus.
+//*****************************************************************************
+void io_expander_poll(void)
+{
+	uint32_t debounceCycles = (uint32_t)timebase_from_us(IO_EXPANDER_DEBOUNCE_MS * 1000);
+	uint32_t now = timebase_cycles();
+	uint32_t primask;
+	uint32_t edgeTime = 0;
+	bool pressed = false;
+	bool settled;
+	uint8_t pin;
+	
+	for (pin = 0; pin < IO_EXPANDER_NUM_BUTTONS; pin++) {
+		settled = false;
+		
+		primask = __get_PRIMASK();
+		__disable_irq();
+		if ((buttons[pin].state == BTN_PRESS_WAIT || buttons[pin].state == BTN_RELEASE_WAIT) &&
+				now - buttons[pin].lastChange >= debounceCycles) {
+			pressed = buttons[pin].state == BTN_PRESS_WAIT;
+			buttons[pin].state = pressed ? BTN_PRESSED : BTN_RELEASED;
+			edgeTime = buttons[pin].edgeTime;
+			settled = true;
+		}
+		__set_PRIMASK(primask);
+		
+		if (settled) {
+			if (pressed)
+				debouncedButtons |= (1 << pin);
+			else
+				debouncedButtons &= ~(1 << pin);
+			io_expander_publish(pin, pressed, edgeTime);
+		}
+	}
+}
+
+//*****************************************************************************
+// Returns the debounced button levels, bit n is set while button pin n is
+// pressed
+//*****************************************************************************
+uint8_t io_expander_buttons(void)
+{
+	return debouncedButtons;
+}
+
+//*****************************************************************************
+// Takes the oldest button event off the queue.  Returns false if the queue
+// is empty.
+//*****************************************************************************
+bool io_expander_get_event(io_expander_event_t *event)
+{
+	if (event == NULL || eventTail == eventHead)
+		return false;
+	
+	*event = events[eventTail];
+	eventTail = (eventTail + 1) % IO_EXPANDER_EVENT_QUEUE_LEN;
+	return true;
+}
+
+//*****************************************************************************
+// Returns the write and interrupt counters
+//*****************************************************************************
+void io_expander_get_stats(io_expander_stats_t *stats)
+{
+	*stats = expanderStats;
+}
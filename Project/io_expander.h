@@ -1,86 +1,145 @@
-// Copyright (c) 2014-16, Joe Krachey
-// All rights reserved.
-//
-// Redistribution and use in binary form, with or without modification, 
-// are permitted provided that the following conditions are met:
-//
-// 1. Redistributions in binary form must reproduce the above copyright 
-//    notice, this list of conditions and the following disclaimer in 
-//    the documentation and/or other materials provided with the distribution.
-//
-// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" 
-// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
-// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR 
-// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR 
-// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, 
-// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, 
-// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; 
-// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
-// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING 
-// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, 
-// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
-
-#ifndef __IO_EXPANDER_H__
-#define __IO_EXPANDER_H__
-
-
-#include <stdint.h>
-#include <string.h>
-#include <stdbool.h>
-#include "gpio_port.h"
-#include "i2c.h"
-
-//*****************************************************************************
-// Fill out the #defines below to configure which pins are connected to
-// the I2C Bus
-//*****************************************************************************
-#define   IO_EXPANDER_GPIO_BASE           GPIOA_BASE
-#define   IO_EXPANDER_I2C_BASE            I2C1_BASE
-#define   IO_EXPANDER_I2C_SCL_PIN         PA6
-#define   IO_EXPANDER_I2C_SDA_PIN         PA7
-#define 	IO_EXPANDER_I2C_SCL_PCTL_M		  GPIO_PCTL_PA6_M
-#define   IO_EXPANDER_I2C_SCL_PIN_PCTL    GPIO_PCTL_PA6_I2C1SCL
-#define 	IO_EXPANDER_I2C_SDA_PCTL_M		  GPIO_PCTL_PA7_M
-#define   IO_EXPANDER_I2C_SDA_PIN_PCTL    GPIO_PCTL_PA7_I2C1SDA
-
-#define   IO_EXPANDER_IRQ_GPIO_BASE       GPIOF_BASE
-#define   IO_EXPANDER_IRQ_PIN_NUM         PF0
-
-#define   DIR_BTN_UP_PIN                  0
-#define   DIR_BTN_DOWN_PIN                1
-#define   DIR_BTN_LEFT_PIN                2
-#define   DIR_BTN_RIGHT_PIN               3
-
-// Define the 7-bit Address of the MCP23017. 
-#define MCP23017_DEV_ID    		0x27
-
-#define MCP23017_IODIRA_R 	  0x00 
-#define MCP23017_IODIRB_R	    0x01 
-#define MCP23017_IPOLA_R 	    0x02 
-#define MCP23017_IPOLB_R	    0x03 
-#define MCP23017_GPINTENA_R   0x04 
-#define MCP23017_GPINTENB_R   0x05
-#define MCP23017_DEFVALA_R 	  0x06
-#define MCP23017_DEFVALB_R 	  0x07
-#define MCP23017_INTCONA_R 	  0x08
-#define MCP23017_INTCONB_R 	  0x09
-#define MCP23017_IOCONA_R	    0x0A
-#define MCP23017_IOCONB_R 	  0x0B
-#define MCP23017_GPPUA_R 	    0x0C
-#define MCP23017_GPPUB_R 	    0x0D
-#define MCP23017_INTFA_R 	    0x0E 
-#define MCP23017_INTFB_R 	    0x0F
-#define MCP23017_INTCAPA_R 	  0x10 
-#define MCP23017_INTCAPB_R 	  0x11 
-#define MCP23017_GPIOA_R 	    0x12 
-#define MCP23017_GPIOB_R 	    0x13 
-#define MCP23017_OLATA_R 	    0x14 
-#define MCP23017_OLATB_R	    0x15 
-
-
-
-
-bool io_expander_init(void);
-void io_expander_write_reg(uint8_t reg, uint8_t data);
-uint8_t io_expander_read_reg(uint8_t);
-#endif
+// Copyright (c) 2014-16, Joe Krachey
+// All rights reserved.
+//
+// Redistribution and use in binary form, with or without modification, 
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions in binary form must reproduce the above copyright 
+//    notice, this list of conditions and the following disclaimer in 
+//    the documentation and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" 
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR 
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR 
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, 
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, 
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; 
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING 
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, 
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef __IO_EXPANDER_H__
+#define __IO_EXPANDER_H__
+
+
+#include <stdint.h>
+#include <string.h>
+#include <stdbool.h>
+#include "gpio_port.h"
+#include "i2c.h"
+
+//*****************************************************************************
+// Fill out the #defines below to configure which pins are connected to
+// the I2C Bus
+//*****************************************************************************
+#define   IO_EXPANDER_GPIO_BASE           GPIOA_BASE
+#define   IO_EXPANDER_I2C_BASE            I2C1_BASE
+#define   IO_EXPANDER_I2C_SCL_PIN         PA6
+#define   IO_EXPANDER_I2C_SDA_PIN         PA7
+#define 	IO_EXPANDER_I2C_SCL_PCTL_M		  GPIO_PCTL_PA6_M
+#define   IO_EXPANDER_I2C_SCL_PIN_PCTL    GPIO_PCTL_PA6_I2C1SCL
+#define 	IO_EXPANDER_I2C_SDA_PCTL_M		  GPIO_PCTL_PA7_M
+#define   IO_EXPANDER_I2C_SDA_PIN_PCTL    GPIO_PCTL_PA7_I2C1SDA
+
+#define   IO_EXPANDER_IRQ_GPIO_BASE       GPIOF_BASE
+#define   IO_EXPANDER_IRQ_PIN_NUM         PF0
+#define   IO_EXPANDER_IRQ_NUM             GPIOF_IRQn
+#define   IO_EXPANDER_IRQ_PRIORITY        3
+
+#define   DIR_BTN_UP_PIN                  0
+#define   DIR_BTN_DOWN_PIN                1
+#define   DIR_BTN_LEFT_PIN                2
+#define   DIR_BTN_RIGHT_PIN               3
+
+// Define the 7-bit Address of the MCP23017. 
+#define MCP23017_DEV_ID    		0x27
+// fastest SCL rate of the MCP23017 (high-speed mode)
+#define MCP23017_MAX_SCL_HZ    1700000
+
+#define MCP23017_IODIRA_R 	  0x00 
+#define MCP23017_IODIRB_R	    0x01 
+#define MCP23017_IPOLA_R 	    0x02 
+#define MCP23017_IPOLB_R	    0x03 
+#define MCP23017_GPINTENA_R   0x04 
+#define MCP23017_GPINTENB_R   0x05
+#define MCP23017_DEFVALA_R 	  0x06
+#define MCP23017_DEFVALB_R 	  0x07
+#define MCP23017_INTCONA_R 	  0x08
+#define MCP23017_INTCONB_R 	  0x09
+#define MCP23017_IOCONA_R	    0x0A
+#define MCP23017_IOCONB_R 	  0x0B
+#define MCP23017_GPPUA_R 	    0x0C
+#define MCP23017_GPPUB_R 	    0x0D
+#define MCP23017_INTFA_R 	    0x0E 
+#define MCP23017_INTFB_R 	    0x0F
+#define MCP23017_INTCAPA_R 	  0x10 
+#define MCP23017_INTCAPB_R 	  0x11 
+#define MCP23017_GPIOA_R 	    0x12 
+#define MCP23017_GPIOB_R 	    0x13 
+#define MCP23017_OLATA_R 	    0x14 
+#define MCP23017_OLATB_R	    0x15 
+
+// IOCON bits
+#define MCP23017_IOCON_MIRROR   0x40  // INTA and INTB are ORed together
+#define MCP23017_IOCON_SEQOP    0x20  // 1 disables address auto increment
+
+// Direction buttons on GPIOB
+#define IO_EXPANDER_NUM_BUTTONS       4
+#define IO_EXPANDER_BUTTON_MASK       0x0F
+
+// A button change is accepted once the level has been stable this long
+#define IO_EXPANDER_DEBOUNCE_MS       10
+
+#define IO_EXPANDER_EVENT_QUEUE_LEN   16
+
+typedef struct {
+	uint32_t timestamp;   // timebase_cycles() when the button started to change
+	uint8_t pin;          // DIR_BTN_xxx_PIN
+	bool pressed;
+} io_expander_event_t;
+
+typedef struct {
+	uint32_t writes;          // register writes sent to the MCP23017
+	uint32_t skippedWrites;   // writes that matched the shadow copy
+	uint32_t interrupts;      // interrupt bursts read
+	uint32_t droppedEvents;   // events lost to a full queue
+	uint32_t busy;            // accesses from a handler that found the bus held
+} io_expander_stats_t;
+
+
+
+
+bool io_expander_init(void);
+
+// These hold the shared I2C bus.  In the main loop they wait for it.  From
+// an interrupt handler that finds the bus held the write is skipped and the
+// read returns 0, both are counted as busy.  Handlers should hand their I2C
+// work to i2c_bus_post() instead, see io_expander_irq_service().
+// Writes to output and configuration registers that would not change the
+// register are skipped.
+void io_expander_write_reg(uint8_t reg, uint8_t data);
+uint8_t io_expander_read_reg(uint8_t);
+
+// Called when PF0 fires instead of reading the expander there.  The 
+// interrupt registers are read in one burst as soon as the I2C bus is free.
+void io_expander_irq_service(void);
+
+// The port F interrupt service, GPIOF_Handler in project_interrupts.c 
+// calls it.  Clears the interrupts and passes PF0 to 
+// io_expander_irq_service() and PF4 to ft6x06_irq_service().
+void io_expander_gpiof_service(void);
+
+// Call from the main loop.  Accepts button changes that have settled and 
+// queues them as events.
+void io_expander_poll(void);
+
+// Debounced button levels, bit n is set while the button on pin n is pressed
+uint8_t io_expander_buttons(void);
+
+// Takes the oldest button event off the queue, false if there is none
+bool io_expander_get_event(io_expander_event_t *event);
+
+void io_expander_get_stats(io_expander_stats_t *stats);
+#endif
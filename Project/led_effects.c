@@ -0,0 +1,283 @@
+#include "led_effects.h"
+
+typedef struct {
+	uint8_t red;
+	uint8_t green;
+	uint8_t blue;
+} led_color_t;
+
+// LED level for a perceptual level, 2.6 power curve
+static const uint8_t ledGamma[256] = {
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   1,   1,   1,   1,   1,   1,   1,   1,
+	  1,   1,   1,   1,   2,   2,   2,   2,   2,   2,   2,   2,   3,   3,   3,   3,
+	  3,   3,   4,   4,   4,   4,   5,   5,   5,   5,   5,   6,   6,   6,   6,   7,
+	  7,   7,   8,   8,   8,   9,   9,   9,  10,  10,  10,  11,  11,  11,  12,  12,
+	 13,  13,  13,  14,  14,  15,  15,  16,  16,  17,  17,  18,  18,  19,  19,  20,
+	 20,  21,  21,  22,  22,  23,  24,  24,  25,  25,  26,  27,  27,  28,  29,  29,
+	 30,  31,  31,  32,  33,  34,  34,  35,  36,  37,  38,  38,  39,  40,  41,  42,
+	 42,  43,  44,  45,  46,  47,  48,  49,  50,  51,  52,  53,  54,  55,  56,  57,
+	 58,  59,  60,  61,  62,  63,  64,  65,  66,  68,  69,  70,  71,  72,  73,  75,
+	 76,  77,  78,  80,  81,  82,  84,  85,  86,  88,  89,  90,  92,  93,  94,  96,
+	 97,  99, 100, 102, 103, 105, 106, 108, 109, 111, 112, 114, 115, 117, 119, 120,
+	122, 124, 125, 127, 129, 130, 132, 134, 136, 137, 139, 141, 143, 145, 146, 148,
+	150, 152, 154, 156, 158, 160, 162, 164, 166, 168, 170, 172, 174, 176, 178, 180,
+	182, 184, 186, 188, 191, 193, 195, 197, 199, 202, 204, 206, 209, 211, 213, 215,
+	218, 220, 223, 225, 227, 230, 232, 235, 237, 240, 242, 245, 247, 250, 252, 255,
+};
+
+// One period of a raised cosine, for smooth pulsing
+static const uint8_t ledWave[64] = {
+	  0,   1,   2,   5,  10,  15,  21,  29,  37,  47,  57,  67,  79,  90, 103, 115,
+	127, 140, 152, 165, 176, 188, 198, 208, 218, 226, 234, 240, 245, 250, 253, 254,
+	255, 254, 253, 250, 245, 240, 234, 226, 218, 208, 198, 188, 176, 165, 152, 140,
+	128, 115, 103,  90,  79,  67,  57,  47,  37,  29,  21,  15,  10,   5,   2,   1,
+};
+
+// Colors of the players on the LCD
+static const led_color_t ledPlayerColors[2] = {
+	{ 0,   255, 255 },   // cyan
+	{ 255, 0,   255 },   // magenta
+};
+
+static const led_color_t ledWhite = { 255, 255, 255 };
+
+// Hues run 0 to 1535, red, yellow, green, cyan, blue, magenta, each 256
+#define LED_HUE_GREEN       512
+#define LED_HUE_RANGE       1536
+
+// The meter is drawn at this alpha so the score flash stands out
+#define LED_METER_ALPHA     192
+
+static uint8_t ledBrightness;
+
+static bool flashOn;
+static uint32_t flashStart;
+static uint8_t flashPlayer;
+
+// Rally meter levels in 1/256 of an LED
+static uint16_t meterTarget;
+static uint16_t meterLevel;
+static uint32_t meterTime;
+
+static uint16_t strobePeriod;
+static uint32_t strobeStart;
+
+static bool winOn;
+static uint32_t winStart;
+static uint8_t winPlayer;
+
+//*****************************************************************************
+// Blends src over dst, alpha 0 to 256
+//*****************************************************************************
+static void led_blend(led_color_t *dst, const led_color_t *src, uint16_t alpha)
+{
+	uint16_t keep = 256 - alpha;
+
+	dst->red = (dst->red * keep + src->red * alpha) >> 8;
+	dst->green = (dst->green * keep + src->green * alpha) >> 8;
+	dst->blue = (dst->blue * keep + src->blue * alpha) >> 8;
+}
+
+//*****************************************************************************
+// Fully saturated color of a hue
+//*****************************************************************************
+static void led_hue(led_color_t *color, uint16_t hue)
+{
+	uint8_t rise = hue & 0xFF;
+	uint8_t fall = 255 - rise;
+
+	switch (hue >> 8) {
+		case 0:  color->red = 255;  color->green = rise; color->blue = 0;    break;
+		case 1:  color->red = fall; color->green = 255;  color->blue = 0;    break;
+		case 2:  color->red = 0;    color->green = 255;  color->blue = rise; break;
+		case 3:  color->red = 0;    color->green = fall; color->blue = 255;  break;
+		case 4:  color->red = rise; color->green = 0;    color->blue = 255;  break;
+		default: color->red = 255;  color->green = 0;    color->blue = fall; break;
+	}
+}
+
+//*****************************************************************************
+// Moves the meter towards its target, one LED every LED_EFFECTS_METER_MS
+//*****************************************************************************
+static void led_meter_move(uint32_t now_ms)
+{
+	uint32_t step = (now_ms - meterTime) * 256 / LED_EFFECTS_METER_MS;
+
+	meterTime = now_ms;
+	if (meterLevel < meterTarget)
+		meterLevel = ((uint32_t)(meterTarget - meterLevel) > step) ? meterLevel + step : meterTarget;
+	else
+		meterLevel = ((uint32_t)(meterLevel - meterTarget) > step) ? meterLevel - step : meterTarget;
+}
+
+//*****************************************************************************
+// Rally meter, green at the start of the strip to red at the end.  A full
+// meter pulses.
+//*****************************************************************************
+static void led_layer_meter(led_color_t *frame, uint32_t now_ms)
+{
+	uint16_t pulse = 256;
+	led_color_t color;
+	int32_t cover;
+	uint8_t i;
+
+	if (meterLevel == LED_EFFECTS_LEDS * 256)
+		pulse = 128 + (ledWave[(now_ms >> 3) & 63] >> 1);
+
+	for (i = 0; i < LED_EFFECTS_LEDS; i++) {
+		cover = (int32_t)meterLevel - i * 256;
+		if (cover <= 0)
+			break;
+		if (cover > 256)
+			cover = 256;
+		led_hue(&color, LED_HUE_GREEN - i * LED_HUE_GREEN / (LED_EFFECTS_LEDS - 1));
+		led_blend(&frame[i], &color, (cover * LED_METER_ALPHA * pulse) >> 16);
+	}
+}
+
+//*****************************************************************************
+// White flash at the start of every strobe period, fading over the flash
+//*****************************************************************************
+static void led_layer_strobe(led_color_t *frame, uint32_t now_ms)
+{
+	uint32_t phase = (now_ms - strobeStart) % strobePeriod;
+	uint16_t alpha;
+	uint8_t i;
+
+	if (phase >= LED_EFFECTS_STROBE_MS)
+		return;
+	alpha = 256 - phase * 256 / LED_EFFECTS_STROBE_MS;
+	for (i = 0; i < LED_EFFECTS_LEDS; i++)
+		led_blend(&frame[i], &ledWhite, alpha);
+}
+
+//*****************************************************************************
+// The scorer's color over the whole strip, fading out
+//*****************************************************************************
+static void led_layer_flash(led_color_t *frame, uint32_t now_ms)
+{
+	uint32_t elapsed = now_ms - flashStart;
+	uint16_t alpha;
+	uint8_t i;
+
+	if (elapsed >= LED_EFFECTS_FLASH_MS) {
+		flashOn = false;
+		return;
+	}
+	alpha = (LED_EFFECTS_FLASH_MS - elapsed) * 256 / LED_EFFECTS_FLASH_MS;
+	for (i = 0; i < LED_EFFECTS_LEDS; i++)
+		led_blend(&frame[i], &ledPlayerColors[flashPlayer], alpha);
+}
+
+//*****************************************************************************
+// Rainbow around the strip, turning towards the winner's side
+//*****************************************************************************
+static void led_layer_rainbow(led_color_t *frame, uint32_t now_ms)
+{
+	uint16_t turn = (now_ms - winStart) % LED_EFFECTS_RAINBOW_MS * LED_HUE_RANGE / LED_EFFECTS_RAINBOW_MS;
+	uint8_t i;
+
+	if (winPlayer == 1)
+		turn = LED_HUE_RANGE - 1 - turn;
+	for (i = 0; i < LED_EFFECTS_LEDS; i++)
+		led_hue(&frame[i], (turn + i * LED_HUE_RANGE / LED_EFFECTS_LEDS) % LED_HUE_RANGE);
+}
+
+//*****************************************************************************
+// Turns every effect off.
+//*****************************************************************************
+void led_effects_init(uint8_t brightness)
+{
+	ledBrightness = brightness;
+	led_effects_clear();
+}
+
+//*****************************************************************************
+// Scales every color, 255 is full brightness.
+//*****************************************************************************
+void led_effects_set_brightness(uint8_t brightness)
+{
+	ledBrightness = brightness;
+}
+
+//*****************************************************************************
+// A point for player 0 or 1, flashes the strip in the player's color.
+//*****************************************************************************
+void led_effects_point(uint8_t player, uint32_t now_ms)
+{
+	flashOn = true;
+	flashStart = now_ms;
+	flashPlayer = player ? 1 : 0;
+}
+
+//*****************************************************************************
+// Length of the current rally, the meter follows it.  0 empties the meter.
+//*****************************************************************************
+void led_effects_rally(uint16_t hits)
+{
+	if (hits > LED_EFFECTS_RALLY_FULL)
+		hits = LED_EFFECTS_RALLY_FULL;
+	meterTarget = hits * LED_EFFECTS_LEDS * 256 / LED_EFFECTS_RALLY_FULL;
+}
+
+//*****************************************************************************
+// Starts a white flash every period_ms from now, 0 stops it.
+//*****************************************************************************
+void led_effects_strobe(uint16_t period_ms, uint32_t now_ms)
+{
+	strobePeriod = period_ms;
+	strobeStart = now_ms;
+}
+
+//*****************************************************************************
+// Player 0 or 1 has won, starts the rainbow.
+//*****************************************************************************
+void led_effects_win(uint8_t player, uint32_t now_ms)
+{
+	winOn = true;
+	winStart = now_ms;
+	winPlayer = player ? 1 : 0;
+}
+
+//*****************************************************************************
+// Stops every effect, the strip goes dark.
+//*****************************************************************************
+void led_effects_clear(void)
+{
+	flashOn = false;
+	meterTarget = 0;
+	meterLevel = 0;
+	strobePeriod = 0;
+	winOn = false;
+}
+
+//*****************************************************************************
+// Works out the strip for now_ms into grb.  Every layer is a fixed number
+// of blends per LED, so a frame costs at most all four layers showing.
+//*****************************************************************************
+void led_effects_compose(uint32_t now_ms, uint8_t *grb)
+{
+	led_color_t frame[LED_EFFECTS_LEDS];
+	uint16_t scale = ledBrightness + 1;
+	uint8_t i;
+
+	memset(frame, 0, sizeof(frame));
+
+	led_meter_move(now_ms);
+	if (meterLevel > 0)
+		led_layer_meter(frame, now_ms);
+	if (strobePeriod > 0)
+		led_layer_strobe(frame, now_ms);
+	if (flashOn)
+		led_layer_flash(frame, now_ms);
+	if (winOn)
+		led_layer_rainbow(frame, now_ms);
+
+	// brightness on the perceptual scale, then to LED levels
+	for (i = 0; i < LED_EFFECTS_LEDS; i++) {
+		*grb++ = ledGamma[(frame[i].green * scale) >> 8];
+		*grb++ = ledGamma[(frame[i].red * scale) >> 8];
+		*grb++ = ledGamma[(frame[i].blue * scale) >> 8];
+	}
+}
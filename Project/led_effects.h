@@ -0,0 +1,84 @@
+#ifndef __LED_EFFECTS_H__
+#define __LED_EFFECTS_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+//*****************************************************************************
+// Effects on the WS2812B strip, driven by game events.  Each effect is a
+// layer with its own start time, led_effects_compose() works out every
+// layer for the current time and blends them bottom to top:
+//
+//    rally meter     lights up along the strip as the rally gets longer
+//    strobe          white flash every period, for heisenberg pong
+//    score flash     the scorer's color, fading out
+//    win rainbow     rotating rainbow over everything until cleared
+//
+// Colors are 8 bit per channel on a perceptual scale and blended in fixed
+// point, alpha 256 is opaque.  The result is scaled by the brightness and
+// put through a gamma table for the LEDs.  Every layer is a fixed number
+// of blends per LED, so a frame never costs more than all four showing,
+// the case tools/led_effects_bench.c measures.
+//
+// Nothing here touches hardware, the same file builds on the PC for
+// tools/led_effects_bench.c.
+//*****************************************************************************
+
+#define LED_EFFECTS_LEDS          8
+
+// Bytes of led_effects_compose() output, green, red, blue per LED
+#define LED_EFFECTS_BYTES         (LED_EFFECTS_LEDS * 3)
+
+// Time between frames, the strip takes 0.6ms to send and 0.3ms to latch
+#define LED_EFFECTS_FRAME_MS      20
+
+#define LED_EFFECTS_FLASH_MS      600   // score flash fades out over this
+#define LED_EFFECTS_STROBE_MS     40    // strobe flash length
+#define LED_EFFECTS_RAINBOW_MS    1536  // one turn of the win rainbow
+#define LED_EFFECTS_RALLY_FULL    16    // hits that fill the rally meter
+#define LED_EFFECTS_METER_MS      60    // meter moves one LED in this time
+
+//*****************************************************************************
+// Turns every effect off.
+//*****************************************************************************
+void led_effects_init(uint8_t brightness);
+
+//*****************************************************************************
+// Scales every color, 255 is full brightness.
+//*****************************************************************************
+void led_effects_set_brightness(uint8_t brightness);
+
+//*****************************************************************************
+// A point for player 0 or 1, flashes the strip in the player's color.
+//*****************************************************************************
+void led_effects_point(uint8_t player, uint32_t now_ms);
+
+//*****************************************************************************
+// Length of the current rally, the meter follows it.  0 empties the meter.
+//*****************************************************************************
+void led_effects_rally(uint16_t hits);
+
+//*****************************************************************************
+// Starts a white flash every period_ms from now, 0 stops it.
+//*****************************************************************************
+void led_effects_strobe(uint16_t period_ms, uint32_t now_ms);
+
+//*****************************************************************************
+// Player 0 or 1 has won, starts the rainbow.
+//*****************************************************************************
+void led_effects_win(uint8_t player, uint32_t now_ms);
+
+//*****************************************************************************
+// Stops every effect, the strip goes dark.
+//*****************************************************************************
+void led_effects_clear(void);
+
+//*****************************************************************************
+// Works out the strip for now_ms into grb, LED_EFFECTS_BYTES bytes in the
+// order of WS2812B_t.  Call every LED_EFFECTS_FRAME_MS, the rally meter
+// moves with the time between calls.
+//*****************************************************************************
+void led_effects_compose(uint32_t now_ms, uint8_t *grb);
+
+#endif
@@ -0,0 +1,26 @@
+#ifndef __LOG_MESSAGES_H__
+#define __LOG_MESSAGES_H__
+
+//*****************************************************************************
+// Every message the game can log.  Only the IDs are compiled into the
+// firmware, the format strings are used by tools/log_decode.c to rebuild
+// the text on the host.  Arguments are 32 bit words, formats may use %d, %i,
+// %u, %x, %X and %c with flags and a width.
+//
+// Add new messages at the end, the ID is the position in the list and logs
+// captured with an older build would otherwise decode as the wrong text.
+// Keep this file free of anything but the list, the host tool includes it.
+//*****************************************************************************
+#define LOG_MESSAGES(X) \
+	X(LOG_DROPPED,            "%u log records dropped") \
+	X(LOG_BOOT,               "boot, gamemode %u seed %u") \
+	X(LOG_MATCH_START,        "match start, gamemode %u") \
+	X(LOG_MATCH_END,          "match end, winner %u score %u-%u after %u ticks") \
+	X(LOG_SETTINGS_SAVED,     "settings saved, caller held %u cycles") \
+	X(LOG_NETPLAY_START,      "network match as player %u, radio %u") \
+	X(LOG_NETPLAY_END,        "network match stopped, status %u at tick %u") \
+	X(LOG_NETPLAY_STATS,      "netplay rollbacks %u resimulated %u max %u stalls %u") \
+	X(LOG_LED_STATS,          "LED frames %u, compose avg %u max %u cycles") \
+	X(LOG_TICK_STATS,         "ticks late %u, max interval %uus work %uus input age %uus")
+
+#endif
@@ -1,2413 +1,2849 @@
-// Copyright (c) 2015-19, Joe Krachey
-// All rights reserved.
-//
-// Redistribution and use in source or binary form, with or without modification, 
-// are permitted provided that the following conditions are met:
-//
-// 1. Redistributions in source form must reproduce the above copyright 
-//    notice, this list of conditions and the following disclaimer in 
-//    the documentation and/or other materials provided with the distribution.
-//
-// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" 
-// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
-// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR 
-// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR 
-// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, 
-// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, 
-// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; 
-// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
-// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING 
-// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, 
-// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
-
-
-// By:
-// Kunal Waghray
-// Christian Henke
-
-#include "main.h"
-// for randomization
-#include <stdlib.h>
-
-// for EEPROM	
-#define addrGamemode 			256+0
-#define addrPlayer1Score 	256+4
-#define addrPlayer2Score 	256+8
-#define addrRandomSeed 		256+12
-
-// joystick variables
-volatile uint32_t direction;
-bool movingJoystick;
-
-// global variables
-bool menu;
-uint8_t gamemode;
-uint8_t player1score;
-uint8_t player2score;
-uint8_t randomSeed;
-volatile int ballWait;
-volatile int waitLoser;
-volatile bool heisenbergBlinking;
-volatile bool AlertTimerDelay;
-volatile bool AlertGameTick;
-volatile bool ioButtonLeft = false;
-volatile bool ioButtonRight = false;
-// sw1 button debounce
-volatile bool AlertTimer4;
-
-
-// this is mostly for info, hence const
-const int GAMEMODES = 5;
-const int maxSpeed = 10;
-const int ballMaxSpeed = 5;
-const int gameSpeed = 20;
-const int winScore = 10;
-const int maxScoreWidth = 30;
-const int maxScoreHeight = 20;
-const int heisenbergBlinkTime = 30; // in ms
-const int accelSensitivity = 7000;
-const int noupdown = 10;
-
-// x and y of the center of the object
-int player1x;
-int player1y;
-int player2x;
-int player2y;
-int ballx;
-int bally;
-int ballChangex; // speed
-int ballChangey; // speed
-
-// used for many calculations, initalized in main using images.c values
-int playerWidth;
-int playerHeight; 
-int ballWidth; 
-int ballHeight;
-
-
-// Debounce the SW1 button using the timer4 ISR
-bool sw1_debounce(void)
-{
-  // this function is constantly called
-	bool pin_logic_level;
-	static int debounceCount = 0;
-	
-	// every 20ms
-	if (AlertTimer4) {
-		// read the SW1 button
-		pin_logic_level = lp_io_read_pin(SW1_BIT);
-		// if unpressed
-		if (pin_logic_level) {
-				debounceCount = 0; // reset
-		}
-		else { // active low
-				// count to debounce
-				if (debounceCount<10)
-					debounceCount++;
-				
-		}
-		// acknowledge interrupt
-		AlertTimer4 = false;
-		// guarantee 1 debounced button signal
-		return debounceCount==7;
-	}
-	else 
-		return false;
-}
-
-// this function called constantly
-void delayWaitFunction(void) 
-{
-	// local variables with only one initialization
-	static int i = 0;
-	static int j = 0;
-	static bool ballWaiting = false;
-	static bool waitingLoser = false;
-	static int blinking = 0;
-	
-	// every 10ms
-	if (AlertTimerDelay){
-			// delay after a point
-			if (ballWait && !ballWaiting){
-					i = 0;
-					ballWaiting = true;
-			}
-			if (ballWaiting) {
-					i++;
-					// a second has been waited
-					if (i>100){
-						ballWait = 0;
-						i = 0;
-						ballWaiting = false;
-					}
-			}
-			
-			// delay after game won 
-			if (waitLoser && !waitingLoser) {
-				j = 0;
-				waitingLoser = true;
-			}
-			if (waitingLoser){
-				j++;
-				if (j>100) {
-					j = 0;
-					waitLoser = 0;
-					waitingLoser = false;
-				}
-			}
-			// every 0.5 seconds switch
-			blinking++;
-			if (blinking>2*heisenbergBlinkTime) blinking = 0;
-			heisenbergBlinking = blinking<heisenbergBlinkTime;
-			
-			// acknowledge interrupt
-			AlertTimerDelay = false;
-	}
-}
-
-// this function sets the game speed
-bool gameTick(void) 
-{
-	if (AlertGameTick){
-			// acknowledge interrupt
-			AlertGameTick = false;
-			return true;
-	}
-	return false;
-}
-
-
-// based on the global variables, draw the menu
-void drawMenu(void)
-{
-	// hide old menu choice
-	lcd_clear_screen(LCD_COLOR_BLACK);
-	
-	// draw menu choices:
-	switch(gamemode) {
-		case 0: 
-			// middle (current option)
-			lcd_draw_image(
-											(COLS/2),                 // X Pos
-											mode0WidthPixels,   // Image Horizontal Width
-											(ROWS/2),                 // Y Pos
-											mode0HeightPixels,  // Image Vertical Height
-											mode0Bitmaps,       // Image
-											LCD_COLOR_GREEN,      // Foreground Color
-											LCD_COLOR_BLACK     // Background Color
-										);
-			// above option
-			lcd_draw_image(
-											(COLS/2),                 // X Pos
-											mode5WidthPixels,   // Image Horizontal Width
-											((ROWS/2)/2),                 // Y Pos
-											mode5HeightPixels,  // Image Vertical Height
-											mode5Bitmaps,       // Image
-											LCD_COLOR_GREEN2,      // Foreground Color
-											LCD_COLOR_BLACK     // Background Color
-										);
-			// below option
-			lcd_draw_image(
-											(COLS/2),                 // X Pos
-											mode1WidthPixels,   // Image Horizontal Width
-											(3*(ROWS/2)/2),                 // Y Pos
-											mode1HeightPixels,  // Image Vertical Height
-											mode1Bitmaps,       // Image
-											LCD_COLOR_GREEN2,      // Foreground Color
-											LCD_COLOR_BLACK     // Background Color
-										);
-			break;
-		case 1: 
-			// middle (current option)
-			lcd_draw_image(
-											(COLS/2),                 // X Pos
-											mode1WidthPixels,   // Image Horizontal Width
-											(ROWS/2),                 // Y Pos
-											mode1HeightPixels,  // Image Vertical Height
-											mode1Bitmaps,       // Image
-											LCD_COLOR_GREEN,      // Foreground Color
-											LCD_COLOR_BLACK     // Background Color
-										);
-			// above option
-			lcd_draw_image(
-											(COLS/2),                 // X Pos
-											mode0WidthPixels,   // Image Horizontal Width
-											((ROWS/2)/2),                 // Y Pos
-											mode0HeightPixels,  // Image Vertical Height
-											mode0Bitmaps,       // Image
-											LCD_COLOR_GREEN2,      // Foreground Color
-											LCD_COLOR_BLACK     // Background Color
-										);
-			// below option
-			lcd_draw_image(
-											(COLS/2),                 // X Pos
-											mode2WidthPixels,   // Image Horizontal Width
-											(3*(ROWS/2)/2),                 // Y Pos
-											mode2HeightPixels,  // Image Vertical Height
-											mode2Bitmaps,       // Image
-											LCD_COLOR_GREEN2,      // Foreground Color
-											LCD_COLOR_BLACK     // Background Color
-										);
-			break;
-		case 2: 
-			// middle (current option)
-			lcd_draw_image(
-											(COLS/2),                 // X Pos
-											mode2WidthPixels,   // Image Horizontal Width
-											(ROWS/2),                 // Y Pos
-											mode2HeightPixels,  // Image Vertical Height
-											mode2Bitmaps,       // Image
-											LCD_COLOR_GREEN,      // Foreground Color
-											LCD_COLOR_BLACK     // Background Color
-										);
-			// above option
-			lcd_draw_image(
-											(COLS/2),                 // X Pos
-											mode1WidthPixels,   // Image Horizontal Width
-											((ROWS/2)/2),                 // Y Pos
-											mode1HeightPixels,  // Image Vertical Height
-											mode1Bitmaps,       // Image
-											LCD_COLOR_GREEN2,      // Foreground Color
-											LCD_COLOR_BLACK     // Background Color
-										);
-			// below option
-			lcd_draw_image(
-											(COLS/2),                 // X Pos
-											mode3WidthPixels,   // Image Horizontal Width
-											(3*(ROWS/2)/2),                 // Y Pos
-											mode3HeightPixels,  // Image Vertical Height
-											mode3Bitmaps,       // Image
-											LCD_COLOR_GREEN2,      // Foreground Color
-											LCD_COLOR_BLACK     // Background Color
-										);
-			break;
-		case 3: 
-			// middle (current option)
-			lcd_draw_image(
-											(COLS/2),                 // X Pos
-											mode3WidthPixels,   // Image Horizontal Width
-											(ROWS/2),                 // Y Pos
-											mode3HeightPixels,  // Image Vertical Height
-											mode3Bitmaps,       // Image
-											LCD_COLOR_GREEN,      // Foreground Color
-											LCD_COLOR_BLACK     // Background Color
-										);
-			// above option
-			lcd_draw_image(
-											(COLS/2),                 // X Pos
-											mode2WidthPixels,   // Image Horizontal Width
-											((ROWS/2)/2),                 // Y Pos
-											mode2HeightPixels,  // Image Vertical Height
-											mode2Bitmaps,       // Image
-											LCD_COLOR_GREEN2,      // Foreground Color
-											LCD_COLOR_BLACK     // Background Color
-										);
-			// below option
-			lcd_draw_image(
-											(COLS/2),                 // X Pos
-											mode4WidthPixels,   // Image Horizontal Width
-											(3*(ROWS/2)/2),                 // Y Pos
-											mode4HeightPixels,  // Image Vertical Height
-											mode4Bitmaps,       // Image
-											LCD_COLOR_GREEN2,      // Foreground Color
-											LCD_COLOR_BLACK     // Background Color
-										);
-			break;
-		case 4: 
-			// middle (current option)
-			lcd_draw_image(
-											(COLS/2),                 // X Pos
-											mode4WidthPixels,   // Image Horizontal Width
-											(ROWS/2),                 // Y Pos
-											mode4HeightPixels,  // Image Vertical Height
-											mode4Bitmaps,       // Image
-											LCD_COLOR_GREEN,      // Foreground Color
-											LCD_COLOR_BLACK     // Background Color
-										);
-			// above option
-			lcd_draw_image(
-											(COLS/2),                 // X Pos
-											mode3WidthPixels,   // Image Horizontal Width
-											((ROWS/2)/2),                 // Y Pos
-											mode3HeightPixels,  // Image Vertical Height
-											mode3Bitmaps,       // Image
-											LCD_COLOR_GREEN2,      // Foreground Color
-											LCD_COLOR_BLACK     // Background Color
-										);
-			// below option
-			lcd_draw_image(
-											(COLS/2),                 // X Pos
-											mode5WidthPixels,   // Image Horizontal Width
-											(3*(ROWS/2)/2),                 // Y Pos
-											mode5HeightPixels,  // Image Vertical Height
-											mode5Bitmaps,       // Image
-											LCD_COLOR_GREEN2,      // Foreground Color
-											LCD_COLOR_BLACK     // Background Color
-										);
-			break;
-		case 5: 
-			// middle (current option)
-			lcd_draw_image(
-											(COLS/2),                 // X Pos
-											mode5WidthPixels,   // Image Horizontal Width
-											(ROWS/2),                 // Y Pos
-											mode5HeightPixels,  // Image Vertical Height
-											mode5Bitmaps,       // Image
-											LCD_COLOR_GREEN,      // Foreground Color
-											LCD_COLOR_BLACK     // Background Color
-										);
-			// above option
-			lcd_draw_image(
-											(COLS/2),                 // X Pos
-											mode4WidthPixels,   // Image Horizontal Width
-											((ROWS/2)/2),                 // Y Pos
-											mode4HeightPixels,  // Image Vertical Height
-											mode4Bitmaps,       // Image
-											LCD_COLOR_GREEN2,      // Foreground Color
-											LCD_COLOR_BLACK     // Background Color
-										);
-			// below option
-			lcd_draw_image(
-											(COLS/2),                 // X Pos
-											mode0WidthPixels,   // Image Horizontal Width
-											(3*(ROWS/2)/2),                 // Y Pos
-											mode0HeightPixels,  // Image Vertical Height
-											mode0Bitmaps,       // Image
-											LCD_COLOR_GREEN2,      // Foreground Color
-											LCD_COLOR_BLACK     // Background Color
-										);
-			break;
-		default:
-			// error
-			lcd_clear_screen(LCD_COLOR_GREEN2);
-			break;
-	}
-
-		/* 
-		Drawing notes:
-		Top left pixel is 0,0
-		Screen width is COLS
-		Screen height is ROWS
-		images are drawn from the CENTER!!!
-		draw_rectangle_centered draws rectangles from the center
-		*/
-}
-// draw the scores on the side
-void drawScore(void){
-	// max score we can draw
-	if (player1score<10 && player2score<10) {
-		// hide old score
-		lcd_draw_image(				(COLS-5)-maxScoreWidth/2,                 // X Pos
-													maxScoreWidth,   // Image Horizontal Width
-													(ROWS/2) - 1 - maxScoreHeight/2,                 // Y Pos
-													maxScoreHeight,  // Image Vertical Height
-													num0Bitmaps,       // Image
-													LCD_COLOR_BLACK,      // Foreground Color
-													LCD_COLOR_BLACK     // Background Color
-												);
-		lcd_draw_image(				(COLS-5)-maxScoreWidth/2,                 // X Pos
-													maxScoreWidth,   // Image Horizontal Width
-													(ROWS/2) + 1 + maxScoreHeight/2,                 // Y Pos
-													maxScoreHeight,  // Image Vertical Height
-													num0Bitmaps,       // Image
-													LCD_COLOR_BLACK,      // Foreground Color
-													LCD_COLOR_BLACK     // Background Color
-												);
-												
-		switch (player1score) {
-			case 0:
-				lcd_draw_image(		(COLS-5)-num0Width/2,                 // X Pos
-													num0Width,   // Image Horizontal Width
-													(ROWS/2) - 1 - num0Height/2,                 // Y Pos
-													num0Height,  // Image Vertical Height
-													num0Bitmaps,       // Image
-													LCD_COLOR_CYAN,      // Foreground Color
-													LCD_COLOR_BLACK     // Background Color
-												);
-				break;
-			case 1:
-				lcd_draw_image(		(COLS-5)-num1Width/2,                 // X Pos
-													num1Width,   // Image Horizontal Width
-													(ROWS/2) - 1 - num1Height/2,                 // Y Pos
-													num1Height,  // Image Vertical Height
-													num1Bitmaps,       // Image
-													LCD_COLOR_CYAN,      // Foreground Color
-													LCD_COLOR_BLACK     // Background Color
-												);
-				break;
-			case 2:
-				lcd_draw_image(		(COLS-5)-num2Width/2,                 // X Pos
-													num2Width,   // Image Horizontal Width
-													(ROWS/2) - 1 - num2Height/2,                 // Y Pos
-													num2Height,  // Image Vertical Height
-													num2Bitmaps,       // Image
-													LCD_COLOR_CYAN,      // Foreground Color
-													LCD_COLOR_BLACK     // Background Color
-												);
-				break;
-			case 3:
-				lcd_draw_image(		(COLS-5)-num3Width/2,                 // X Pos
-													num1Width,   // Image Horizontal Width
-													(ROWS/2) - 1 - num3Height/2,                 // Y Pos
-													num3Height,  // Image Vertical Height
-													num3Bitmaps,       // Image
-													LCD_COLOR_CYAN,      // Foreground Color
-													LCD_COLOR_BLACK     // Background Color
-												);
-				break;
-			case 4:
-				lcd_draw_image(		(COLS-5)-num4Width/2,                 // X Pos
-													num4Width,   // Image Horizontal Width
-													(ROWS/2) - 1 - num4Height/2,                 // Y Pos
-													num4Height,  // Image Vertical Height
-													num4Bitmaps,       // Image
-													LCD_COLOR_CYAN,      // Foreground Color
-													LCD_COLOR_BLACK     // Background Color
-												);
-				break;
-			case 5:
-				lcd_draw_image(		(COLS-5)-num5Width/2,                 // X Pos
-													num5Width,   // Image Horizontal Width
-													(ROWS/2) - 1 - num5Height/2,                 // Y Pos
-													num5Height,  // Image Vertical Height
-													num5Bitmaps,       // Image
-													LCD_COLOR_CYAN,      // Foreground Color
-													LCD_COLOR_BLACK     // Background Color
-												);
-				break;
-			case 6:
-				lcd_draw_image(		(COLS-5)-num6Width/2,                 // X Pos
-													num6Width,   // Image Horizontal Width
-													(ROWS/2) - 1 - num6Height/2,                 // Y Pos
-													num6Height,  // Image Vertical Height
-													num6Bitmaps,       // Image
-													LCD_COLOR_CYAN,      // Foreground Color
-													LCD_COLOR_BLACK     // Background Color
-												);
-				break;
-			case 7:
-				lcd_draw_image(		(COLS-5)-num7Width/2,                 // X Pos
-													num7Width,   // Image Horizontal Width
-													(ROWS/2) - 1 - num7Height/2,                 // Y Pos
-													num7Height,  // Image Vertical Height
-													num7Bitmaps,       // Image
-													LCD_COLOR_CYAN,      // Foreground Color
-													LCD_COLOR_BLACK     // Background Color
-												);
-				break;
-			case 8:
-				lcd_draw_image(		(COLS-5)-num8Width/2,                 // X Pos
-													num8Width,   // Image Horizontal Width
-													(ROWS/2) - 1 - num8Height/2,                 // Y Pos
-													num8Height,  // Image Vertical Height
-													num8Bitmaps,       // Image
-													LCD_COLOR_CYAN,      // Foreground Color
-													LCD_COLOR_BLACK     // Background Color
-												);
-				break;
-			case 9:
-				lcd_draw_image(		(COLS-5)-num9Width/2,                 // X Pos
-													num9Width,   // Image Horizontal Width
-													(ROWS/2) - 1 - num9Height/2,                 // Y Pos
-													num9Height,  // Image Vertical Height
-													num9Bitmaps,       // Image
-													LCD_COLOR_CYAN,      // Foreground Color
-													LCD_COLOR_BLACK     // Background Color
-												);
-				break;
-			default: //error
-				lcd_clear_screen(LCD_COLOR_GREEN2);
-				break;
-		}						
-		switch (player2score) {
-			case 0:
-				lcd_draw_image(		(COLS-5)-num0Width/2,                 // X Pos
-													num0Width,   // Image Horizontal Width
-													(ROWS/2) + 1 + num0Height/2,                 // Y Pos
-													num0Height,  // Image Vertical Height
-													num0Bitmaps,       // Image
-													LCD_COLOR_MAGENTA,      // Foreground Color
-													LCD_COLOR_BLACK     // Background Color
-												);
-				break;
-			case 1:
-				lcd_draw_image(		(COLS-5)-num1Width/2,                 // X Pos
-													num1Width,   // Image Horizontal Width
-													(ROWS/2) + 1 + num0Height/2,                 // Y Pos
-													num1Height,  // Image Vertical Height
-													num1Bitmaps,       // Image
-													LCD_COLOR_MAGENTA,      // Foreground Color
-													LCD_COLOR_BLACK     // Background Color
-												);
-				break;
-			case 2:
-				lcd_draw_image(		(COLS-5)-num2Width/2,                 // X Pos
-													num2Width,   // Image Horizontal Width
-													(ROWS/2) + 1 + num0Height/2,                 // Y Pos
-													num2Height,  // Image Vertical Height
-													num2Bitmaps,       // Image
-													LCD_COLOR_MAGENTA,      // Foreground Color
-													LCD_COLOR_BLACK     // Background Color
-												);
-				break;
-			case 3:
-				lcd_draw_image(		(COLS-5)-num3Width/2,                 // X Pos
-													num1Width,   // Image Horizontal Width
-													(ROWS/2) + 1 + num0Height/2,                 // Y Pos
-													num3Height,  // Image Vertical Height
-													num3Bitmaps,       // Image
-													LCD_COLOR_MAGENTA,      // Foreground Color
-													LCD_COLOR_BLACK     // Background Color
-												);
-				break;
-			case 4:
-				lcd_draw_image(		(COLS-5)-num4Width/2,                 // X Pos
-													num4Width,   // Image Horizontal Width
-													(ROWS/2) + 1 + num0Height/2,                 // Y Pos
-													num4Height,  // Image Vertical Height
-													num4Bitmaps,       // Image
-													LCD_COLOR_MAGENTA,      // Foreground Color
-													LCD_COLOR_BLACK     // Background Color
-												);
-				break;
-			case 5:
-				lcd_draw_image(		(COLS-5)-num5Width/2,                 // X Pos
-													num5Width,   // Image Horizontal Width
-													(ROWS/2) + 1 + num0Height/2,                 // Y Pos
-													num5Height,  // Image Vertical Height
-													num5Bitmaps,       // Image
-													LCD_COLOR_MAGENTA,      // Foreground Color
-													LCD_COLOR_BLACK     // Background Color
-												);
-				break;
-			case 6:
-				lcd_draw_image(		(COLS-5)-num6Width/2,                 // X Pos
-													num6Width,   // Image Horizontal Width
-													(ROWS/2) + 1 + num0Height/2,                 // Y Pos
-													num6Height,  // Image Vertical Height
-													num6Bitmaps,       // Image
-													LCD_COLOR_MAGENTA,      // Foreground Color
-													LCD_COLOR_BLACK     // Background Color
-												);
-				break;
-			case 7:
-				lcd_draw_image(		(COLS-5)-num7Width/2,                 // X Pos
-													num7Width,   // Image Horizontal Width
-													(ROWS/2) + 1 + num0Height/2,                 // Y Pos
-													num7Height,  // Image Vertical Height
-													num7Bitmaps,       // Image
-													LCD_COLOR_MAGENTA,      // Foreground Color
-													LCD_COLOR_BLACK     // Background Color
-												);
-				break;
-			case 8:
-				lcd_draw_image(		(COLS-5)-num8Width/2,                 // X Pos
-													num8Width,   // Image Horizontal Width
-													(ROWS/2) + 1 + num0Height/2,                 // Y Pos
-													num8Height,  // Image Vertical Height
-													num8Bitmaps,       // Image
-													LCD_COLOR_MAGENTA,      // Foreground Color
-													LCD_COLOR_BLACK     // Background Color
-												);
-				break;
-			case 9:
-				lcd_draw_image(		(COLS-5)-num9Width/2,                 // X Pos
-													num9Width,   // Image Horizontal Width
-													(ROWS/2) + 1 + num0Height/2,                 // Y Pos
-													num9Height,  // Image Vertical Height
-													num9Bitmaps,       // Image
-													LCD_COLOR_MAGENTA,      // Foreground Color
-													LCD_COLOR_BLACK     // Background Color
-												);
-				break;
-			default: //error
-				lcd_clear_screen(LCD_COLOR_GREEN2);
-				break;
-		}
-	}
-}
-
-// draw fireworks on game won screen
-void drawFireworks(void) {
-			int color1 = rand() % 12; // 0 to 11
-			int color2 = rand() % 12;
-			switch (color1) {
-				case 0:
-					color1 = LCD_COLOR_WHITE;
-					break;
-				case 1:
-					color1 = LCD_COLOR_RED;
-					break;
-				case 2:
-					color1 = LCD_COLOR_GREEN;
-					break;
-				case 3:
-					color1 = LCD_COLOR_GREEN2;
-					break;
-				case 4:
-					color1 = LCD_COLOR_BLUE;
-					break;
-				case 5:
-					color1 = LCD_COLOR_BLUE2;
-					break;
-				case 6:
-					color1 = LCD_COLOR_YELLOW;
-					break;
-				case 7:
-					color1 = LCD_COLOR_ORANGE;
-					break;
-				case 8:
-					color1 = LCD_COLOR_CYAN;
-					break;
-				case 9:
-					color1 = LCD_COLOR_MAGENTA;
-					break;
-				case 10:
-					color1 = LCD_COLOR_GRAY;
-					break;
-				case 11:
-					color1 = LCD_COLOR_BROWN;
-					break;
-			}
-			switch (color2) {
-				case 0:
-					color2 = LCD_COLOR_WHITE;
-					break;
-				case 1:
-					color2 = LCD_COLOR_RED;
-					break;
-				case 2:
-					color2 = LCD_COLOR_GREEN;
-					break;
-				case 3:
-					color2 = LCD_COLOR_GREEN2;
-					break;
-				case 4:
-					color2 = LCD_COLOR_BLUE;
-					break;
-				case 5:
-					color2 = LCD_COLOR_BLUE2;
-					break;
-				case 6:
-					color2 = LCD_COLOR_YELLOW;
-					break;
-				case 7:
-					color2 = LCD_COLOR_ORANGE;
-					break;
-				case 8:
-					color2 = LCD_COLOR_CYAN;
-					break;
-				case 9:
-					color2 = LCD_COLOR_MAGENTA;
-					break;
-				case 10:
-					color2 = LCD_COLOR_GRAY;
-					break;
-				case 11:
-					color2 = LCD_COLOR_BROWN;
-					break;
-			}
-			lcd_draw_image(
-											(COLS/2),                 // X Pos
-											fireworksWidth,   // Image Horizontal Width
-											((ROWS/2)/2),                 // Y Pos
-											fireworksHeight,  // Image Vertical Height
-											fireworksBitmaps,       // Image
-											color1,      // Foreground Color
-											LCD_COLOR_BLACK     // Background Color
-										);
-					
-			lcd_draw_image(
-											(COLS/2),                 // X Pos
-											fireworksWidth,   // Image Horizontal Width
-											(3*(ROWS/2)/2),                 // Y Pos
-											fireworksHeight,  // Image Vertical Height
-											fireworksBitmaps,       // Image
-											color2,      // Foreground Color
-											LCD_COLOR_BLACK     // Background Color
-										);
-}
-//*****************************************************************************
-void DisableInterrupts(void)
-{
-  __asm {
-         CPSID  I
-  }
-}
-
-//*****************************************************************************
-void EnableInterrupts(void)
-{
-  __asm {
-    CPSIE  I
-  }
-}
-
-
-
-// returns true if the ball is touching a player
-bool playercontact(void){
-	
-		bool isContacting = false;
-		
-		// hit detection
-		if (player2x - playerWidth/2 < ballx + ballWidth/2 &&
-				player2x + playerWidth/2 > ballx - ballWidth/2 &&
-				player2y - playerHeight/2 < bally + ballHeight/2 &&
-				player2y + playerHeight/2 > bally - ballHeight/2) {
-			isContacting = true;
-		}
-		if (player1x - playerWidth/2 < ballx + ballWidth/2 &&
-				player1x + playerWidth/2 > ballx - ballWidth/2 &&
-				player1y - playerHeight/2 < bally + ballHeight/2 &&
-				player1y + playerHeight/2 > bally - ballHeight/2) {
-			isContacting = true;
-		}
-		// this logic will result in if the ball is touching both players 
-		// (due to some crazy gamemodes)
-		// that the ball twitches back and forth as long as it's touching one player
-		return isContacting;
-}
-
-// returns true if the ball is touching a wall
-bool wallcontact(void){
-		bool isContacting = false;
-		// half of the ball is past the left or right wall 
-		// (because of the motion this ball is about to take)
-		if (ballx < 0 + ballWidth)
-			isContacting = true;
-		if (ballx > COLS - ballWidth)
-			isContacting = true;
-		
-		return isContacting;
-}
-
-
-// randomizes the direction the ball will travel in
-void randomizeBall(void) {
-	ballChangex = (rand() % (ballMaxSpeed*2+1)) - ballMaxSpeed; // from 0 to (ballMaxSpeed*2), then from -ballMaxSpeed to ballMaxSpeed
-	ballChangey = (rand() % (ballMaxSpeed*2+1)) - ballMaxSpeed;
-	// prevent infinite loop left and right (but not up and down cause that'd be funny)
-	while (ballChangey==0){
-		ballChangex = (rand() % (ballMaxSpeed*2+1)) - ballMaxSpeed; 
-		ballChangey = (rand() % (ballMaxSpeed*2+1)) - ballMaxSpeed;
-	}
-}
-
-//*****************************************************************************
-//************DEATH**********************PONG**********************************
-//*****************************************************************************
-
-// run the game: DEATH PONG
-int 
-main(void)
-{
-	bool done = false;
-	int accelX = 0;
-	
-	// ideals: player 40 width, 10 height. ball 10 width, 10 height.
-	playerWidth = playerWidthPixels; // get these values from bitmap
-	playerHeight = playerHeightPixels; // get these values from bitmap
-	ballWidth = ballWidthPixels; // get these values from bitmap
-	ballHeight = ballHeightPixels; // get these values from bitmap
-	
-	gamemode = 0;
-	player1score = 0;
-	player2score = 0;
-	randomSeed = 0;
-	// initialize hardware
-	project_initialize_hardware();
-
-	// EEPROM example
-	//eeprom_byte_write(I2C1_BASE,addrGamemode, gamemode);
-	//eeprom_byte_read(I2C1_BASE,addrGamemode, &gamemode);
-	// read EEPROM for gamemode currently
-	// read EEPROM for player scores
-	// read EEPROM for random seed
-	eeprom_byte_read(I2C1_BASE, addrGamemode, &gamemode);
-	eeprom_byte_read(I2C1_BASE, addrPlayer1Score, &player1score);
-	eeprom_byte_read(I2C1_BASE, addrPlayer2Score, &player2score);
-	eeprom_byte_read(I2C1_BASE, addrRandomSeed, &randomSeed);
-	
-	// initialize menu defaults
-	menu = 1;
-	movingJoystick = 0;
-	ballWait = 0;
-	waitLoser = 0;
-	
-	// initialize random number generator 
-  srand(randomSeed);   // Initialization, should only be called once.
-	randomSeed++; //loops around, only uint8
-	// write random seed to EEPROM
-	eeprom_byte_write(I2C1_BASE,addrRandomSeed, randomSeed);
-	
-	// initialize screen
-	lcd_config_screen();
-	lcd_clear_screen(LCD_COLOR_BLACK);
-	drawMenu();
-	
-	while (!done) {
-		// pre-game menu selection
-		if (menu) {
-			// joystick move
-			if (direction!=0 && movingJoystick==0){
-					// not allowed to move until moving stops
-					movingJoystick = 1;
-					// move to new choice (wrap around motion)
-					if (direction==1) { // up  
-							gamemode--;
-							if (gamemode==0xFF) gamemode = GAMEMODES; //0xFF as -1
-					}
-					else if (direction==3) { // down
-							gamemode++;
-							if (gamemode==GAMEMODES+1) gamemode = 0; 
-					}
-					// write currently selected gamemode to EEPROM
-					eeprom_byte_write(I2C1_BASE,addrGamemode, gamemode);
-					
-					// redraw the menu 
-					lcd_clear_screen(LCD_COLOR_BLACK);
-					drawMenu();
-			}
-			// joystick is back at center
-			else if (direction==0) {
-				// can move it again
-					movingJoystick = 0;
-			}
-			// select-menu-option button pressed
-			if (sw1_debounce()) {
-					// select menu option by turning off menu
-					// and going into current gamemode
-					menu = 0;
-					// initialize variables based on gamemode
-				  switch (gamemode) {
-					// regular pong
-					case 0:
-						player1x = (COLS/2);
-						player1y = (ROWS/6);
-						player2x = (COLS/2);
-						player2y = (5*ROWS/6);
-						ballx = (COLS/2);
-						bally = (ROWS/2);
-						// randomize ball
-						randomizeBall();
-						
-						lcd_clear_screen(LCD_COLOR_BLACK);
-						// draw players
-						lcd_draw_image(
-													player1x,                 // X Pos
-													playerWidth,   // Image Horizontal Width
-													player1y,                 // Y Pos
-													playerHeight,  // Image Vertical Height
-													playerBitmaps,       // Image
-													LCD_COLOR_BLUE,      // Foreground Color
-													LCD_COLOR_BLACK     // Background Color
-												);
-						lcd_draw_image(
-													player2x,                 // X Pos
-													playerWidth,   // Image Horizontal Width
-													player2y,                 // Y Pos
-													playerHeight,  // Image Vertical Height
-													playerBitmaps,       // Image
-													LCD_COLOR_BLUE,      // Foreground Color
-													LCD_COLOR_BLACK     // Background Color
-												);
-						// draw ball
-						lcd_draw_image(
-													ballx,                 // X Pos
-													ballWidth,   // Image Horizontal Width
-													bally,                 // Y Pos
-													ballHeight,  // Image Vertical Height
-													ballBitmaps,       // Image
-													LCD_COLOR_BLUE,      // Foreground Color
-													LCD_COLOR_BLACK     // Background Color
-												);
-						// draw score
-						drawScore();
-						break;
-					// gravity pong
-					case 1:
-						player1x = (COLS/2);
-						player1y = (ROWS/6);
-						player2x = (COLS/2);
-						player2y = (5*ROWS/6);
-						ballx = (COLS/2);
-						bally = (ROWS/2);
-						// randomize ball
-						randomizeBall();
-						
-						lcd_clear_screen(LCD_COLOR_BLACK);
-						// draw players
-						lcd_draw_image(
-													player1x,                 // X Pos
-													playerWidth,   // Image Horizontal Width
-													player1y,                 // Y Pos
-													playerHeight,  // Image Vertical Height
-													playerBitmaps,       // Image
-													LCD_COLOR_BLUE,      // Foreground Color
-													LCD_COLOR_BLACK     // Background Color
-												);
-						lcd_draw_image(
-													player2x,                 // X Pos
-													playerWidth,   // Image Horizontal Width
-													player2y,                 // Y Pos
-													playerHeight,  // Image Vertical Height
-													playerBitmaps,       // Image
-													LCD_COLOR_BLUE,      // Foreground Color
-													LCD_COLOR_BLACK     // Background Color
-												);
-						// draw ball
-						lcd_draw_image(
-													ballx,                 // X Pos
-													ballWidth,   // Image Horizontal Width
-													bally,                 // Y Pos
-													ballHeight,  // Image Vertical Height
-													ballBitmaps,       // Image
-													LCD_COLOR_BLUE,      // Foreground Color
-													LCD_COLOR_BLACK     // Background Color
-												);
-						// draw score
-						drawScore();
-						break;
-					// heisenberg pong
-					case 2:
-						player1x = (COLS/2);
-						player1y = (ROWS/6);
-						player2x = (COLS/2);
-						player2y = (5*ROWS/6);
-						ballx = (COLS/2);
-						bally = (ROWS/2);
-						// randomize ball
-						randomizeBall();
-						
-						lcd_clear_screen(LCD_COLOR_BLACK);
-						// draw players
-						lcd_draw_image(
-													player1x,                 // X Pos
-													playerWidth,   // Image Horizontal Width
-													player1y,                 // Y Pos
-													playerHeight,  // Image Vertical Height
-													playerBitmaps,       // Image
-													LCD_COLOR_BLUE,      // Foreground Color
-													LCD_COLOR_BLACK     // Background Color
-												);
-						lcd_draw_image(
-													player2x,                 // X Pos
-													playerWidth,   // Image Horizontal Width
-													player2y,                 // Y Pos
-													playerHeight,  // Image Vertical Height
-													playerBitmaps,       // Image
-													LCD_COLOR_BLUE,      // Foreground Color
-													LCD_COLOR_BLACK     // Background Color
-												);
-						// draw ball
-						lcd_draw_image(
-													ballx,                 // X Pos
-													ballWidth,   // Image Horizontal Width
-													bally,                 // Y Pos
-													ballHeight,  // Image Vertical Height
-													ballBitmaps,       // Image
-													LCD_COLOR_BLUE,      // Foreground Color
-													LCD_COLOR_BLACK     // Background Color
-												);
-						// draw score
-						drawScore();
-						break;
-					// weird controls pong
-					case 3:
-						player1x = (COLS/2);
-						player1y = (ROWS/6);
-						player2x = (COLS/2);
-						player2y = (5*ROWS/6);
-						ballx = (COLS/2);
-						bally = (ROWS/2);
-						// randomize ball
-						randomizeBall();
-						
-						lcd_clear_screen(LCD_COLOR_BLACK);
-						// draw players
-						lcd_draw_image(
-													player1x,                 // X Pos
-													playerWidth,   // Image Horizontal Width
-													player1y,                 // Y Pos
-													playerHeight,  // Image Vertical Height
-													playerBitmaps,       // Image
-													LCD_COLOR_BLUE,      // Foreground Color
-													LCD_COLOR_BLACK     // Background Color
-												);
-						lcd_draw_image(
-													player2x,                 // X Pos
-													playerWidth,   // Image Horizontal Width
-													player2y,                 // Y Pos
-													playerHeight,  // Image Vertical Height
-													playerBitmaps,       // Image
-													LCD_COLOR_BLUE,      // Foreground Color
-													LCD_COLOR_BLACK     // Background Color
-												);
-						// draw ball
-						lcd_draw_image(
-													ballx,                 // X Pos
-													ballWidth,   // Image Horizontal Width
-													bally,                 // Y Pos
-													ballHeight,  // Image Vertical Height
-													ballBitmaps,       // Image
-													LCD_COLOR_BLUE,      // Foreground Color
-													LCD_COLOR_BLACK     // Background Color
-												);
-						// draw score
-						drawScore();
-						break;
-					// more dimensional pong
-					case 4:
-						player1x = (COLS/2);
-						player1y = (ROWS/6);
-						player2x = (COLS/2);
-						player2y = (5*ROWS/6);
-						ballx = (COLS/2);
-						bally = (ROWS/2);
-						// randomize ball
-						randomizeBall();
-						
-						lcd_clear_screen(LCD_COLOR_BLACK);
-						// draw players
-						lcd_draw_image(
-													player1x,                 // X Pos
-													playerWidth,   // Image Horizontal Width
-													player1y,                 // Y Pos
-													playerHeight,  // Image Vertical Height
-													playerBitmaps,       // Image
-													LCD_COLOR_BLUE,      // Foreground Color
-													LCD_COLOR_BLACK     // Background Color
-												);
-						lcd_draw_image(
-													player2x,                 // X Pos
-													playerWidth,   // Image Horizontal Width
-													player2y,                 // Y Pos
-													playerHeight,  // Image Vertical Height
-													playerBitmaps,       // Image
-													LCD_COLOR_BLUE,      // Foreground Color
-													LCD_COLOR_BLACK     // Background Color
-												);
-						// draw ball
-						lcd_draw_image(
-													ballx,                 // X Pos
-													ballWidth,   // Image Horizontal Width
-													bally,                 // Y Pos
-													ballHeight,  // Image Vertical Height
-													ballBitmaps,       // Image
-													LCD_COLOR_BLUE,      // Foreground Color
-													LCD_COLOR_BLACK     // Background Color
-												);
-						// draw score
-						drawScore();
-						break;
-					// reset scores
-					case 5: 
-						// easter egg with scores of 4-2
-						if (player1score==4 && player2score==2) {
-							lcd_clear_screen(LCD_COLOR_MAGENTA);
-							// lcd draw image of an easter egg
-							lcd_draw_image(
-											(COLS/2),                 // X Pos
-											easterEggWidth,   // Image Horizontal Width
-											(ROWS/2),                 // Y Pos
-											easterEggHeight,  // Image Vertical Height
-											easterEggBitmaps,       // Image
-											LCD_COLOR_ORANGE,      // Foreground Color
-											LCD_COLOR_BLACK     // Background Color
-										);
-							player1score = 0;
-							player2score = 0;
-							// write scores to EEPROM
-							eeprom_byte_write(I2C1_BASE,addrPlayer1Score, player1score);
-							eeprom_byte_write(I2C1_BASE,addrPlayer2Score, player2score);
-							// back to 0 gamemode 
-							gamemode = 0;					
-							// write currently selected gamemode to EEPROM
-							eeprom_byte_write(I2C1_BASE,addrGamemode, gamemode);
-						
-							done = 1;
-							break;
-						}
-						player1score = 0;
-						player2score = 0;
-						// write scores to EEPROM
-						eeprom_byte_write(I2C1_BASE,addrPlayer1Score, player1score);
-						eeprom_byte_write(I2C1_BASE,addrPlayer2Score, player2score);
-						
-						// back to 0 gamemode and stay in the menu
-						gamemode = 0;
-						menu = 1;
-					
-						// write currently selected gamemode to EEPROM
-						eeprom_byte_write(I2C1_BASE,addrGamemode, gamemode);
-						// redraw the menu 
-						lcd_clear_screen(LCD_COLOR_BLACK);
-						drawMenu();
-						break;
-					default:
-						gamemode = 0; // set to regular pong if random value
-						break;
-				} 
-			}
-		}
-		// post-game 
-		else if (player1score>=winScore || player2score>=winScore){
-				delayWaitFunction();
-				if (!waitLoser){
-					// initialize post game 
-					if (player1score==winScore || player2score==winScore) {
-							if (player1score==winScore && player2score==winScore) {
-									// freak tie occurence
-									player1score = 0;
-									player2score = 0;
-									// write scores to EEPROM
-									eeprom_byte_write(I2C1_BASE,addrPlayer1Score, player1score);
-									eeprom_byte_write(I2C1_BASE,addrPlayer2Score, player2score);
-						
-									// so reset the scores and keep playing!
-							}
-							else if (player1score==winScore){
-								player2score = 0;
-								player1score++;
-								// write scores to EEPROM
-								eeprom_byte_write(I2C1_BASE,addrPlayer1Score, player1score);
-								eeprom_byte_write(I2C1_BASE,addrPlayer2Score, player2score);
-								
-							}
-							// player2score==winScore
-							else {
-								player1score = 0;
-								player2score++;
-								//write scores to EEPROM
-								eeprom_byte_write(I2C1_BASE,addrPlayer1Score, player1score);
-								eeprom_byte_write(I2C1_BASE,addrPlayer2Score, player2score);
-							}
-					}
-					else if (player1score>=winScore) {
-							lcd_clear_screen(LCD_COLOR_BLACK);
-							drawFireworks();
-							lcd_draw_image(
-														(COLS/2),                 // X Pos
-														player1winWidth,   // Image Horizontal Width
-														(ROWS/2),                 // Y Pos
-														player1winHeight,  // Image Vertical Height
-														player1winBitmaps,       // Image
-														LCD_COLOR_CYAN,      // Foreground Color
-														LCD_COLOR_BLACK     // Background Color
-													);
-							player1score = 0;
-							player2score = 0;
-							//write scores to EEPROM
-							eeprom_byte_write(I2C1_BASE,addrPlayer1Score, player1score);
-							eeprom_byte_write(I2C1_BASE,addrPlayer2Score, player2score);
-							done = true;
-							
-					}
-					else {
-							lcd_clear_screen(LCD_COLOR_BLACK);
-							drawFireworks();
-							lcd_draw_image(
-													(COLS/2),                 // X Pos
-													player2winWidth,   // Image Horizontal Width
-													(ROWS/2),                 // Y Pos
-													player2winHeight,  // Image Vertical Height
-													player2winBitmaps,       // Image
-													LCD_COLOR_MAGENTA,      // Foreground Color
-													LCD_COLOR_BLACK     // Background Color
-												);
-						player1score = 0;
-						player2score = 0;
-						//write scores to EEPROM
-						eeprom_byte_write(I2C1_BASE,addrPlayer1Score, player1score);
-						eeprom_byte_write(I2C1_BASE,addrPlayer2Score, player2score);
-						done = true;
-					}
-				
-				}
-		}
-		// in-game gameplay
-		else {
-				if (gameTick()) {
-							switch (gamemode) {
-//////////////// regular pong
-							case 0:
-								// PLAYER MOVEMENT
-								// player 1: touchscreen 
-								// screen goes from 0 to ROWS=320 and 0 to COLS=240
-								if (ft6x06_read_td_status()>0){
-									int x;
-									// hide player1
-									lcd_draw_image(
-															player1x,                 // X Pos
-															playerWidth,   // Image Horizontal Width
-															player1y,                 // Y Pos
-															playerHeight,  // Image Vertical Height
-															playerBitmaps,       // Image
-															LCD_COLOR_BLACK,      // Foreground Color
-															LCD_COLOR_BLACK     // Background Color
-														);
-									x = ft6x06_read_x();
-									if (player1x-x>maxSpeed)
-										player1x = player1x-maxSpeed;
-									else if (x-player1x>maxSpeed)
-										player1x = player1x+maxSpeed;
-									else
-										player1x = x;
-									
-									// redraw player1
-									lcd_draw_image(
-															player1x,                 // X Pos
-															playerWidth,   // Image Horizontal Width
-															player1y,                 // Y Pos
-															playerHeight,  // Image Vertical Height
-															playerBitmaps,       // Image
-															LCD_COLOR_BLUE,      // Foreground Color
-															LCD_COLOR_BLACK     // Background Color
-														);
-								}
-								
-								
-								// player 2: joystick
-								// joystick_y and joystick_x from 000 to FFF
-								if (direction!=0){
-									// hide player2
-									lcd_draw_image(
-																player2x,                 // X Pos
-																playerWidth,   // Image Horizontal Width
-																player2y,                 // Y Pos
-																playerHeight,  // Image Vertical Height
-																playerBitmaps,       // Image
-																LCD_COLOR_BLACK,      // Foreground Color
-																LCD_COLOR_BLACK     // Background Color
-															);
-									if (direction==2) { // left  
-										player2x = player2x-maxSpeed;
-										// wall cutoffs
-										if (player2x<0+playerWidth/2)
-											player2x = player2x+maxSpeed;
-									}
-									else if (direction==4) { // right
-										player2x = player2x+maxSpeed;
-										// wall cutoffs
-										if (player2x>COLS-playerWidth/2)
-											player2x = player2x-maxSpeed;
-									}
-									
-									// redraw player2
-									lcd_draw_image(
-																player2x,                 // X Pos
-																playerWidth,   // Image Horizontal Width
-																player2y,                 // Y Pos
-																playerHeight,  // Image Vertical Height
-																playerBitmaps,       // Image
-																LCD_COLOR_BLUE,      // Foreground Color
-																LCD_COLOR_BLACK     // Background Color
-															);
-								}
-								
-								// BALL MOVEMENT
-								delayWaitFunction();
-								if (!ballWait) {
-									// hide ball
-									lcd_draw_image(
-															ballx,                 // X Pos
-															ballWidth,   // Image Horizontal Width
-															bally,                 // Y Pos
-															ballHeight,  // Image Vertical Height
-															ballBitmaps,       // Image
-															LCD_COLOR_BLACK,      // Foreground Color
-															LCD_COLOR_BLACK     // Background Color
-														);
-									ballx = ballx+ballChangex;
-									bally = bally+ballChangey;
-									// player 1 point
-									if (bally>ROWS-ballHeight){
-											// point
-											player1score = player1score+1;
-											// write score to EEPROM
-											eeprom_byte_write(I2C1_BASE,addrPlayer1Score, player1score);
-											if (player1score>=winScore) {
-												// delay here for the loser to realize they've just lost and freeze frame that moment
-												waitLoser = 1;	
-												lcd_draw_image(
-															ballx,                 // X Pos
-															ballWidth,   // Image Horizontal Width
-															bally,                 // Y Pos
-															ballHeight,  // Image Vertical Height
-															ballBitmaps,       // Image
-															LCD_COLOR_RED,      // Foreground Color
-															LCD_COLOR_BLACK     // Background Color
-														);
-												break;
-											}
-											
-											// redraw score
-											drawScore();
-											// reset ball and wait for a bit
-											ballx = COLS/2;
-											bally = ROWS/2;
-											// randomize
-											randomizeBall();
-											
-											// wait for players to reset
-											ballWait = 1; 
-									}
-									// player 2 point
-									else if (bally<ballHeight){
-											// point
-											player2score = player2score+1;
-											// write score to EEPROM
-											eeprom_byte_write(I2C1_BASE,addrPlayer2Score, player2score);
-						
-											if (player2score>=winScore) {
-												// delay here for the loser to realize they've just lost and freeze frame that moment
-												waitLoser = 1;	
-												lcd_draw_image(
-															ballx,                 // X Pos
-															ballWidth,   // Image Horizontal Width
-															bally,                 // Y Pos
-															ballHeight,  // Image Vertical Height
-															ballBitmaps,       // Image
-															LCD_COLOR_RED,      // Foreground Color
-															LCD_COLOR_BLACK     // Background Color
-														);
-												break;
-											}
-											
-											// redraw score
-											drawScore();
-											// reset ball and wait for a bit
-											ballx = COLS/2;
-											bally = ROWS/2;
-											// randomize
-											randomizeBall();
-											
-											// wait for players to reset
-											ballWait = 1; 
-									}
-									else {
-										// player contact 
-										if (playercontact()) {
-											ballChangey = -ballChangey;
-											// for each player contact, randomly change the changex by a bit so not an infinite loop of up and down											
-											if (ballChangex==0 && rand()%noupdown==0)
-												ballChangex = ballChangex + (-1)^(rand() % 2); 
-										}	
-										// wallcontact 
-										if (wallcontact()) {
-											ballChangex = -ballChangex;
-										}
-									 }
-									 //redraw ball
-									 lcd_draw_image(
-																ballx,                 // X Pos
-																ballWidth,   // Image Horizontal Width
-																bally,                 // Y Pos
-																ballHeight,  // Image Vertical Height
-																ballBitmaps,       // Image
-																LCD_COLOR_RED,      // Foreground Color
-																LCD_COLOR_BLACK     // Background Color
-															);
-								}
-								break;
-//////////////// GRAVITY pong
-							// paddle and paddle slow down in the center and speed up at extremes
-							case 1:
-								// PLAYER MOVEMENT
-								// player 1: touchscreen 
-								// screen goes from 0 to ROWS=320 and 0 to COLS=240
-								if (ft6x06_read_td_status()>0){
-									int x;
-									// hide player1
-									lcd_draw_image(
-															player1x,                 // X Pos
-															playerWidth,   // Image Horizontal Width
-															player1y,                 // Y Pos
-															playerHeight,  // Image Vertical Height
-															playerBitmaps,       // Image
-															LCD_COLOR_BLACK,      // Foreground Color
-															LCD_COLOR_BLACK     // Background Color
-														);
-									x = ft6x06_read_x();
-									if ((COLS/2)-player1x>0) // left side
-									{
-										if (player1x-x>0) // move left
-											player1x = player1x-(((COLS/2)-player1x)/10 + 1);
-										else // (x-player1x>0) move right
-											player1x = player1x+(((COLS/2)-player1x)/10 + 1);
-										// wall cutoffs
-										if (player1x<0+playerWidth/2)
-											player1x = playerWidth/2;
-										if (player1x>COLS-playerWidth/2)
-											player1x = COLS-playerWidth/2;
-									}
-									else { // right side
-										if (player1x-x>0) // move left
-											player1x = player1x-((player1x-(COLS/2))/10 + 1);
-										else // (x-player1x>0) move right
-											player1x = player1x+((player1x-(COLS/2))/10 + 1);
-										// wall cutoffs
-										if (player1x<0+playerWidth/2)
-											player1x = playerWidth/2;
-										if (player1x>COLS-playerWidth/2)
-											player1x = COLS-playerWidth/2;
-									}
-									
-									// redraw player1
-									lcd_draw_image(
-															player1x,                 // X Pos
-															playerWidth,   // Image Horizontal Width
-															player1y,                 // Y Pos
-															playerHeight,  // Image Vertical Height
-															playerBitmaps,       // Image
-															LCD_COLOR_BLUE,      // Foreground Color
-															LCD_COLOR_BLACK     // Background Color
-														);
-								}
-								
-								
-								// player 2: joystick
-								// joystick_y and joystick_x from 000 to FFF
-								if (direction!=0){
-									// hide player2
-									lcd_draw_image(
-																player2x,                 // X Pos
-																playerWidth,   // Image Horizontal Width
-																player2y,                 // Y Pos
-																playerHeight,  // Image Vertical Height
-																playerBitmaps,       // Image
-																LCD_COLOR_BLACK,      // Foreground Color
-																LCD_COLOR_BLACK     // Background Color
-															);
-									
-									if ((COLS/2)-player2x>0) // left side
-									{
-										if (direction==2) { // move left  
-											player2x = player2x-(((COLS/2)-player2x)/10 + 1);
-											// wall cutoffs
-											if (player2x<0+playerWidth/2)
-												player2x = playerWidth/2;
-										}
-										else if (direction==4) { // move right
-											player2x = player2x+(((COLS/2)-player2x)/10 + 1);
-											// wall cutoffs
-											if (player2x>COLS-playerWidth/2)
-												player2x = COLS-playerWidth/2;
-										}
-									}
-									else { // right side										if (player1x-x>0) // move left
-											if (direction==2) { // move left  
-												player2x = player2x-((player2x-(COLS/2))/10 + 1);
-												// wall cutoffs
-												if (player2x<0+playerWidth/2)
-													player2x = playerWidth/2;
-												}
-											else if (direction==4) { // move right
-												player2x = player2x+((player2x-(COLS/2))/10 + 1);
-												// wall cutoffs
-												if (player2x>COLS-playerWidth/2)
-													player2x = COLS-playerWidth/2;
-											}
-									}
-									
-									// redraw player2
-									lcd_draw_image(
-																player2x,                 // X Pos
-																playerWidth,   // Image Horizontal Width
-																player2y,                 // Y Pos
-																playerHeight,  // Image Vertical Height
-																playerBitmaps,       // Image
-																LCD_COLOR_BLUE,      // Foreground Color
-																LCD_COLOR_BLACK     // Background Color
-															);
-								}
-								
-								// BALL MOVEMENT
-								delayWaitFunction();
-								if (!ballWait) {
-									// hide ball
-									lcd_draw_image(
-															ballx,                 // X Pos
-															ballWidth,   // Image Horizontal Width
-															bally,                 // Y Pos
-															ballHeight,  // Image Vertical Height
-															ballBitmaps,       // Image
-															LCD_COLOR_BLACK,      // Foreground Color
-															LCD_COLOR_BLACK     // Background Color
-														);
-									ballx = ballx+ballChangex;
-									if (bally==ROWS/2) // middle
-										bally = bally+(ballChangey>0 ? 1 : -1);
-									else if (bally>ROWS/2) { // bottom half 
-										if (ballChangey>0)
-											bally = bally+(ballChangey/((bally-(ROWS/2))/40))+1;
-										else
-											bally = bally+(ballChangey/((bally-(ROWS/2))/40))-1;
-									}
-									else {// top half
-										if (ballChangey>0)
-											bally = bally+(ballChangey/(((ROWS/2)-bally)/40))+1;
-										else
-											bally = bally+(ballChangey/(((ROWS/2)-bally)/40))-1;
-									}
-									// player 1 point
-									if (bally>ROWS-ballHeight){
-											// point
-											player1score = player1score+1;
-											// write score to EEPROM
-											eeprom_byte_write(I2C1_BASE,addrPlayer1Score, player1score);
-											if (player1score>=winScore) {
-												// delay here for the loser to realize they've just lost and freeze frame that moment
-												waitLoser = 1;	
-												lcd_draw_image(
-															ballx,                 // X Pos
-															ballWidth,   // Image Horizontal Width
-															bally,                 // Y Pos
-															ballHeight,  // Image Vertical Height
-															ballBitmaps,       // Image
-															LCD_COLOR_RED,      // Foreground Color
-															LCD_COLOR_BLACK     // Background Color
-														);
-												break;
-											}
-											
-											// redraw score
-											drawScore();
-											// reset ball and wait for a bit
-											ballx = COLS/2;
-											bally = ROWS/2;
-											// randomize
-											randomizeBall();
-											
-											// wait for players to reset
-											ballWait = 1; 
-									}
-									// player 2 point
-									else if (bally<ballHeight){
-											// point
-											player2score = player2score+1;
-											// write score to EEPROM
-											eeprom_byte_write(I2C1_BASE,addrPlayer2Score, player2score);
-						
-											if (player2score>=winScore) {
-												// delay here for the loser to realize they've just lost and freeze frame that moment
-												waitLoser = 1;	
-												lcd_draw_image(
-															ballx,                 // X Pos
-															ballWidth,   // Image Horizontal Width
-															bally,                 // Y Pos
-															ballHeight,  // Image Vertical Height
-															ballBitmaps,       // Image
-															LCD_COLOR_RED,      // Foreground Color
-															LCD_COLOR_BLACK     // Background Color
-														);
-												break;
-											}
-											
-											// redraw score
-											drawScore();
-											// reset ball and wait for a bit
-											ballx = COLS/2;
-											bally = ROWS/2;
-											// randomize
-											randomizeBall();
-											
-											// wait for players to reset
-											ballWait = 1; 
-									}
-									else {
-										// player contact 
-										if (playercontact()) {
-											ballChangey = -ballChangey;
-											// for each player contact, randomly change the changex by a bit so not an infinite loop of up and down											
-											if (ballChangex==0 && rand()%noupdown==0)
-												ballChangex = ballChangex + (-1)^(rand() % 2); 
-										}	
-										// wallcontact 
-										if (wallcontact()) {
-											ballChangex = -ballChangex;
-										}
-									 }
-									 //redraw ball
-									 lcd_draw_image(
-																ballx,                 // X Pos
-																ballWidth,   // Image Horizontal Width
-																bally,                 // Y Pos
-																ballHeight,  // Image Vertical Height
-																ballBitmaps,       // Image
-																LCD_COLOR_RED,      // Foreground Color
-																LCD_COLOR_BLACK     // Background Color
-															);
-								}
-								break;
-//////////////// heisenberg pong
-							// can see paddle or ball but not both
-							case 2:
-								// required at the start for blink boolean to be equal for paddles and ball
-								delayWaitFunction();
-							
-								// PLAYER MOVEMENT
-								// player 1: touchscreen 
-								// screen goes from 0 to ROWS=320 and 0 to COLS=240
-								if (ft6x06_read_td_status()>0){
-									int x;
-									// hide player1
-									lcd_draw_image(
-															player1x,                 // X Pos
-															playerWidth,   // Image Horizontal Width
-															player1y,                 // Y Pos
-															playerHeight,  // Image Vertical Height
-															playerBitmaps,       // Image
-															LCD_COLOR_BLACK,      // Foreground Color
-															LCD_COLOR_BLACK     // Background Color
-														);
-									x = ft6x06_read_x();
-									if (player1x-x>maxSpeed)
-										player1x = player1x-maxSpeed;
-									else if (x-player1x>maxSpeed)
-										player1x = player1x+maxSpeed;
-									else
-										player1x = x;
-									
-									// maybe redraw player1 
-									if (!heisenbergBlinking) {
-											lcd_draw_image(
-															player1x,                 // X Pos
-															playerWidth,   // Image Horizontal Width
-															player1y,                 // Y Pos
-															playerHeight,  // Image Vertical Height
-															playerBitmaps,       // Image
-															LCD_COLOR_BLUE,      // Foreground Color
-															LCD_COLOR_BLACK     // Background Color
-														);
-									}
-								}
-								// player 1 not moving
-								else {
-									if (heisenbergBlinking) {
-										// hide player1
-										lcd_draw_image(
-															player1x,                 // X Pos
-															playerWidth,   // Image Horizontal Width
-															player1y,                 // Y Pos
-															playerHeight,  // Image Vertical Height
-															playerBitmaps,       // Image
-															LCD_COLOR_BLACK,      // Foreground Color
-															LCD_COLOR_BLACK     // Background Color
-														);
-									}
-									else {
-										lcd_draw_image(
-															player1x,                 // X Pos
-															playerWidth,   // Image Horizontal Width
-															player1y,                 // Y Pos
-															playerHeight,  // Image Vertical Height
-															playerBitmaps,       // Image
-															LCD_COLOR_BLUE,      // Foreground Color
-															LCD_COLOR_BLACK     // Background Color
-														);
-									}
-								}
-								
-								
-								// player 2: joystick
-								// joystick_y and joystick_x from 000 to FFF
-								if (direction!=0){
-									// hide player2
-									lcd_draw_image(
-																player2x,                 // X Pos
-																playerWidth,   // Image Horizontal Width
-																player2y,                 // Y Pos
-																playerHeight,  // Image Vertical Height
-																playerBitmaps,       // Image
-																LCD_COLOR_BLACK,      // Foreground Color
-																LCD_COLOR_BLACK     // Background Color
-															);
-									if (direction==2) { // left  
-										player2x = player2x-maxSpeed;
-										// wall cutoffs
-										if (player2x<0+playerWidth/2)
-											player2x = player2x+maxSpeed;
-									}
-									else if (direction==4) { // right
-										player2x = player2x+maxSpeed;
-										// wall cutoffs
-										if (player2x>COLS-playerWidth/2)
-											player2x = player2x-maxSpeed;
-									}
-									
-									// maybe redraw player2
-									if (!heisenbergBlinking){
-										lcd_draw_image(
-																player2x,                 // X Pos
-																playerWidth,   // Image Horizontal Width
-																player2y,                 // Y Pos
-																playerHeight,  // Image Vertical Height
-																playerBitmaps,       // Image
-																LCD_COLOR_BLUE,      // Foreground Color
-																LCD_COLOR_BLACK     // Background Color
-															);
-									}
-								}
-								// player 2 not moving
-								else {
-									if (heisenbergBlinking){
-										// hide player2
-										lcd_draw_image(
-																player2x,                 // X Pos
-																playerWidth,   // Image Horizontal Width
-																player2y,                 // Y Pos
-																playerHeight,  // Image Vertical Height
-																playerBitmaps,       // Image
-																LCD_COLOR_BLACK,      // Foreground Color
-																LCD_COLOR_BLACK     // Background Color
-															);
-									}
-									else {
-										lcd_draw_image(
-																player2x,                 // X Pos
-																playerWidth,   // Image Horizontal Width
-																player2y,                 // Y Pos
-																playerHeight,  // Image Vertical Height
-																playerBitmaps,       // Image
-																LCD_COLOR_BLUE,      // Foreground Color
-																LCD_COLOR_BLACK     // Background Color
-															);
-									}
-								}
-								
-								// BALL MOVEMENT
-								if (!ballWait) {
-									// hide ball
-									lcd_draw_image(
-															ballx,                 // X Pos
-															ballWidth,   // Image Horizontal Width
-															bally,                 // Y Pos
-															ballHeight,  // Image Vertical Height
-															ballBitmaps,       // Image
-															LCD_COLOR_BLACK,      // Foreground Color
-															LCD_COLOR_BLACK     // Background Color
-														);
-									ballx = ballx+ballChangex;
-									bally = bally+ballChangey;
-									// player 1 point
-									if (bally>ROWS-ballHeight){
-											// point
-											player1score = player1score+1;
-											// write score to EEPROM
-											eeprom_byte_write(I2C1_BASE,addrPlayer1Score, player1score);
-											if (player1score>=winScore) {
-												// delay here for the loser to realize they've just lost and freeze frame that moment
-												waitLoser = 1;	
-												lcd_draw_image(
-															ballx,                 // X Pos
-															ballWidth,   // Image Horizontal Width
-															bally,                 // Y Pos
-															ballHeight,  // Image Vertical Height
-															ballBitmaps,       // Image
-															LCD_COLOR_RED,      // Foreground Color
-															LCD_COLOR_BLACK     // Background Color
-														);
-												break;
-											}
-											
-											// redraw score
-											drawScore();
-											// reset ball and wait for a bit
-											ballx = COLS/2;
-											bally = ROWS/2;
-											// randomize
-											randomizeBall();
-											
-											// wait for players to reset
-											ballWait = 1; 
-									}
-									// player 2 point
-									else if (bally<ballHeight){
-											// point
-											player2score = player2score+1;
-											// write score to EEPROM
-											eeprom_byte_write(I2C1_BASE,addrPlayer2Score, player2score);
-						
-											if (player2score>=winScore) {
-												// delay here for the loser to realize they've just lost and freeze frame that moment
-												waitLoser = 1;	
-												lcd_draw_image(
-															ballx,                 // X Pos
-															ballWidth,   // Image Horizontal Width
-															bally,                 // Y Pos
-															ballHeight,  // Image Vertical Height
-															ballBitmaps,       // Image
-															LCD_COLOR_RED,      // Foreground Color
-															LCD_COLOR_BLACK     // Background Color
-														);
-												break;
-											}
-											
-											// redraw score
-											drawScore();
-											// reset ball and wait for a bit
-											ballx = COLS/2;
-											bally = ROWS/2;
-											// randomize
-											randomizeBall();
-											
-											// wait for players to reset
-											ballWait = 1; 
-									}
-									else {
-										// player contact 
-										if (playercontact()) {
-											ballChangey = -ballChangey;
-											// for each player contact, randomly change the changex by a bit so not an infinite loop of up and down											
-											if (ballChangex==0 && rand()%noupdown==0)
-												ballChangex = ballChangex + (-1)^(rand() % 2); 
-										}	
-										// wallcontact 
-										if (wallcontact()) {
-											ballChangex = -ballChangex;
-										}
-									 }
-									 // maybe redraw ball
-									 if (heisenbergBlinking){
-										 lcd_draw_image(
-																ballx,                 // X Pos
-																ballWidth,   // Image Horizontal Width
-																bally,                 // Y Pos
-																ballHeight,  // Image Vertical Height
-																ballBitmaps,       // Image
-																LCD_COLOR_RED,      // Foreground Color
-																LCD_COLOR_BLACK     // Background Color
-															);
-									 }
-								}
-								// ball not moving
-								else {
-									if (!heisenbergBlinking){
-										// hide ball
-										lcd_draw_image(
-															ballx,                 // X Pos
-															ballWidth,   // Image Horizontal Width
-															bally,                 // Y Pos
-															ballHeight,  // Image Vertical Height
-															ballBitmaps,       // Image
-															LCD_COLOR_BLACK,      // Foreground Color
-															LCD_COLOR_BLACK     // Background Color
-														);
-									}
-									else {
-										lcd_draw_image(
-																ballx,                 // X Pos
-																ballWidth,   // Image Horizontal Width
-																bally,                 // Y Pos
-																ballHeight,  // Image Vertical Height
-																ballBitmaps,       // Image
-																LCD_COLOR_RED,      // Foreground Color
-																LCD_COLOR_BLACK     // Background Color
-															);
-									}
-								}
-								 break;
-//////////////// weird controls pong
-							// accelerometer vs buttons
-							case 3:
-								// PLAYER MOVEMENT
-								// player 1: accelerometer 
-								// screen goes from 0 to ROWS=320 and 0 to COLS=240
-								accelX = accel_read_x();
-								if (accelX>accelSensitivity | accelX<-accelSensitivity){
-									// hide player1
-									lcd_draw_image(
-															player1x,                 // X Pos
-															playerWidth,   // Image Horizontal Width
-															player1y,                 // Y Pos
-															playerHeight,  // Image Vertical Height
-															playerBitmaps,       // Image
-															LCD_COLOR_BLACK,      // Foreground Color
-															LCD_COLOR_BLACK     // Background Color
-														);
-									
-									if (accelX>accelSensitivity){
-										player1x = player1x-maxSpeed;
-										// wall cutoffs
-										if (player1x<0+playerWidth/2)
-											player1x = player1x+maxSpeed;
-									}
-									else {// accelX<-accelSensitivity
-										player1x = player1x+maxSpeed;
-										// wall cutoffs
-										if (player1x>COLS-playerWidth/2)
-											player1x = player1x-maxSpeed;
-									}
-									
-									// redraw player1
-									lcd_draw_image(
-															player1x,                 // X Pos
-															playerWidth,   // Image Horizontal Width
-															player1y,                 // Y Pos
-															playerHeight,  // Image Vertical Height
-															playerBitmaps,       // Image
-															LCD_COLOR_BLUE,      // Foreground Color
-															LCD_COLOR_BLACK     // Background Color
-														);
-								}
-								
-								
-								// player 2: IO buttons
-								if (ioButtonLeft|ioButtonRight){
-									// hide player2
-									lcd_draw_image(
-																player2x,                 // X Pos
-																playerWidth,   // Image Horizontal Width
-																player2y,                 // Y Pos
-																playerHeight,  // Image Vertical Height
-																playerBitmaps,       // Image
-																LCD_COLOR_BLACK,      // Foreground Color
-																LCD_COLOR_BLACK     // Background Color
-															);
-									if (ioButtonLeft) { // left  
-										player2x = player2x-maxSpeed;
-										// wall cutoffs
-										if (player2x<0+playerWidth/2)
-											player2x = player2x+maxSpeed;
-									}
-									if (ioButtonRight) { // right
-										player2x = player2x+maxSpeed;
-										// wall cutoffs
-										if (player2x>COLS-playerWidth/2)
-											player2x = player2x-maxSpeed;
-									}
-									
-									// redraw player2
-									lcd_draw_image(
-																player2x,                 // X Pos
-																playerWidth,   // Image Horizontal Width
-																player2y,                 // Y Pos
-																playerHeight,  // Image Vertical Height
-																playerBitmaps,       // Image
-																LCD_COLOR_BLUE,      // Foreground Color
-																LCD_COLOR_BLACK     // Background Color
-															);
-								}
-								
-								// BALL MOVEMENT
-								delayWaitFunction();
-								if (!ballWait) {
-									// hide ball
-									lcd_draw_image(
-															ballx,                 // X Pos
-															ballWidth,   // Image Horizontal Width
-															bally,                 // Y Pos
-															ballHeight,  // Image Vertical Height
-															ballBitmaps,       // Image
-															LCD_COLOR_BLACK,      // Foreground Color
-															LCD_COLOR_BLACK     // Background Color
-														);
-									ballx = ballx+ballChangex;
-									bally = bally+ballChangey;
-									// player 1 point
-									if (bally>ROWS-ballHeight){
-											// point
-											player1score = player1score+1;
-											// write score to EEPROM
-											eeprom_byte_write(I2C1_BASE,addrPlayer1Score, player1score);
-											if (player1score>=winScore) {
-												// delay here for the loser to realize they've just lost and freeze frame that moment
-												waitLoser = 1;	
-												lcd_draw_image(
-															ballx,                 // X Pos
-															ballWidth,   // Image Horizontal Width
-															bally,                 // Y Pos
-															ballHeight,  // Image Vertical Height
-															ballBitmaps,       // Image
-															LCD_COLOR_RED,      // Foreground Color
-															LCD_COLOR_BLACK     // Background Color
-														);
-												break;
-											}
-											
-											// redraw score
-											drawScore();
-											// reset ball and wait for a bit
-											ballx = COLS/2;
-											bally = ROWS/2;
-											// randomize
-											randomizeBall();
-											
-											// wait for players to reset
-											ballWait = 1; 
-									}
-									// player 2 point
-									else if (bally<ballHeight){
-											// point
-											player2score = player2score+1;
-											// write score to EEPROM
-											eeprom_byte_write(I2C1_BASE,addrPlayer2Score, player2score);
-						
-											if (player2score>=winScore) {
-												// delay here for the loser to realize they've just lost and freeze frame that moment
-												waitLoser = 1;	
-												lcd_draw_image(
-															ballx,                 // X Pos
-															ballWidth,   // Image Horizontal Width
-															bally,                 // Y Pos
-															ballHeight,  // Image Vertical Height
-															ballBitmaps,       // Image
-															LCD_COLOR_RED,      // Foreground Color
-															LCD_COLOR_BLACK     // Background Color
-														);
-												break;
-											}
-											
-											// redraw score
-											drawScore();
-											// reset ball and wait for a bit
-											ballx = COLS/2;
-											bally = ROWS/2;
-											// randomize
-											randomizeBall();
-											
-											// wait for players to reset
-											ballWait = 1; 
-									}
-									else {
-										// player contact 
-										if (playercontact()) {
-											ballChangey = -ballChangey;
-											// for each player contact, randomly change the changex by a bit so not an infinite loop of up and down											
-											if (ballChangex==0 && rand()%noupdown==0)
-												ballChangex = ballChangex + (-1)^(rand() % 2); 
-										}	
-										// wallcontact 
-										if (wallcontact()) {
-											ballChangex = -ballChangex;
-										}
-									 }
-									 //redraw ball
-									 lcd_draw_image(
-																ballx,                 // X Pos
-																ballWidth,   // Image Horizontal Width
-																bally,                 // Y Pos
-																ballHeight,  // Image Vertical Height
-																ballBitmaps,       // Image
-																LCD_COLOR_RED,      // Foreground Color
-																LCD_COLOR_BLACK     // Background Color
-															);
-								}
-								
-								break;
-//////////////// multi dimensional pong
-							// not just left/right, but up down
-							case 4:
-								// PLAYER MOVEMENT
-								// player 1: touchscreen 
-								// screen goes from 0 to ROWS=320 and 0 to COLS=240
-								if (ft6x06_read_td_status()>0){
-									int x, y;
-									// hide player1
-									lcd_draw_image(
-															player1x,                 // X Pos
-															playerWidth,   // Image Horizontal Width
-															player1y,                 // Y Pos
-															playerHeight,  // Image Vertical Height
-															playerBitmaps,       // Image
-															LCD_COLOR_BLACK,      // Foreground Color
-															LCD_COLOR_BLACK     // Background Color
-														);
-									x = ft6x06_read_x();
-									y = ft6x06_read_y();
-									if (player1x-x>maxSpeed)
-										player1x = player1x-maxSpeed;
-									else if (x-player1x>maxSpeed)
-										player1x = player1x+maxSpeed;
-									else
-										player1x = x;
-									if (player1y-y>maxSpeed)
-										player1y = player1y-maxSpeed;
-									else if (y-player1y>maxSpeed)
-										player1y = player1y+maxSpeed;
-									else
-										player1y = y;
-									
-									// redraw player1
-									lcd_draw_image(
-															player1x,                 // X Pos
-															playerWidth,   // Image Horizontal Width
-															player1y,                 // Y Pos
-															playerHeight,  // Image Vertical Height
-															playerBitmaps,       // Image
-															LCD_COLOR_BLUE,      // Foreground Color
-															LCD_COLOR_BLACK     // Background Color
-														);
-								}
-								
-								
-								// player 2: joystick
-								// joystick_y and joystick_x from 000 to FFF
-								if (direction!=0){
-									// hide player2
-									lcd_draw_image(
-																player2x,                 // X Pos
-																playerWidth,   // Image Horizontal Width
-																player2y,                 // Y Pos
-																playerHeight,  // Image Vertical Height
-																playerBitmaps,       // Image
-																LCD_COLOR_BLACK,      // Foreground Color
-																LCD_COLOR_BLACK     // Background Color
-															);
-									if (direction==2) { // left  
-										player2x = player2x-maxSpeed;
-										// wall cutoffs
-										if (player2x<0+playerWidth/2)
-											player2x = player2x+maxSpeed;
-									}
-									else if (direction==4) { // right
-										player2x = player2x+maxSpeed;
-										// wall cutoffs
-										if (player2x>(COLS-playerWidth/2))
-											player2x = player2x-maxSpeed;
-									}
-									else if (direction==1) { // up
-										player2y = player2y-maxSpeed;
-										// wall cutoffs
-										if (player2y<0+(playerHeight/2))
-											player2y = player2y+maxSpeed;
-									}
-									else if (direction==3) { // down
-										player2y = player2y+maxSpeed;
-										// wall cutoffs
-										if (player2y>(ROWS-(playerHeight/2)))
-											player2y = player2y-maxSpeed;
-									}
-									
-									// redraw player2
-									lcd_draw_image(
-																player2x,                 // X Pos
-																playerWidth,   // Image Horizontal Width
-																player2y,                 // Y Pos
-																playerHeight,  // Image Vertical Height
-																playerBitmaps,       // Image
-																LCD_COLOR_BLUE,      // Foreground Color
-																LCD_COLOR_BLACK     // Background Color
-															);
-								}
-								
-								// BALL MOVEMENT
-								delayWaitFunction();
-								if (!ballWait) {
-									// hide ball
-									lcd_draw_image(
-															ballx,                 // X Pos
-															ballWidth,   // Image Horizontal Width
-															bally,                 // Y Pos
-															ballHeight,  // Image Vertical Height
-															ballBitmaps,       // Image
-															LCD_COLOR_BLACK,      // Foreground Color
-															LCD_COLOR_BLACK     // Background Color
-														);
-									ballx = ballx+ballChangex;
-									bally = bally+ballChangey;
-									// player 1 point
-									if (bally>ROWS-ballHeight){
-											// point
-											player1score = player1score+1;
-											// write score to EEPROM
-											eeprom_byte_write(I2C1_BASE,addrPlayer1Score, player1score);
-											if (player1score>=winScore) {
-												// delay here for the loser to realize they've just lost and freeze frame that moment
-												waitLoser = 1;	
-												lcd_draw_image(
-															ballx,                 // X Pos
-															ballWidth,   // Image Horizontal Width
-															bally,                 // Y Pos
-															ballHeight,  // Image Vertical Height
-															ballBitmaps,       // Image
-															LCD_COLOR_RED,      // Foreground Color
-															LCD_COLOR_BLACK     // Background Color
-														);
-												break;
-											}
-											
-											// redraw score
-											drawScore();
-											// reset players
-											lcd_draw_image(
-															player1x,                 // X Pos
-															playerWidth,   // Image Horizontal Width
-															player1y,                 // Y Pos
-															playerHeight,  // Image Vertical Height
-															playerBitmaps,       // Image
-															LCD_COLOR_BLACK,      // Foreground Color
-															LCD_COLOR_BLACK     // Background Color
-														);
-											lcd_draw_image(
-																player2x,                 // X Pos
-																playerWidth,   // Image Horizontal Width
-																player2y,                 // Y Pos
-																playerHeight,  // Image Vertical Height
-																playerBitmaps,       // Image
-																LCD_COLOR_BLACK,      // Foreground Color
-																LCD_COLOR_BLACK     // Background Color
-															);
-											player1x = (COLS/2);
-											player1y = (ROWS/6);
-											player2x = (COLS/2);
-											player2y = (5*ROWS/6);
-											lcd_draw_image(
-															player1x,                 // X Pos
-															playerWidth,   // Image Horizontal Width
-															player1y,                 // Y Pos
-															playerHeight,  // Image Vertical Height
-															playerBitmaps,       // Image
-															LCD_COLOR_BLUE,      // Foreground Color
-															LCD_COLOR_BLACK     // Background Color
-														);
-											lcd_draw_image(
-															player2x,                 // X Pos
-															playerWidth,   // Image Horizontal Width
-															player2y,                 // Y Pos
-															playerHeight,  // Image Vertical Height
-															playerBitmaps,       // Image
-															LCD_COLOR_BLUE,      // Foreground Color
-															LCD_COLOR_BLACK     // Background Color
-														);
-											// reset ball 
-											ballx = COLS/2;
-											bally = ROWS/2;
-											// randomize
-											randomizeBall();
-											
-											// wait for players to reset
-											ballWait = 1; 
-									}
-									// player 2 point
-									else if (bally<ballHeight){
-											// point
-											player2score = player2score+1;
-											// write score to EEPROM
-											eeprom_byte_write(I2C1_BASE,addrPlayer2Score, player2score);
-						
-											if (player2score>=winScore) {
-												// delay here for the loser to realize they've just lost and freeze frame that moment
-												waitLoser = 1;	
-												lcd_draw_image(
-															ballx,                 // X Pos
-															ballWidth,   // Image Horizontal Width
-															bally,                 // Y Pos
-															ballHeight,  // Image Vertical Height
-															ballBitmaps,       // Image
-															LCD_COLOR_RED,      // Foreground Color
-															LCD_COLOR_BLACK     // Background Color
-														);
-												break;
-											}
-											
-											// redraw score
-											drawScore();
-											// reset players
-											lcd_draw_image(
-															player1x,                 // X Pos
-															playerWidth,   // Image Horizontal Width
-															player1y,                 // Y Pos
-															playerHeight,  // Image Vertical Height
-															playerBitmaps,       // Image
-															LCD_COLOR_BLACK,      // Foreground Color
-															LCD_COLOR_BLACK     // Background Color
-														);
-											lcd_draw_image(
-																player2x,                 // X Pos
-																playerWidth,   // Image Horizontal Width
-																player2y,                 // Y Pos
-																playerHeight,  // Image Vertical Height
-																playerBitmaps,       // Image
-																LCD_COLOR_BLACK,      // Foreground Color
-																LCD_COLOR_BLACK     // Background Color
-															);
-											player1x = (COLS/2);
-											player1y = (ROWS/6);
-											player2x = (COLS/2);
-											player2y = (5*ROWS/6);
-											lcd_draw_image(
-															player1x,                 // X Pos
-															playerWidth,   // Image Horizontal Width
-															player1y,                 // Y Pos
-															playerHeight,  // Image Vertical Height
-															playerBitmaps,       // Image
-															LCD_COLOR_BLUE,      // Foreground Color
-															LCD_COLOR_BLACK     // Background Color
-														);
-											lcd_draw_image(
-															player2x,                 // X Pos
-															playerWidth,   // Image Horizontal Width
-															player2y,                 // Y Pos
-															playerHeight,  // Image Vertical Height
-															playerBitmaps,       // Image
-															LCD_COLOR_BLUE,      // Foreground Color
-															LCD_COLOR_BLACK     // Background Color
-														);
-											// reset ball and wait for a bit
-											ballx = COLS/2;
-											bally = ROWS/2;
-											// randomize
-											randomizeBall();
-											
-											// wait for players to reset
-											ballWait = 1; 
-									}
-									else {
-										// player contact 
-										if (playercontact()) {
-											ballChangey = -ballChangey;
-											// for each player contact, randomly change the changex by a bit so not an infinite loop of up and down											
-											if (ballChangex==0 && rand()%noupdown==0)
-												ballChangex = ballChangex + (-1)^(rand() % 2); 
-										}	
-										// wallcontact 
-										if (wallcontact()) {
-											ballChangex = -ballChangex;
-										}
-									 }
-									 //redraw ball
-									 lcd_draw_image(
-																ballx,                 // X Pos
-																ballWidth,   // Image Horizontal Width
-																bally,                 // Y Pos
-																ballHeight,  // Image Vertical Height
-																ballBitmaps,       // Image
-																LCD_COLOR_RED,      // Foreground Color
-																LCD_COLOR_BLACK     // Background Color
-															);
-								}
-
-								break;
-							// possible future gamemodes
-							// multiple ball pong
-							// powerup pong
-							// colorful craziness pong
-							// run from chasing ball
-							// keep ball from touching wall
-							// pong where the old images aren't hidden (so laggy window being dragged around pong or slurred pong), screen only cleared on point
-							// random game mode
-							default:
-								gamemode = 0; // set to regular pong if error value
-								break;
-						} 
-						}
-		}
-	};
-	// freeze screen at the end, blink LEDs
-	while (1) {
-		// blink LEDs
-		delayWaitFunction();
-		if (heisenbergBlinking){
-			// turn all on
-			io_expander_write_reg(MCP23017_GPIOA_R, 0xFF);
-		}
-		else {
-			// turn all off
-			io_expander_write_reg(MCP23017_GPIOA_R, 0x00);
-		}
-		
-	}
-}
+// Copyright (c) 2015-19, Joe Krachey
+// All rights reserved.
+//
+// Redistribution and use in source or binary form, with or without modification, 
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions in source form must reproduce the above copyright 
+//    notice, this list of conditions and the following disclaimer in 
+//    the documentation and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" 
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR 
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR 
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, 
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, 
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; 
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING 
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, 
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+// By:
+// Kunal Waghray
+// Christian Henke
+
+#include "main.h"
+// for randomization
+#include <stdlib.h>
+
+// joystick variables
+volatile uint32_t direction;
+bool movingJoystick;
+
+// global variables
+bool menu;
+uint8_t gamemode;
+uint8_t player1score;
+uint8_t player2score;
+uint8_t randomSeed;
+volatile int ballWait;
+volatile int waitLoser;
+volatile bool heisenbergBlinking;
+volatile bool AlertTimerDelay;
+volatile bool AlertGameTick;
+volatile bool ioButtonLeft = false;
+volatile bool ioButtonRight = false;
+// sw1 button debounce
+volatile bool AlertTimer4;
+// match statistics
+uint16_t rallyHits;
+uint16_t longestRally;
+uint32_t matchTicks;
+// regular pong is being played against another board
+bool netplayMatch;
+// game tick timing of the match being played, in microseconds
+uint64_t tickStart;
+uint32_t tickMaxInterval;
+uint32_t tickMaxWork;
+uint32_t ticksLate;
+uint32_t inputMaxAge;
+// LED strip frames and their compose cost since the last match ended
+uint32_t ledFrames;
+uint32_t ledComposeCycles;
+uint32_t ledComposeMax;
+
+
+// this is mostly for info, hence const
+const int GAMEMODES = 5;
+const int gameSpeed = 20;
+const int maxScoreWidth = 30;
+const int maxScoreHeight = 20;
+const int statsBarWidth = 200;
+const int statsBarHeight = 6;
+
+// game balance, these can be changed from the serial console
+int maxSpeed = 10;
+int ballMaxSpeed = 5;
+int winScore = 10;
+int heisenbergBlinkTime = 30; // in 10ms
+int accelTiltDeadZone = 2; // in degrees
+int accelTiltFullSpeed = 20; // in degrees
+int noupdown = 10;
+int joystickDeadZone = INPUT_DEAD_ZONE;
+int joystickCurve = INPUT_CURVE_PERCENT;
+int networkPlayer = 0; // 1 or 2 plays regular pong against another board as that player
+int ledBrightness = 64; // of the WS2812B strip, 255 is full
+
+// x and y of the center of the object
+int player1x;
+int player1y;
+int player2x;
+int player2y;
+int ballx;
+int bally;
+int ballChangex; // speed
+int ballChangey; // speed
+
+// used for many calculations, initalized in main using images.c values
+int playerWidth;
+int playerHeight; 
+int ballWidth; 
+int ballHeight;
+
+
+// Debounce the SW1 button using the timer4 ISR
+bool sw1_debounce(void)
+{
+  // this function is constantly called
+	bool pin_logic_level;
+	static int debounceCount = 0;
+	
+	// every 20ms
+	if (AlertTimer4) {
+		// read the SW1 button
+		pin_logic_level = lp_io_read_pin(SW1_BIT);
+		// if unpressed
+		if (pin_logic_level) {
+				debounceCount = 0; // reset
+		}
+		else { // active low
+				// count to debounce
+				if (debounceCount<10)
+					debounceCount++;
+				
+		}
+		// acknowledge interrupt
+		AlertTimer4 = false;
+		// guarantee 1 debounced button signal
+		return debounceCount==7;
+	}
+	else 
+		return false;
+}
+
+// this function called constantly
+void delayWaitFunction(void) 
+{
+	// local variables with only one initialization
+	static int i = 0;
+	static int j = 0;
+	static bool ballWaiting = false;
+	static bool waitingLoser = false;
+	static int blinking = 0;
+	
+	// every 10ms
+	if (AlertTimerDelay){
+			// delay after a point
+			if (ballWait && !ballWaiting){
+					i = 0;
+					ballWaiting = true;
+			}
+			if (ballWaiting) {
+					i++;
+					// a second has been waited
+					if (i>100){
+						ballWait = 0;
+						i = 0;
+						ballWaiting = false;
+					}
+			}
+			
+			// delay after game won 
+			if (waitLoser && !waitingLoser) {
+				j = 0;
+				waitingLoser = true;
+			}
+			if (waitingLoser){
+				j++;
+				if (j>100) {
+					j = 0;
+					waitLoser = 0;
+					waitingLoser = false;
+				}
+			}
+			// every 0.5 seconds switch
+			blinking++;
+			if (blinking>2*heisenbergBlinkTime) blinking = 0;
+			heisenbergBlinking = blinking<heisenbergBlinkTime;
+			
+			// acknowledge interrupt
+			AlertTimerDelay = false;
+	}
+}
+
+// this function sets the game speed
+bool gameTick(void) 
+{
+	uint64_t now;
+	uint32_t interval;
+	
+	if (AlertGameTick){
+			// acknowledge interrupt
+			AlertGameTick = false;
+			// time since the previous tick was picked up, late when the main
+			// loop was held up for half a tick or more
+			now = timebase_now();
+			if (tickStart) {
+				interval = timebase_to_us(now-tickStart);
+				if (interval>tickMaxInterval)
+					tickMaxInterval = interval;
+				if (interval>=gameSpeed*1500)
+					ticksLate++;
+			}
+			tickStart = now;
+			return true;
+	}
+	return false;
+}
+
+// a game tick has been played, records how long it took
+void gameTickDone(void)
+{
+	uint32_t work = timebase_to_us(timebase_now()-tickStart);
+	
+	if (work>tickMaxWork)
+		tickMaxWork = work;
+	if (input_sample_age_us()>inputMaxAge)
+		inputMaxAge = input_sample_age_us();
+}
+
+
+// draws the player 1 (cyan) vs player 2 (magenta) share of the wins 
+// in the selected gamemode as a bar along the bottom of the screen
+void drawModeStats(void)
+{
+	const match_db_mode_stats_t *stats = match_db_mode_stats(gamemode);
+	uint32_t wins;
+	uint32_t split;
+	uint16_t i, j;
+	
+	if (stats==NULL)
+		return;
+	wins = stats->p1Wins + stats->p2Wins;
+	if (wins==0)
+		return;
+	split = (statsBarWidth * stats->p1Wins) / wins;
+	
+	lcd_set_pos((COLS-statsBarWidth)/2, (COLS+statsBarWidth)/2 - 1, ROWS-2*statsBarHeight, ROWS-statsBarHeight - 1);
+	for (i=0; i<statsBarHeight; i++) {
+		for (j=0; j<statsBarWidth; j++) {
+			lcd_write_data_u16(j<split ? LCD_COLOR_CYAN : LCD_COLOR_MAGENTA);
+		}
+	}
+}
+
+// based on the global variables, draw the menu
+void drawMenu(void)
+{
+	// hide old menu choice
+	lcd_clear_screen(LCD_COLOR_BLACK);
+	
+	// draw menu choices:
+	switch(gamemode) {
+		case 0: 
+			// middle (current option)
+			lcd_draw_image(
+											(COLS/2),                 // X Pos
+											mode0WidthPixels,   // Image Horizontal Width
+											(ROWS/2),                 // Y Pos
+											mode0HeightPixels,  // Image Vertical Height
+											mode0Bitmaps,       // Image
+											LCD_COLOR_GREEN,      // Foreground Color
+											LCD_COLOR_BLACK     // Background Color
+										);
+			// above option
+			lcd_draw_image(
+											(COLS/2),                 // X Pos
+											mode5WidthPixels,   // Image Horizontal Width
+											((ROWS/2)/2),                 // Y Pos
+											mode5HeightPixels,  // Image Vertical Height
+											mode5Bitmaps,       // Image
+											LCD_COLOR_GREEN2,      // Foreground Color
+											LCD_COLOR_BLACK     // Background Color
+										);
+			// below option
+			lcd_draw_image(
+											(COLS/2),                 // X Pos
+											mode1WidthPixels,   // Image Horizontal Width
+											(3*(ROWS/2)/2),                 // Y Pos
+											mode1HeightPixels,  // Image Vertical Height
+											mode1Bitmaps,       // Image
+											LCD_COLOR_GREEN2,      // Foreground Color
+											LCD_COLOR_BLACK     // Background Color
+										);
+			break;
+		case 1: 
+			// middle (current option)
+			lcd_draw_image(
+											(COLS/2),                 // X Pos
+											mode1WidthPixels,   // Image Horizontal Width
+											(ROWS/2),                 // Y Pos
+											mode1HeightPixels,  // Image Vertical Height
+											mode1Bitmaps,       // Image
+											LCD_COLOR_GREEN,      // Foreground Color
+											LCD_COLOR_BLACK     // Background Color
+										);
+			// above option
+			lcd_draw_image(
+											(COLS/2),                 // X Pos
+											mode0WidthPixels,   // Image Horizontal Width
+											((ROWS/2)/2),                 // Y Pos
+											mode0HeightPixels,  // Image Vertical Height
+											mode0Bitmaps,       // Image
+											LCD_COLOR_GREEN2,      // Foreground Color
+											LCD_COLOR_BLACK     // Background Color
+										);
+			// below option
+			lcd_draw_image(
+											(COLS/2),                 // X Pos
+											mode2WidthPixels,   // Image Horizontal Width
+											(3*(ROWS/2)/2),                 // Y Pos
+											mode2HeightPixels,  // Image Vertical Height
+											mode2Bitmaps,       // Image
+											LCD_COLOR_GREEN2,      // Foreground Color
+											LCD_COLOR_BLACK     // Background Color
+										);
+			break;
+		case 2: 
+			// middle (current option)
+			lcd_draw_image(
+											(COLS/2),                 // X Pos
+											mode2WidthPixels,   // Image Horizontal Width
+											(ROWS/2),                 // Y Pos
+											mode2HeightPixels,  // Image Vertical Height
+											mode2Bitmaps,       // Image
+											LCD_COLOR_GREEN,      // Foreground Color
+											LCD_COLOR_BLACK     // Background Color
+										);
+			// above option
+			lcd_draw_image(
+											(COLS/2),                 // X Pos
+											mode1WidthPixels,   // Image Horizontal Width
+											((ROWS/2)/2),                 // Y Pos
+											mode1HeightPixels,  // Image Vertical Height
+											mode1Bitmaps,       // Image
+											LCD_COLOR_GREEN2,      // Foreground Color
+											LCD_COLOR_BLACK     // Background Color
+										);
+			// below option
+			lcd_draw_image(
+											(COLS/2),                 // X Pos
+											mode3WidthPixels,   // Image Horizontal Width
+											(3*(ROWS/2)/2),                 // Y Pos
+											mode3HeightPixels,  // Image Vertical Height
+											mode3Bitmaps,       // Image
+											LCD_COLOR_GREEN2,      // Foreground Color
+											LCD_COLOR_BLACK     // Background Color
+										);
+			break;
+		case 3: 
+			// middle (current option)
+			lcd_draw_image(
+											(COLS/2),                 // X Pos
+											mode3WidthPixels,   // Image Horizontal Width
+											(ROWS/2),                 // Y Pos
+											mode3HeightPixels,  // Image Vertical Height
+											mode3Bitmaps,       // Image
+											LCD_COLOR_GREEN,      // Foreground Color
+											LCD_COLOR_BLACK     // Background Color
+										);
+			// above option
+			lcd_draw_image(
+											(COLS/2),                 // X Pos
+											mode2WidthPixels,   // Image Horizontal Width
+											((ROWS/2)/2),                 // Y Pos
+											mode2HeightPixels,  // Image Vertical Height
+											mode2Bitmaps,       // Image
+											LCD_COLOR_GREEN2,      // Foreground Color
+											LCD_COLOR_BLACK     // Background Color
+										);
+			// below option
+			lcd_draw_image(
+											(COLS/2),                 // X Pos
+											mode4WidthPixels,   // Image Horizontal Width
+											(3*(ROWS/2)/2),                 // Y Pos
+											mode4HeightPixels,  // Image Vertical Height
+											mode4Bitmaps,       // Image
+											LCD_COLOR_GREEN2,      // Foreground Color
+											LCD_COLOR_BLACK     // Background Color
+										);
+			break;
+		case 4: 
+			// middle (current option)
+			lcd_draw_image(
+											(COLS/2),                 // X Pos
+											mode4WidthPixels,   // Image Horizontal Width
+											(ROWS/2),                 // Y Pos
+											mode4HeightPixels,  // Image Vertical Height
+											mode4Bitmaps,       // Image
+											LCD_COLOR_GREEN,      // Foreground Color
+											LCD_COLOR_BLACK     // Background Color
+										);
+			// above option
+			lcd_draw_image(
+											(COLS/2),                 // X Pos
+											mode3WidthPixels,   // Image Horizontal Width
+											((ROWS/2)/2),                 // Y Pos
+											mode3HeightPixels,  // Image Vertical Height
+											mode3Bitmaps,       // Image
+											LCD_COLOR_GREEN2,      // Foreground Color
+											LCD_COLOR_BLACK     // Background Color
+										);
+			// below option
+			lcd_draw_image(
+											(COLS/2),                 // X Pos
+											mode5WidthPixels,   // Image Horizontal Width
+											(3*(ROWS/2)/2),                 // Y Pos
+											mode5HeightPixels,  // Image Vertical Height
+											mode5Bitmaps,       // Image
+											LCD_COLOR_GREEN2,      // Foreground Color
+											LCD_COLOR_BLACK     // Background Color
+										);
+			break;
+		case 5: 
+			// middle (current option)
+			lcd_draw_image(
+											(COLS/2),                 // X Pos
+											mode5WidthPixels,   // Image Horizontal Width
+											(ROWS/2),                 // Y Pos
+											mode5HeightPixels,  // Image Vertical Height
+											mode5Bitmaps,       // Image
+											LCD_COLOR_GREEN,      // Foreground Color
+											LCD_COLOR_BLACK     // Background Color
+										);
+			// above option
+			lcd_draw_image(
+											(COLS/2),                 // X Pos
+											mode4WidthPixels,   // Image Horizontal Width
+											((ROWS/2)/2),                 // Y Pos
+											mode4HeightPixels,  // Image Vertical Height
+											mode4Bitmaps,       // Image
+											LCD_COLOR_GREEN2,      // Foreground Color
+											LCD_COLOR_BLACK     // Background Color
+										);
+			// below option
+			lcd_draw_image(
+											(COLS/2),                 // X Pos
+											mode0WidthPixels,   // Image Horizontal Width
+											(3*(ROWS/2)/2),                 // Y Pos
+											mode0HeightPixels,  // Image Vertical Height
+											mode0Bitmaps,       // Image
+											LCD_COLOR_GREEN2,      // Foreground Color
+											LCD_COLOR_BLACK     // Background Color
+										);
+			break;
+		default:
+			// error
+			lcd_clear_screen(LCD_COLOR_GREEN2);
+			break;
+	}
+	drawModeStats();
+
+		/* 
+		Drawing notes:
+		Top left pixel is 0,0
+		Screen width is COLS
+		Screen height is ROWS
+		images are drawn from the CENTER!!!
+		draw_rectangle_centered draws rectangles from the center
+		*/
+}
+// draw the scores on the side
+void drawScore(void){
+	// max score we can draw
+	if (player1score<10 && player2score<10) {
+		// hide old score
+		lcd_draw_image(				(COLS-5)-maxScoreWidth/2,                 // X Pos
+													maxScoreWidth,   // Image Horizontal Width
+													(ROWS/2) - 1 - maxScoreHeight/2,                 // Y Pos
+													maxScoreHeight,  // Image Vertical Height
+													num0Bitmaps,       // Image
+													LCD_COLOR_BLACK,      // Foreground Color
+													LCD_COLOR_BLACK     // Background Color
+												);
+		lcd_draw_image(				(COLS-5)-maxScoreWidth/2,                 // X Pos
+													maxScoreWidth,   // Image Horizontal Width
+													(ROWS/2) + 1 + maxScoreHeight/2,                 // Y Pos
+													maxScoreHeight,  // Image Vertical Height
+													num0Bitmaps,       // Image
+													LCD_COLOR_BLACK,      // Foreground Color
+													LCD_COLOR_BLACK     // Background Color
+												);
+												
+		switch (player1score) {
+			case 0:
+				lcd_draw_image(		(COLS-5)-num0Width/2,                 // X Pos
+													num0Width,   // Image Horizontal Width
+													(ROWS/2) - 1 - num0Height/2,                 // Y Pos
+													num0Height,  // Image Vertical Height
+													num0Bitmaps,       // Image
+													LCD_COLOR_CYAN,      // Foreground Color
+													LCD_COLOR_BLACK     // Background Color
+												);
+				break;
+			case 1:
+				lcd_draw_image(		(COLS-5)-num1Width/2,                 // X Pos
+													num1Width,   // Image Horizontal Width
+													(ROWS/2) - 1 - num1Height/2,                 // Y Pos
+													num1Height,  // Image Vertical Height
+													num1Bitmaps,       // Image
+													LCD_COLOR_CYAN,      // Foreground Color
+													LCD_COLOR_BLACK     // Background Color
+												);
+				break;
+			case 2:
+				lcd_draw_image(		(COLS-5)-num2Width/2,                 // X Pos
+													num2Width,   // Image Horizontal Width
+													(ROWS/2) - 1 - num2Height/2,                 // Y Pos
+													num2Height,  // Image Vertical Height
+													num2Bitmaps,       // Image
+													LCD_COLOR_CYAN,      // Foreground Color
+													LCD_COLOR_BLACK     // Background Color
+												);
+				break;
+			case 3:
+				lcd_draw_image(		(COLS-5)-num3Width/2,                 // X Pos
+													num1Width,   // Image Horizontal Width
+													(ROWS/2) - 1 - num3Height/2,                 // Y Pos
+													num3Height,  // Image Vertical Height
+													num3Bitmaps,       // Image
+													LCD_COLOR_CYAN,      // Foreground Color
+													LCD_COLOR_BLACK     // Background Color
+												);
+				break;
+			case 4:
+				lcd_draw_image(		(COLS-5)-num4Width/2,                 // X Pos
+													num4Width,   // Image Horizontal Width
+													(ROWS/2) - 1 - num4Height/2,                 // Y Pos
+													num4Height,  // Image Vertical Height
+													num4Bitmaps,       // Image
+													LCD_COLOR_CYAN,      // Foreground Color
+													LCD_COLOR_BLACK     // Background Color
+												);
+				break;
+			case 5:
+				lcd_draw_image(		(COLS-5)-num5Width/2,                 // X Pos
+													num5Width,   // Image Horizontal Width
+													(ROWS/2) - 1 - num5Height/2,                 // Y Pos
+													num5Height,  // Image Vertical Height
+													num5Bitmaps,       // Image
+													LCD_COLOR_CYAN,      // Foreground Color
+													LCD_COLOR_BLACK     // Background Color
+												);
+				break;
+			case 6:
+				lcd_draw_image(		(COLS-5)-num6Width/2,                 // X Pos
+													num6Width,   // Image Horizontal Width
+													(ROWS/2) - 1 - num6Height/2,                 // Y Pos
+													num6Height,  // Image Vertical Height
+													num6Bitmaps,       // Image
+													LCD_COLOR_CYAN,      // Foreground Color
+													LCD_COLOR_BLACK     // Background Color
+												);
+				break;
+			case 7:
+				lcd_draw_image(		(COLS-5)-num7Width/2,                 // X Pos
+													num7Width,   // Image Horizontal Width
+													(ROWS/2) - 1 - num7Height/2,                 // Y Pos
+													num7Height,  // Image Vertical Height
+													num7Bitmaps,       // Image
+													LCD_COLOR_CYAN,      // Foreground Color
+													LCD_COLOR_BLACK     // Background Color
+												);
+				break;
+			case 8:
+				lcd_draw_image(		(COLS-5)-num8Width/2,                 // X Pos
+													num8Width,   // Image Horizontal Width
+													(ROWS/2) - 1 - num8Height/2,                 // Y Pos
+													num8Height,  // Image Vertical Height
+													num8Bitmaps,       // Image
+													LCD_COLOR_CYAN,      // Foreground Color
+													LCD_COLOR_BLACK     // Background Color
+												);
+				break;
+			case 9:
+				lcd_draw_image(		(COLS-5)-num9Width/2,                 // X Pos
+													num9Width,   // Image Horizontal Width
+													(ROWS/2) - 1 - num9Height/2,                 // Y Pos
+													num9Height,  // Image Vertical Height
+													num9Bitmaps,       // Image
+													LCD_COLOR_CYAN,      // Foreground Color
+													LCD_COLOR_BLACK     // Background Color
+												);
+				break;
+			default: //error
+				lcd_clear_screen(LCD_COLOR_GREEN2);
+				break;
+		}						
+		switch (player2score) {
+			case 0:
+				lcd_draw_image(		(COLS-5)-num0Width/2,                 // X Pos
+													num0Width,   // Image Horizontal Width
+													(ROWS/2) + 1 + num0Height/2,                 // Y Pos
+													num0Height,  // Image Vertical Height
+													num0Bitmaps,       // Image
+													LCD_COLOR_MAGENTA,      // Foreground Color
+													LCD_COLOR_BLACK     // Background Color
+												);
+				break;
+			case 1:
+				lcd_draw_image(		(COLS-5)-num1Width/2,                 // X Pos
+													num1Width,   // Image Horizontal Width
+													(ROWS/2) + 1 + num0Height/2,                 // Y Pos
+													num1Height,  // Image Vertical Height
+													num1Bitmaps,       // Image
+													LCD_COLOR_MAGENTA,      // Foreground Color
+													LCD_COLOR_BLACK     // Background Color
+												);
+				break;
+			case 2:
+				lcd_draw_image(		(COLS-5)-num2Width/2,                 // X Pos
+													num2Width,   // Image Horizontal Width
+													(ROWS/2) + 1 + num0Height/2,                 // Y Pos
+													num2Height,  // Image Vertical Height
+													num2Bitmaps,       // Image
+													LCD_COLOR_MAGENTA,      // Foreground Color
+													LCD_COLOR_BLACK     // Background Color
+												);
+				break;
+			case 3:
+				lcd_draw_image(		(COLS-5)-num3Width/2,                 // X Pos
+													num1Width,   // Image Horizontal Width
+													(ROWS/2) + 1 + num0Height/2,                 // Y Pos
+													num3Height,  // Image Vertical Height
+													num3Bitmaps,       // Image
+													LCD_COLOR_MAGENTA,      // Foreground Color
+													LCD_COLOR_BLACK     // Background Color
+												);
+				break;
+			case 4:
+				lcd_draw_image(		(COLS-5)-num4Width/2,                 // X Pos
+													num4Width,   // Image Horizontal Width
+													(ROWS/2) + 1 + num0Height/2,                 // Y Pos
+													num4Height,  // Image Vertical Height
+													num4Bitmaps,       // Image
+													LCD_COLOR_MAGENTA,      // Foreground Color
+													LCD_COLOR_BLACK     // Background Color
+												);
+				break;
+			case 5:
+				lcd_draw_image(		(COLS-5)-num5Width/2,                 // X Pos
+													num5Width,   // Image Horizontal Width
+													(ROWS/2) + 1 + num0Height/2,                 // Y Pos
+													num5Height,  // Image Vertical Height
+													num5Bitmaps,       // Image
+													LCD_COLOR_MAGENTA,      // Foreground Color
+													LCD_COLOR_BLACK     // Background Color
+												);
+				break;
+			case 6:
+				lcd_draw_image(		(COLS-5)-num6Width/2,                 // X Pos
+													num6Width,   // Image Horizontal Width
+													(ROWS/2) + 1 + num0Height/2,                 // Y Pos
+													num6Height,  // Image Vertical Height
+													num6Bitmaps,       // Image
+													LCD_COLOR_MAGENTA,      // Foreground Color
+													LCD_COLOR_BLACK     // Background Color
+												);
+				break;
+			case 7:
+				lcd_draw_image(		(COLS-5)-num7Width/2,                 // X Pos
+													num7Width,   // Image Horizontal Width
+													(ROWS/2) + 1 + num0Height/2,                 // Y Pos
+													num7Height,  // Image Vertical Height
+													num7Bitmaps,       // Image
+													LCD_COLOR_MAGENTA,      // Foreground Color
+													LCD_COLOR_BLACK     // Background Color
+												);
+				break;
+			case 8:
+				lcd_draw_image(		(COLS-5)-num8Width/2,                 // X Pos
+													num8Width,   // Image Horizontal Width
+													(ROWS/2) + 1 + num0Height/2,                 // Y Pos
+													num8Height,  // Image Vertical Height
+													num8Bitmaps,       // Image
+													LCD_COLOR_MAGENTA,      // Foreground Color
+													LCD_COLOR_BLACK     // Background Color
+												);
+				break;
+			case 9:
+				lcd_draw_image(		(COLS-5)-num9Width/2,                 // X Pos
+													num9Width,   // Image Horizontal Width
+													(ROWS/2) + 1 + num0Height/2,                 // Y Pos
+													num9Height,  // Image Vertical Height
+													num9Bitmaps,       // Image
+													LCD_COLOR_MAGENTA,      // Foreground Color
+													LCD_COLOR_BLACK     // Background Color
+												);
+				break;
+			default: //error
+				lcd_clear_screen(LCD_COLOR_GREEN2);
+				break;
+		}
+	}
+}
+
+// draw fireworks on game won screen
+void drawFireworks(void) {
+			int color1 = rand() % 12; // 0 to 11
+			int color2 = rand() % 12;
+			switch (color1) {
+				case 0:
+					color1 = LCD_COLOR_WHITE;
+					break;
+				case 1:
+					color1 = LCD_COLOR_RED;
+					break;
+				case 2:
+					color1 = LCD_COLOR_GREEN;
+					break;
+				case 3:
+					color1 = LCD_COLOR_GREEN2;
+					break;
+				case 4:
+					color1 = LCD_COLOR_BLUE;
+					break;
+				case 5:
+					color1 = LCD_COLOR_BLUE2;
+					break;
+				case 6:
+					color1 = LCD_COLOR_YELLOW;
+					break;
+				case 7:
+					color1 = LCD_COLOR_ORANGE;
+					break;
+				case 8:
+					color1 = LCD_COLOR_CYAN;
+					break;
+				case 9:
+					color1 = LCD_COLOR_MAGENTA;
+					break;
+				case 10:
+					color1 = LCD_COLOR_GRAY;
+					break;
+				case 11:
+					color1 = LCD_COLOR_BROWN;
+					break;
+			}
+			switch (color2) {
+				case 0:
+					color2 = LCD_COLOR_WHITE;
+					break;
+				case 1:
+					color2 = LCD_COLOR_RED;
+					break;
+				case 2:
+					color2 = LCD_COLOR_GREEN;
+					break;
+				case 3:
+					color2 = LCD_COLOR_GREEN2;
+					break;
+				case 4:
+					color2 = LCD_COLOR_BLUE;
+					break;
+				case 5:
+					color2 = LCD_COLOR_BLUE2;
+					break;
+				case 6:
+					color2 = LCD_COLOR_YELLOW;
+					break;
+				case 7:
+					color2 = LCD_COLOR_ORANGE;
+					break;
+				case 8:
+					color2 = LCD_COLOR_CYAN;
+					break;
+				case 9:
+					color2 = LCD_COLOR_MAGENTA;
+					break;
+				case 10:
+					color2 = LCD_COLOR_GRAY;
+					break;
+				case 11:
+					color2 = LCD_COLOR_BROWN;
+					break;
+			}
+			lcd_draw_image(
+											(COLS/2),                 // X Pos
+											fireworksWidth,   // Image Horizontal Width
+											((ROWS/2)/2),                 // Y Pos
+											fireworksHeight,  // Image Vertical Height
+											fireworksBitmaps,       // Image
+											color1,      // Foreground Color
+											LCD_COLOR_BLACK     // Background Color
+										);
+					
+			lcd_draw_image(
+											(COLS/2),                 // X Pos
+											fireworksWidth,   // Image Horizontal Width
+											(3*(ROWS/2)/2),                 // Y Pos
+											fireworksHeight,  // Image Vertical Height
+											fireworksBitmaps,       // Image
+											color2,      // Foreground Color
+											LCD_COLOR_BLACK     // Background Color
+										);
+}
+//*****************************************************************************
+void DisableInterrupts(void)
+{
+  __asm {
+         CPSID  I
+  }
+}
+
+//*****************************************************************************
+void EnableInterrupts(void)
+{
+  __asm {
+    CPSIE  I
+  }
+}
+
+
+
+// returns true if the ball is touching a player
+bool playercontact(void){
+	
+		bool isContacting = false;
+		
+		// hit detection
+		if (player2x - playerWidth/2 < ballx + ballWidth/2 &&
+				player2x + playerWidth/2 > ballx - ballWidth/2 &&
+				player2y - playerHeight/2 < bally + ballHeight/2 &&
+				player2y + playerHeight/2 > bally - ballHeight/2) {
+			isContacting = true;
+		}
+		if (player1x - playerWidth/2 < ballx + ballWidth/2 &&
+				player1x + playerWidth/2 > ballx - ballWidth/2 &&
+				player1y - playerHeight/2 < bally + ballHeight/2 &&
+				player1y + playerHeight/2 > bally - ballHeight/2) {
+			isContacting = true;
+		}
+		// this logic will result in if the ball is touching both players 
+		// (due to some crazy gamemodes)
+		// that the ball twitches back and forth as long as it's touching one player
+		return isContacting;
+}
+
+// returns true if the ball is touching a wall
+bool wallcontact(void){
+		bool isContacting = false;
+		// half of the ball is past the left or right wall 
+		// (because of the motion this ball is about to take)
+		if (ballx < 0 + ballWidth)
+			isContacting = true;
+		if (ballx > COLS - ballWidth)
+			isContacting = true;
+		
+		return isContacting;
+}
+
+
+// reads the persisted settings record from EEPROM into the globals
+void loadSettings(void) {
+	settings_t settings;
+	
+	settings_init(&settings);
+	gamemode = settings.gamemode;
+	player1score = settings.player1score;
+	player2score = settings.player2score;
+	randomSeed = settings.randomSeed;
+}
+
+// hands the globals to the settings cache, they reach the EEPROM 
+// the next time the game is idle and calls settings_flush()
+void saveSettings(void) {
+	settings_t settings;
+	
+	settings.gamemode = gamemode;
+	settings.player1score = player1score;
+	settings.player2score = player2score;
+	settings.randomSeed = randomSeed;
+	settings_write(&settings);
+}
+
+// counts a paddle hit in the current rally
+void rallyHit(void) {
+	rallyHits++;
+	if (rallyHits>longestRally)
+		longestRally = rallyHits;
+}
+
+// a point ends the current rally
+void rallyEnd(void) {
+	rallyHits = 0;
+}
+
+// clears the statistics of the match being played
+void resetMatchStats(void) {
+	rallyHits = 0;
+	longestRally = 0;
+	matchTicks = 0;
+	tickStart = 0;
+	tickMaxInterval = 0;
+	tickMaxWork = 0;
+	ticksLate = 0;
+	inputMaxAge = 0;
+}
+
+// adds the match that just ended to the match database
+// scores must still hold the final result
+void recordMatch(uint8_t winner) {
+	match_record_t match;
+	telemetry_phase_t phase;
+	
+	match.mode = gamemode;
+	match.winner = winner;
+	match.score1 = player1score;
+	match.score2 = player2score;
+	match.rally = longestRally>MATCH_DB_MAX_RALLY ? MATCH_DB_MAX_RALLY : longestRally;
+	match.duration = matchTicks>MATCH_DB_MAX_DURATION ? MATCH_DB_MAX_DURATION : matchTicks;
+	match.seed = randomSeed-1; // randomSeed was incremented after seeding rand()
+	LOG4(LOG_MATCH_END, winner, player1score, player2score, matchTicks);
+	LOG4(LOG_TICK_STATS, ticksLate, tickMaxInterval, tickMaxWork, inputMaxAge);
+	if (ledFrames) {
+		LOG3(LOG_LED_STATS, ledFrames, ledComposeCycles/ledFrames, ledComposeMax);
+		ledFrames = 0;
+		ledComposeCycles = 0;
+		ledComposeMax = 0;
+	}
+	phase = telemetry_phase(TELEMETRY_PHASE_PERSIST);
+	match_db_record(&match);
+	telemetry_phase(phase);
+	
+	resetMatchStats();
+}
+
+// persists the settings, tunables and match records if the EEPROM is 
+// free, counted as persistence in the telemetry
+void flushSettings(void) {
+	telemetry_phase_t phase = telemetry_phase(TELEMETRY_PHASE_PERSIST);
+	settings_stats_t stats;
+	
+	if (settings_flush(false)) {
+		settings_get_stats(&stats);
+		LOG1(LOG_SETTINGS_SAVED, stats.lastBlockCycles);
+	}
+	tunables_flush(false);
+	match_db_flush(false);
+	telemetry_phase(phase);
+}
+
+// rebuilds the joystick curve after one of its tunables changed
+void applyJoystickResponse(void) {
+	input_set_response(joystickDeadZone, joystickCurve, maxSpeed);
+}
+
+// passes a new ledBrightness to the LED effects
+void applyLedBrightness(void) {
+	led_effects_set_brightness(ledBrightness);
+}
+
+// everything the serial console can change, bump tunablesVersion when 
+// this table changes so old saved values are ignored
+const uint8_t tunablesVersion = 3;
+const tunable_t tunables[] = {
+	{ "maxSpeed",            &maxSpeed,            1, 15,   applyJoystickResponse },
+	{ "ballMaxSpeed",        &ballMaxSpeed,        1, 10,   NULL },
+	{ "winScore",            &winScore,            1, 30,   NULL },
+	{ "heisenbergBlinkTime", &heisenbergBlinkTime, 1, 100,  NULL },
+	{ "accelTiltDeadZone",   &accelTiltDeadZone,   0, 45,   NULL },
+	{ "accelTiltFullSpeed",  &accelTiltFullSpeed,  1, 90,   NULL },
+	{ "noupdown",            &noupdown,            1, 100,  NULL },
+	{ "joystickDeadZone",    &joystickDeadZone,    0, 1024, applyJoystickResponse },
+	{ "joystickCurve",       &joystickCurve,       0, 100,  applyJoystickResponse },
+	{ "networkPlayer",       &networkPlayer,       0, 2,    NULL },
+	{ "ledBrightness",       &ledBrightness,       0, 255,  applyLedBrightness },
+};
+
+// sends this tick's game state over the serial debug port
+void sendTelemetry(void) {
+	telemetry_record_t record;
+	
+	record.gamemode = gamemode;
+	record.tick = matchTicks;
+	record.player1x = player1x;
+	record.player1y = player1y;
+	record.player2x = player2x;
+	record.player2y = player2y;
+	record.ballx = ballx;
+	record.bally = bally;
+	record.ballChangex = ballChangex;
+	record.ballChangey = ballChangey;
+	record.joystickX = input_step_x();
+	record.joystickY = input_step_y();
+	record.tilt = accel_tilt_angle();
+	record.buttons = (ioButtonLeft << TELEMETRY_BUTTON_LEFT) | (ioButtonRight << TELEMETRY_BUTTON_RIGHT);
+	record.player1score = player1score;
+	record.player2score = player2score;
+	telemetry_send(&record);
+}
+
+// paddle speed for a tilt: none inside the dead zone, then rising linearly
+// to maxSpeed at accelTiltFullSpeed
+int accelTiltToSpeed(int16_t tilt) {
+	int magnitude = (tilt<0) ? -tilt : tilt;
+	int deadZone = ACCEL_TILT_DEGREES(accelTiltDeadZone);
+	int fullSpeed = ACCEL_TILT_DEGREES(accelTiltFullSpeed);
+	int speed;
+	
+	if (magnitude<=deadZone)
+		return 0;
+	if (fullSpeed<=deadZone)
+		return (tilt<0) ? -maxSpeed : maxSpeed;
+	speed = (magnitude-deadZone)*maxSpeed/(fullSpeed-deadZone) + 1;
+	if (speed>maxSpeed)
+		speed = maxSpeed;
+	return (tilt<0) ? -speed : speed;
+}
+
+// randomizes the direction the ball will travel in
+void randomizeBall(void) {
+	ballChangex = (rand() % (ballMaxSpeed*2+1)) - ballMaxSpeed; // from 0 to (ballMaxSpeed*2), then from -ballMaxSpeed to ballMaxSpeed
+	ballChangey = (rand() % (ballMaxSpeed*2+1)) - ballMaxSpeed;
+	// prevent infinite loop left and right (but not up and down cause that'd be funny)
+	while (ballChangey==0){
+		ballChangex = (rand() % (ballMaxSpeed*2+1)) - ballMaxSpeed; 
+		ballChangey = (rand() % (ballMaxSpeed*2+1)) - ballMaxSpeed;
+	}
+}
+
+// radio addresses of the two boards in a network match
+const uint8_t netplayIds[2][RF_ADDR_WIDTH] = {
+	{ 'P', 'O', 'N', 'G', '1' },
+	{ 'P', 'O', 'N', 'G', '2' }
+};
+
+// starts regular pong against the other board as networkPlayer, the 
+// scores start from 0 since both boards must agree on them
+void startNetplay(void) {
+	pong_sim_config_t config;
+	uint8_t player = networkPlayer-1;
+	bool radio;
+	
+	radio = wireless_link_init(netplayIds[player], netplayIds[1-player]);
+	LOG2(LOG_NETPLAY_START, networkPlayer, radio);
+	if (!radio) {
+		wireless_link_release();
+		accel_resume();
+		return;
+	}
+	
+	config.playerWidth = playerWidth;
+	config.playerHeight = playerHeight;
+	config.ballWidth = ballWidth;
+	config.ballHeight = ballHeight;
+	config.maxSpeed = maxSpeed;
+	config.ballMaxSpeed = ballMaxSpeed;
+	config.noupdown = noupdown;
+	config.winScore = winScore;
+	// only player 1's seed is used
+	netplay_init(player, rand(), &config);
+	
+	player1score = 0;
+	player2score = 0;
+	netplayMatch = true;
+}
+
+// ends a network match that cannot go on and goes back to the menu
+void stopNetplay(netplay_status_t status) {
+	uint16_t checksum;
+	
+	LOG2(LOG_NETPLAY_END, status, netplay_confirmed_tick(&checksum));
+	netplayMatch = false;
+	// the radio borrowed the accelerometer's SSI and interrupt pin
+	wireless_link_release();
+	accel_resume();
+	menu = 1;
+	drawMenu();
+}
+
+// moves an image from where it was drawn to x, y
+void moveImage(int *drawnx, int *drawny, int x, int y, int width, int height, const uint8_t *bitmap, uint16_t color) {
+	if (*drawnx==x && *drawny==y)
+		return;
+	lcd_draw_image(*drawnx, width, *drawny, height, bitmap, LCD_COLOR_BLACK, LCD_COLOR_BLACK);
+	lcd_draw_image(x, width, y, height, bitmap, color, LCD_COLOR_BLACK);
+	*drawnx = x;
+	*drawny = y;
+}
+
+// one tick of a network match: both paddles and the ball come from the 
+// simulation shared with the other board, the joystick steps this board's 
+// paddle.  A rollback can move anything, so everything is redrawn from the 
+// simulation state.
+void netplayTick(void) {
+	const pong_sim_state_t *state;
+	netplay_status_t status;
+	netplay_stats_t stats;
+	uint8_t winner;
+	
+	status = netplay_tick(input_step_x());
+	if (status==NETPLAY_DESYNC || status==NETPLAY_CONFIG_MISMATCH) {
+		stopNetplay(status);
+		return;
+	}
+	if (status==NETPLAY_SYNCING)
+		return;
+	
+	state = netplay_state();
+	moveImage(&player1x, &player1y, state->player1x, PONG_SIM_PLAYER1Y, playerWidth, playerHeight, playerBitmaps, LCD_COLOR_BLUE);
+	moveImage(&player2x, &player2y, state->player2x, PONG_SIM_PLAYER2Y, playerWidth, playerHeight, playerBitmaps, LCD_COLOR_BLUE);
+	moveImage(&ballx, &bally, state->ballx, state->bally, ballWidth, ballHeight, ballBitmaps, LCD_COLOR_RED);
+	ballChangex = state->ballChangex;
+	ballChangey = state->ballChangey;
+	
+	// the match only ends once both boards agree on it, the post game 
+	// code then records it like any other
+	if (netplay_finished(&winner)) {
+		netplay_get_stats(&stats);
+		LOG4(LOG_NETPLAY_STATS, stats.rollbacks, stats.resimulated, stats.maxRollback, stats.stalls);
+		player1score = state->player1score;
+		player2score = state->player2score;
+		longestRally = state->longestRally;
+		saveSettings();
+		waitLoser = 1;
+		return;
+	}
+	
+	// a predicted winning point could still be rolled back
+	if ((state->player1score!=player1score || state->player2score!=player2score) &&
+			state->player1score<winScore && state->player2score<winScore) {
+		player1score = state->player1score;
+		player2score = state->player2score;
+		saveSettings();
+		drawScore();
+	}
+}
+
+// follows the game on the LED strip, called every pass of the main loop.
+// Game events are picked up as changes since the last frame, so every 
+// gamemode and network play light the strip the same way.
+void updateLeds(void) {
+	static uint32_t frameTime;
+	static uint8_t shownScore1;
+	static uint8_t shownScore2;
+	static bool shownWin;
+	static bool shownBlink;
+	static uint16_t strobePeriod;
+	uint8_t grb[LED_EFFECTS_BYTES];
+	uint32_t now = timebase_now_ms();
+	uint32_t start;
+	bool won;
+	
+	if (now-frameTime<LED_EFFECTS_FRAME_MS || ws2812b_dma_busy())
+		return;
+	frameTime = now;
+	
+	// exactly one player at winScore, a tie is played on
+	won = !menu && ((player1score>=winScore) != (player2score>=winScore));
+	
+	if (menu) {
+		led_effects_clear();
+		shownWin = false;
+		strobePeriod = 0;
+	}
+	else if (won && !shownWin) {
+		led_effects_win(player1score>=winScore ? 0 : 1, now);
+		shownWin = true;
+	}
+	else if (!shownWin) {
+		if (player1score>shownScore1)
+			led_effects_point(0, now);
+		if (player2score>shownScore2)
+			led_effects_point(1, now);
+		led_effects_rally(rallyHits);
+		
+		// heisenberg pong strobes as the objects appear and disappear
+		if (gamemode==2 && !netplayMatch) {
+			if (heisenbergBlinking!=shownBlink && strobePeriod!=heisenbergBlinkTime*10) {
+				strobePeriod = heisenbergBlinkTime*10;
+				led_effects_strobe(strobePeriod, now);
+			}
+		}
+		else if (strobePeriod) {
+			strobePeriod = 0;
+			led_effects_strobe(0, now);
+		}
+	}
+	shownScore1 = player1score;
+	shownScore2 = player2score;
+	shownBlink = heisenbergBlinking;
+	
+	start = timebase_cycles();
+	led_effects_compose(now, grb);
+	start = timebase_cycles_since(start);
+	ledFrames++;
+	ledComposeCycles += start;
+	if (start>ledComposeMax)
+		ledComposeMax = start;
+	
+	ws2812b_dma_show((const WS2812B_t *)grb, LED_EFFECTS_LEDS);
+}
+
+//*****************************************************************************
+//************DEATH**********************PONG**********************************
+//*****************************************************************************
+
+// run the game: DEATH PONG
+int 
+main(void)
+{
+	bool done = false;
+	int tiltSpeed = 0;
+	int joystickX = 0;
+	int joystickY = 0;
+	ft6x06_touch_t touch;
+	io_expander_event_t buttonEvent;
+	
+	// ideals: player 40 width, 10 height. ball 10 width, 10 height.
+	playerWidth = playerWidthPixels; // get these values from bitmap
+	playerHeight = playerHeightPixels; // get these values from bitmap
+	ballWidth = ballWidthPixels; // get these values from bitmap
+	ballHeight = ballHeightPixels; // get these values from bitmap
+	
+	gamemode = 0;
+	player1score = 0;
+	player2score = 0;
+	randomSeed = 0;
+	// every timestamp comes from the timebase, start it first
+	timebase_init();
+	profile_zones_init();
+	// initialize hardware
+	project_initialize_hardware();
+	debug_log_init();
+
+	// read EEPROM for gamemode currently
+	// read EEPROM for player scores
+	// read EEPROM for random seed
+	loadSettings();
+	LOG2(LOG_BOOT, gamemode, randomSeed);
+	// read the match history header for the menu stats
+	match_db_init();
+	resetMatchStats();
+	// the board should be still while the gyro offset is measured
+	accel_tilt_init();
+	// and the joystick released while its centre is measured
+	input_init(maxSpeed);
+	// saved tunables replace the defaults above
+	tunables_init(tunables, sizeof(tunables)/sizeof(tunables[0]), tunablesVersion);
+	applyJoystickResponse();
+	// the LED strip follows the game from the first pass of the loop
+	ws2812b_dma_init();
+	led_effects_init(ledBrightness);
+	// per tick game state goes out over the serial debug port
+	telemetry_init();
+	console_init();
+	
+	// initialize menu defaults
+	menu = 1;
+	movingJoystick = 0;
+	ballWait = 0;
+	waitLoser = 0;
+	
+	// initialize random number generator 
+  srand(randomSeed);   // Initialization, should only be called once.
+	randomSeed++; //loops around, only uint8
+	// write random seed to EEPROM
+	saveSettings();
+	
+	// initialize screen
+	lcd_config_screen();
+	lcd_clear_screen(LCD_COLOR_BLACK);
+	drawMenu();
+	
+	while (!done) {
+		telemetry_phase(TELEMETRY_PHASE_INPUT);
+		// filter every accelerometer sample, mode 3 uses the tilt
+		accel_tilt_update();
+		// debounced expander button changes drive player 2 in mode 3
+		io_expander_poll();
+		while (io_expander_get_event(&buttonEvent)) {
+			if (buttonEvent.pin==DIR_BTN_LEFT_PIN)
+				ioButtonLeft = buttonEvent.pressed;
+			else if (buttonEvent.pin==DIR_BTN_RIGHT_PIN)
+				ioButtonRight = buttonEvent.pressed;
+		}
+		telemetry_phase(TELEMETRY_PHASE_IDLE);
+		debug_log_flush();
+		console_poll();
+		updateLeds();
+		
+		// pre-game menu selection
+		if (menu) {
+			// joystick move
+			if (direction!=0 && movingJoystick==0){
+					// not allowed to move until moving stops
+					movingJoystick = 1;
+					// move to new choice (wrap around motion)
+					if (direction==1) { // up  
+							gamemode--;
+							if (gamemode==0xFF) gamemode = GAMEMODES; //0xFF as -1
+					}
+					else if (direction==3) { // down
+							gamemode++;
+							if (gamemode==GAMEMODES+1) gamemode = 0; 
+					}
+					// write currently selected gamemode to EEPROM
+					saveSettings();
+					
+					// redraw the menu 
+					lcd_clear_screen(LCD_COLOR_BLACK);
+					drawMenu();
+			}
+			// joystick is back at center
+			else if (direction==0) {
+				// can move it again
+					movingJoystick = 0;
+			}
+			// nothing is animating in the menu, persist anything that changed
+			flushSettings();
+			// select-menu-option button pressed
+			if (sw1_debounce()) {
+					// select menu option by turning off menu
+					// and going into current gamemode
+					menu = 0;
+					resetMatchStats();
+					LOG1(LOG_MATCH_START, gamemode);
+					// initialize variables based on gamemode
+				  switch (gamemode) {
+					// regular pong
+					case 0:
+						// against another board once the console has set networkPlayer
+						if (networkPlayer!=0)
+							startNetplay();
+						player1x = (COLS/2);
+						player1y = (ROWS/6);
+						player2x = (COLS/2);
+						player2y = (5*ROWS/6);
+						ballx = (COLS/2);
+						bally = (ROWS/2);
+						// randomize ball
+						randomizeBall();
+						
+						lcd_clear_screen(LCD_COLOR_BLACK);
+						// draw players
+						lcd_draw_image(
+													player1x,                 // X Pos
+													playerWidth,   // Image Horizontal Width
+													player1y,                 // Y Pos
+													playerHeight,  // Image Vertical Height
+													playerBitmaps,       // Image
+													LCD_COLOR_BLUE,      // Foreground Color
+													LCD_COLOR_BLACK     // Background Color
+												);
+						lcd_draw_image(
+													player2x,                 // X Pos
+													playerWidth,   // Image Horizontal Width
+													player2y,                 // Y Pos
+													playerHeight,  // Image Vertical Height
+													playerBitmaps,       // Image
+													LCD_COLOR_BLUE,      // Foreground Color
+													LCD_COLOR_BLACK     // Background Color
+												);
+						// draw ball
+						lcd_draw_image(
+													ballx,                 // X Pos
+													ballWidth,   // Image Horizontal Width
+													bally,                 // Y Pos
+													ballHeight,  // Image Vertical Height
+													ballBitmaps,       // Image
+													LCD_COLOR_BLUE,      // Foreground Color
+													LCD_COLOR_BLACK     // Background Color
+												);
+						// draw score
+						drawScore();
+						break;
+					// gravity pong
+					case 1:
+						player1x = (COLS/2);
+						player1y = (ROWS/6);
+						player2x = (COLS/2);
+						player2y = (5*ROWS/6);
+						ballx = (COLS/2);
+						bally = (ROWS/2);
+						// randomize ball
+						randomizeBall();
+						
+						lcd_clear_screen(LCD_COLOR_BLACK);
+						// draw players
+						lcd_draw_image(
+													player1x,                 // X Pos
+													playerWidth,   // Image Horizontal Width
+													player1y,                 // Y Pos
+													playerHeight,  // Image Vertical Height
+													playerBitmaps,       // Image
+													LCD_COLOR_BLUE,      // Foreground Color
+													LCD_COLOR_BLACK     // Background Color
+												);
+						lcd_draw_image(
+													player2x,                 // X Pos
+													playerWidth,   // Image Horizontal Width
+													player2y,                 // Y Pos
+													playerHeight,  // Image Vertical Height
+													playerBitmaps,       // Image
+													LCD_COLOR_BLUE,      // Foreground Color
+													LCD_COLOR_BLACK     // Background Color
+												);
+						// draw ball
+						lcd_draw_image(
+													ballx,                 // X Pos
+													ballWidth,   // Image Horizontal Width
+													bally,                 // Y Pos
+													ballHeight,  // Image Vertical Height
+													ballBitmaps,       // Image
+													LCD_COLOR_BLUE,      // Foreground Color
+													LCD_COLOR_BLACK     // Background Color
+												);
+						// draw score
+						drawScore();
+						break;
+					// heisenberg pong
+					case 2:
+						player1x = (COLS/2);
+						player1y = (ROWS/6);
+						player2x = (COLS/2);
+						player2y = (5*ROWS/6);
+						ballx = (COLS/2);
+						bally = (ROWS/2);
+						// randomize ball
+						randomizeBall();
+						
+						lcd_clear_screen(LCD_COLOR_BLACK);
+						// draw players
+						lcd_draw_image(
+													player1x,                 // X Pos
+													playerWidth,   // Image Horizontal Width
+													player1y,                 // Y Pos
+													playerHeight,  // Image Vertical Height
+													playerBitmaps,       // Image
+													LCD_COLOR_BLUE,      // Foreground Color
+													LCD_COLOR_BLACK     // Background Color
+												);
+						lcd_draw_image(
+													player2x,                 // X Pos
+													playerWidth,   // Image Horizontal Width
+													player2y,                 // Y Pos
+													playerHeight,  // Image Vertical Height
+													playerBitmaps,       // Image
+													LCD_COLOR_BLUE,      // Foreground Color
+													LCD_COLOR_BLACK     // Background Color
+												);
+						// draw ball
+						lcd_draw_image(
+													ballx,                 // X Pos
+													ballWidth,   // Image Horizontal Width
+													bally,                 // Y Pos
+													ballHeight,  // Image Vertical Height
+													ballBitmaps,       // Image
+													LCD_COLOR_BLUE,      // Foreground Color
+													LCD_COLOR_BLACK     // Background Color
+												);
+						// draw score
+						drawScore();
+						break;
+					// weird controls pong
+					case 3:
+						player1x = (COLS/2);
+						player1y = (ROWS/6);
+						player2x = (COLS/2);
+						player2y = (5*ROWS/6);
+						ballx = (COLS/2);
+						bally = (ROWS/2);
+						// randomize ball
+						randomizeBall();
+						
+						lcd_clear_screen(LCD_COLOR_BLACK);
+						// draw players
+						lcd_draw_image(
+													player1x,                 // X Pos
+													playerWidth,   // Image Horizontal Width
+													player1y,                 // Y Pos
+													playerHeight,  // Image Vertical Height
+													playerBitmaps,       // Image
+													LCD_COLOR_BLUE,      // Foreground Color
+													LCD_COLOR_BLACK     // Background Color
+												);
+						lcd_draw_image(
+													player2x,                 // X Pos
+													playerWidth,   // Image Horizontal Width
+													player2y,                 // Y Pos
+													playerHeight,  // Image Vertical Height
+													playerBitmaps,       // Image
+													LCD_COLOR_BLUE,      // Foreground Color
+													LCD_COLOR_BLACK     // Background Color
+												);
+						// draw ball
+						lcd_draw_image(
+													ballx,                 // X Pos
+													ballWidth,   // Image Horizontal Width
+													bally,                 // Y Pos
+													ballHeight,  // Image Vertical Height
+													ballBitmaps,       // Image
+													LCD_COLOR_BLUE,      // Foreground Color
+													LCD_COLOR_BLACK     // Background Color
+												);
+						// draw score
+						drawScore();
+						break;
+					// more dimensional pong
+					case 4:
+						player1x = (COLS/2);
+						player1y = (ROWS/6);
+						player2x = (COLS/2);
+						player2y = (5*ROWS/6);
+						ballx = (COLS/2);
+						bally = (ROWS/2);
+						// randomize ball
+						randomizeBall();
+						
+						lcd_clear_screen(LCD_COLOR_BLACK);
+						// draw players
+						lcd_draw_image(
+													player1x,                 // X Pos
+													playerWidth,   // Image Horizontal Width
+													player1y,                 // Y Pos
+													playerHeight,  // Image Vertical Height
+													playerBitmaps,       // Image
+													LCD_COLOR_BLUE,      // Foreground Color
+													LCD_COLOR_BLACK     // Background Color
+												);
+						lcd_draw_image(
+													player2x,                 // X Pos
+													playerWidth,   // Image Horizontal Width
+													player2y,                 // Y Pos
+													playerHeight,  // Image Vertical Height
+													playerBitmaps,       // Image
+													LCD_COLOR_BLUE,      // Foreground Color
+													LCD_COLOR_BLACK     // Background Color
+												);
+						// draw ball
+						lcd_draw_image(
+													ballx,                 // X Pos
+													ballWidth,   // Image Horizontal Width
+													bally,                 // Y Pos
+													ballHeight,  // Image Vertical Height
+													ballBitmaps,       // Image
+													LCD_COLOR_BLUE,      // Foreground Color
+													LCD_COLOR_BLACK     // Background Color
+												);
+						// draw score
+						drawScore();
+						break;
+					// reset scores
+					case 5: 
+						// easter egg with scores of 4-2
+						if (player1score==4 && player2score==2) {
+							lcd_clear_screen(LCD_COLOR_MAGENTA);
+							// lcd draw image of an easter egg
+							lcd_draw_image(
+											(COLS/2),                 // X Pos
+											easterEggWidth,   // Image Horizontal Width
+											(ROWS/2),                 // Y Pos
+											easterEggHeight,  // Image Vertical Height
+											easterEggBitmaps,       // Image
+											LCD_COLOR_ORANGE,      // Foreground Color
+											LCD_COLOR_BLACK     // Background Color
+										);
+							player1score = 0;
+							player2score = 0;
+							// back to 0 gamemode 
+							gamemode = 0;					
+							// write scores and gamemode to EEPROM
+							saveSettings();
+						
+							done = 1;
+							break;
+						}
+						player1score = 0;
+						player2score = 0;
+						// back to 0 gamemode and stay in the menu
+						gamemode = 0;
+						menu = 1;
+					
+						// write scores and gamemode to EEPROM
+						saveSettings();
+						// redraw the menu 
+						lcd_clear_screen(LCD_COLOR_BLACK);
+						drawMenu();
+						break;
+					default:
+						gamemode = 0; // set to regular pong if random value
+						break;
+				} 
+			}
+		}
+		// post-game 
+		else if (player1score>=winScore || player2score>=winScore){
+				delayWaitFunction();
+				flushSettings();
+				// keep answering the other board while it finishes the match
+				if (netplayMatch && gameTick())
+					netplay_tick(0);
+				if (!waitLoser){
+					// initialize post game 
+					if (player1score==winScore || player2score==winScore) {
+							if (player1score==winScore && player2score==winScore) {
+									// freak tie occurence
+									player1score = 0;
+									player2score = 0;
+									// write scores to EEPROM
+									saveSettings();
+						
+									// so reset the scores and keep playing!
+							}
+							else if (player1score==winScore){
+								recordMatch(0);
+								player2score = 0;
+								player1score++;
+								// write scores to EEPROM
+								saveSettings();
+								
+							}
+							// player2score==winScore
+							else {
+								recordMatch(1);
+								player1score = 0;
+								player2score++;
+								//write scores to EEPROM
+								saveSettings();
+							}
+					}
+					else if (player1score>=winScore) {
+							lcd_clear_screen(LCD_COLOR_BLACK);
+							drawFireworks();
+							lcd_draw_image(
+														(COLS/2),                 // X Pos
+														player1winWidth,   // Image Horizontal Width
+														(ROWS/2),                 // Y Pos
+														player1winHeight,  // Image Vertical Height
+														player1winBitmaps,       // Image
+														LCD_COLOR_CYAN,      // Foreground Color
+														LCD_COLOR_BLACK     // Background Color
+													);
+							player1score = 0;
+							player2score = 0;
+							//write scores to EEPROM
+							saveSettings();
+							done = true;
+							
+					}
+					else {
+							lcd_clear_screen(LCD_COLOR_BLACK);
+							drawFireworks();
+							lcd_draw_image(
+													(COLS/2),                 // X Pos
+													player2winWidth,   // Image Horizontal Width
+													(ROWS/2),                 // Y Pos
+													player2winHeight,  // Image Vertical Height
+													player2winBitmaps,       // Image
+													LCD_COLOR_MAGENTA,      // Foreground Color
+													LCD_COLOR_BLACK     // Background Color
+												);
+						player1score = 0;
+						player2score = 0;
+						//write scores to EEPROM
+						saveSettings();
+						done = true;
+					}
+				
+				}
+		}
+		// in-game gameplay
+		else {
+				if (gameTick()) {
+						PROFILE_BEGIN(PROFILE_ZONE_TICK);
+						matchTicks++;
+						telemetry_phase(TELEMETRY_PHASE_INPUT);
+						input_update();
+						// the touch job posted from PF4 keeps the last reading
+						ft6x06_get_touch(&touch);
+						telemetry_phase(TELEMETRY_PHASE_PHYSICS);
+						if (netplayMatch)
+							netplayTick();
+						else
+							switch (gamemode) {
+//////////////// regular pong
+							case 0:
+								// PLAYER MOVEMENT
+								// player 1: touchscreen 
+								// screen goes from 0 to ROWS=320 and 0 to COLS=240
+								if (touch.touches>0){
+									int x;
+									// hide player1
+									lcd_draw_image(
+															player1x,                 // X Pos
+															playerWidth,   // Image Horizontal Width
+															player1y,                 // Y Pos
+															playerHeight,  // Image Vertical Height
+															playerBitmaps,       // Image
+															LCD_COLOR_BLACK,      // Foreground Color
+															LCD_COLOR_BLACK     // Background Color
+														);
+									x = touch.x;
+									if (player1x-x>maxSpeed)
+										player1x = player1x-maxSpeed;
+									else if (x-player1x>maxSpeed)
+										player1x = player1x+maxSpeed;
+									else
+										player1x = x;
+									
+									// redraw player1
+									lcd_draw_image(
+															player1x,                 // X Pos
+															playerWidth,   // Image Horizontal Width
+															player1y,                 // Y Pos
+															playerHeight,  // Image Vertical Height
+															playerBitmaps,       // Image
+															LCD_COLOR_BLUE,      // Foreground Color
+															LCD_COLOR_BLACK     // Background Color
+														);
+								}
+								
+								
+								// player 2: joystick, speed follows the deflection
+								joystickX = input_step_x();
+								if (joystickX!=0){
+									// hide player2
+									lcd_draw_image(
+																player2x,                 // X Pos
+																playerWidth,   // Image Horizontal Width
+																player2y,                 // Y Pos
+																playerHeight,  // Image Vertical Height
+																playerBitmaps,       // Image
+																LCD_COLOR_BLACK,      // Foreground Color
+																LCD_COLOR_BLACK     // Background Color
+															);
+									player2x = player2x+joystickX;
+									// wall cutoffs
+									if (player2x<0+playerWidth/2)
+										player2x = playerWidth/2;
+									if (player2x>COLS-playerWidth/2)
+										player2x = COLS-playerWidth/2;
+									
+									// redraw player2
+									lcd_draw_image(
+																player2x,                 // X Pos
+																playerWidth,   // Image Horizontal Width
+																player2y,                 // Y Pos
+																playerHeight,  // Image Vertical Height
+																playerBitmaps,       // Image
+																LCD_COLOR_BLUE,      // Foreground Color
+																LCD_COLOR_BLACK     // Background Color
+															);
+								}
+								
+								// BALL MOVEMENT
+								delayWaitFunction();
+								if (!ballWait) {
+									// hide ball
+									lcd_draw_image(
+															ballx,                 // X Pos
+															ballWidth,   // Image Horizontal Width
+															bally,                 // Y Pos
+															ballHeight,  // Image Vertical Height
+															ballBitmaps,       // Image
+															LCD_COLOR_BLACK,      // Foreground Color
+															LCD_COLOR_BLACK     // Background Color
+														);
+									ballx = ballx+ballChangex;
+									bally = bally+ballChangey;
+									// player 1 point
+									if (bally>ROWS-ballHeight){
+											// point
+											player1score = player1score+1;
+											rallyEnd();
+											// write score to EEPROM
+											saveSettings();
+											if (player1score>=winScore) {
+												// delay here for the loser to realize they've just lost and freeze frame that moment
+												waitLoser = 1;	
+												lcd_draw_image(
+															ballx,                 // X Pos
+															ballWidth,   // Image Horizontal Width
+															bally,                 // Y Pos
+															ballHeight,  // Image Vertical Height
+															ballBitmaps,       // Image
+															LCD_COLOR_RED,      // Foreground Color
+															LCD_COLOR_BLACK     // Background Color
+														);
+												break;
+											}
+											
+											// redraw score
+											drawScore();
+											// reset ball and wait for a bit
+											ballx = COLS/2;
+											bally = ROWS/2;
+											// randomize
+											randomizeBall();
+											
+											// wait for players to reset
+											ballWait = 1; 
+									}
+									// player 2 point
+									else if (bally<ballHeight){
+											// point
+											player2score = player2score+1;
+											rallyEnd();
+											// write score to EEPROM
+											saveSettings();
+						
+											if (player2score>=winScore) {
+												// delay here for the loser to realize they've just lost and freeze frame that moment
+												waitLoser = 1;	
+												lcd_draw_image(
+															ballx,                 // X Pos
+															ballWidth,   // Image Horizontal Width
+															bally,                 // Y Pos
+															ballHeight,  // Image Vertical Height
+															ballBitmaps,       // Image
+															LCD_COLOR_RED,      // Foreground Color
+															LCD_COLOR_BLACK     // Background Color
+														);
+												break;
+											}
+											
+											// redraw score
+											drawScore();
+											// reset ball and wait for a bit
+											ballx = COLS/2;
+											bally = ROWS/2;
+											// randomize
+											randomizeBall();
+											
+											// wait for players to reset
+											ballWait = 1; 
+									}
+									else {
+										// player contact 
+										if (playercontact()) {
+											rallyHit();
+											ballChangey = -ballChangey;
+											// for each player contact, randomly change the changex by a bit so not an infinite loop of up and down											
+											if (ballChangex==0 && rand()%noupdown==0)
+												ballChangex = ballChangex + (-1)^(rand() % 2); 
+										}	
+										// wallcontact 
+										if (wallcontact()) {
+											ballChangex = -ballChangex;
+										}
+									 }
+									 //redraw ball
+									 lcd_draw_image(
+																ballx,                 // X Pos
+																ballWidth,   // Image Horizontal Width
+																bally,                 // Y Pos
+																ballHeight,  // Image Vertical Height
+																ballBitmaps,       // Image
+																LCD_COLOR_RED,      // Foreground Color
+																LCD_COLOR_BLACK     // Background Color
+															);
+								}
+								break;
+//////////////// GRAVITY pong
+							// paddle and paddle slow down in the center and speed up at extremes
+							case 1:
+								// PLAYER MOVEMENT
+								// player 1: touchscreen 
+								// screen goes from 0 to ROWS=320 and 0 to COLS=240
+								if (touch.touches>0){
+									int x;
+									// hide player1
+									lcd_draw_image(
+															player1x,                 // X Pos
+															playerWidth,   // Image Horizontal Width
+															player1y,                 // Y Pos
+															playerHeight,  // Image Vertical Height
+															playerBitmaps,       // Image
+															LCD_COLOR_BLACK,      // Foreground Color
+															LCD_COLOR_BLACK     // Background Color
+														);
+									x = touch.x;
+									if ((COLS/2)-player1x>0) // left side
+									{
+										if (player1x-x>0) // move left
+											player1x = player1x-(((COLS/2)-player1x)/10 + 1);
+										else // (x-player1x>0) move right
+											player1x = player1x+(((COLS/2)-player1x)/10 + 1);
+										// wall cutoffs
+										if (player1x<0+playerWidth/2)
+											player1x = playerWidth/2;
+										if (player1x>COLS-playerWidth/2)
+											player1x = COLS-playerWidth/2;
+									}
+									else { // right side
+										if (player1x-x>0) // move left
+											player1x = player1x-((player1x-(COLS/2))/10 + 1);
+										else // (x-player1x>0) move right
+											player1x = player1x+((player1x-(COLS/2))/10 + 1);
+										// wall cutoffs
+										if (player1x<0+playerWidth/2)
+											player1x = playerWidth/2;
+										if (player1x>COLS-playerWidth/2)
+											player1x = COLS-playerWidth/2;
+									}
+									
+									// redraw player1
+									lcd_draw_image(
+															player1x,                 // X Pos
+															playerWidth,   // Image Horizontal Width
+															player1y,                 // Y Pos
+															playerHeight,  // Image Vertical Height
+															playerBitmaps,       // Image
+															LCD_COLOR_BLUE,      // Foreground Color
+															LCD_COLOR_BLACK     // Background Color
+														);
+								}
+								
+								
+								// player 2: joystick, speed follows the deflection
+								joystickX = input_step_x();
+								if (joystickX!=0){
+									// hide player2
+									lcd_draw_image(
+																player2x,                 // X Pos
+																playerWidth,   // Image Horizontal Width
+																player2y,                 // Y Pos
+																playerHeight,  // Image Vertical Height
+																playerBitmaps,       // Image
+																LCD_COLOR_BLACK,      // Foreground Color
+																LCD_COLOR_BLACK     // Background Color
+															);
+									
+									if ((COLS/2)-player2x>0) // left side
+									{
+										if (joystickX<0) { // move left  
+											player2x = player2x-(((COLS/2)-player2x)/10 + 1);
+											// wall cutoffs
+											if (player2x<0+playerWidth/2)
+												player2x = playerWidth/2;
+										}
+										else if (joystickX>0) { // move right
+											player2x = player2x+(((COLS/2)-player2x)/10 + 1);
+											// wall cutoffs
+											if (player2x>COLS-playerWidth/2)
+												player2x = COLS-playerWidth/2;
+										}
+									}
+									else { // right side										if (player1x-x>0) // move left
+											if (joystickX<0) { // move left  
+												player2x = player2x-((player2x-(COLS/2))/10 + 1);
+												// wall cutoffs
+												if (player2x<0+playerWidth/2)
+													player2x = playerWidth/2;
+												}
+											else if (joystickX>0) { // move right
+												player2x = player2x+((player2x-(COLS/2))/10 + 1);
+												// wall cutoffs
+												if (player2x>COLS-playerWidth/2)
+													player2x = COLS-playerWidth/2;
+											}
+									}
+									
+									// redraw player2
+									lcd_draw_image(
+																player2x,                 // X Pos
+																playerWidth,   // Image Horizontal Width
+																player2y,                 // Y Pos
+																playerHeight,  // Image Vertical Height
+																playerBitmaps,       // Image
+																LCD_COLOR_BLUE,      // Foreground Color
+																LCD_COLOR_BLACK     // Background Color
+															);
+								}
+								
+								// BALL MOVEMENT
+								delayWaitFunction();
+								if (!ballWait) {
+									// hide ball
+									lcd_draw_image(
+															ballx,                 // X Pos
+															ballWidth,   // Image Horizontal Width
+															bally,                 // Y Pos
+															ballHeight,  // Image Vertical Height
+															ballBitmaps,       // Image
+															LCD_COLOR_BLACK,      // Foreground Color
+															LCD_COLOR_BLACK     // Background Color
+														);
+									ballx = ballx+ballChangex;
+									if (bally==ROWS/2) // middle
+										bally = bally+(ballChangey>0 ? 1 : -1);
+									else if (bally>ROWS/2) { // bottom half 
+										if (ballChangey>0)
+											bally = bally+(ballChangey/((bally-(ROWS/2))/40))+1;
+										else
+											bally = bally+(ballChangey/((bally-(ROWS/2))/40))-1;
+									}
+									else {// top half
+										if (ballChangey>0)
+											bally = bally+(ballChangey/(((ROWS/2)-bally)/40))+1;
+										else
+											bally = bally+(ballChangey/(((ROWS/2)-bally)/40))-1;
+									}
+									// player 1 point
+									if (bally>ROWS-ballHeight){
+											// point
+											player1score = player1score+1;
+											rallyEnd();
+											// write score to EEPROM
+											saveSettings();
+											if (player1score>=winScore) {
+												// delay here for the loser to realize they've just lost and freeze frame that moment
+												waitLoser = 1;	
+												lcd_draw_image(
+															ballx,                 // X Pos
+															ballWidth,   // Image Horizontal Width
+															bally,                 // Y Pos
+															ballHeight,  // Image Vertical Height
+															ballBitmaps,       // Image
+															LCD_COLOR_RED,      // Foreground Color
+															LCD_COLOR_BLACK     // Background Color
+														);
+												break;
+											}
+											
+											// redraw score
+											drawScore();
+											// reset ball and wait for a bit
+											ballx = COLS/2;
+											bally = ROWS/2;
+											// randomize
+											randomizeBall();
+											
+											// wait for players to reset
+											ballWait = 1; 
+									}
+									// player 2 point
+									else if (bally<ballHeight){
+											// point
+											player2score = player2score+1;
+											rallyEnd();
+											// write score to EEPROM
+											saveSettings();
+						
+											if (player2score>=winScore) {
+												// delay here for the loser to realize they've just lost and freeze frame that moment
+												waitLoser = 1;	
+												lcd_draw_image(
+															ballx,                 // X Pos
+															ballWidth,   // Image Horizontal Width
+															bally,                 // Y Pos
+															ballHeight,  // Image Vertical Height
+															ballBitmaps,       // Image
+															LCD_COLOR_RED,      // Foreground Color
+															LCD_COLOR_BLACK     // Background Color
+														);
+												break;
+											}
+											
+											// redraw score
+											drawScore();
+											// reset ball and wait for a bit
+											ballx = COLS/2;
+											bally = ROWS/2;
+											// randomize
+											randomizeBall();
+											
+											// wait for players to reset
+											ballWait = 1; 
+									}
+									else {
+										// player contact 
+										if (playercontact()) {
+											rallyHit();
+											ballChangey = -ballChangey;
+											// for each player contact, randomly change the changex by a bit so not an infinite loop of up and down											
+											if (ballChangex==0 && rand()%noupdown==0)
+												ballChangex = ballChangex + (-1)^(rand() % 2); 
+										}	
+										// wallcontact 
+										if (wallcontact()) {
+											ballChangex = -ballChangex;
+										}
+									 }
+									 //redraw ball
+									 lcd_draw_image(
+																ballx,                 // X Pos
+																ballWidth,   // Image Horizontal Width
+																bally,                 // Y Pos
+																ballHeight,  // Image Vertical Height
+																ballBitmaps,       // Image
+																LCD_COLOR_RED,      // Foreground Color
+																LCD_COLOR_BLACK     // Background Color
+															);
+								}
+								break;
+//////////////// heisenberg pong
+							// can see paddle or ball but not both
+							case 2:
+								// required at the start for blink boolean to be equal for paddles and ball
+								delayWaitFunction();
+							
+								// PLAYER MOVEMENT
+								// player 1: touchscreen 
+								// screen goes from 0 to ROWS=320 and 0 to COLS=240
+								if (touch.touches>0){
+									int x;
+									// hide player1
+									lcd_draw_image(
+															player1x,                 // X Pos
+															playerWidth,   // Image Horizontal Width
+															player1y,                 // Y Pos
+															playerHeight,  // Image Vertical Height
+															playerBitmaps,       // Image
+															LCD_COLOR_BLACK,      // Foreground Color
+															LCD_COLOR_BLACK     // Background Color
+														);
+									x = touch.x;
+									if (player1x-x>maxSpeed)
+										player1x = player1x-maxSpeed;
+									else if (x-player1x>maxSpeed)
+										player1x = player1x+maxSpeed;
+									else
+										player1x = x;
+									
+									// maybe redraw player1 
+									if (!heisenbergBlinking) {
+											lcd_draw_image(
+															player1x,                 // X Pos
+															playerWidth,   // Image Horizontal Width
+															player1y,                 // Y Pos
+															playerHeight,  // Image Vertical Height
+															playerBitmaps,       // Image
+															LCD_COLOR_BLUE,      // Foreground Color
+															LCD_COLOR_BLACK     // Background Color
+														);
+									}
+								}
+								// player 1 not moving
+								else {
+									if (heisenbergBlinking) {
+										// hide player1
+										lcd_draw_image(
+															player1x,                 // X Pos
+															playerWidth,   // Image Horizontal Width
+															player1y,                 // Y Pos
+															playerHeight,  // Image Vertical Height
+															playerBitmaps,       // Image
+															LCD_COLOR_BLACK,      // Foreground Color
+															LCD_COLOR_BLACK     // Background Color
+														);
+									}
+									else {
+										lcd_draw_image(
+															player1x,                 // X Pos
+															playerWidth,   // Image Horizontal Width
+															player1y,                 // Y Pos
+															playerHeight,  // Image Vertical Height
+															playerBitmaps,       // Image
+															LCD_COLOR_BLUE,      // Foreground Color
+															LCD_COLOR_BLACK     // Background Color
+														);
+									}
+								}
+								
+								
+								// player 2: joystick, speed follows the deflection
+								joystickX = input_step_x();
+								if (joystickX!=0){
+									// hide player2
+									lcd_draw_image(
+																player2x,                 // X Pos
+																playerWidth,   // Image Horizontal Width
+																player2y,                 // Y Pos
+																playerHeight,  // Image Vertical Height
+																playerBitmaps,       // Image
+																LCD_COLOR_BLACK,      // Foreground Color
+																LCD_COLOR_BLACK     // Background Color
+															);
+									player2x = player2x+joystickX;
+									// wall cutoffs
+									if (player2x<0+playerWidth/2)
+										player2x = playerWidth/2;
+									if (player2x>COLS-playerWidth/2)
+										player2x = COLS-playerWidth/2;
+									
+									// maybe redraw player2
+									if (!heisenbergBlinking){
+										lcd_draw_image(
+																player2x,                 // X Pos
+																playerWidth,   // Image Horizontal Width
+																player2y,                 // Y Pos
+																playerHeight,  // Image Vertical Height
+																playerBitmaps,       // Image
+																LCD_COLOR_BLUE,      // Foreground Color
+																LCD_COLOR_BLACK     // Background Color
+															);
+									}
+								}
+								// player 2 not moving
+								else {
+									if (heisenbergBlinking){
+										// hide player2
+										lcd_draw_image(
+																player2x,                 // X Pos
+																playerWidth,   // Image Horizontal Width
+																player2y,                 // Y Pos
+																playerHeight,  // Image Vertical Height
+																playerBitmaps,       // Image
+																LCD_COLOR_BLACK,      // Foreground Color
+																LCD_COLOR_BLACK     // Background Color
+															);
+									}
+									else {
+										lcd_draw_image(
+																player2x,                 // X Pos
+																playerWidth,   // Image Horizontal Width
+																player2y,                 // Y Pos
+																playerHeight,  // Image Vertical Height
+																playerBitmaps,       // Image
+																LCD_COLOR_BLUE,      // Foreground Color
+																LCD_COLOR_BLACK     // Background Color
+															);
+									}
+								}
+								
+								// BALL MOVEMENT
+								if (!ballWait) {
+									// hide ball
+									lcd_draw_image(
+															ballx,                 // X Pos
+															ballWidth,   // Image Horizontal Width
+															bally,                 // Y Pos
+															ballHeight,  // Image Vertical Height
+															ballBitmaps,       // Image
+															LCD_COLOR_BLACK,      // Foreground Color
+															LCD_COLOR_BLACK     // Background Color
+														);
+									ballx = ballx+ballChangex;
+									bally = bally+ballChangey;
+									// player 1 point
+									if (bally>ROWS-ballHeight){
+											// point
+											player1score = player1score+1;
+											rallyEnd();
+											// write score to EEPROM
+											saveSettings();
+											if (player1score>=winScore) {
+												// delay here for the loser to realize they've just lost and freeze frame that moment
+												waitLoser = 1;	
+												lcd_draw_image(
+															ballx,                 // X Pos
+															ballWidth,   // Image Horizontal Width
+															bally,                 // Y Pos
+															ballHeight,  // Image Vertical Height
+															ballBitmaps,       // Image
+															LCD_COLOR_RED,      // Foreground Color
+															LCD_COLOR_BLACK     // Background Color
+														);
+												break;
+											}
+											
+											// redraw score
+											drawScore();
+											// reset ball and wait for a bit
+											ballx = COLS/2;
+											bally = ROWS/2;
+											// randomize
+											randomizeBall();
+											
+											// wait for players to reset
+											ballWait = 1; 
+									}
+									// player 2 point
+									else if (bally<ballHeight){
+											// point
+											player2score = player2score+1;
+											rallyEnd();
+											// write score to EEPROM
+											saveSettings();
+						
+											if (player2score>=winScore) {
+												// delay here for the loser to realize they've just lost and freeze frame that moment
+												waitLoser = 1;	
+												lcd_draw_image(
+															ballx,                 // X Pos
+															ballWidth,   // Image Horizontal Width
+															bally,                 // Y Pos
+															ballHeight,  // Image Vertical Height
+															ballBitmaps,       // Image
+															LCD_COLOR_RED,      // Foreground Color
+															LCD_COLOR_BLACK     // Background Color
+														);
+												break;
+											}
+											
+											// redraw score
+											drawScore();
+											// reset ball and wait for a bit
+											ballx = COLS/2;
+											bally = ROWS/2;
+											// randomize
+											randomizeBall();
+											
+											// wait for players to reset
+											ballWait = 1; 
+									}
+									else {
+										// player contact 
+										if (playercontact()) {
+											rallyHit();
+											ballChangey = -ballChangey;
+											// for each player contact, randomly change the changex by a bit so not an infinite loop of up and down											
+											if (ballChangex==0 && rand()%noupdown==0)
+												ballChangex = ballChangex + (-1)^(rand() % 2); 
+										}	
+										// wallcontact 
+										if (wallcontact()) {
+											ballChangex = -ballChangex;
+										}
+									 }
+									 // maybe redraw ball
+									 if (heisenbergBlinking){
+										 lcd_draw_image(
+																ballx,                 // X Pos
+																ballWidth,   // Image Horizontal Width
+																bally,                 // Y Pos
+																ballHeight,  // Image Vertical Height
+																ballBitmaps,       // Image
+																LCD_COLOR_RED,      // Foreground Color
+																LCD_COLOR_BLACK     // Background Color
+															);
+									 }
+								}
+								// ball not moving
+								else {
+									if (!heisenbergBlinking){
+										// hide ball
+										lcd_draw_image(
+															ballx,                 // X Pos
+															ballWidth,   // Image Horizontal Width
+															bally,                 // Y Pos
+															ballHeight,  // Image Vertical Height
+															ballBitmaps,       // Image
+															LCD_COLOR_BLACK,      // Foreground Color
+															LCD_COLOR_BLACK     // Background Color
+														);
+									}
+									else {
+										lcd_draw_image(
+																ballx,                 // X Pos
+																ballWidth,   // Image Horizontal Width
+																bally,                 // Y Pos
+																ballHeight,  // Image Vertical Height
+																ballBitmaps,       // Image
+																LCD_COLOR_RED,      // Foreground Color
+																LCD_COLOR_BLACK     // Background Color
+															);
+									}
+								}
+								 break;
+//////////////// weird controls pong
+							// accelerometer vs buttons
+							case 3:
+								// PLAYER MOVEMENT
+								// player 1: accelerometer 
+								// screen goes from 0 to ROWS=320 and 0 to COLS=240
+								// paddle speed proportional to the filtered tilt
+								tiltSpeed = accelTiltToSpeed(accel_tilt_angle());
+								if (tiltSpeed!=0){
+									// hide player1
+									lcd_draw_image(
+															player1x,                 // X Pos
+															playerWidth,   // Image Horizontal Width
+															player1y,                 // Y Pos
+															playerHeight,  // Image Vertical Height
+															playerBitmaps,       // Image
+															LCD_COLOR_BLACK,      // Foreground Color
+															LCD_COLOR_BLACK     // Background Color
+														);
+									
+									// tilting the +X edge up moves left
+									player1x = player1x+tiltSpeed;
+									// wall cutoffs
+									if (player1x<0+playerWidth/2)
+										player1x = playerWidth/2;
+									if (player1x>COLS-playerWidth/2)
+										player1x = COLS-playerWidth/2;
+									
+									// redraw player1
+									lcd_draw_image(
+															player1x,                 // X Pos
+															playerWidth,   // Image Horizontal Width
+															player1y,                 // Y Pos
+															playerHeight,  // Image Vertical Height
+															playerBitmaps,       // Image
+															LCD_COLOR_BLUE,      // Foreground Color
+															LCD_COLOR_BLACK     // Background Color
+														);
+								}
+								
+								
+								// player 2: IO buttons
+								if (ioButtonLeft|ioButtonRight){
+									// hide player2
+									lcd_draw_image(
+																player2x,                 // X Pos
+																playerWidth,   // Image Horizontal Width
+																player2y,                 // Y Pos
+																playerHeight,  // Image Vertical Height
+																playerBitmaps,       // Image
+																LCD_COLOR_BLACK,      // Foreground Color
+																LCD_COLOR_BLACK     // Background Color
+															);
+									if (ioButtonLeft) { // left  
+										player2x = player2x-maxSpeed;
+										// wall cutoffs
+										if (player2x<0+playerWidth/2)
+											player2x = player2x+maxSpeed;
+									}
+									if (ioButtonRight) { // right
+										player2x = player2x+maxSpeed;
+										// wall cutoffs
+										if (player2x>COLS-playerWidth/2)
+											player2x = player2x-maxSpeed;
+									}
+									
+									// redraw player2
+									lcd_draw_image(
+																player2x,                 // X Pos
+																playerWidth,   // Image Horizontal Width
+																player2y,                 // Y Pos
+																playerHeight,  // Image Vertical Height
+																playerBitmaps,       // Image
+																LCD_COLOR_BLUE,      // Foreground Color
+																LCD_COLOR_BLACK     // Background Color
+															);
+								}
+								
+								// BALL MOVEMENT
+								delayWaitFunction();
+								if (!ballWait) {
+									// hide ball
+									lcd_draw_image(
+															ballx,                 // X Pos
+															ballWidth,   // Image Horizontal Width
+															bally,                 // Y Pos
+															ballHeight,  // Image Vertical Height
+															ballBitmaps,       // Image
+															LCD_COLOR_BLACK,      // Foreground Color
+															LCD_COLOR_BLACK     // Background Color
+														);
+									ballx = ballx+ballChangex;
+									bally = bally+ballChangey;
+									// player 1 point
+									if (bally>ROWS-ballHeight){
+											// point
+											player1score = player1score+1;
+											rallyEnd();
+											// write score to EEPROM
+											saveSettings();
+											if (player1score>=winScore) {
+												// delay here for the loser to realize they've just lost and freeze frame that moment
+												waitLoser = 1;	
+												lcd_draw_image(
+															ballx,                 // X Pos
+															ballWidth,   // Image Horizontal Width
+															bally,                 // Y Pos
+															ballHeight,  // Image Vertical Height
+															ballBitmaps,       // Image
+															LCD_COLOR_RED,      // Foreground Color
+															LCD_COLOR_BLACK     // Background Color
+														);
+												break;
+											}
+											
+											// redraw score
+											drawScore();
+											// reset ball and wait for a bit
+											ballx = COLS/2;
+											bally = ROWS/2;
+											// randomize
+											randomizeBall();
+											
+											// wait for players to reset
+											ballWait = 1; 
+									}
+									// player 2 point
+									else if (bally<ballHeight){
+											// point
+											player2score = player2score+1;
+											rallyEnd();
+											// write score to EEPROM
+											saveSettings();
+						
+											if (player2score>=winScore) {
+												// delay here for the loser to realize they've just lost and freeze frame that moment
+												waitLoser = 1;	
+												lcd_draw_image(
+															ballx,                 // X Pos
+															ballWidth,   // Image Horizontal Width
+															bally,                 // Y Pos
+															ballHeight,  // Image Vertical Height
+															ballBitmaps,       // Image
+															LCD_COLOR_RED,      // Foreground Color
+															LCD_COLOR_BLACK     // Background Color
+														);
+												break;
+											}
+											
+											// redraw score
+											drawScore();
+											// reset ball and wait for a bit
+											ballx = COLS/2;
+											bally = ROWS/2;
+											// randomize
+											randomizeBall();
+											
+											// wait for players to reset
+											ballWait = 1; 
+									}
+									else {
+										// player contact 
+										if (playercontact()) {
+											rallyHit();
+											ballChangey = -ballChangey;
+											// for each player contact, randomly change the changex by a bit so not an infinite loop of up and down											
+											if (ballChangex==0 && rand()%noupdown==0)
+												ballChangex = ballChangex + (-1)^(rand() % 2); 
+										}	
+										// wallcontact 
+										if (wallcontact()) {
+											ballChangex = -ballChangex;
+										}
+									 }
+									 //redraw ball
+									 lcd_draw_image(
+																ballx,                 // X Pos
+																ballWidth,   // Image Horizontal Width
+																bally,                 // Y Pos
+																ballHeight,  // Image Vertical Height
+																ballBitmaps,       // Image
+																LCD_COLOR_RED,      // Foreground Color
+																LCD_COLOR_BLACK     // Background Color
+															);
+								}
+								
+								break;
+//////////////// multi dimensional pong
+							// not just left/right, but up down
+							case 4:
+								// PLAYER MOVEMENT
+								// player 1: touchscreen 
+								// screen goes from 0 to ROWS=320 and 0 to COLS=240
+								if (touch.touches>0){
+									int x, y;
+									// hide player1
+									lcd_draw_image(
+															player1x,                 // X Pos
+															playerWidth,   // Image Horizontal Width
+															player1y,                 // Y Pos
+															playerHeight,  // Image Vertical Height
+															playerBitmaps,       // Image
+															LCD_COLOR_BLACK,      // Foreground Color
+															LCD_COLOR_BLACK     // Background Color
+														);
+									x = touch.x;
+									y = touch.y;
+									if (player1x-x>maxSpeed)
+										player1x = player1x-maxSpeed;
+									else if (x-player1x>maxSpeed)
+										player1x = player1x+maxSpeed;
+									else
+										player1x = x;
+									if (player1y-y>maxSpeed)
+										player1y = player1y-maxSpeed;
+									else if (y-player1y>maxSpeed)
+										player1y = player1y+maxSpeed;
+									else
+										player1y = y;
+									
+									// redraw player1
+									lcd_draw_image(
+															player1x,                 // X Pos
+															playerWidth,   // Image Horizontal Width
+															player1y,                 // Y Pos
+															playerHeight,  // Image Vertical Height
+															playerBitmaps,       // Image
+															LCD_COLOR_BLUE,      // Foreground Color
+															LCD_COLOR_BLACK     // Background Color
+														);
+								}
+								
+								
+								// player 2: joystick, speed follows the deflection
+								joystickX = input_step_x();
+								joystickY = input_step_y();
+								if (joystickX!=0 || joystickY!=0){
+									// hide player2
+									lcd_draw_image(
+																player2x,                 // X Pos
+																playerWidth,   // Image Horizontal Width
+																player2y,                 // Y Pos
+																playerHeight,  // Image Vertical Height
+																playerBitmaps,       // Image
+																LCD_COLOR_BLACK,      // Foreground Color
+																LCD_COLOR_BLACK     // Background Color
+															);
+									player2x = player2x+joystickX;
+									player2y = player2y+joystickY;
+									// wall cutoffs
+									if (player2x<0+playerWidth/2)
+										player2x = playerWidth/2;
+									if (player2x>(COLS-playerWidth/2))
+										player2x = COLS-playerWidth/2;
+									if (player2y<0+(playerHeight/2))
+										player2y = playerHeight/2;
+									if (player2y>(ROWS-(playerHeight/2)))
+										player2y = ROWS-(playerHeight/2);
+									
+									// redraw player2
+									lcd_draw_image(
+																player2x,                 // X Pos
+																playerWidth,   // Image Horizontal Width
+																player2y,                 // Y Pos
+																playerHeight,  // Image Vertical Height
+																playerBitmaps,       // Image
+																LCD_COLOR_BLUE,      // Foreground Color
+																LCD_COLOR_BLACK     // Background Color
+															);
+								}
+								
+								// BALL MOVEMENT
+								delayWaitFunction();
+								if (!ballWait) {
+									// hide ball
+									lcd_draw_image(
+															ballx,                 // X Pos
+															ballWidth,   // Image Horizontal Width
+															bally,                 // Y Pos
+															ballHeight,  // Image Vertical Height
+															ballBitmaps,       // Image
+															LCD_COLOR_BLACK,      // Foreground Color
+															LCD_COLOR_BLACK     // Background Color
+														);
+									ballx = ballx+ballChangex;
+									bally = bally+ballChangey;
+									// player 1 point
+									if (bally>ROWS-ballHeight){
+											// point
+											player1score = player1score+1;
+											rallyEnd();
+											// write score to EEPROM
+											saveSettings();
+											if (player1score>=winScore) {
+												// delay here for the loser to realize they've just lost and freeze frame that moment
+												waitLoser = 1;	
+												lcd_draw_image(
+															ballx,                 // X Pos
+															ballWidth,   // Image Horizontal Width
+															bally,                 // Y Pos
+															ballHeight,  // Image Vertical Height
+															ballBitmaps,       // Image
+															LCD_COLOR_RED,      // Foreground Color
+															LCD_COLOR_BLACK     // Background Color
+														);
+												break;
+											}
+											
+											// redraw score
+											drawScore();
+											// reset players
+											lcd_draw_image(
+															player1x,                 // X Pos
+															playerWidth,   // Image Horizontal Width
+															player1y,                 // Y Pos
+															playerHeight,  // Image Vertical Height
+															playerBitmaps,       // Image
+															LCD_COLOR_BLACK,      // Foreground Color
+															LCD_COLOR_BLACK     // Background Color
+														);
+											lcd_draw_image(
+																player2x,                 // X Pos
+																playerWidth,   // Image Horizontal Width
+																player2y,                 // Y Pos
+																playerHeight,  // Image Vertical Height
+																playerBitmaps,       // Image
+																LCD_COLOR_BLACK,      // Foreground Color
+																LCD_COLOR_BLACK     // Background Color
+															);
+											player1x = (COLS/2);
+											player1y = (ROWS/6);
+											player2x = (COLS/2);
+											player2y = (5*ROWS/6);
+											lcd_draw_image(
+															player1x,                 // X Pos
+															playerWidth,   // Image Horizontal Width
+															player1y,                 // Y Pos
+															playerHeight,  // Image Vertical Height
+															playerBitmaps,       // Image
+															LCD_COLOR_BLUE,      // Foreground Color
+															LCD_COLOR_BLACK     // Background Color
+														);
+											lcd_draw_image(
+															player2x,                 // X Pos
+															playerWidth,   // Image Horizontal Width
+															player2y,                 // Y Pos
+															playerHeight,  // Image Vertical Height
+															playerBitmaps,       // Image
+															LCD_COLOR_BLUE,      // Foreground Color
+															LCD_COLOR_BLACK     // Background Color
+														);
+											// reset ball 
+											ballx = COLS/2;
+											bally = ROWS/2;
+											// randomize
+											randomizeBall();
+											
+											// wait for players to reset
+											ballWait = 1; 
+									}
+									// player 2 point
+									else if (bally<ballHeight){
+											// point
+											player2score = player2score+1;
+											rallyEnd();
+											// write score to EEPROM
+											saveSettings();
+						
+											if (player2score>=winScore) {
+												// delay here for the loser to realize they've just lost and freeze frame that moment
+												waitLoser = 1;	
+												lcd_draw_image(
+															ballx,                 // X Pos
+															ballWidth,   // Image Horizontal Width
+															bally,                 // Y Pos
+															ballHeight,  // Image Vertical Height
+															ballBitmaps,       // Image
+															LCD_COLOR_RED,      // Foreground Color
+															LCD_COLOR_BLACK     // Background Color
+														);
+												break;
+											}
+											
+											// redraw score
+											drawScore();
+											// reset players
+											lcd_draw_image(
+															player1x,                 // X Pos
+															playerWidth,   // Image Horizontal Width
+															player1y,                 // Y Pos
+															playerHeight,  // Image Vertical Height
+															playerBitmaps,       // Image
+															LCD_COLOR_BLACK,      // Foreground Color
+															LCD_COLOR_BLACK     // Background Color
+														);
+											lcd_draw_image(
+																player2x,                 // X Pos
+																playerWidth,   // Image Horizontal Width
+																player2y,                 // Y Pos
+																playerHeight,  // Image Vertical Height
+																playerBitmaps,       // Image
+																LCD_COLOR_BLACK,      // Foreground Color
+																LCD_COLOR_BLACK     // Background Color
+															);
+											player1x = (COLS/2);
+											player1y = (ROWS/6);
+											player2x = (COLS/2);
+											player2y = (5*ROWS/6);
+											lcd_draw_image(
+															player1x,                 // X Pos
+															playerWidth,   // Image Horizontal Width
+															player1y,                 // Y Pos
+															playerHeight,  // Image Vertical Height
+															playerBitmaps,       // Image
+															LCD_COLOR_BLUE,      // Foreground Color
+															LCD_COLOR_BLACK     // Background Color
+														);
+											lcd_draw_image(
+															player2x,                 // X Pos
+															playerWidth,   // Image Horizontal Width
+															player2y,                 // Y Pos
+															playerHeight,  // Image Vertical Height
+															playerBitmaps,       // Image
+															LCD_COLOR_BLUE,      // Foreground Color
+															LCD_COLOR_BLACK     // Background Color
+														);
+											// reset ball and wait for a bit
+											ballx = COLS/2;
+											bally = ROWS/2;
+											// randomize
+											randomizeBall();
+											
+											// wait for players to reset
+											ballWait = 1; 
+									}
+									else {
+										// player contact 
+										if (playercontact()) {
+											rallyHit();
+											ballChangey = -ballChangey;
+											// for each player contact, randomly change the changex by a bit so not an infinite loop of up and down											
+											if (ballChangex==0 && rand()%noupdown==0)
+												ballChangex = ballChangex + (-1)^(rand() % 2); 
+										}	
+										// wallcontact 
+										if (wallcontact()) {
+											ballChangex = -ballChangex;
+										}
+									 }
+									 //redraw ball
+									 lcd_draw_image(
+																ballx,                 // X Pos
+																ballWidth,   // Image Horizontal Width
+																bally,                 // Y Pos
+																ballHeight,  // Image Vertical Height
+																ballBitmaps,       // Image
+																LCD_COLOR_RED,      // Foreground Color
+																LCD_COLOR_BLACK     // Background Color
+															);
+								}
+
+								break;
+							// possible future gamemodes
+							// multiple ball pong
+							// powerup pong
+							// colorful craziness pong
+							// run from chasing ball
+							// keep ball from touching wall
+							// pong where the old images aren't hidden (so laggy window being dragged around pong or slurred pong), screen only cleared on point
+							// random game mode
+							default:
+								gamemode = 0; // set to regular pong if error value
+								break;
+						} 
+						telemetry_phase(TELEMETRY_PHASE_IDLE);
+						sendTelemetry();
+						PROFILE_END(PROFILE_ZONE_TICK);
+						gameTickDone();
+						}
+				// waiting for the next tick, persist anything that changed
+				else {
+						flushSettings();
+				}
+		}
+	};
+	// make sure the final scores reach the EEPROM
+	settings_flush(true);
+	tunables_flush(true);
+	match_db_flush(true);
+	
+	// freeze screen at the end, the winner's rainbow keeps turning
+	while (1) {
+		updateLeds();
+	}
+}
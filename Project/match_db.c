@@ -0,0 +1,349 @@
+#include <stddef.h>
+#include "match_db.h"
+#include "crc.h"
+
+typedef __packed struct {
+	uint8_t magic;
+	uint8_t version;
+	uint8_t head;         // history slot the next match is written to
+	uint8_t reserved;
+	uint32_t total;       // matches recorded since the database was created
+	match_db_mode_stats_t modes[MATCH_DB_NUM_MODES];
+	uint16_t crc;
+} match_db_header_t;
+
+// RAM copy of the header, the menu reads the stats from here
+static match_db_header_t header;
+
+// raw history records, large enough for the whole history
+static uint8_t historyBuffer[MATCH_DB_HISTORY_LEN * MATCH_DB_RECORD_SIZE];
+
+// packed records waiting to be written, oldest first
+typedef struct {
+	uint8_t slot;
+	uint8_t record[MATCH_DB_RECORD_SIZE];
+} match_db_pending_t;
+
+static match_db_pending_t pending[MATCH_DB_PENDING_LEN];
+static match_db_stats_t dbStats;
+
+//*****************************************************************************
+// Match number of the total'th match.  Numbers run from 1 to 
+// MATCH_DB_NUMBER_MASK and wrap, 0 is never used.
+//*****************************************************************************
+static uint16_t match_db_number(uint32_t total)
+{
+	return (total - 1) % MATCH_DB_NUMBER_MASK + 1;
+}
+
+//*****************************************************************************
+// True if match number a was recorded after b.  Numbers are compared 
+// modulo 2^14, any two in the history are far less than 2^13 apart.
+//*****************************************************************************
+static bool match_db_newer(uint16_t a, uint16_t b)
+{
+	uint16_t ahead = (a - b) & MATCH_DB_NUMBER_MASK;
+	
+	return ahead != 0 && ahead <= MATCH_DB_NUMBER_MASK / 2;
+}
+
+//*****************************************************************************
+// Packs a match into its 64 bit EEPROM record, least significant byte first
+//*****************************************************************************
+static void match_db_pack(const match_record_t *match, uint8_t *record)
+{
+	uint64_t bits;
+	int i;
+	
+	bits  = (uint64_t)(match->mode & 0x07);
+	bits |= (uint64_t)(match->winner & 0x01) << 3;
+	bits |= (uint64_t)(match->score1 & MATCH_DB_MAX_SCORE) << 4;
+	bits |= (uint64_t)(match->score2 & MATCH_DB_MAX_SCORE) << 9;
+	bits |= (uint64_t)(match->rally & MATCH_DB_MAX_RALLY) << 14;
+	bits |= (uint64_t)(match->duration & MATCH_DB_MAX_DURATION) << 26;
+	bits |= (uint64_t)(match->seed) << 42;
+	bits |= (uint64_t)(match->number & MATCH_DB_NUMBER_MASK) << 50;
+	
+	for (i = 0; i < MATCH_DB_RECORD_SIZE; i++) {
+		record[i] = bits & 0xFF;
+		bits >>= 8;
+	}
+}
+
+//*****************************************************************************
+// Unpacks a 64 bit EEPROM record.  Returns false for an erased record and
+// for one that no match could have produced: a mode past the last one,
+// match number 0 (an all zero record) or a winner without the higher
+// score, ties are played on and never recorded.
+//*****************************************************************************
+static bool match_db_unpack(const uint8_t *record, match_record_t *match)
+{
+	uint64_t bits = 0;
+	int i;
+	
+	for (i = MATCH_DB_RECORD_SIZE - 1; i >= 0; i--)
+		bits = (bits << 8) | record[i];
+	
+	if (bits == 0xFFFFFFFFFFFFFFFFULL)
+		return false;
+	
+	match->mode = bits & 0x07;
+	match->winner = (bits >> 3) & 0x01;
+	match->score1 = (bits >> 4) & MATCH_DB_MAX_SCORE;
+	match->score2 = (bits >> 9) & MATCH_DB_MAX_SCORE;
+	match->rally = (bits >> 14) & MATCH_DB_MAX_RALLY;
+	match->duration = (bits >> 26) & MATCH_DB_MAX_DURATION;
+	match->seed = (bits >> 42) & 0xFF;
+	match->number = (bits >> 50) & MATCH_DB_NUMBER_MASK;
+	
+	if (match->mode >= MATCH_DB_NUM_MODES || match->number == 0)
+		return false;
+	if (match->winner == 0 ? match->score1 <= match->score2 : match->score2 <= match->score1)
+		return false;
+	return true;
+}
+
+//*****************************************************************************
+// Adds a match to the stats of its game mode
+//*****************************************************************************
+static void match_db_add_stats(const match_record_t *match)
+{
+	match_db_mode_stats_t *stats;
+	
+	if (match->mode >= MATCH_DB_NUM_MODES)
+		return;
+	stats = &header.modes[match->mode];
+	
+	if (match->winner == 0) {
+		if (stats->p1Wins < 0xFFFF)
+			stats->p1Wins++;
+	}
+	else {
+		if (stats->p2Wins < 0xFFFF)
+			stats->p2Wins++;
+	}
+	
+	if (match->rally > stats->bestRally)
+		stats->bestRally = match->rally;
+	
+	if (stats->fastestWin == 0 || match->duration < stats->fastestWin)
+		stats->fastestWin = match->duration;
+}
+
+//*****************************************************************************
+// Writes the RAM copy of the header to the EEPROM
+//*****************************************************************************
+static i2c_status_t match_db_write_header(void)
+{
+	header.crc = crc16_ccitt(CRC16_INIT, (uint8_t *)&header, offsetof(match_db_header_t, crc));
+	return eeprom_write_block(EEPROM_I2C_BASE, MATCH_DB_HEADER_ADDR, (uint8_t *)&header, sizeof(header));
+}
+
+//*****************************************************************************
+// Writes the oldest pending record, or the header once no record is left
+//*****************************************************************************
+static i2c_status_t match_db_write_next(void)
+{
+	i2c_status_t status;
+	
+	if (dbStats.pending > 0) {
+		status = eeprom_write_block(
+			EEPROM_I2C_BASE, 
+			MATCH_DB_HISTORY_ADDR + pending[0].slot * MATCH_DB_RECORD_SIZE, 
+			pending[0].record, 
+			MATCH_DB_RECORD_SIZE
+		);
+		if (status == I2C_OK) {
+			dbStats.pending--;
+			memmove(&pending[0], &pending[1], dbStats.pending * sizeof(pending[0]));
+		}
+		return status;
+	}
+	
+	status = match_db_write_header();
+	if (status == I2C_OK)
+		dbStats.headerDirty = false;
+	return status;
+}
+
+//*****************************************************************************
+// Recreates the header from the history records.  The newest record is the 
+// one the other match numbers are behind, modulo 2^14.  The total is only
+// known modulo MATCH_DB_NUMBER_MASK, it is taken past the wrap when there 
+// are more records than the newest number.
+//*****************************************************************************
+static void match_db_rebuild(void)
+{
+	match_record_t match;
+	uint16_t newest = 0;
+	uint8_t valid = 0;
+	uint8_t slot;
+	
+	memset(&header, 0, sizeof(header));
+	header.magic = MATCH_DB_MAGIC;
+	header.version = MATCH_DB_VERSION;
+	
+	eeprom_read_block(EEPROM_I2C_BASE, MATCH_DB_HISTORY_ADDR, historyBuffer, sizeof(historyBuffer));
+	
+	for (slot = 0; slot < MATCH_DB_HISTORY_LEN; slot++) {
+		if (!match_db_unpack(&historyBuffer[slot * MATCH_DB_RECORD_SIZE], &match))
+			continue;
+		
+		match_db_add_stats(&match);
+		if (valid == 0 || match_db_newer(match.number, newest)) {
+			newest = match.number;
+			header.head = (slot + 1) % MATCH_DB_HISTORY_LEN;
+		}
+		valid++;
+	}
+	
+	header.total = newest;
+	if (header.total < valid)
+		header.total += MATCH_DB_NUMBER_MASK;
+	
+	dbStats.headerDirty = true;
+	match_db_flush(true);
+}
+
+//*****************************************************************************
+// Reads the header into RAM, rebuilding it if it is missing or corrupt.
+//*****************************************************************************
+void match_db_init(void)
+{
+	uint16_t crc;
+	
+	memset(&dbStats, 0, sizeof(dbStats));
+	eeprom_read_block(EEPROM_I2C_BASE, MATCH_DB_HEADER_ADDR, (uint8_t *)&header, sizeof(header));
+	crc = crc16_ccitt(CRC16_INIT, (uint8_t *)&header, offsetof(match_db_header_t, crc));
+	
+	if (
+		header.magic != MATCH_DB_MAGIC || 
+		header.version != MATCH_DB_VERSION || 
+		header.head >= MATCH_DB_HISTORY_LEN ||
+		header.crc != crc
+	) {
+		match_db_rebuild();
+	}
+}
+
+//*****************************************************************************
+// Appends a match to the history and updates the stats of its game mode.
+//*****************************************************************************
+void match_db_record(match_record_t *match)
+{
+	match_db_pending_t *entry;
+	
+	if (dbStats.pending >= MATCH_DB_PENDING_LEN) {
+		dbStats.droppedCount++;
+		match->number = 0;
+		return;
+	}
+	
+	header.total++;
+	match->number = match_db_number(header.total);
+	
+	entry = &pending[dbStats.pending++];
+	entry->slot = header.head;
+	match_db_pack(match, entry->record);
+	header.head = (header.head + 1) % MATCH_DB_HISTORY_LEN;
+	
+	match_db_add_stats(match);
+	dbStats.headerDirty = true;
+	match_db_flush(true);
+}
+
+//*****************************************************************************
+// Writes pending records, then the header.  Stops at the first failure so
+// a record is never left out behind a header that counts it.
+//*****************************************************************************
+bool match_db_flush(bool force)
+{
+	while (dbStats.pending > 0 || dbStats.headerDirty) {
+		if (!force && eeprom_busy(EEPROM_I2C_BASE))
+			return false;
+		if (match_db_write_next() != I2C_OK) {
+			dbStats.failedCount++;
+			return false;
+		}
+	}
+	return true;
+}
+
+//*****************************************************************************
+// Returns the write statistics.
+//*****************************************************************************
+void match_db_get_stats(match_db_stats_t *stats)
+{
+	*stats = dbStats;
+}
+
+//*****************************************************************************
+// Returns the stats of a game mode from the RAM copy of the header.
+//*****************************************************************************
+const match_db_mode_stats_t *match_db_mode_stats(uint8_t mode)
+{
+	if (mode >= MATCH_DB_NUM_MODES)
+		return NULL;
+	return &header.modes[mode];
+}
+
+//*****************************************************************************
+// Returns the number of matches recorded.
+//*****************************************************************************
+uint32_t match_db_total(void)
+{
+	return header.total;
+}
+
+//*****************************************************************************
+// Reads up to max_records of the most recent matches, newest first.
+//*****************************************************************************
+uint8_t match_db_history(match_record_t *records, uint8_t max_records)
+{
+	uint8_t count;
+	uint8_t first;
+	uint8_t tail;
+	uint8_t offset;
+	uint8_t i;
+	uint8_t n = 0;
+	
+	if (records == NULL)
+		return 0;
+	
+	count = max_records;
+	if (count > MATCH_DB_HISTORY_LEN)
+		count = MATCH_DB_HISTORY_LEN;
+	if (count > header.total)
+		count = header.total;
+	if (count == 0)
+		return 0;
+	
+	// the wanted records are the count slots before head.  If they wrap 
+	// around the end of the history they are read in two pieces.
+	first = (header.head + MATCH_DB_HISTORY_LEN - count) % MATCH_DB_HISTORY_LEN;
+	if (first + count <= MATCH_DB_HISTORY_LEN) {
+		eeprom_read_block(EEPROM_I2C_BASE, MATCH_DB_HISTORY_ADDR + first * MATCH_DB_RECORD_SIZE, 
+		                  historyBuffer, count * MATCH_DB_RECORD_SIZE);
+	}
+	else {
+		tail = MATCH_DB_HISTORY_LEN - first;
+		eeprom_read_block(EEPROM_I2C_BASE, MATCH_DB_HISTORY_ADDR + first * MATCH_DB_RECORD_SIZE, 
+		                  historyBuffer, tail * MATCH_DB_RECORD_SIZE);
+		eeprom_read_block(EEPROM_I2C_BASE, MATCH_DB_HISTORY_ADDR, 
+		                  &historyBuffer[tail * MATCH_DB_RECORD_SIZE], (count - tail) * MATCH_DB_RECORD_SIZE);
+	}
+	
+	// records the EEPROM has not taken yet come from RAM
+	for (i = 0; i < dbStats.pending; i++) {
+		offset = (pending[i].slot + MATCH_DB_HISTORY_LEN - first) % MATCH_DB_HISTORY_LEN;
+		if (offset < count)
+			memcpy(&historyBuffer[offset * MATCH_DB_RECORD_SIZE], pending[i].record, MATCH_DB_RECORD_SIZE);
+	}
+	
+	for (i = count; i > 0; i--) {
+		if (match_db_unpack(&historyBuffer[(i - 1) * MATCH_DB_RECORD_SIZE], &records[n]))
+			n++;
+	}
+	
+	return n;
+}
@@ -0,0 +1,134 @@
+#ifndef __MATCH_DB_H__
+#define __MATCH_DB_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include "eeprom.h"
+
+//*****************************************************************************
+// Match history and per-mode leaderboard kept in the EEPROM.
+//
+// EEPROM layout
+//    MATCH_DB_HEADER_ADDR    64 byte header, cached in RAM.  Holds the total
+//                            number of matches, the next history slot and 
+//                            the stats of every game mode.  CRC protected.
+//    MATCH_DB_HISTORY_ADDR   circular history of the last 
+//                            MATCH_DB_HISTORY_LEN matches, 8 bytes each
+//
+// Each history record is bit packed into 64 bits
+//    bits  0-2   game mode
+//    bit   3     winner, 0 for player 1 and 1 for player 2
+//    bits  4-8   player 1 final score
+//    bits  9-13  player 2 final score
+//    bits 14-25  longest rally, in paddle hits
+//    bits 26-41  duration, in game ticks
+//    bits 42-49  random seed the match was played with
+//    bits 50-63  match number, counts 1 to MATCH_DB_NUMBER_MASK and wraps
+//                back to 1
+//
+// Records that fail the range checks in match_db_unpack(), for example an
+// all zero one, are treated as empty.  A record or header the EEPROM 
+// fails to take stays pending in RAM and match_db_flush() retries it.
+// Records always go out before the header, so the header never points 
+// past a record that was not written.  tools/match_db_check.c runs the
+// database against a 4K EEPROM image on the PC.
+//*****************************************************************************
+
+#define MATCH_DB_HEADER_ADDR      512
+#define MATCH_DB_HEADER_SIZE      64
+#define MATCH_DB_HISTORY_ADDR     (MATCH_DB_HEADER_ADDR + MATCH_DB_HEADER_SIZE)
+#define MATCH_DB_HISTORY_LEN      64
+#define MATCH_DB_RECORD_SIZE      8
+
+#define MATCH_DB_NUM_MODES        6
+
+#define MATCH_DB_MAGIC            0x5A
+#define MATCH_DB_VERSION          1
+
+// field limits of a packed record
+#define MATCH_DB_MAX_SCORE        0x1F
+#define MATCH_DB_MAX_RALLY        0xFFF
+#define MATCH_DB_MAX_DURATION     0xFFFF
+#define MATCH_DB_NUMBER_MASK      0x3FFF
+
+// records held in RAM while the EEPROM does not take them
+#define MATCH_DB_PENDING_LEN      4
+
+typedef struct {
+	uint8_t mode;
+	uint8_t winner;       // 0 for player 1, 1 for player 2
+	uint8_t score1;
+	uint8_t score2;
+	uint16_t rally;       // longest rally, in paddle hits
+	uint16_t duration;    // in game ticks
+	uint8_t seed;
+	uint16_t number;      // filled in by match_db_record()
+} match_record_t;
+
+typedef __packed struct {
+	uint16_t p1Wins;
+	uint16_t p2Wins;
+	uint16_t bestRally;
+	uint16_t fastestWin;  // in game ticks, 0 until a match was played
+} match_db_mode_stats_t;
+
+typedef struct {
+	uint32_t failedCount;     // record and header writes the EEPROM refused
+	uint32_t droppedCount;    // matches lost because the pending records were full
+	uint8_t pending;          // records not in the EEPROM yet
+	bool headerDirty;         // RAM header is newer than the EEPROM
+} match_db_stats_t;
+
+//*****************************************************************************
+// Reads the header into RAM.  If the header is missing or corrupt it is
+// rebuilt from the history records that are still in the EEPROM, so stats
+// of matches that already left the history are lost.  This blocks, so it 
+// is only called at boot.
+//*****************************************************************************
+void match_db_init(void);
+
+//*****************************************************************************
+// Appends a match to the history and updates the stats of its game mode.
+// Writes one history record and the header, waiting for the EEPROM.  If a
+// write fails the match is kept pending for match_db_flush().  With 
+// MATCH_DB_PENDING_LEN records already pending the match is dropped and
+// its number is set to 0.
+//*****************************************************************************
+void match_db_record(match_record_t *match);
+
+//*****************************************************************************
+// Writes pending records, then the header.  Works like settings_flush(): 
+// unless force is set it stops as soon as the EEPROM is busy, so an idle
+// call writes one record or the header at most.  A failed write stays 
+// pending and is counted.
+//
+// Returns true once nothing is pending.
+//*****************************************************************************
+bool match_db_flush(bool force);
+
+//*****************************************************************************
+// Returns the write statistics.
+//*****************************************************************************
+void match_db_get_stats(match_db_stats_t *stats);
+
+//*****************************************************************************
+// Returns the stats of a game mode from the RAM copy of the header, or NULL
+// for an invalid mode.  Does not touch the EEPROM.
+//*****************************************************************************
+const match_db_mode_stats_t *match_db_mode_stats(uint8_t mode);
+
+//*****************************************************************************
+// Returns the number of matches recorded.  Does not touch the EEPROM.
+//*****************************************************************************
+uint32_t match_db_total(void);
+
+//*****************************************************************************
+// Reads up to max_records of the most recent matches, newest first.  The 
+// history is fetched with at most two sequential reads.
+//
+// Returns the number of records copied into records.
+//*****************************************************************************
+uint8_t match_db_history(match_record_t *records, uint8_t max_records);
+
+#endif
@@ -0,0 +1,343 @@
+#include "netplay.h"
+
+#define NETPLAY_FLAG_PLAYER       (1 << 0)
+#define NETPLAY_FLAG_CHECKSUM     (1 << 1)
+
+// Inputs of tick t are at [t & NETPLAY_HISTORY_MASK]
+#define NETPLAY_HISTORY_MASK      (NETPLAY_HISTORY - 1)
+#define NETPLAY_SNAPSHOT_MASK     (NETPLAY_MAX_ROLLBACK - 1)
+
+#define NETPLAY_NO_ROLLBACK       0xFFFFFFFF
+
+static pong_sim_config_t simConfig;
+static uint16_t configChecksum;
+static uint8_t localPlayer;
+static uint32_t simSeed;
+static netplay_status_t netStatus;
+
+// Ticks 0 to state.tick-1 have been simulated
+static pong_sim_state_t state;
+// The state before tick t is at [t & NETPLAY_SNAPSHOT_MASK]
+static pong_sim_state_t snapshots[NETPLAY_MAX_ROLLBACK];
+
+static int8_t localInputs[NETPLAY_HISTORY];
+static int8_t remoteInputs[NETPLAY_HISTORY];
+// The remote input each simulated tick used, real or predicted
+static int8_t usedInputs[NETPLAY_HISTORY];
+
+// Local inputs below localNext are recorded, remote inputs below
+// remoteNext have arrived, and the other board has our inputs below
+// remoteAck
+static uint32_t localNext;
+static uint32_t remoteNext;
+static uint32_t remoteAck;
+
+// Earliest simulated tick that used a wrong prediction
+static uint32_t rollbackFrom;
+
+// Checksum of the state after c ticks is at [c & NETPLAY_HISTORY_MASK],
+// known for every c up to confirmed
+static uint16_t checksums[NETPLAY_HISTORY];
+static uint32_t confirmed;
+
+// The newest checksum from the other board not compared yet
+static bool remoteChecksumPending;
+static uint32_t remoteChecksumTicks;
+static uint16_t remoteChecksum;
+
+// Tick the match was won on, NETPLAY_NO_ROLLBACK while playing
+static uint32_t winTick;
+static uint8_t winner;
+
+static netplay_stats_t netStats;
+
+static uint8_t *netplay_put32(uint8_t *p, uint32_t value)
+{
+	*p++ = value;
+	*p++ = value >> 8;
+	*p++ = value >> 16;
+	*p++ = value >> 24;
+	return p;
+}
+
+static uint32_t netplay_get32(const uint8_t *p)
+{
+	return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+//*****************************************************************************
+// Simulates state.tick with the real remote input if it has arrived,
+// otherwise with the last one that did.
+//*****************************************************************************
+static void netplay_simulate(void)
+{
+	uint32_t tick = state.tick;
+	int8_t local = localInputs[tick & NETPLAY_HISTORY_MASK];
+	int8_t remote;
+
+	if (tick < remoteNext)
+		remote = remoteInputs[tick & NETPLAY_HISTORY_MASK];
+	else if (remoteNext > 0)
+		remote = remoteInputs[(remoteNext - 1) & NETPLAY_HISTORY_MASK];
+	else
+		remote = 0;
+	usedInputs[tick & NETPLAY_HISTORY_MASK] = remote;
+
+	snapshots[tick & NETPLAY_SNAPSHOT_MASK] = state;
+	if (localPlayer == 0)
+		pong_sim_step(&state, &simConfig, local, remote);
+	else
+		pong_sim_step(&state, &simConfig, remote, local);
+}
+
+//*****************************************************************************
+// Puts the game back to before the first mispredicted tick and simulates
+// up to where it was.
+//*****************************************************************************
+static void netplay_rollback(void)
+{
+	uint32_t end = state.tick;
+	uint32_t ticks = end - rollbackFrom;
+
+	state = snapshots[rollbackFrom & NETPLAY_SNAPSHOT_MASK];
+	while (state.tick < end)
+		netplay_simulate();
+
+	netStats.rollbacks++;
+	netStats.resimulated += ticks;
+	if (ticks > netStats.maxRollback)
+		netStats.maxRollback = ticks;
+	rollbackFrom = NETPLAY_NO_ROLLBACK;
+}
+
+//*****************************************************************************
+// Checksums the states that became final, every tick below both remoteNext
+// and state.tick, and compares the one the other board sent.
+//*****************************************************************************
+static void netplay_confirm(void)
+{
+	uint32_t last = remoteNext < state.tick ? remoteNext : state.tick;
+	const pong_sim_state_t *after;
+
+	// nothing after the winning tick matters, so both boards end on the
+	// same checksum
+	while (confirmed < last && winTick == NETPLAY_NO_ROLLBACK) {
+		confirmed++;
+		after = confirmed == state.tick ? &state : &snapshots[confirmed & NETPLAY_SNAPSHOT_MASK];
+		checksums[confirmed & NETPLAY_HISTORY_MASK] = pong_sim_checksum(after);
+		if (after->winner != PONG_SIM_NO_WINNER) {
+			winTick = confirmed;
+			winner = after->winner;
+		}
+	}
+
+	if (remoteChecksumPending && remoteChecksumTicks <= confirmed) {
+		remoteChecksumPending = false;
+		if (confirmed - remoteChecksumTicks >= NETPLAY_HISTORY)
+			return;
+		if (checksums[remoteChecksumTicks & NETPLAY_HISTORY_MASK] != remoteChecksum)
+			netStatus = NETPLAY_DESYNC;
+		else
+			netStats.checksumsMatched++;
+	}
+}
+
+//*****************************************************************************
+// Takes the new inputs and checksum out of a packet.
+//*****************************************************************************
+static void netplay_receive(const uint8_t *packet, uint8_t length)
+{
+	uint32_t first, ack, tick;
+	uint8_t count, i;
+	int8_t input;
+
+	if (length < NETPLAY_HEADER_BYTES)
+		return;
+	count = packet[21];
+	if (count > NETPLAY_REDUNDANCY || length != NETPLAY_HEADER_BYTES + count)
+		return;
+	// our own packets, two boards set to the same player
+	if (((packet[0] & NETPLAY_FLAG_PLAYER) != 0) == (localPlayer != 0))
+		return;
+
+	netStats.packetsReceived++;
+	if ((packet[1] | (packet[2] << 8)) != configChecksum) {
+		netStatus = NETPLAY_CONFIG_MISMATCH;
+		return;
+	}
+
+	if (netStatus == NETPLAY_SYNCING) {
+		if (localPlayer == 1)
+			simSeed = netplay_get32(&packet[3]);
+		pong_sim_init(&state, &simConfig, simSeed);
+		netStatus = NETPLAY_RUNNING;
+	}
+
+	first = netplay_get32(&packet[7]);
+	ack = netplay_get32(&packet[11]);
+	if (ack > remoteAck && ack <= localNext)
+		remoteAck = ack;
+
+	// only in order, anything after a gap is sent again
+	for (i = 0; i < count; i++) {
+		tick = first + i;
+		if (tick != remoteNext)
+			continue;
+		input = packet[NETPLAY_HEADER_BYTES + i];
+		remoteInputs[tick & NETPLAY_HISTORY_MASK] = input;
+		remoteNext++;
+		if (tick < state.tick && input != usedInputs[tick & NETPLAY_HISTORY_MASK] && tick < rollbackFrom)
+			rollbackFrom = tick;
+	}
+
+	if (packet[0] & NETPLAY_FLAG_CHECKSUM) {
+		remoteChecksumTicks = netplay_get32(&packet[15]);
+		remoteChecksum = packet[19] | (packet[20] << 8);
+		remoteChecksumPending = true;
+	}
+}
+
+//*****************************************************************************
+// Sends the inputs the other board has not acknowledged, oldest first.
+//*****************************************************************************
+static void netplay_send(void)
+{
+	uint8_t packet[NETPLAY_HEADER_BYTES + NETPLAY_REDUNDANCY];
+	uint8_t *p = packet;
+	uint32_t count = localNext - remoteAck;
+	uint32_t i;
+
+	if (count > NETPLAY_REDUNDANCY)
+		count = NETPLAY_REDUNDANCY;
+
+	*p++ = (localPlayer ? NETPLAY_FLAG_PLAYER : 0) | (confirmed > 0 ? NETPLAY_FLAG_CHECKSUM : 0);
+	*p++ = configChecksum;
+	*p++ = configChecksum >> 8;
+	p = netplay_put32(p, simSeed);
+	p = netplay_put32(p, remoteAck);
+	p = netplay_put32(p, remoteNext);
+	p = netplay_put32(p, confirmed);
+	*p++ = checksums[confirmed & NETPLAY_HISTORY_MASK];
+	*p++ = checksums[confirmed & NETPLAY_HISTORY_MASK] >> 8;
+	*p++ = count;
+	for (i = 0; i < count; i++)
+		*p++ = localInputs[(remoteAck + i) & NETPLAY_HISTORY_MASK];
+
+	if (wireless_link_send(packet, p - packet))
+		netStats.packetsSent++;
+	else
+		netStats.sendFailed++;
+}
+
+//*****************************************************************************
+// Starts a match as player 0 or 1.  The link must already be set up.  seed
+// is only used by player 0.
+//*****************************************************************************
+void netplay_init(uint8_t player, uint32_t seed, const pong_sim_config_t *config)
+{
+	localPlayer = player ? 1 : 0;
+	simSeed = seed;
+	simConfig = *config;
+	configChecksum = pong_sim_config_checksum(config);
+	netStatus = NETPLAY_SYNCING;
+
+	memset(&state, 0, sizeof(state));
+	memset(localInputs, 0, sizeof(localInputs));
+	memset(remoteInputs, 0, sizeof(remoteInputs));
+	memset(checksums, 0, sizeof(checksums));
+	memset(&netStats, 0, sizeof(netStats));
+
+	// the first ticks run before any input reaches them
+	localNext = NETPLAY_INPUT_DELAY;
+	remoteNext = 0;
+	remoteAck = 0;
+	rollbackFrom = NETPLAY_NO_ROLLBACK;
+	confirmed = 0;
+	remoteChecksumPending = false;
+	winTick = NETPLAY_NO_ROLLBACK;
+}
+
+//*****************************************************************************
+// Call once per game tick with the local paddle step.  Receives and sends
+// packets, rolls back if needed and simulates at most one tick.
+//*****************************************************************************
+netplay_status_t netplay_tick(int8_t input)
+{
+	uint8_t packet[WIRELESS_MAX_PAYLOAD];
+	uint8_t length;
+
+	if (netStatus == NETPLAY_DESYNC || netStatus == NETPLAY_CONFIG_MISMATCH)
+		return netStatus;
+
+	while (wireless_link_receive(packet, &length))
+		netplay_receive(packet, length);
+
+	if (netStatus == NETPLAY_SYNCING || netStatus == NETPLAY_CONFIG_MISMATCH) {
+		netplay_send();
+		return netStatus;
+	}
+
+	if (rollbackFrom != NETPLAY_NO_ROLLBACK)
+		netplay_rollback();
+	netplay_confirm();
+	if (netStatus == NETPLAY_DESYNC)
+		return netStatus;
+
+	// predicting further would overwrite the snapshot a rollback needs, or
+	// an input the other board has not acknowledged
+	if (state.tick + 1 >= remoteNext + NETPLAY_MAX_ROLLBACK ||
+	    localNext - remoteAck >= NETPLAY_HISTORY - 1) {
+		netStats.stalls++;
+		netStatus = NETPLAY_STALLED;
+		netplay_send();
+		return netStatus;
+	}
+
+	localInputs[localNext & NETPLAY_HISTORY_MASK] = input;
+	localNext++;
+	netplay_simulate();
+	netStats.ticks++;
+	netplay_confirm();
+
+	netplay_send();
+	netStatus = NETPLAY_RUNNING;
+	return netStatus;
+}
+
+//*****************************************************************************
+// The state to draw, including predicted ticks.
+//*****************************************************************************
+const pong_sim_state_t *netplay_state(void)
+{
+	return &state;
+}
+
+//*****************************************************************************
+// Returns true once the match is over with the inputs of both boards known
+// up to the winning tick, and both boards know them.
+//*****************************************************************************
+bool netplay_finished(uint8_t *winnerPlayer)
+{
+	if (winTick == NETPLAY_NO_ROLLBACK || remoteAck < winTick)
+		return false;
+	*winnerPlayer = winner;
+	return true;
+}
+
+//*****************************************************************************
+// Returns how many ticks have both inputs known, and the checksum of the
+// state after the last of them.
+//*****************************************************************************
+uint32_t netplay_confirmed_tick(uint16_t *checksum)
+{
+	*checksum = checksums[confirmed & NETPLAY_HISTORY_MASK];
+	return confirmed;
+}
+
+//*****************************************************************************
+// Returns the netplay statistics.
+//*****************************************************************************
+void netplay_get_stats(netplay_stats_t *stats)
+{
+	*stats = netStats;
+}
@@ -0,0 +1,103 @@
+#ifndef __NETPLAY_H__
+#define __NETPLAY_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include "pong_sim.h"
+#include "wireless_link.h"
+
+//*****************************************************************************
+// Two board pong over the wireless link with rollback.
+//
+// Both boards run pong_sim and only send their paddle inputs.  A local
+// input is applied NETPLAY_INPUT_DELAY ticks after it is read, which hides
+// most of the radio latency.  When the other board's input for a tick has
+// not arrived it is predicted to be the same as its last one, and when it
+// arrives and differs the game is put back to the snapshot from before that
+// tick and simulated forward again.  Prediction only reaches
+// NETPLAY_MAX_ROLLBACK ticks ahead, past that the board stalls until the
+// inputs catch up.
+//
+// Every packet carries the inputs the other board has not acknowledged, up
+// to NETPLAY_REDUNDANCY of them, so a lost packet costs nothing as long as a
+// later one arrives.  Packets also carry the checksum of the newest state
+// both inputs are known for, a different checksum on the other board means
+// the games have diverged and the match stops with NETPLAY_DESYNC.
+//
+// Player 0 is player 1 on the screen (top) and picks the seed, player 1
+// takes the seed from the first packet it receives.
+//*****************************************************************************
+
+#define NETPLAY_INPUT_DELAY       2
+
+// Snapshots kept, the furthest a rollback can go.  Power of two.
+#define NETPLAY_MAX_ROLLBACK      16
+
+// Inputs and checksums kept.  Power of two, larger than
+// NETPLAY_MAX_ROLLBACK + NETPLAY_INPUT_DELAY.
+#define NETPLAY_HISTORY           64
+
+// Most inputs in one packet
+#define NETPLAY_REDUNDANCY        8
+
+// Packet bytes before the inputs
+#define NETPLAY_HEADER_BYTES      22
+
+typedef enum {
+	NETPLAY_SYNCING = 0,      // waiting for the other board
+	NETPLAY_RUNNING,          // simulated a tick
+	NETPLAY_STALLED,          // too far ahead of the other board, no tick
+	NETPLAY_DESYNC,           // the checksums differ, the match is over
+	NETPLAY_CONFIG_MISMATCH   // the boards have different rules
+} netplay_status_t;
+
+typedef struct {
+	uint32_t ticks;           // ticks simulated for the first time
+	uint32_t stalls;          // calls that could not simulate
+	uint32_t rollbacks;       // mispredictions corrected
+	uint32_t resimulated;     // ticks simulated again by rollbacks
+	uint32_t maxRollback;     // longest rollback in ticks
+	uint32_t packetsSent;
+	uint32_t sendFailed;      // the link queue was full
+	uint32_t packetsReceived;
+	uint32_t checksumsMatched;
+} netplay_stats_t;
+
+//*****************************************************************************
+// Starts a match as player 0 or 1.  The link must already be set up.  seed
+// is only used by player 0.
+//*****************************************************************************
+void netplay_init(uint8_t player, uint32_t seed, const pong_sim_config_t *config);
+
+//*****************************************************************************
+// Call once per game tick with the local paddle step.  Receives and sends
+// packets, rolls back if needed and simulates at most one tick.
+//*****************************************************************************
+netplay_status_t netplay_tick(int8_t input);
+
+//*****************************************************************************
+// The state to draw, including predicted ticks.  Only valid once
+// netplay_tick() has returned something other than NETPLAY_SYNCING.
+//*****************************************************************************
+const pong_sim_state_t *netplay_state(void);
+
+//*****************************************************************************
+// Returns true once the match is over with the inputs of both boards known
+// up to the winning tick, and both boards know them.  winner is 0 or 1.
+//*****************************************************************************
+bool netplay_finished(uint8_t *winner);
+
+//*****************************************************************************
+// Returns how many ticks have both inputs known, and the checksum of the
+// state after the last of them for comparing the two boards.  Stops at the
+// winning tick once the match is over.
+//*****************************************************************************
+uint32_t netplay_confirmed_tick(uint16_t *checksum);
+
+//*****************************************************************************
+// Returns the netplay statistics.
+//*****************************************************************************
+void netplay_get_stats(netplay_stats_t *stats);
+
+#endif
@@ -0,0 +1,190 @@
+#include "pong_sim.h"
+
+//*****************************************************************************
+// Linear congruential generator from Numerical Recipes.  rand() cannot be
+// used, its state is outside pong_sim_state_t and differs between C
+// libraries.
+//*****************************************************************************
+static uint16_t pong_sim_random(pong_sim_state_t *state)
+{
+	state->rng = state->rng * 1664525u + 1013904223u;
+	return state->rng >> 16;
+}
+
+// randomizeBall() in main.c
+static void pong_sim_serve(pong_sim_state_t *state, const pong_sim_config_t *config)
+{
+	int range = config->ballMaxSpeed*2 + 1;
+
+	state->ballx = PONG_SIM_COLS/2;
+	state->bally = PONG_SIM_ROWS/2;
+	do {
+		state->ballChangex = (pong_sim_random(state) % range) - config->ballMaxSpeed;
+		state->ballChangey = (pong_sim_random(state) % range) - config->ballMaxSpeed;
+	} while (state->ballChangey == 0);
+}
+
+static int16_t pong_sim_move_player(int16_t x, int8_t step, const pong_sim_config_t *config)
+{
+	if (step > config->maxSpeed)
+		step = config->maxSpeed;
+	else if (step < -config->maxSpeed)
+		step = -config->maxSpeed;
+
+	x += step;
+	if (x < config->playerWidth/2)
+		x = config->playerWidth/2;
+	if (x > PONG_SIM_COLS - config->playerWidth/2)
+		x = PONG_SIM_COLS - config->playerWidth/2;
+	return x;
+}
+
+// playercontact() in main.c
+static bool pong_sim_player_contact(const pong_sim_state_t *state, const pong_sim_config_t *config, int16_t x, int16_t y)
+{
+	return x - config->playerWidth/2 < state->ballx + config->ballWidth/2 &&
+	       x + config->playerWidth/2 > state->ballx - config->ballWidth/2 &&
+	       y - config->playerHeight/2 < state->bally + config->ballHeight/2 &&
+	       y + config->playerHeight/2 > state->bally - config->ballHeight/2;
+}
+
+// a point for player, 0 or 1
+static uint8_t pong_sim_point(pong_sim_state_t *state, const pong_sim_config_t *config, uint8_t player)
+{
+	uint8_t score = player == 0 ? ++state->player1score : ++state->player2score;
+
+	state->rallyHits = 0;
+	if (score >= config->winScore) {
+		// the ball stays where it went out
+		state->winner = player;
+		return PONG_SIM_EVENT_POINT | PONG_SIM_EVENT_WIN;
+	}
+
+	pong_sim_serve(state, config);
+	state->ballWait = PONG_SIM_SERVE_TICKS;
+	return PONG_SIM_EVENT_POINT;
+}
+
+//*****************************************************************************
+// Starts a match, paddles and ball in the centre and the ball served in a
+// direction picked from seed.
+//*****************************************************************************
+void pong_sim_init(pong_sim_state_t *state, const pong_sim_config_t *config, uint32_t seed)
+{
+	memset(state, 0, sizeof(*state));
+	state->rng = seed;
+	state->player1x = PONG_SIM_COLS/2;
+	state->player2x = PONG_SIM_COLS/2;
+	state->winner = PONG_SIM_NO_WINNER;
+	pong_sim_serve(state, config);
+}
+
+//*****************************************************************************
+// Advances the game one tick.  input1 and input2 are the paddle steps of
+// player 1 and 2 in pixels, limited to maxSpeed.  Returns the
+// PONG_SIM_EVENT bits of what happened.  A finished match no longer
+// changes except for the tick count.
+//*****************************************************************************
+uint8_t pong_sim_step(pong_sim_state_t *state, const pong_sim_config_t *config, int8_t input1, int8_t input2)
+{
+	uint8_t events = 0;
+
+	state->tick++;
+	if (state->winner != PONG_SIM_NO_WINNER)
+		return 0;
+
+	state->player1x = pong_sim_move_player(state->player1x, input1, config);
+	state->player2x = pong_sim_move_player(state->player2x, input2, config);
+
+	if (state->ballWait > 0) {
+		state->ballWait--;
+		return 0;
+	}
+
+	state->ballx += state->ballChangex;
+	state->bally += state->ballChangey;
+
+	if (state->bally > PONG_SIM_ROWS - config->ballHeight)
+		return pong_sim_point(state, config, 0);
+	if (state->bally < config->ballHeight)
+		return pong_sim_point(state, config, 1);
+
+	if (pong_sim_player_contact(state, config, state->player1x, PONG_SIM_PLAYER1Y) ||
+	    pong_sim_player_contact(state, config, state->player2x, PONG_SIM_PLAYER2Y)) {
+		state->rallyHits++;
+		if (state->rallyHits > state->longestRally)
+			state->longestRally = state->rallyHits;
+		state->ballChangey = -state->ballChangey;
+		// nudge a ball going straight up and down
+		if (state->ballChangex == 0 && pong_sim_random(state) % config->noupdown == 0)
+			state->ballChangex = (pong_sim_random(state) & 1) ? 1 : -1;
+		events |= PONG_SIM_EVENT_HIT;
+	}
+
+	// wallcontact() in main.c
+	if (state->ballx < config->ballWidth || state->ballx > PONG_SIM_COLS - config->ballWidth) {
+		state->ballChangex = -state->ballChangex;
+		events |= PONG_SIM_EVENT_WALL;
+	}
+
+	return events;
+}
+
+static uint8_t *pong_sim_put16(uint8_t *p, uint16_t value)
+{
+	*p++ = value;
+	*p++ = value >> 8;
+	return p;
+}
+
+static uint8_t *pong_sim_put32(uint8_t *p, uint32_t value)
+{
+	p = pong_sim_put16(p, value);
+	return pong_sim_put16(p, value >> 16);
+}
+
+//*****************************************************************************
+// CRC16 over every field of the state, independent of struct padding.
+//*****************************************************************************
+uint16_t pong_sim_checksum(const pong_sim_state_t *state)
+{
+	uint8_t bytes[26];
+	uint8_t *p = bytes;
+
+	p = pong_sim_put32(p, state->tick);
+	p = pong_sim_put32(p, state->rng);
+	p = pong_sim_put16(p, state->player1x);
+	p = pong_sim_put16(p, state->player2x);
+	p = pong_sim_put16(p, state->ballx);
+	p = pong_sim_put16(p, state->bally);
+	*p++ = state->ballChangex;
+	*p++ = state->ballChangey;
+	*p++ = state->player1score;
+	*p++ = state->player2score;
+	*p++ = state->ballWait;
+	*p++ = state->winner;
+	p = pong_sim_put16(p, state->rallyHits);
+	p = pong_sim_put16(p, state->longestRally);
+
+	return crc16_ccitt(CRC16_INIT, bytes, p - bytes);
+}
+
+//*****************************************************************************
+// CRC16 over the rules, boards with different rules must not play.
+//*****************************************************************************
+uint16_t pong_sim_config_checksum(const pong_sim_config_t *config)
+{
+	uint8_t bytes[16];
+	uint8_t *p = bytes;
+
+	p = pong_sim_put16(p, config->playerWidth);
+	p = pong_sim_put16(p, config->playerHeight);
+	p = pong_sim_put16(p, config->ballWidth);
+	p = pong_sim_put16(p, config->ballHeight);
+	p = pong_sim_put16(p, config->maxSpeed);
+	p = pong_sim_put16(p, config->ballMaxSpeed);
+	p = pong_sim_put16(p, config->noupdown);
+	p = pong_sim_put16(p, config->winScore);
+
+	return crc16_ccitt(CRC16_INIT, bytes, p - bytes);
+}
@@ -0,0 +1,95 @@
+#ifndef __PONG_SIM_H__
+#define __PONG_SIM_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include "crc.h"
+
+//*****************************************************************************
+// Deterministic simulation of regular pong for network play.  The whole
+// game is in pong_sim_state_t and only changes through pong_sim_step(), so
+// two boards that start from the same seed and apply the same inputs hold
+// identical states, and an old state can be copied back to simulate again.
+//
+// Nothing here touches hardware, uses floating point or calls rand(), the
+// same file builds on the PC for the netplay simulator in tools/.
+//
+// Follows mode 0 in main.c, except that both paddles are moved by a step
+// in pixels instead of the touchscreen position, and the wait after a
+// point is counted in ticks.
+//*****************************************************************************
+
+// Playing field, matches lcd.h
+#define PONG_SIM_COLS             240
+#define PONG_SIM_ROWS             320
+
+// Ticks the ball waits in the centre after a point, 1 second at 50Hz
+#define PONG_SIM_SERVE_TICKS      50
+
+#define PONG_SIM_NO_WINNER        0xFF
+
+// pong_sim_step() return bits
+#define PONG_SIM_EVENT_HIT        (1 << 0)
+#define PONG_SIM_EVENT_WALL       (1 << 1)
+#define PONG_SIM_EVENT_POINT      (1 << 2)
+#define PONG_SIM_EVENT_WIN        (1 << 3)
+
+// Rules both boards must agree on, the tunables from main.c
+typedef struct {
+	int16_t playerWidth;
+	int16_t playerHeight;
+	int16_t ballWidth;
+	int16_t ballHeight;
+	int16_t maxSpeed;
+	int16_t ballMaxSpeed;
+	int16_t noupdown;
+	int16_t winScore;
+} pong_sim_config_t;
+
+typedef struct {
+	uint32_t tick;            // ticks simulated so far
+	uint32_t rng;             // state of the random number generator
+	int16_t player1x;         // the paddles only move sideways
+	int16_t player2x;
+	int16_t ballx;
+	int16_t bally;
+	int8_t ballChangex;
+	int8_t ballChangey;
+	uint8_t player1score;
+	uint8_t player2score;
+	uint8_t ballWait;         // ticks left before the ball moves
+	uint8_t winner;           // 0 or 1, PONG_SIM_NO_WINNER while playing
+	uint16_t rallyHits;
+	uint16_t longestRally;
+} pong_sim_state_t;
+
+// The paddles never move vertically
+#define PONG_SIM_PLAYER1Y         (PONG_SIM_ROWS/6)
+#define PONG_SIM_PLAYER2Y         (5*PONG_SIM_ROWS/6)
+
+//*****************************************************************************
+// Starts a match, paddles and ball in the centre and the ball served in a
+// direction picked from seed.
+//*****************************************************************************
+void pong_sim_init(pong_sim_state_t *state, const pong_sim_config_t *config, uint32_t seed);
+
+//*****************************************************************************
+// Advances the game one tick.  input1 and input2 are the paddle steps of
+// player 1 and 2 in pixels, limited to maxSpeed.  Returns the
+// PONG_SIM_EVENT bits of what happened.  A finished match no longer
+// changes except for the tick count.
+//*****************************************************************************
+uint8_t pong_sim_step(pong_sim_state_t *state, const pong_sim_config_t *config, int8_t input1, int8_t input2);
+
+//*****************************************************************************
+// CRC16 over every field of the state, independent of struct padding.
+//*****************************************************************************
+uint16_t pong_sim_checksum(const pong_sim_state_t *state);
+
+//*****************************************************************************
+// CRC16 over the rules, boards with different rules must not play.
+//*****************************************************************************
+uint16_t pong_sim_config_checksum(const pong_sim_config_t *config);
+
+#endif
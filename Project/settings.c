@@ -0,0 +1,95 @@
+#include "settings.h"
+#include "cycle_counter.h"
+
+// RAM copy of the record, this is what the game reads and writes
+static settings_t settingsCache;
+static settings_stats_t settingsStats;
+static eeprom_journal_t settingsJournal;
+
+//*****************************************************************************
+// Finds the newest settings record in the EEPROM journal, copies it into the
+// RAM copy and returns it.  All fields are zero if no valid record exists.
+// This blocks, so it is only called at boot.
+//*****************************************************************************
+void settings_init(settings_t *settings)
+{
+	uint8_t version;
+	
+	cycle_counter_init();
+	
+	memset(&settingsCache, 0, sizeof(settingsCache));
+	memset(&settingsStats, 0, sizeof(settingsStats));
+	
+	if (eeprom_journal_init(&settingsJournal, EEPROM_I2C_BASE, SETTINGS_EEPROM_ADDR, 
+	                        SETTINGS_NUM_SLOTS, sizeof(settingsCache), &settingsCache, &version)) {
+		// records from an older layout are discarded
+		if (version != SETTINGS_VERSION)
+			memset(&settingsCache, 0, sizeof(settingsCache));
+	}
+	
+	*settings = settingsCache;
+}
+
+//*****************************************************************************
+// Updates the RAM copy of the settings.  Nothing is written to the EEPROM 
+// here, the record is only marked dirty if it changed.
+//*****************************************************************************
+void settings_write(const settings_t *settings)
+{
+	if (memcmp(&settingsCache, settings, sizeof(settingsCache)) != 0) {
+		settingsCache = *settings;
+		settingsStats.dirty = true;
+	}
+}
+
+//*****************************************************************************
+// Writes the RAM copy to the EEPROM if it is dirty.  
+//
+// Unless force is set, the flush is skipped if the EEPROM is still busy 
+// with a previous write cycle so the caller never waits on it.  Call this
+// from idle time.  With force set, the function waits for the EEPROM and 
+// the record is always written.  A write that fails leaves the record dirty
+// and is counted, the next flush tries again.
+//
+// Returns true if the record was written.
+//*****************************************************************************
+bool settings_flush(bool force)
+{
+	uint32_t start;
+	uint32_t cycles;
+	i2c_status_t status;
+	
+	if (!settingsStats.dirty)
+		return false;
+	
+	start = cycle_counter_read();
+	
+	if (!force && eeprom_busy(EEPROM_I2C_BASE)) {
+		settingsStats.deferredCount++;
+		return false;
+	}
+	
+	status = eeprom_journal_append(&settingsJournal, SETTINGS_VERSION, &settingsCache);
+	
+	cycles = cycle_counter_read() - start;
+	settingsStats.lastBlockCycles = cycles;
+	if (cycles > settingsStats.maxBlockCycles)
+		settingsStats.maxBlockCycles = cycles;
+	
+	if (status != I2C_OK) {
+		settingsStats.failedCount++;
+		return false;
+	}
+	
+	settingsStats.dirty = false;
+	settingsStats.flushCount++;
+	return true;
+}
+
+//*****************************************************************************
+// Returns the flush statistics.
+//*****************************************************************************
+void settings_get_stats(settings_stats_t *stats)
+{
+	*stats = settingsStats;
+}
@@ -0,0 +1,66 @@
+#ifndef __SETTINGS_H__
+#define __SETTINGS_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include "eeprom.h"
+#include "eeprom_journal.h"
+
+// EEPROM region holding the settings journal.  Every flush appends a record
+// to the next page of the region so the writes are spread over all of them.
+#define SETTINGS_EEPROM_ADDR    256
+#define SETTINGS_NUM_SLOTS      8
+
+// bump when the layout of settings_t changes
+#define SETTINGS_VERSION        1
+
+// everything that survives a power cycle
+typedef __packed struct {
+	uint8_t gamemode;
+	uint8_t player1score;
+	uint8_t player2score;
+	uint8_t randomSeed;
+} settings_t;
+
+typedef struct {
+	uint32_t flushCount;      // records written to the EEPROM
+	uint32_t deferredCount;   // flushes skipped because the EEPROM was busy
+	uint32_t failedCount;     // writes the EEPROM did not complete
+	uint32_t lastBlockCycles; // time the caller was held by the last flush
+	uint32_t maxBlockCycles;  // worst case time a caller was held by a flush
+	bool dirty;               // RAM copy is newer than the EEPROM
+} settings_stats_t;
+
+//*****************************************************************************
+// Finds the newest settings record in the EEPROM journal, copies it into the
+// RAM copy and returns it.  All fields are zero if no valid record exists.
+// This blocks, so it is only called at boot.
+//*****************************************************************************
+void settings_init(settings_t *settings);
+
+//*****************************************************************************
+// Updates the RAM copy of the settings.  Nothing is written to the EEPROM 
+// here, the record is only marked dirty if it changed.
+//*****************************************************************************
+void settings_write(const settings_t *settings);
+
+//*****************************************************************************
+// Writes the RAM copy to the EEPROM if it is dirty.  
+//
+// Unless force is set, the flush is skipped if the EEPROM is still busy 
+// with a previous write cycle so the caller never waits on it.  Call this
+// from idle time.  With force set, the function waits for the EEPROM and 
+// the record is always written.  A write that fails leaves the record dirty
+// and is counted, the next flush tries again.
+//
+// Returns true if the record was written.
+//*****************************************************************************
+bool settings_flush(bool force);
+
+//*****************************************************************************
+// Returns the flush statistics.
+//*****************************************************************************
+void settings_get_stats(settings_stats_t *stats);
+
+#endif
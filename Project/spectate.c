@@ -0,0 +1,356 @@
+#include "spectate.h"
+
+// First byte of a packet
+#define SPECTATE_KEYFRAME         0x80
+#define SPECTATE_FIELD_PLAYER1X   (1 << 0)
+#define SPECTATE_FIELD_PLAYER2X   (1 << 1)
+#define SPECTATE_FIELD_BALLX      (1 << 2)
+#define SPECTATE_FIELD_BALLY      (1 << 3)
+#define SPECTATE_FIELD_SCORE      (1 << 4)
+// the delta after a keyframe carries it again
+#define SPECTATE_KEYFRAME_COPY    (1 << 5)
+#define SPECTATE_FIELDS_M         0x3F
+
+#define SPECTATE_HEADER_BYTES     3
+// Every field of a view but the tick
+#define SPECTATE_BODY_BYTES       (SPECTATE_KEYFRAME_BYTES - SPECTATE_HEADER_BYTES)
+
+// Deltas refer to the keyframe of the tick rounded down to the interval
+#define SPECTATE_KEYFRAME_M       (SPECTATE_KEYFRAME_INTERVAL - 1)
+
+typedef struct {
+	uint8_t *data;
+	uint8_t max;
+	uint8_t bytes;            // bytes started
+	uint8_t bits;             // bits used in the last byte
+} spectate_bits_t;
+
+//*****************************************************************************
+// Appends the low count bits of value, most significant first.  Returns
+// false if the packet is full.
+//*****************************************************************************
+static bool spectate_put_bits(spectate_bits_t *b, uint32_t value, uint8_t count)
+{
+	while (count > 0) {
+		if (b->bits == 0) {
+			if (b->bytes == b->max)
+				return false;
+			b->data[b->bytes++] = 0;
+		}
+		count--;
+		b->data[b->bytes - 1] |= ((value >> count) & 1) << (7 - b->bits);
+		b->bits = (b->bits + 1) & 7;
+	}
+	return true;
+}
+
+static bool spectate_get_bits(spectate_bits_t *b, uint8_t count, uint32_t *value)
+{
+	*value = 0;
+	while (count > 0) {
+		if (b->bytes == b->max)
+			return false;
+		*value = (*value << 1) | ((b->data[b->bytes] >> (7 - b->bits)) & 1);
+		b->bits++;
+		if (b->bits == 8) {
+			b->bits = 0;
+			b->bytes++;
+		}
+		count--;
+	}
+	return true;
+}
+
+//*****************************************************************************
+// A change is stored zigzag coded, small changes of either sign become
+// small numbers, behind a prefix giving its size:
+//    0   + 4 bits    up to +-8, a paddle or ball step
+//    10  + 9 bits    up to +-256, anything over a keyframe interval
+//    11  + 16 bits   anything else
+//*****************************************************************************
+static bool spectate_put_change(spectate_bits_t *b, int16_t change)
+{
+	uint16_t zigzag = ((uint16_t)change << 1) ^ (uint16_t)(change >> 15);
+
+	if (zigzag < (1 << 4))
+		return spectate_put_bits(b, zigzag, 5);
+	if (zigzag < (1 << 9))
+		return spectate_put_bits(b, (2 << 9) | zigzag, 11);
+	return spectate_put_bits(b, (3 << 16) | zigzag, 18);
+}
+
+static bool spectate_get_change(spectate_bits_t *b, int16_t *change)
+{
+	uint32_t prefix, zigzag;
+
+	if (!spectate_get_bits(b, 1, &prefix))
+		return false;
+	if (prefix == 0) {
+		if (!spectate_get_bits(b, 4, &zigzag))
+			return false;
+	}
+	else {
+		if (!spectate_get_bits(b, 1, &prefix))
+			return false;
+		if (!spectate_get_bits(b, prefix ? 16 : 9, &zigzag))
+			return false;
+	}
+	*change = (int16_t)((zigzag >> 1) ^ -(zigzag & 1));
+	return true;
+}
+
+static uint8_t *spectate_put16(uint8_t *p, uint16_t value)
+{
+	*p++ = value;
+	*p++ = value >> 8;
+	return p;
+}
+
+static uint16_t spectate_get16(const uint8_t *p)
+{
+	return p[0] | (p[1] << 8);
+}
+
+static uint8_t *spectate_put_body(uint8_t *p, const spectate_view_t *view)
+{
+	p = spectate_put16(p, view->player1x);
+	p = spectate_put16(p, view->player2x);
+	p = spectate_put16(p, view->ballx);
+	p = spectate_put16(p, view->bally);
+	*p++ = view->player1score;
+	*p++ = view->player2score;
+	*p++ = view->winner;
+	return p;
+}
+
+static void spectate_get_body(const uint8_t *p, uint16_t tick, spectate_view_t *view)
+{
+	view->tick = tick;
+	view->player1x = spectate_get16(&p[0]);
+	view->player2x = spectate_get16(&p[2]);
+	view->ballx = spectate_get16(&p[4]);
+	view->bally = spectate_get16(&p[6]);
+	view->player1score = p[8];
+	view->player2score = p[9];
+	view->winner = p[10];
+}
+
+//*****************************************************************************
+// Copies the fields a spectator needs out of the simulation state.
+//*****************************************************************************
+void spectate_view(spectate_view_t *view, const pong_sim_state_t *state)
+{
+	view->tick = state->tick;
+	view->player1x = state->player1x;
+	view->player2x = state->player2x;
+	view->ballx = state->ballx;
+	view->bally = state->bally;
+	view->player1score = state->player1score;
+	view->player2score = state->player2score;
+	view->winner = state->winner;
+}
+
+//*****************************************************************************
+// Starts an encoder, the first packet will be a keyframe.
+//*****************************************************************************
+void spectate_encoder_init(spectate_encoder_t *encoder)
+{
+	memset(encoder, 0, sizeof(*encoder));
+}
+
+//*****************************************************************************
+// Encodes the view of one tick into packet, which must hold
+// SPECTATE_MAX_PACKET bytes.  Returns the packet length.
+//*****************************************************************************
+uint8_t spectate_encode(spectate_encoder_t *encoder, const spectate_view_t *view, uint8_t *packet)
+{
+	const spectate_view_t *key = &encoder->keyframe;
+	spectate_bits_t bits;
+	uint8_t fields = 0;
+	uint8_t *p = packet;
+
+	// until the first keyframe on the interval every packet is a keyframe,
+	// the deltas after it have nothing to refer to
+	if (!encoder->started || (view->tick & SPECTATE_KEYFRAME_M) == 0 ||
+	    (uint16_t)(view->tick - key->tick) >= SPECTATE_KEYFRAME_INTERVAL) {
+		*p++ = SPECTATE_KEYFRAME;
+		p = spectate_put16(p, view->tick);
+		p = spectate_put_body(p, view);
+		if ((view->tick & SPECTATE_KEYFRAME_M) == 0) {
+			encoder->keyframe = *view;
+			encoder->started = true;
+		}
+		encoder->keyframes++;
+		encoder->bytes += p - packet;
+		return p - packet;
+	}
+
+	if (view->player1x != key->player1x)
+		fields |= SPECTATE_FIELD_PLAYER1X;
+	if (view->player2x != key->player2x)
+		fields |= SPECTATE_FIELD_PLAYER2X;
+	if (view->ballx != key->ballx)
+		fields |= SPECTATE_FIELD_BALLX;
+	if (view->bally != key->bally)
+		fields |= SPECTATE_FIELD_BALLY;
+	if (view->player1score != key->player1score || view->player2score != key->player2score ||
+	    view->winner != key->winner)
+		fields |= SPECTATE_FIELD_SCORE;
+
+	// losing a keyframe loses the whole interval, so the next tick sends
+	// it again
+	if ((view->tick & SPECTATE_KEYFRAME_M) == 1)
+		fields |= SPECTATE_KEYFRAME_COPY;
+
+	*p++ = fields;
+	p = spectate_put16(p, view->tick);
+	if (fields & SPECTATE_KEYFRAME_COPY)
+		p = spectate_put_body(p, key);
+
+	bits.data = p;
+	bits.max = SPECTATE_MAX_PACKET - (p - packet);
+	bits.bytes = 0;
+	bits.bits = 0;
+	// 4 changes of at most 18 bits and 24 bits of scores fit in 12 bytes
+	if (fields & SPECTATE_FIELD_PLAYER1X)
+		spectate_put_change(&bits, view->player1x - key->player1x);
+	if (fields & SPECTATE_FIELD_PLAYER2X)
+		spectate_put_change(&bits, view->player2x - key->player2x);
+	if (fields & SPECTATE_FIELD_BALLX)
+		spectate_put_change(&bits, view->ballx - key->ballx);
+	if (fields & SPECTATE_FIELD_BALLY)
+		spectate_put_change(&bits, view->bally - key->bally);
+	if (fields & SPECTATE_FIELD_SCORE) {
+		spectate_put_bits(&bits, view->player1score, 8);
+		spectate_put_bits(&bits, view->player2score, 8);
+		spectate_put_bits(&bits, view->winner, 8);
+	}
+
+	encoder->deltas++;
+	encoder->bytes += (p - packet) + bits.bytes;
+	return (p - packet) + bits.bytes;
+}
+
+//*****************************************************************************
+// Starts a decoder with nothing to show.
+//*****************************************************************************
+void spectate_decoder_init(spectate_decoder_t *decoder)
+{
+	memset(decoder, 0, sizeof(*decoder));
+}
+
+//*****************************************************************************
+// Applies the changes in a delta to the keyframe in view.  Returns false if
+// the packet ends early.
+//*****************************************************************************
+static bool spectate_decode_delta(spectate_bits_t *b, uint8_t fields, const spectate_view_t *key, spectate_view_t *view)
+{
+	int16_t change;
+	uint32_t value;
+
+	if (fields & SPECTATE_FIELD_PLAYER1X) {
+		if (!spectate_get_change(b, &change))
+			return false;
+		view->player1x = key->player1x + change;
+	}
+	if (fields & SPECTATE_FIELD_PLAYER2X) {
+		if (!spectate_get_change(b, &change))
+			return false;
+		view->player2x = key->player2x + change;
+	}
+	if (fields & SPECTATE_FIELD_BALLX) {
+		if (!spectate_get_change(b, &change))
+			return false;
+		view->ballx = key->ballx + change;
+	}
+	if (fields & SPECTATE_FIELD_BALLY) {
+		if (!spectate_get_change(b, &change))
+			return false;
+		view->bally = key->bally + change;
+	}
+	if (fields & SPECTATE_FIELD_SCORE) {
+		if (!spectate_get_bits(b, 8, &value))
+			return false;
+		view->player1score = value;
+		if (!spectate_get_bits(b, 8, &value))
+			return false;
+		view->player2score = value;
+		if (!spectate_get_bits(b, 8, &value))
+			return false;
+		view->winner = value;
+	}
+	return true;
+}
+
+//*****************************************************************************
+// Decodes a packet into view.  Returns false if the packet gives nothing
+// new to show: malformed, older than the last view, or a delta whose
+// keyframe has not been received.
+//*****************************************************************************
+bool spectate_decode(spectate_decoder_t *decoder, const uint8_t *packet, uint8_t length, spectate_view_t *view)
+{
+	const spectate_view_t *key = &decoder->keyframe;
+	spectate_bits_t bits;
+	uint8_t fields;
+	uint16_t tick;
+	const uint8_t *p;
+
+	if (length < SPECTATE_HEADER_BYTES || length > SPECTATE_MAX_PACKET) {
+		decoder->invalid++;
+		return false;
+	}
+	tick = spectate_get16(&packet[1]);
+
+	if (decoder->haveView && (int16_t)(tick - decoder->lastTick) <= 0) {
+		decoder->stale++;
+		return false;
+	}
+
+	if (packet[0] == SPECTATE_KEYFRAME) {
+		if (length != SPECTATE_KEYFRAME_BYTES) {
+			decoder->invalid++;
+			return false;
+		}
+		spectate_get_body(&packet[SPECTATE_HEADER_BYTES], tick, view);
+		if ((tick & SPECTATE_KEYFRAME_M) == 0) {
+			decoder->keyframe = *view;
+			decoder->haveKeyframe = true;
+		}
+	}
+	else {
+		fields = packet[0];
+		p = &packet[SPECTATE_HEADER_BYTES];
+		if ((fields & ~SPECTATE_FIELDS_M) ||
+		    ((fields & SPECTATE_KEYFRAME_COPY) && length < SPECTATE_KEYFRAME_BYTES)) {
+			decoder->invalid++;
+			return false;
+		}
+		if (fields & SPECTATE_KEYFRAME_COPY) {
+			spectate_get_body(p, tick & ~SPECTATE_KEYFRAME_M, &decoder->keyframe);
+			decoder->haveKeyframe = true;
+			p += SPECTATE_BODY_BYTES;
+		}
+		if (!decoder->haveKeyframe || key->tick != (tick & ~SPECTATE_KEYFRAME_M)) {
+			decoder->noKeyframe++;
+			return false;
+		}
+
+		*view = *key;
+		view->tick = tick;
+		bits.data = (uint8_t *)p;
+		bits.max = length - (p - packet);
+		bits.bytes = 0;
+		bits.bits = 0;
+		if (!spectate_decode_delta(&bits, fields, key, view)) {
+			decoder->invalid++;
+			return false;
+		}
+	}
+
+	if (decoder->haveView)
+		decoder->lost += (uint16_t)(tick - decoder->lastTick) - 1;
+	decoder->lastTick = tick;
+	decoder->haveView = true;
+	decoder->decoded++;
+	return true;
+}
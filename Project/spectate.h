@@ -0,0 +1,96 @@
+#ifndef __SPECTATE_H__
+#define __SPECTATE_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include "pong_sim.h"
+#include "wireless_link.h"
+
+//*****************************************************************************
+// State updates for boards watching a match.  The board running the match
+// encodes what is on its screen every tick into one packet that fits a
+// radio payload, and any number of watching boards decode them.
+//
+// Every SPECTATE_KEYFRAME_INTERVAL ticks a keyframe carries every field.
+// The ticks in between send a delta against that keyframe: a mask of the
+// fields that changed and each change bit packed in as few bits as it
+// needs.  A delta only depends on its keyframe, so a lost delta costs one
+// frame.  The delta right after a keyframe carries a copy of it, so only
+// losing both costs the rest of the interval.
+// Ticks are numbered, the decoder drops duplicates and anything older
+// than what it has shown, and counts the gaps as lost.
+//
+// Nothing here touches hardware, the same file builds on the PC for
+// tools/spectate_bench.c.
+//*****************************************************************************
+
+#define SPECTATE_KEYFRAME_INTERVAL  16
+
+#define SPECTATE_KEYFRAME_BYTES     14
+
+// Largest packet, the delta after a keyframe with a copy of it, every field
+// moved far and the score changed
+#define SPECTATE_MAX_PACKET         26
+
+// What a watching board draws
+typedef struct {
+	uint16_t tick;            // low 16 bits of pong_sim_state_t.tick
+	int16_t player1x;
+	int16_t player2x;
+	int16_t ballx;
+	int16_t bally;
+	uint8_t player1score;
+	uint8_t player2score;
+	uint8_t winner;           // PONG_SIM_NO_WINNER while playing
+} spectate_view_t;
+
+typedef struct {
+	spectate_view_t keyframe;
+	bool started;
+	uint32_t keyframes;       // packets encoded by type
+	uint32_t deltas;
+	uint32_t bytes;           // total encoded
+} spectate_encoder_t;
+
+typedef struct {
+	spectate_view_t keyframe;
+	bool haveKeyframe;
+	bool haveView;
+	uint16_t lastTick;        // tick of the last decoded view
+	uint32_t decoded;         // views produced
+	uint32_t lost;            // ticks that never arrived
+	uint32_t stale;           // duplicates and late packets dropped
+	uint32_t noKeyframe;      // deltas dropped, their keyframe was lost
+	uint32_t invalid;         // malformed packets
+} spectate_decoder_t;
+
+//*****************************************************************************
+// Copies the fields a spectator needs out of the simulation state.
+//*****************************************************************************
+void spectate_view(spectate_view_t *view, const pong_sim_state_t *state);
+
+//*****************************************************************************
+// Starts an encoder, the first packet will be a keyframe.
+//*****************************************************************************
+void spectate_encoder_init(spectate_encoder_t *encoder);
+
+//*****************************************************************************
+// Encodes the view of one tick into packet, which must hold
+// SPECTATE_MAX_PACKET bytes.  Returns the packet length.
+//*****************************************************************************
+uint8_t spectate_encode(spectate_encoder_t *encoder, const spectate_view_t *view, uint8_t *packet);
+
+//*****************************************************************************
+// Starts a decoder with nothing to show.
+//*****************************************************************************
+void spectate_decoder_init(spectate_decoder_t *decoder);
+
+//*****************************************************************************
+// Decodes a packet into view.  Returns false if the packet gives nothing
+// new to show: malformed, older than the last view, or a delta whose
+// keyframe has not been received.
+//*****************************************************************************
+bool spectate_decode(spectate_decoder_t *decoder, const uint8_t *packet, uint8_t length, spectate_view_t *view);
+
+#endif
@@ -0,0 +1,243 @@
+#include "telemetry.h"
+
+static telemetry_phase_t currentPhase;
+static uint32_t phaseStart;
+static uint32_t phaseLcdStart;
+static uint32_t phaseCycles[TELEMETRY_NUM_PHASES];
+
+static uint16_t sequence;
+static int16_t lastPlayer1x;
+static int16_t lastPlayer1y;
+static int16_t lastPlayer2x;
+static int16_t lastPlayer2y;
+static telemetry_stats_t telemetryStats;
+static bool telemetryEnabled;
+
+static telemetry_profile_t profile;
+static uint16_t profileRemaining;
+static bool profileDone;
+
+//*****************************************************************************
+// Clamps a paddle movement to what fits in the record.
+//*****************************************************************************
+static int8_t telemetry_delta(int16_t now, int16_t last)
+{
+	int delta = now - last;
+
+	if (delta > 127)
+		return 127;
+	if (delta < -128)
+		return -128;
+	return (int8_t)delta;
+}
+
+//*****************************************************************************
+// COBS encodes num_bytes of data and adds the zero delimiter.  out must
+// hold num_bytes + num_bytes/254 + 2 bytes.  Returns the encoded length.
+//*****************************************************************************
+static uint32_t telemetry_cobs_encode(const uint8_t *data, uint32_t num_bytes, uint8_t *out)
+{
+	uint32_t code_index = 0;
+	uint32_t length = 1;
+	uint8_t code = 1;
+	uint32_t i;
+
+	for (i = 0; i < num_bytes; i++) {
+		if (data[i] == 0) {
+			out[code_index] = code;
+			code_index = length++;
+			code = 1;
+		}
+		else {
+			out[length++] = data[i];
+			code++;
+			if (code == 0xFF) {
+				out[code_index] = code;
+				code_index = length++;
+				code = 1;
+			}
+		}
+	}
+	out[code_index] = code;
+	out[length++] = 0;
+
+	return length;
+}
+
+//*****************************************************************************
+// Adds the phase cycles of a record to the running capture.
+//*****************************************************************************
+static void telemetry_profile_add(const telemetry_record_t *record)
+{
+	int i;
+
+	for (i = 0; i < TELEMETRY_NUM_PHASES; i++) {
+		uint32_t cycles = record->phaseCycles[i];
+
+		if (profile.records == 0 || cycles < profile.min[i])
+			profile.min[i] = cycles;
+		if (cycles > profile.max[i])
+			profile.max[i] = cycles;
+		profile.total[i] += cycles;
+	}
+	profile.records++;
+
+	if (--profileRemaining == 0)
+		profileDone = true;
+}
+
+//*****************************************************************************
+// Starts the phase timing in TELEMETRY_PHASE_IDLE and sends a zero byte so
+// the receiver starts at a frame boundary.  The serial debug interface must
+// already be initialized with transmit enabled.
+//*****************************************************************************
+void telemetry_init(void)
+{
+	uint8_t delimiter = 0;
+
+	cycle_counter_init();
+
+	memset(phaseCycles, 0, sizeof(phaseCycles));
+	memset(&telemetryStats, 0, sizeof(telemetryStats));
+	sequence = 0;
+	telemetryEnabled = true;
+	profileRemaining = 0;
+	profileDone = false;
+	currentPhase = TELEMETRY_PHASE_IDLE;
+	phaseStart = cycle_counter_read();
+	phaseLcdStart = lcd_busy_cycles();
+
+	serial_debug_write(&delimiter, 1);
+}
+
+//*****************************************************************************
+// Charges the cycles since the last call to the current phase and makes
+// phase the current one.  Returns the phase that was current, so a caller
+// can switch back to it when done.
+//*****************************************************************************
+telemetry_phase_t telemetry_phase(telemetry_phase_t phase)
+{
+	telemetry_phase_t previous = currentPhase;
+	uint32_t now = cycle_counter_read();
+	uint32_t lcdNow = lcd_busy_cycles();
+	uint32_t lcd = lcdNow - phaseLcdStart;
+
+	// whatever the LCD driver took is rendering, the rest belongs to the
+	// phase that was running
+	phaseCycles[currentPhase] += (now - phaseStart) - lcd;
+	phaseCycles[TELEMETRY_PHASE_RENDER] += lcd;
+
+	phaseStart = now;
+	phaseLcdStart = lcdNow;
+	currentPhase = phase;
+
+	return previous;
+}
+
+//*****************************************************************************
+// Completes the record with its type, sequence number, paddle movement and
+// phase cycles, then queues the frame.  The phase cycles restart from zero.
+//
+// Returns false if the frame was dropped.
+//*****************************************************************************
+bool telemetry_send(telemetry_record_t *record)
+{
+	// close the running phase so the record covers everything up to now
+	telemetry_phase(currentPhase);
+
+	record->type = TELEMETRY_RECORD_TICK;
+	record->sequence = sequence++;
+	record->player1dx = telemetry_delta(record->player1x, lastPlayer1x);
+	record->player1dy = telemetry_delta(record->player1y, lastPlayer1y);
+	record->player2dx = telemetry_delta(record->player2x, lastPlayer2x);
+	record->player2dy = telemetry_delta(record->player2y, lastPlayer2y);
+	memcpy(record->phaseCycles, phaseCycles, sizeof(phaseCycles));
+	memset(phaseCycles, 0, sizeof(phaseCycles));
+
+	if (profileRemaining > 0)
+		telemetry_profile_add(record);
+
+	lastPlayer1x = record->player1x;
+	lastPlayer1y = record->player1y;
+	lastPlayer2x = record->player2x;
+	lastPlayer2y = record->player2y;
+
+	if (!telemetryEnabled)
+		return true;
+	return telemetry_write_frame((const uint8_t *)record, sizeof(telemetry_record_t));
+}
+
+//*****************************************************************************
+// Turns sending the tick records on or off, for example while the serial
+// port is used as a console.  The phase timing and profile captures carry
+// on either way.  Telemetry starts on.
+//*****************************************************************************
+void telemetry_enable(bool enable)
+{
+	telemetryEnabled = enable;
+}
+
+//*****************************************************************************
+// Starts collecting the phase cycles of the next num_records records.
+// A capture that is running is restarted.
+//*****************************************************************************
+void telemetry_profile_start(uint16_t num_records)
+{
+	memset(&profile, 0, sizeof(profile));
+	profileDone = false;
+	profileRemaining = num_records;
+}
+
+//*****************************************************************************
+// Returns true, and copies the result, once a capture has finished.  A
+// finished capture is only returned once.
+//*****************************************************************************
+bool telemetry_profile_done(telemetry_profile_t *result)
+{
+	if (!profileDone)
+		return false;
+
+	profileDone = false;
+	*result = profile;
+	return true;
+}
+
+//*****************************************************************************
+// Sends num_bytes of data, TELEMETRY_MAX_PAYLOAD at most, as one frame with
+// the same CRC and COBS framing as the tick records.  The first byte should
+// be a TELEMETRY_RECORD_ type.  Never waits.
+//
+// Returns false if the frame was dropped.
+//*****************************************************************************
+bool telemetry_write_frame(const uint8_t *data, uint32_t num_bytes)
+{
+	uint8_t raw[TELEMETRY_MAX_PAYLOAD + 2];
+	uint8_t frame[TELEMETRY_MAX_PAYLOAD + 4];
+	uint32_t length;
+	uint16_t crc;
+
+	if (num_bytes > TELEMETRY_MAX_PAYLOAD)
+		return false;
+
+	memcpy(raw, data, num_bytes);
+	crc = crc16_ccitt(CRC16_INIT, raw, num_bytes);
+	raw[num_bytes] = crc & 0xFF;
+	raw[num_bytes + 1] = crc >> 8;
+
+	length = telemetry_cobs_encode(raw, num_bytes + 2, frame);
+
+	if (!serial_debug_write(frame, length)) {
+		telemetryStats.dropped++;
+		return false;
+	}
+	telemetryStats.sent++;
+	return true;
+}
+
+//*****************************************************************************
+// Returns the frame counts.
+//*****************************************************************************
+void telemetry_get_stats(telemetry_stats_t *stats)
+{
+	*stats = telemetryStats;
+}
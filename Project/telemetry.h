@@ -0,0 +1,148 @@
+#ifndef __TELEMETRY_H__
+#define __TELEMETRY_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "serial_debug.h"
+#include "crc.h"
+#include "lcd.h"
+#include "cycle_counter.h"
+#include <string.h>
+
+//*****************************************************************************
+// Binary telemetry over the serial debug UART.  Every game tick one
+// telemetry_record_t is sent followed by its CRC-16/CCITT (low byte first).
+// The pair is COBS encoded and ended with a zero byte, so a receiver that
+// starts mid stream, or sees text from printf between frames, resyncs at the
+// next zero.  tools/telemetry_decode.c turns the stream back into CSV.
+//
+// Bandwidth: 115200 baud 8N1 carries 11520 bytes/s, 230 bytes per 50Hz
+// tick.  A frame is TELEMETRY_FRAME_BYTES (57), about 25% of the link, which
+// leaves room for debug text.  Frames go through serial_debug_write() and
+// are dropped rather than waited on if the link ever falls behind.
+//*****************************************************************************
+
+// First byte of every frame.  Change TELEMETRY_RECORD_TICK whenever the 
+// layout of telemetry_record_t changes.
+#define TELEMETRY_RECORD_TICK     0x01
+#define TELEMETRY_RECORD_LOG      0x02
+
+// Largest frame payload, so one COBS overhead byte always covers it
+#define TELEMETRY_MAX_PAYLOAD     250
+
+// Where the main loop spends its time.  Each record carries the cycles
+// spent in every phase since the previous record.  Time spent in the LCD
+// driver is always counted as TELEMETRY_PHASE_RENDER, whichever phase drew.
+typedef enum {
+	TELEMETRY_PHASE_INPUT = 0,
+	TELEMETRY_PHASE_PHYSICS,
+	TELEMETRY_PHASE_RENDER,
+	TELEMETRY_PHASE_PERSIST,
+	TELEMETRY_PHASE_IDLE,
+	TELEMETRY_NUM_PHASES
+} telemetry_phase_t;
+
+// Bit numbers of telemetry_record_t.buttons
+#define TELEMETRY_BUTTON_LEFT     0
+#define TELEMETRY_BUTTON_RIGHT    1
+
+// Wire layout, little endian with no padding.  type, sequence, the paddle
+// movement and phaseCycles are filled in by telemetry_send().
+typedef __packed struct {
+	uint8_t type;
+	uint8_t gamemode;
+	uint16_t sequence;        // counts every record, gaps are lost frames
+	uint32_t tick;            // game ticks since the match started
+	int16_t player1x;
+	int16_t player1y;
+	int16_t player2x;
+	int16_t player2y;
+	int16_t ballx;
+	int16_t bally;
+	int8_t ballChangex;
+	int8_t ballChangey;
+	int8_t player1dx;         // paddle movement since the previous record
+	int8_t player1dy;
+	int8_t player2dx;
+	int8_t player2dy;
+	int8_t joystickX;         // joystick step this tick
+	int8_t joystickY;
+	int16_t tilt;             // board tilt, 32768 is 180 degrees
+	uint8_t buttons;
+	uint8_t player1score;
+	uint8_t player2score;
+	uint32_t phaseCycles[TELEMETRY_NUM_PHASES];
+} telemetry_record_t;
+
+// record + CRC, plus the COBS overhead byte and the zero delimiter
+#define TELEMETRY_FRAME_BYTES     (sizeof(telemetry_record_t) + 2 + 2)
+
+typedef struct {
+	uint32_t sent;            // frames queued on the UART
+	uint32_t dropped;         // frames the UART had no room for
+} telemetry_stats_t;
+
+// Phase cycles per record over a profile capture
+typedef struct {
+	uint16_t records;
+	uint32_t min[TELEMETRY_NUM_PHASES];
+	uint32_t max[TELEMETRY_NUM_PHASES];
+	uint32_t total[TELEMETRY_NUM_PHASES];
+} telemetry_profile_t;
+
+//*****************************************************************************
+// Starts the phase timing in TELEMETRY_PHASE_IDLE and sends a zero byte so
+// the receiver starts at a frame boundary.  The serial debug interface must
+// already be initialized with transmit enabled.
+//*****************************************************************************
+void telemetry_init(void);
+
+//*****************************************************************************
+// Charges the cycles since the last call to the current phase and makes
+// phase the current one.  Returns the phase that was current, so a caller
+// can switch back to it when done.
+//*****************************************************************************
+telemetry_phase_t telemetry_phase(telemetry_phase_t phase);
+
+//*****************************************************************************
+// Completes the record with its type, sequence number, paddle movement and
+// phase cycles, then queues the frame.  The phase cycles restart from zero.  Never waits.
+//
+// Returns false if the frame was dropped.
+//*****************************************************************************
+bool telemetry_send(telemetry_record_t *record);
+
+//*****************************************************************************
+// Turns sending the tick records on or off, for example while the serial
+// port is used as a console.  The phase timing and profile captures carry
+// on either way.  Telemetry starts on.
+//*****************************************************************************
+void telemetry_enable(bool enable);
+
+//*****************************************************************************
+// Starts collecting the phase cycles of the next num_records records.
+// A capture that is running is restarted.
+//*****************************************************************************
+void telemetry_profile_start(uint16_t num_records);
+
+//*****************************************************************************
+// Returns true, and copies the result, once a capture has finished.  A
+// finished capture is only returned once.
+//*****************************************************************************
+bool telemetry_profile_done(telemetry_profile_t *profile);
+
+//*****************************************************************************
+// Sends num_bytes of data, TELEMETRY_MAX_PAYLOAD at most, as one frame with
+// the same CRC and COBS framing as the tick records.  The first byte should
+// be a TELEMETRY_RECORD_ type.  Never waits.
+//
+// Returns false if the frame was dropped.
+//*****************************************************************************
+bool telemetry_write_frame(const uint8_t *data, uint32_t num_bytes);
+
+//*****************************************************************************
+// Returns the frame counts.
+//*****************************************************************************
+void telemetry_get_stats(telemetry_stats_t *stats);
+
+#endif
@@ -0,0 +1,129 @@
+#include "tunables.h"
+
+static const tunable_t *tunableTable;
+static uint8_t tunableCount;
+static uint8_t tunableVersion;
+static tunables_stats_t tunableStats;
+static eeprom_journal_t tunableJournal;
+
+//*****************************************************************************
+// Registers the table and replaces the values with the saved ones, if the
+// EEPROM holds a record written with the same version.  Bump version
+// whenever the table changes.  This blocks, so it is only called at boot.
+//*****************************************************************************
+void tunables_init(const tunable_t *table, uint8_t num_tunables, uint8_t version)
+{
+	int16_t saved[TUNABLES_MAX];
+	uint8_t savedVersion;
+	uint8_t i;
+
+	if (num_tunables > TUNABLES_MAX)
+		num_tunables = TUNABLES_MAX;
+
+	tunableTable = table;
+	tunableCount = num_tunables;
+	tunableVersion = version;
+	memset(&tunableStats, 0, sizeof(tunableStats));
+
+	if (!eeprom_journal_init(&tunableJournal, EEPROM_I2C_BASE, TUNABLES_EEPROM_ADDR,
+	                         TUNABLES_NUM_SLOTS, sizeof(saved), saved, &savedVersion))
+		return;
+	if (savedVersion != version)
+		return;
+
+	for (i = 0; i < tunableCount; i++)
+		tunables_set(&tunableTable[i], saved[i]);
+}
+
+//*****************************************************************************
+// Returns the number of registered tunables and the table itself.
+//*****************************************************************************
+uint8_t tunables_count(void)
+{
+	return tunableCount;
+}
+
+const tunable_t *tunables_get(uint8_t index)
+{
+	return index < tunableCount ? &tunableTable[index] : NULL;
+}
+
+//*****************************************************************************
+// Returns the tunable called name, or NULL if there is none.
+//*****************************************************************************
+const tunable_t *tunables_find(const char *name)
+{
+	uint8_t i;
+
+	for (i = 0; i < tunableCount; i++) {
+		if (strcmp(tunableTable[i].name, name) == 0)
+			return &tunableTable[i];
+	}
+	return NULL;
+}
+
+//*****************************************************************************
+// Sets a tunable and calls its changed callback.  Returns false, leaving
+// the value alone, if it is outside the range of the tunable.
+//*****************************************************************************
+bool tunables_set(const tunable_t *tunable, int value)
+{
+	if (value < tunable->min || value > tunable->max)
+		return false;
+
+	if (*tunable->value != value) {
+		*tunable->value = value;
+		if (tunable->changed)
+			tunable->changed();
+	}
+	return true;
+}
+
+//*****************************************************************************
+// Marks the current values to be written to the EEPROM by the next flush.
+//*****************************************************************************
+void tunables_save(void)
+{
+	tunableStats.dirty = true;
+}
+
+//*****************************************************************************
+// Writes the values to the EEPROM if a save is pending.  Works like
+// settings_flush(): unless force is set the write is skipped while the
+// EEPROM is busy and a failed write stays pending.  Returns true if the
+// record was written.
+//*****************************************************************************
+bool tunables_flush(bool force)
+{
+	int16_t values[TUNABLES_MAX];
+	uint8_t i;
+
+	if (!tunableStats.dirty)
+		return false;
+
+	if (!force && eeprom_busy(EEPROM_I2C_BASE)) {
+		tunableStats.deferredCount++;
+		return false;
+	}
+
+	memset(values, 0, sizeof(values));
+	for (i = 0; i < tunableCount; i++)
+		values[i] = *tunableTable[i].value;
+
+	if (eeprom_journal_append(&tunableJournal, tunableVersion, values) != I2C_OK) {
+		tunableStats.failedCount++;
+		return false;
+	}
+
+	tunableStats.dirty = false;
+	tunableStats.flushCount++;
+	return true;
+}
+
+//*****************************************************************************
+// Returns the flush statistics.
+//*****************************************************************************
+void tunables_get_stats(tunables_stats_t *stats)
+{
+	*stats = tunableStats;
+}
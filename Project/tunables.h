@@ -0,0 +1,81 @@
+#ifndef __TUNABLES_H__
+#define __TUNABLES_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include "eeprom.h"
+#include "eeprom_journal.h"
+
+//*****************************************************************************
+// Named game constants that can be changed at run time.  The owner keeps
+// the values in ordinary int globals and hands a table describing them to
+// tunables_init().  Saved values are kept in their own EEPROM journal and
+// written the same way as the settings, from idle time.
+//*****************************************************************************
+
+// EEPROM region holding the tunables journal, after the match database
+#define TUNABLES_EEPROM_ADDR    1536
+#define TUNABLES_NUM_SLOTS      8
+
+// Values are stored as int16_t, so this many fit in one journal record
+#define TUNABLES_MAX            (EEPROM_JOURNAL_MAX_PAYLOAD / 2)
+
+typedef struct {
+	const char *name;
+	int *value;
+	int16_t min;
+	int16_t max;
+	void (*changed)(void);    // called after the value changes, may be NULL
+} tunable_t;
+
+typedef struct {
+	uint32_t flushCount;      // records written to the EEPROM
+	uint32_t deferredCount;   // flushes skipped because the EEPROM was busy
+	uint32_t failedCount;     // writes the EEPROM did not complete
+	bool dirty;               // a save is waiting for the EEPROM
+} tunables_stats_t;
+
+//*****************************************************************************
+// Registers the table and replaces the values with the saved ones, if the
+// EEPROM holds a record written with the same version.  Bump version
+// whenever the table changes.  This blocks, so it is only called at boot.
+//*****************************************************************************
+void tunables_init(const tunable_t *table, uint8_t num_tunables, uint8_t version);
+
+//*****************************************************************************
+// Returns the number of registered tunables and the table itself.
+//*****************************************************************************
+uint8_t tunables_count(void);
+const tunable_t *tunables_get(uint8_t index);
+
+//*****************************************************************************
+// Returns the tunable called name, or NULL if there is none.
+//*****************************************************************************
+const tunable_t *tunables_find(const char *name);
+
+//*****************************************************************************
+// Sets a tunable and calls its changed callback.  Returns false, leaving
+// the value alone, if it is outside the range of the tunable.
+//*****************************************************************************
+bool tunables_set(const tunable_t *tunable, int value);
+
+//*****************************************************************************
+// Marks the current values to be written to the EEPROM by the next flush.
+//*****************************************************************************
+void tunables_save(void);
+
+//*****************************************************************************
+// Writes the values to the EEPROM if a save is pending.  Works like
+// settings_flush(): unless force is set the write is skipped while the
+// EEPROM is busy and a failed write stays pending.  Returns true if the
+// record was written.
+//*****************************************************************************
+bool tunables_flush(bool force);
+
+//*****************************************************************************
+// Returns the flush statistics.
+//*****************************************************************************
+void tunables_get_stats(tunables_stats_t *stats);
+
+#endif
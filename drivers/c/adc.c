@@ -1,124 +1,261 @@
-// Copyright (c) 2014, Joe Krachey
-// All rights reserved.
-//
-// Redistribution and use in binary form, with or without modification, 
-// are permitted provided that the following conditions are met:
-//
-// 1. Redistributions in binary form must reproduce the above copyright 
-//    notice, this list of conditions and the following disclaimer in 
-//    the documentation and/or other materials provided with the distribution.
-//
-// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" 
-// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
-// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR 
-// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR 
-// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, 
-// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, 
-// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; 
-// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
-// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING 
-// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, 
-// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
-
-#include "adc.h"
-#include "driver_defines.h"
-
-/******************************************************************************
- * Initializes ADC to use Sample Sequencer #3, triggered by the processor,
- * no IRQs
- *****************************************************************************/
-bool initialize_adc(  uint32_t adc_base )
-{
-  ADC0_Type  *myADC;
-  uint32_t rcgc_adc_mask;
-  uint32_t pr_mask;
-  
-
-  // examine the adc_base.  Verify that it is either ADC0 or ADC1
-  // Set the rcgc_adc_mask and pr_mask  
-  switch (adc_base) 
-  {
-    case ADC0_BASE :
-    {
-      
-      // ADD CODE
-      // set rcgc_adc_mask
-      rcgc_adc_mask = SYSCTL_RCGCADC_R0;
-      // ADD CODE
-      // Set pr_mask 
-      pr_mask = SYSCTL_PRADC_R0;
-      break;
-    }
-    case ADC1_BASE :
-    {
-      // ADD CODE
-      // set rcgc_adc_mask
-      rcgc_adc_mask = SYSCTL_RCGCADC_R1;
-      // ADD CODE
-      // Set pr_mask 
-      pr_mask = SYSCTL_PRADC_R1;
-      break;
-    }
-    
-    default:
-      return false;
-  }
-  
-  // Turn on the ADC Clock
-  SYSCTL->RCGCADC |= rcgc_adc_mask;
-  
-  // Wait for ADCx to become ready
-  while( (pr_mask & SYSCTL->PRADC) != pr_mask){}
-    
-  // Type Cast adc_base and set it to myADC
-  myADC = (ADC0_Type *)adc_base;
-  
-  // ADD CODE
-  // disable sample sequencer #3 by writing a 0 to the 
-  // corresponding ASENn bit in the ADCACTSS register 
-	myADC->ACTSS &= ~ADC_ACTSS_ASEN3;
-		
-  // ADD CODE
-  // Set the event multiplexer to trigger conversion on a processor trigger
-  // for sample sequencer #3.
-  myADC->EMUX &= ~ADC_EMUX_EM3_PROCESSOR;
-  // ADD CODE
-  // Set IE0 and END0 in SSCTL3
-  myADC->SSCTL3 |= ADC_SSCTL3_IE0 | ADC_SSCTL3_END0;
-  return true;
-}
-
-
-/******************************************************************************
- * Reads SSMUX3 for the given ADC.  Busy waits until completion
- *****************************************************************************/
-uint32_t get_adc_value( uint32_t adc_base, uint8_t channel)
-{
-  ADC0_Type  *myADC;
-  uint32_t result;
-  
-  if( adc_base == 0)
-  {
-    return false;
-  }
-  
-  myADC = (ADC0_Type *)adc_base;
-  
-  myADC->SSMUX3 = channel;          // Set the Channel
-  
-  myADC->ACTSS |= ADC_ACTSS_ASEN3;  // Enable SS3
-  
-  myADC->PSSI =   ADC_PSSI_SS3;     // Start SS3
-  
-  while( (myADC->RIS & ADC_RIS_INR3)  == 0)
-  {
-    // wait
-  }
-  
-  result = myADC->SSFIFO3 & 0xFFF;    // Read 12-bit data
-  
-  myADC->ISC  = ADC_ISC_IN3;          // Ack the conversion
-  
-  return result;
-}
-
+// Copyright (c) 2014, Joe Krachey
+// All rights reserved.
+//
+// Redistribution and use in binary form, with or without modification, 
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions in binary form must reproduce the above copyright 
+//    notice, this list of conditions and the following disclaimer in 
+//    the documentation and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" 
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR 
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR 
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, 
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, 
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; 
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING 
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, 
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "adc.h"
+#include "driver_defines.h"
+#include "timebase.h"
+#include "profile_zones.h"
+
+static ADC0_Type *serviceADC;
+static uint8_t serviceChannels;
+static uint32_t serviceSequence;
+
+// The interrupt handler fills adcSlots[adcLatest ^ 1] and then flips 
+// adcLatest, readers copy adcSlots[adcLatest]
+static adc_sample_t adcSlots[2];
+static volatile uint8_t adcLatest;
+
+/******************************************************************************
+ * Initializes ADC to use Sample Sequencer #3, triggered by the processor,
+ * no IRQs
+ *****************************************************************************/
+bool initialize_adc(  uint32_t adc_base )
+{
+  ADC0_Type  *myADC;
+  uint32_t rcgc_adc_mask;
+  uint32_t pr_mask;
+  
+
+  // examine the adc_base.  Verify that it is either ADC0 or ADC1
+  // Set the rcgc_adc_mask and pr_mask  
+  switch (adc_base) 
+  {
+    case ADC0_BASE :
+    {
+      
+      // ADD CODE
+      // set rcgc_adc_mask
+      rcgc_adc_mask = SYSCTL_RCGCADC_R0;
+      // ADD CODE
+      // Set pr_mask 
+      pr_mask = SYSCTL_PRADC_R0;
+      break;
+    }
+    case ADC1_BASE :
+    {
+      // ADD CODE
+      // set rcgc_adc_mask
+      rcgc_adc_mask = SYSCTL_RCGCADC_R1;
+      // ADD CODE
+      // Set pr_mask 
+      pr_mask = SYSCTL_PRADC_R1;
+      break;
+    }
+    
+    default:
+      return false;
+  }
+  
+  // Turn on the ADC Clock
+  SYSCTL->RCGCADC |= rcgc_adc_mask;
+  
+  // Wait for ADCx to become ready
+  while( (pr_mask & SYSCTL->PRADC) != pr_mask){}
+    
+  // Type Cast adc_base and set it to myADC
+  myADC = (ADC0_Type *)adc_base;
+  
+  // ADD CODE
+  // disable sample sequencer #3 by writing a 0 to the 
+  // corresponding ASENn bit in the ADCACTSS register 
+	myADC->ACTSS &= ~ADC_ACTSS_ASEN3;
+		
+  // ADD CODE
+  // Set the event multiplexer to trigger conversion on a processor trigger
+  // for sample sequencer #3.
+  myADC->EMUX &= ~ADC_EMUX_EM3_PROCESSOR;
+  // ADD CODE
+  // Set IE0 and END0 in SSCTL3
+  myADC->SSCTL3 |= ADC_SSCTL3_IE0 | ADC_SSCTL3_END0;
+  return true;
+}
+
+
+/******************************************************************************
+ * Reads SSMUX3 for the given ADC.  Busy waits until completion
+ *****************************************************************************/
+uint32_t get_adc_value( uint32_t adc_base, uint8_t channel)
+{
+  ADC0_Type  *myADC;
+  uint32_t result;
+  
+  if( adc_base == 0)
+  {
+    return false;
+  }
+  
+  myADC = (ADC0_Type *)adc_base;
+  
+  myADC->SSMUX3 = channel;          // Set the Channel
+  
+  myADC->ACTSS |= ADC_ACTSS_ASEN3;  // Enable SS3
+  
+  myADC->PSSI =   ADC_PSSI_SS3;     // Start SS3
+  
+  while( (myADC->RIS & ADC_RIS_INR3)  == 0)
+  {
+    // wait
+  }
+  
+  result = myADC->SSFIFO3 & 0xFFF;    // Read 12-bit data
+  
+  myADC->ISC  = ADC_ISC_IN3;          // Ack the conversion
+  
+  return result;
+}
+
+
+/******************************************************************************
+ * Configures Sample Sequencer #2 and its trigger timer
+ *****************************************************************************/
+bool adc_service_start(
+  uint32_t adc_base, 
+  uint32_t timer_base, 
+  const uint8_t *channels, 
+  uint8_t num_channels, 
+  uint32_t rate_hz,
+  uint32_t averaging
+)
+{
+  ADC0_Type  *myADC;
+  TIMER0_Type *trigger;
+  uint32_t ssmux = 0;
+  uint32_t ssctl = 0;
+  uint8_t i;
+  
+  if ( (adc_base != ADC0_BASE && adc_base != ADC1_BASE) ||
+       num_channels == 0 || num_channels > ADC_SERVICE_MAX_CHANNELS ||
+       rate_hz == 0
+  )
+  {
+    return false;
+  }
+  
+  // The timer counts down from the load value and pulses the ADC trigger 
+  // at every timeout
+  if ( !gp_timer_config_32(timer_base, TIMER_TAMR_TAMR_PERIOD, false, false))
+  {
+    return false;
+  }
+  trigger = (TIMER0_Type *)timer_base;
+  trigger->TAILR = SystemCoreClock / rate_hz - 1;
+  
+  myADC = (ADC0_Type *)adc_base;
+  myADC->ACTSS &= ~ADC_ACTSS_ASEN2;
+  
+  // One step per channel, the last one ends the sequence and interrupts
+  for ( i = 0; i < num_channels; i++)
+  {
+    ssmux |= (uint32_t)(channels[i] & 0xF) << (i * 4);
+  }
+  ssctl = (ADC_SSCTL2_END0 | ADC_SSCTL2_IE0) << ((num_channels - 1) * 4);
+  
+  myADC->SSMUX2 = ssmux;
+  myADC->SSCTL2 = ssctl;
+  myADC->EMUX = (myADC->EMUX & ~ADC_EMUX_EM2_M) | ADC_EMUX_EM2_TIMER;
+  myADC->SAC = averaging & ADC_SAC_AVG_M;
+  
+  serviceADC = myADC;
+  serviceChannels = num_channels;
+  serviceSequence = 0;
+  adcLatest = 0;
+  adcSlots[0].sequence = 0;
+  timebase_init();
+  
+  myADC->ISC = ADC_ISC_IN2;
+  myADC->IM |= ADC_IM_MASK2;
+  if ( adc_base == ADC0_BASE)
+  {
+    NVIC_SetPriority(ADC0SS2_IRQn, ADC_SERVICE_IRQ_PRIORITY);
+    NVIC_EnableIRQ(ADC0SS2_IRQn);
+  }
+  else
+  {
+    NVIC_SetPriority(ADC1SS2_IRQn, ADC_SERVICE_IRQ_PRIORITY);
+    NVIC_EnableIRQ(ADC1SS2_IRQn);
+  }
+  myADC->ACTSS |= ADC_ACTSS_ASEN2;
+  
+  trigger->CTL |= TIMER_CTL_TAOTE | TIMER_CTL_TAEN;
+  
+  return true;
+}
+
+/******************************************************************************
+ * Stores the results of one sequence in the free slot
+ *****************************************************************************/
+static void adc_service_isr(void)
+{
+  uint32_t timestamp = timebase_cycles();
+  adc_sample_t *slot = &adcSlots[adcLatest ^ 1];
+  uint8_t i;
+  
+  PROFILE_BEGIN(PROFILE_ZONE_ADC);
+  serviceADC->ISC = ADC_ISC_IN2;
+  
+  for ( i = 0; i < serviceChannels; i++)
+  {
+    slot->value[i] = serviceADC->SSFIFO2 & 0xFFF;
+  }
+  slot->timestamp = timestamp;
+  slot->sequence = ++serviceSequence;
+  
+  adcLatest ^= 1;
+  PROFILE_END(PROFILE_ZONE_ADC);
+}
+
+void ADC0SS2_Handler(void)
+{
+  adc_service_isr();
+}
+
+void ADC1SS2_Handler(void)
+{
+  adc_service_isr();
+}
+
+/******************************************************************************
+ * Copies the most recent conversion.  If the handler refilled the slot while
+ * it was being copied, the copy is repeated.
+ *****************************************************************************/
+bool adc_service_read(adc_sample_t *sample)
+{
+  uint8_t latest;
+  
+  do
+  {
+    latest = adcLatest;
+    *sample = adcSlots[latest];
+  } while ( latest != adcLatest || sample->sequence != adcSlots[latest].sequence);
+  
+  return sample->sequence != 0;
+}
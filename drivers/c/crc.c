@@ -0,0 +1,24 @@
+#include "crc.h"
+
+// CRC of each 4-bit value, processing a nibble at a time keeps the table 
+// in 32 bytes of flash
+static const uint16_t crc16_nibble_table[16] = {
+  0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
+  0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF
+};
+
+//*****************************************************************************
+// Computes the CRC-16/CCITT (polynomial 0x1021) of a block of data.  
+//*****************************************************************************
+uint16_t crc16_ccitt(uint16_t crc, const uint8_t *data, uint32_t num_bytes)
+{
+  while ( num_bytes > 0 )
+  {
+    crc = (crc << 4) ^ crc16_nibble_table[((crc >> 12) ^ (*data >> 4)) & 0x0F];
+    crc = (crc << 4) ^ crc16_nibble_table[((crc >> 12) ^ (*data & 0x0F)) & 0x0F];
+    data++;
+    num_bytes--;
+  }
+  
+  return crc;
+}
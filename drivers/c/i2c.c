@@ -1,382 +1,705 @@
-#include "i2c.h"
-#include "driver_defines.h"
-
-//*****************************************************************************
-// Initializes a given I2C peripheral to operate at 100KHz.  This assumes
-// MCU core is running at 50MHz
-//
-// Paramters:
-//    base_addr:  The base address of the I2C peripheral that is being
-//                configured
-//
-// Return Value:
-//    Returns I2C_OK if the base address is a valid I2C peripheral
-//    Returns I2C_INVALID_BASE if the base address is not a valid I2C address
-//*****************************************************************************
-i2c_status_t initializeI2CMaster(uint32_t base_addr)
-{
-  I2C0_Type *myI2C;
-  
-  myI2C = (I2C0_Type *) base_addr;
-  
-  // Validate that a correct base address has been passed
-    // Turn on the Clock Gating Register
-    switch (base_addr) 
-    {
-      case I2C0_BASE :
-          SYSCTL->RCGCI2C |= SYSCTL_RCGCI2C_R0;
-          while ((SYSCTL->PRI2C & SYSCTL_PRI2C_R0) == 0);    /* wait until SSI is ready */
-          break;
-      case I2C1_BASE :
-          SYSCTL->RCGCI2C |= SYSCTL_RCGCI2C_R1;
-          while ((SYSCTL->PRI2C & SYSCTL_PRI2C_R1) == 0);    /* wait until SSI is ready */
-          break;
-      case I2C2_BASE :
-          SYSCTL->RCGCI2C |= SYSCTL_RCGCI2C_R2;
-          while ((SYSCTL->PRI2C & SYSCTL_PRI2C_R2) == 0);    /* wait until SSI is ready */
-          break;
-      case I2C3_BASE :
-          SYSCTL->RCGCI2C |= SYSCTL_RCGCI2C_R3;
-          while ((SYSCTL->PRI2C & SYSCTL_PRI2C_R3) == 0);    /* wait until SSI is ready */
-          break;
-      default:
-          return I2C_INVALID_BASE;
-    }
-    
-    // Enable the I2C port as master
-    myI2C->MCR = I2C_MCR_MFE;
-    
-    // Set the clock speed to be 100Kpbs assuming a 50MHz clock
-    // TPR = (System Clock/(2*(SCL_LP + SCL_HP)*SCL_CLK))-1;
-    // TPR = (50MHz/(2*(6+4)*100000))-1
-    //myI2C->MTPR = 0x18;
-    myI2C->MTPR = 0x06;
-    
-    
-    return I2C_OK;
-}
-
-//*****************************************************************************
-// verifies if the base addressed passed to a function is a valid I2C address
-//*****************************************************************************
-bool
-i2cVerifyBaseAddr(
-  uint32_t i2c_base
-)
-{
-    if( i2c_base == I2C0_BASE ||
-        i2c_base == I2C1_BASE ||
-        i2c_base == I2C2_BASE ||
-        i2c_base == I2C3_BASE
-    )
-  {
-    return true;
-  }
-  else
-  {
-    return false;
-  }
-}
-
-//*****************************************************************************
-// Sets the slave address that is currently being addressed.
-//
-// Paramters:
-//    baseAddr:  The base address of the I2C peripheral that is being
-//                configured
-//    slaveAddr: The address of the slave device being accessed.  This is a 
-//                7-bit slave address
-//    readWrite: If the the transaction will be a read or write operation.
-//               read = 0x01.  write = 0x00
-// Return Value:
-//    Returns I2C_OK if the base address is a valid I2C peripheral
-//    Returns I2C_INVALID_BASE if the base address is not a valid I2C address
-//*****************************************************************************
-i2c_status_t i2cSetSlaveAddr(
-  uint32_t baseAddr, 
-  uint8_t slaveAddr,
-  i2c_read_write_t readWrite
-)
-{
-  I2C0_Type *myI2C;
-  if( i2cVerifyBaseAddr(baseAddr) == false)
-  {
-    return I2C_INVALID_BASE;
-  }
-  
-  myI2C = (I2C0_Type *) baseAddr;
-  
-  // Set the slave address to transmit data
-   myI2C->MSA = (slaveAddr << 1) | readWrite;
-  //myI2C->MSA = slaveAddr | readWrite;
-  
-  return I2C_OK;
-}
-
-
-//*****************************************************************************
-// Initiates a stop condition.  This function is used when the master does
-// not receive an ACK.
-//
-// Paramters:
-//    baseAddr:  The base address of the I2C peripheral that is being
-//                configured
-// Return Value:
-//    Returns I2C_OK if the base address is a valid I2C peripheral
-//    Returns I2C_INVALID_BASE if the base address is not a valid I2C address
-//*****************************************************************************
-i2c_status_t i2cStop(
-  uint32_t baseAddr
-)
-{
-  I2C0_Type *myI2C;
-  if( i2cVerifyBaseAddr(baseAddr) == false)
-  {
-    return I2C_INVALID_BASE;
-  }
-  
-  myI2C = (I2C0_Type *) baseAddr;
-  
-  // Stop the interface
-  myI2C->MCS = I2C_MCS_STOP;
-  
-  return I2C_OK;
-}
-
-//*****************************************************************************
-// Determines if the I2C device is busy transmitting data.  
-//
-// Paramters:
-//    baseAddr:  The base address of the I2C peripheral that is being accessed
-//
-// Returns
-//    Returns true if the I2C device is busy
-//    Returns false if the I2C device is NOT busy or i2c_base is invalid
-//*****************************************************************************
-bool
-I2CMasterBusy(uint32_t i2c_base)
-{
-  I2C0_Type *myI2C;
-  
-  if( i2cVerifyBaseAddr(i2c_base) == false)
-  {
-    return false;
-  }
-  
-    myI2C = (I2C0_Type *) i2c_base;
-    
-    if(myI2C->MCS & I2C_MCS_BUSY)
-    {
-        return(true);
-    }
-    else
-    {
-        return(false);
-    }
-}
-
-//*****************************************************************************
-// Determines if the address (control word) was ACKed.  
-//
-// Paramters:
-//    baseAddr:  The base address of the I2C peripheral that is being accessed
-//
-// Returns
-//    Returns true if the address was ACKed
-//    Returns false if the address was not ACKed or i2c_base is invalid
-//*****************************************************************************
-bool
-I2CMasterAdrAck(uint32_t i2c_base)
-{
-    I2C0_Type *myI2C;
-    uint32_t status;
-  if( i2cVerifyBaseAddr(i2c_base) == false)
-  {
-    return false;
-  }
-  
-  myI2C = (I2C0_Type *) i2c_base;
-  
-  status = myI2C->MCS;
-  if((status & I2C_MCS_ADRACK)!= 0)
-  {
-      return(false);
-  }
-  else
-  {
-      return(true);
-  }
-}
-
-
-//*****************************************************************************
-// Determines if the last byte of data transmitted was ACKed.  
-//
-// Paramters:
-//    baseAddr:  The base address of the I2C peripheral that is being accessed
-//
-// Returns
-//    Returns true if the data was ACKed
-//    Returns false if the data was not ACKed or i2c_base is invalid
-//*****************************************************************************
-bool
-I2CMasterDatAck(uint32_t i2c_base)
-{
-    I2C0_Type *myI2C;
-    uint32_t status;
-  if( i2cVerifyBaseAddr(i2c_base) == false)
-  {
-    return false;
-  }
-  
-  myI2C = (I2C0_Type *) i2c_base;
-  
-  status = myI2C->MCS;
-  if((status & I2C_MCS_DATACK)!= 0)
-  {
-      return(false);
-  }
-  else
-  {
-      return(true);
-  }
-}
-
-//*****************************************************************************
-// Sends one byte of data over a I2C bus.  
-//
-// Paramters:
-//    baseAddr:  The base address of the I2C peripheral that is being
-//                configured
-//    byte:      The next byte of the data transaction.
-//    mcs:       Sets master control register of the I2C peripheral. Since a
-//               data transaction can consist of multiple bytes, the value
-//               of mcs is used to determine when start and stop bits are 
-//               generated.
-//
-// Examples:
-//    * Sending control word (i2c address) + write 1st byte of data. This
-//    * assumes that additional bytes will follow in the transaction
-//    i2cSendByte(I2C0_BASE, byte, I2C_MCS_START | I2C_MCS_RUN);
-//
-//    * Sending a byte in the middle of a multi-byte operation. (> 2 bytes)
-//    i2cSendByte(I2C0_BASE, byte, I2C_MCS_RUN);
-//
-//    * Sending final byte  of data
-//    i2cSendByte(I2C0_BASE, byte, I2C_MCS_RUN | I2C_MCS_STOP);
-//
-//    * Sending control word (i2c address) + a single byte transaction.
-//    i2cSendByte(I2C0_BASE, byte, I2C_MCS_START | I2C_MCS_RUN | I2C_MCS_STOP);
-//
-// Return Value:
-//    Returns I2C_OK if the base address is a valid and the data was 
-//    transmitted sucessfully.
-//*****************************************************************************
-i2c_status_t i2cSendByte(
-  uint32_t baseAddr, 
-  uint8_t byte, 
-  uint8_t mcs
-)
-{
-  I2C0_Type *myI2C;
-  
-  if( i2cVerifyBaseAddr(baseAddr) == false)
-  {
-    return I2C_INVALID_BASE;
-  }
-  myI2C = (I2C0_Type *) baseAddr;
-  
-   // Write the upper address to the data register
-  myI2C->MDR   = byte;
-  
-  // Start the transaction
-  myI2C->MCS = mcs;
-  
-  // Wait for the device to be free
-  while ( I2CMasterBusy(baseAddr)) {};
-  
-    // Check for error conditions
-  if ( myI2C->MCS & (I2C_MCS_ERROR | I2C_MCS_ARBLST) )
-  {
-      return I2C_ARBLST;
-  }
-  else if ( myI2C->MCS & I2C_MCS_ERROR )
-  {
-    myI2C->MCS = I2C_MCS_STOP;
-    return I2C_BUS_ERROR;
-  }
-  else if ( myI2C->MCS & I2C_MCS_DATACK )
-  {
-    return I2C_NO_ACK;
-  }
-  else
-  {
-    return I2C_OK;
-  }
-}
-
-//*****************************************************************************
-// Reads one byte of data over a I2C bus.  
-//
-// Paramters:
-//    baseAddr:  The base address of the I2C peripheral that is being
-//                configured
-//    data:      The data read by the transaction.
-//    mcs:       Sets master control register of the I2C peripheral. Since a
-//               data transaction can consist of multiple bytes, the value
-//               of mcs is used to determine when start and stop bits are 
-//               generated.
-//
-// Examples:
-//    * Sending control word (i2c address) + read 1st byte of data. This
-//    * assumes that additional bytes be read after this byte.  This
-//    * would be used for reading multiple bytes at consecutive addresses
-//    * in the slave address.  
-//    i2cGetByte(I2C0_BASE, byte, I2C_MCS_START | I2C_MCS_RUN);
-//
-//    * Reading a byte in the middle of a multi-byte operation. (> 2 bytes)
-//    i2cGetByte(I2C0_BASE, byte, I2C_MCS_RUN);
-//
-//    * Reading final byte of data in a multi-byte read 
-//    i2cGetByte(I2C0_BASE, byte, I2C_MCS_RUN | I2C_MCS_STOP);
-//
-//    * Sending control word (i2c address) + reading a single byte read.
-//    i2cGetByte(I2C0_BASE, byte, I2C_MCS_START | I2C_MCS_RUN | I2C_MCS_STOP);
-//
-// Return Value:
-//    Returns I2C_OK if the base address is a valid and the data was 
-//    transmitted sucessfully.
-//*****************************************************************************
-i2c_status_t i2cGetByte(
-  uint32_t baseAddr, 
-  uint8_t *data, 
-  uint8_t mcs
-)
-{
-  I2C0_Type *myI2C;
-  
-  if( i2cVerifyBaseAddr(baseAddr) == false)
-  {
-    return I2C_INVALID_BASE;
-  }
-  
- myI2C = (I2C0_Type *) baseAddr;
-  
-  // Start the transaction
-  myI2C->MCS = mcs;
-  
-  // Wait for the device to be free
-  while ( I2CMasterBusy(baseAddr)) {};
-  
-  // Check for error conditions
-  if ( myI2C->MCS & I2C_MCS_ERROR  )
-  {
-    myI2C->MCS = I2C_MCS_STOP;
-    return I2C_BUS_ERROR;
-  }
-  else
-  {
-    *data = myI2C->MDR;
-    return I2C_OK;
-  }
-}
+#include "i2c.h"
+#include "driver_defines.h"
+#include "cycle_counter.h"
+#include <string.h>
+
+#define I2C_NUM_BUSES   4
+
+typedef struct {
+  uint32_t      scl_request;  // rate asked for with i2cSetBusSpeed()
+  i2c_timing_t  timing;       // rate the peripheral is running at
+  uint32_t      txnStart;     // cycle counter at the last START
+  int8_t        txnDevice;    // device of the open transaction, -1 if none
+} i2c_bus_t;
+
+typedef struct {
+  uint32_t            base;
+  uint8_t             addr;
+  uint32_t            max_scl_hz;
+  i2c_device_stats_t  stats;
+} i2c_device_t;
+
+static i2c_bus_t i2cBuses[I2C_NUM_BUSES];
+static i2c_device_t i2cDevices[I2C_MAX_DEVICES];
+static uint8_t i2cNumDevices = 0;
+
+//*****************************************************************************
+// Returns the index of an I2C peripheral, -1 for an invalid base address
+//*****************************************************************************
+static int8_t i2cBusIndex(uint32_t baseAddr)
+{
+  switch (baseAddr) 
+  {
+    case I2C0_BASE: return 0;
+    case I2C1_BASE: return 1;
+    case I2C2_BASE: return 2;
+    case I2C3_BASE: return 3;
+    default:        return -1;
+  }
+}
+
+//*****************************************************************************
+// Programs MTPR with the rate picked by i2cBusRate() from the request and
+// the slowest device registered on the bus.  MTPR is only written if the 
+// peripheral is clocked, otherwise the rate is applied by 
+// initializeI2CMaster().
+//*****************************************************************************
+static i2c_status_t i2cApplyBusSpeed(uint32_t baseAddr)
+{
+  I2C0_Type *myI2C = (I2C0_Type *) baseAddr;
+  int8_t bus = i2cBusIndex(baseAddr);
+  uint32_t slowest_hz = 0;
+  uint32_t scl_hz;
+  i2c_timing_t timing;
+  uint8_t i;
+  
+  for ( i = 0; i < i2cNumDevices; i++)
+  {
+    if ( i2cDevices[i].base == baseAddr && 
+        (slowest_hz == 0 || i2cDevices[i].max_scl_hz < slowest_hz) )
+    {
+      slowest_hz = i2cDevices[i].max_scl_hz;
+    }
+  }
+  scl_hz = i2cBusRate(i2cBuses[bus].scl_request, slowest_hz);
+  
+  if ( i2cCalcTiming(SystemCoreClock, scl_hz, &timing) == false)
+  {
+    return I2C_INVALID_PARAM;
+  }
+  i2cBuses[bus].timing = timing;
+  
+  if ( SYSCTL->RCGCI2C & (1 << bus) )
+  {
+    // Wait for any transaction in progress to finish
+    while ( myI2C->MCS & I2C_MCS_BUSY ) {};
+    myI2C->MTPR = timing.tpr | (timing.high_speed ? I2C_MTPR_HS : 0);
+  }
+  
+  return I2C_OK;
+}
+
+//*****************************************************************************
+// Sets the SCL rate of an I2C peripheral from SystemCoreClock.
+//*****************************************************************************
+i2c_status_t i2cSetBusSpeed(
+  uint32_t baseAddr,
+  uint32_t scl_hz
+)
+{
+  int8_t bus = i2cBusIndex(baseAddr);
+  
+  if ( bus < 0 )
+  {
+    return I2C_INVALID_BASE;
+  }
+  
+  i2cBuses[bus].scl_request = scl_hz;
+  return i2cApplyBusSpeed(baseAddr);
+}
+
+//*****************************************************************************
+// Returns the timing the I2C peripheral is currently running at.
+//*****************************************************************************
+i2c_status_t i2cGetBusSpeed(
+  uint32_t baseAddr,
+  i2c_timing_t *timing
+)
+{
+  int8_t bus = i2cBusIndex(baseAddr);
+  
+  if ( bus < 0 )
+  {
+    return I2C_INVALID_BASE;
+  }
+  if ( timing == NULL )
+  {
+    return I2C_NULL_PTR;
+  }
+  
+  *timing = i2cBuses[bus].timing;
+  return I2C_OK;
+}
+
+//*****************************************************************************
+// Returns the index of a registered device, -1 if it is not registered
+//*****************************************************************************
+static int8_t i2cFindDevice(uint32_t baseAddr, uint8_t slaveAddr)
+{
+  uint8_t i;
+  
+  for ( i = 0; i < i2cNumDevices; i++)
+  {
+    if ( i2cDevices[i].base == baseAddr && i2cDevices[i].addr == slaveAddr )
+    {
+      return i;
+    }
+  }
+  return -1;
+}
+
+//*****************************************************************************
+// Declares a slave device on an I2C peripheral and the fastest SCL rate it
+// supports.
+//*****************************************************************************
+i2c_status_t i2cRegisterDevice(
+  uint32_t baseAddr,
+  uint8_t slaveAddr,
+  uint32_t max_scl_hz
+)
+{
+  int8_t dev;
+  
+  if ( i2cBusIndex(baseAddr) < 0 )
+  {
+    return I2C_INVALID_BASE;
+  }
+  
+  dev = i2cFindDevice(baseAddr, slaveAddr);
+  if ( dev < 0 )
+  {
+    if ( i2cNumDevices >= I2C_MAX_DEVICES )
+    {
+      return I2C_INVALID_PARAM;
+    }
+    dev = i2cNumDevices++;
+    memset(&i2cDevices[dev], 0, sizeof(i2cDevices[dev]));
+    i2cDevices[dev].base = baseAddr;
+    i2cDevices[dev].addr = slaveAddr;
+  }
+  i2cDevices[dev].max_scl_hz = max_scl_hz;
+  
+  return i2cApplyBusSpeed(baseAddr);
+}
+
+//*****************************************************************************
+// Returns the transaction timing measured for a registered device.
+//*****************************************************************************
+i2c_status_t i2cGetDeviceStats(
+  uint32_t baseAddr,
+  uint8_t slaveAddr,
+  i2c_device_stats_t *stats
+)
+{
+  int8_t dev = i2cFindDevice(baseAddr, slaveAddr);
+  
+  if ( stats == NULL )
+  {
+    return I2C_NULL_PTR;
+  }
+  if ( dev < 0 )
+  {
+    return I2C_INVALID_PARAM;
+  }
+  
+  *stats = i2cDevices[dev].stats;
+  return I2C_OK;
+}
+
+//*****************************************************************************
+// Marks the start of a transaction, called before a START is issued
+//*****************************************************************************
+static void i2cTxnStart(uint32_t baseAddr, I2C0_Type *myI2C)
+{
+  i2c_bus_t *bus = &i2cBuses[i2cBusIndex(baseAddr)];
+  
+  bus->txnDevice = i2cFindDevice(baseAddr, myI2C->MSA >> 1);
+  bus->txnStart = cycle_counter_read();
+}
+
+//*****************************************************************************
+// Marks the end of a transaction, called once the STOP has been sent or 
+// the transaction failed
+//*****************************************************************************
+static void i2cTxnEnd(uint32_t baseAddr, bool error)
+{
+  i2c_bus_t *bus = &i2cBuses[i2cBusIndex(baseAddr)];
+  i2c_device_stats_t *stats;
+  uint32_t cycles;
+  
+  if ( bus->txnDevice < 0 )
+  {
+    return;
+  }
+  
+  cycles = cycle_counter_read() - bus->txnStart;
+  stats = &i2cDevices[bus->txnDevice].stats;
+  bus->txnDevice = -1;
+  
+  stats->transactions++;
+  if ( error )
+  {
+    stats->errors++;
+  }
+  stats->lastCycles = cycles;
+  stats->totalCycles += cycles;
+  if ( cycles > stats->maxCycles )
+  {
+    stats->maxCycles = cycles;
+  }
+}
+
+//*****************************************************************************
+// Drops the open transaction after the device did not ACK its address.  
+// The EEPROM ack polls expect these while a write cycle runs, so they are
+// counted apart from the transactions and errors.
+//*****************************************************************************
+static void i2cTxnNack(uint32_t baseAddr)
+{
+  i2c_bus_t *bus = &i2cBuses[i2cBusIndex(baseAddr)];
+  
+  if ( bus->txnDevice < 0 )
+  {
+    return;
+  }
+  
+  i2cDevices[bus->txnDevice].stats.nacks++;
+  bus->txnDevice = -1;
+}
+
+//*****************************************************************************
+// Initializes a given I2C peripheral as a master.  The SCL rate is picked
+// by i2cBusRate(), the slowest rate of the devices registered on the 
+// peripheral up to fast-mode plus, 100KHz if no device has been registered
+// yet.  The TPR value is derived from SystemCoreClock.
+//
+// Paramters:
+//    base_addr:  The base address of the I2C peripheral that is being
+//                configured
+//
+// Return Value:
+//    Returns I2C_OK if the base address is a valid I2C peripheral
+//    Returns I2C_INVALID_BASE if the base address is not a valid I2C address
+//*****************************************************************************
+i2c_status_t initializeI2CMaster(uint32_t base_addr)
+{
+  I2C0_Type *myI2C;
+  
+  myI2C = (I2C0_Type *) base_addr;
+  
+  // Validate that a correct base address has been passed
+    // Turn on the Clock Gating Register
+    switch (base_addr) 
+    {
+      case I2C0_BASE :
+          SYSCTL->RCGCI2C |= SYSCTL_RCGCI2C_R0;
+          while ((SYSCTL->PRI2C & SYSCTL_PRI2C_R0) == 0);    /* wait until SSI is ready */
+          break;
+      case I2C1_BASE :
+          SYSCTL->RCGCI2C |= SYSCTL_RCGCI2C_R1;
+          while ((SYSCTL->PRI2C & SYSCTL_PRI2C_R1) == 0);    /* wait until SSI is ready */
+          break;
+      case I2C2_BASE :
+          SYSCTL->RCGCI2C |= SYSCTL_RCGCI2C_R2;
+          while ((SYSCTL->PRI2C & SYSCTL_PRI2C_R2) == 0);    /* wait until SSI is ready */
+          break;
+      case I2C3_BASE :
+          SYSCTL->RCGCI2C |= SYSCTL_RCGCI2C_R3;
+          while ((SYSCTL->PRI2C & SYSCTL_PRI2C_R3) == 0);    /* wait until SSI is ready */
+          break;
+      default:
+          return I2C_INVALID_BASE;
+    }
+    
+    // Enable the I2C port as master
+    myI2C->MCR = I2C_MCR_MFE;
+    
+    // Transactions are timed with the DWT cycle counter
+    cycle_counter_init();
+    i2cBuses[i2cBusIndex(base_addr)].txnDevice = -1;
+    
+    // TPR = (System Clock/(2*(SCL_LP + SCL_HP)*SCL_CLK))-1;
+    return i2cApplyBusSpeed(base_addr);
+}
+
+//*****************************************************************************
+// verifies if the base addressed passed to a function is a valid I2C address
+//*****************************************************************************
+bool
+i2cVerifyBaseAddr(
+  uint32_t i2c_base
+)
+{
+    if( i2c_base == I2C0_BASE ||
+        i2c_base == I2C1_BASE ||
+        i2c_base == I2C2_BASE ||
+        i2c_base == I2C3_BASE
+    )
+  {
+    return true;
+  }
+  else
+  {
+    return false;
+  }
+}
+
+//*****************************************************************************
+// Sets the slave address that is currently being addressed.
+//
+// Paramters:
+//    baseAddr:  The base address of the I2C peripheral that is being
+//                configured
+//    slaveAddr: The address of the slave device being accessed.  This is a 
+//                7-bit slave address
+//    readWrite: If the the transaction will be a read or write operation.
+//               read = 0x01.  write = 0x00
+// Return Value:
+//    Returns I2C_OK if the base address is a valid I2C peripheral
+//    Returns I2C_INVALID_BASE if the base address is not a valid I2C address
+//*****************************************************************************
+i2c_status_t i2cSetSlaveAddr(
+  uint32_t baseAddr, 
+  uint8_t slaveAddr,
+  i2c_read_write_t readWrite
+)
+{
+  I2C0_Type *myI2C;
+  if( i2cVerifyBaseAddr(baseAddr) == false)
+  {
+    return I2C_INVALID_BASE;
+  }
+  
+  myI2C = (I2C0_Type *) baseAddr;
+  
+  // Set the slave address to transmit data
+   myI2C->MSA = (slaveAddr << 1) | readWrite;
+  //myI2C->MSA = slaveAddr | readWrite;
+  
+  return I2C_OK;
+}
+
+
+//*****************************************************************************
+// Initiates a stop condition.  This function is used when the master does
+// not receive an ACK.
+//
+// Paramters:
+//    baseAddr:  The base address of the I2C peripheral that is being
+//                configured
+// Return Value:
+//    Returns I2C_OK if the base address is a valid I2C peripheral
+//    Returns I2C_INVALID_BASE if the base address is not a valid I2C address
+//*****************************************************************************
+i2c_status_t i2cStop(
+  uint32_t baseAddr
+)
+{
+  I2C0_Type *myI2C;
+  if( i2cVerifyBaseAddr(baseAddr) == false)
+  {
+    return I2C_INVALID_BASE;
+  }
+  
+  myI2C = (I2C0_Type *) baseAddr;
+  
+  // Stop the interface
+  myI2C->MCS = I2C_MCS_STOP;
+  i2cTxnEnd(baseAddr, false);
+  
+  return I2C_OK;
+}
+
+//*****************************************************************************
+// Determines if the I2C device is busy transmitting data.  
+//
+// Paramters:
+//    baseAddr:  The base address of the I2C peripheral that is being accessed
+//
+// Returns
+//    Returns true if the I2C device is busy
+//    Returns false if the I2C device is NOT busy or i2c_base is invalid
+//*****************************************************************************
+bool
+I2CMasterBusy(uint32_t i2c_base)
+{
+  I2C0_Type *myI2C;
+  
+  if( i2cVerifyBaseAddr(i2c_base) == false)
+  {
+    return false;
+  }
+  
+    myI2C = (I2C0_Type *) i2c_base;
+    
+    if(myI2C->MCS & I2C_MCS_BUSY)
+    {
+        return(true);
+    }
+    else
+    {
+        return(false);
+    }
+}
+
+//*****************************************************************************
+// Determines if the address (control word) was ACKed.  
+//
+// Paramters:
+//    baseAddr:  The base address of the I2C peripheral that is being accessed
+//
+// Returns
+//    Returns true if the address was ACKed
+//    Returns false if the address was not ACKed or i2c_base is invalid
+//*****************************************************************************
+bool
+I2CMasterAdrAck(uint32_t i2c_base)
+{
+    I2C0_Type *myI2C;
+    uint32_t status;
+  if( i2cVerifyBaseAddr(i2c_base) == false)
+  {
+    return false;
+  }
+  
+  myI2C = (I2C0_Type *) i2c_base;
+  
+  status = myI2C->MCS;
+  if((status & I2C_MCS_ADRACK)!= 0)
+  {
+      return(false);
+  }
+  else
+  {
+      return(true);
+  }
+}
+
+
+//*****************************************************************************
+// Determines if the last byte of data transmitted was ACKed.  
+//
+// Paramters:
+//    baseAddr:  The base address of the I2C peripheral that is being accessed
+//
+// Returns
+//    Returns true if the data was ACKed
+//    Returns false if the data was not ACKed or i2c_base is invalid
+//*****************************************************************************
+bool
+I2CMasterDatAck(uint32_t i2c_base)
+{
+    I2C0_Type *myI2C;
+    uint32_t status;
+  if( i2cVerifyBaseAddr(i2c_base) == false)
+  {
+    return false;
+  }
+  
+  myI2C = (I2C0_Type *) i2c_base;
+  
+  status = myI2C->MCS;
+  if((status & I2C_MCS_DATACK)!= 0)
+  {
+      return(false);
+  }
+  else
+  {
+      return(true);
+  }
+}
+
+//*****************************************************************************
+// Sends one byte of data over a I2C bus.  
+//
+// Paramters:
+//    baseAddr:  The base address of the I2C peripheral that is being
+//                configured
+//    byte:      The next byte of the data transaction.
+//    mcs:       Sets master control register of the I2C peripheral. Since a
+//               data transaction can consist of multiple bytes, the value
+//               of mcs is used to determine when start and stop bits are 
+//               generated.
+//
+// Examples:
+//    * Sending control word (i2c address) + write 1st byte of data. This
+//    * assumes that additional bytes will follow in the transaction
+//    i2cSendByte(I2C0_BASE, byte, I2C_MCS_START | I2C_MCS_RUN);
+//
+//    * Sending a byte in the middle of a multi-byte operation. (> 2 bytes)
+//    i2cSendByte(I2C0_BASE, byte, I2C_MCS_RUN);
+//
+//    * Sending final byte  of data
+//    i2cSendByte(I2C0_BASE, byte, I2C_MCS_RUN | I2C_MCS_STOP);
+//
+//    * Sending control word (i2c address) + a single byte transaction.
+//    i2cSendByte(I2C0_BASE, byte, I2C_MCS_START | I2C_MCS_RUN | I2C_MCS_STOP);
+//
+// Return Value:
+//    Returns I2C_OK if the base address is a valid and the data was 
+//    transmitted sucessfully.
+//    Returns I2C_NO_ACK if the address or the data was not ACKed.  The 
+//    STOP has been sent.
+//    Returns I2C_ARBLST if another master won the bus.
+//    Returns I2C_BUS_ERROR for any other error.
+//*****************************************************************************
+i2c_status_t i2cSendByte(
+  uint32_t baseAddr, 
+  uint8_t byte, 
+  uint8_t mcs
+)
+{
+  I2C0_Type *myI2C;
+  uint32_t status;
+  
+  if( i2cVerifyBaseAddr(baseAddr) == false)
+  {
+    return I2C_INVALID_BASE;
+  }
+  myI2C = (I2C0_Type *) baseAddr;
+  
+   // Write the upper address to the data register
+  myI2C->MDR   = byte;
+  
+  if ( mcs & I2C_MCS_START )
+  {
+    i2cTxnStart(baseAddr, myI2C);
+    
+    // The master code is sent ahead of the address in high-speed mode
+    if ( i2cBuses[i2cBusIndex(baseAddr)].timing.high_speed )
+    {
+      mcs |= I2C_MCS_HS;
+    }
+  }
+  
+  // Start the transaction
+  myI2C->MCS = mcs;
+  
+  // Wait for the device to be free
+  while ( I2CMasterBusy(baseAddr)) {};
+  
+  // Check for error conditions.  A NACK sets ERROR as well, so the 
+  // ACK bits are tested before the generic error.  The master only sends
+  // the STOP itself when it was asked to.
+  status = myI2C->MCS;
+  if ( status & I2C_MCS_ARBLST )
+  {
+    i2cTxnEnd(baseAddr, true);
+    return I2C_ARBLST;
+  }
+  else if ( status & (I2C_MCS_ADRACK | I2C_MCS_DATACK) )
+  {
+    if ( (mcs & I2C_MCS_STOP) == 0 )
+    {
+      myI2C->MCS = I2C_MCS_STOP;
+    }
+    if ( status & I2C_MCS_ADRACK )
+    {
+      i2cTxnNack(baseAddr);
+    }
+    else
+    {
+      i2cTxnEnd(baseAddr, true);
+    }
+    return I2C_NO_ACK;
+  }
+  else if ( status & I2C_MCS_ERROR )
+  {
+    myI2C->MCS = I2C_MCS_STOP;
+    i2cTxnEnd(baseAddr, true);
+    return I2C_BUS_ERROR;
+  }
+  else
+  {
+    if ( mcs & I2C_MCS_STOP )
+    {
+      i2cTxnEnd(baseAddr, false);
+    }
+    return I2C_OK;
+  }
+}
+
+//*****************************************************************************
+// Reads one byte of data over a I2C bus.  
+//
+// Paramters:
+//    baseAddr:  The base address of the I2C peripheral that is being
+//                configured
+//    data:      The data read by the transaction.
+//    mcs:       Sets master control register of the I2C peripheral. Since a
+//               data transaction can consist of multiple bytes, the value
+//               of mcs is used to determine when start and stop bits are 
+//               generated.
+//
+// Examples:
+//    * Sending control word (i2c address) + read 1st byte of data. This
+//    * assumes that additional bytes be read after this byte.  This
+//    * would be used for reading multiple bytes at consecutive addresses
+//    * in the slave address.  
+//    i2cGetByte(I2C0_BASE, byte, I2C_MCS_START | I2C_MCS_RUN);
+//
+//    * Reading a byte in the middle of a multi-byte operation. (> 2 bytes)
+//    i2cGetByte(I2C0_BASE, byte, I2C_MCS_RUN);
+//
+//    * Reading final byte of data in a multi-byte read 
+//    i2cGetByte(I2C0_BASE, byte, I2C_MCS_RUN | I2C_MCS_STOP);
+//
+//    * Sending control word (i2c address) + reading a single byte read.
+//    i2cGetByte(I2C0_BASE, byte, I2C_MCS_START | I2C_MCS_RUN | I2C_MCS_STOP);
+//
+// Return Value:
+//    Returns I2C_OK if the base address is a valid and the data was 
+//    transmitted sucessfully.
+//    Returns I2C_NO_ACK if the address was not ACKed.  The STOP has been 
+//    sent.
+//*****************************************************************************
+i2c_status_t i2cGetByte(
+  uint32_t baseAddr, 
+  uint8_t *data, 
+  uint8_t mcs
+)
+{
+  I2C0_Type *myI2C;
+  uint32_t status;
+  
+  if( i2cVerifyBaseAddr(baseAddr) == false)
+  {
+    return I2C_INVALID_BASE;
+  }
+  
+ myI2C = (I2C0_Type *) baseAddr;
+  
+  if ( mcs & I2C_MCS_START )
+  {
+    i2cTxnStart(baseAddr, myI2C);
+    
+    // The master code is sent ahead of the address in high-speed mode
+    if ( i2cBuses[i2cBusIndex(baseAddr)].timing.high_speed )
+    {
+      mcs |= I2C_MCS_HS;
+    }
+  }
+  
+  // Start the transaction
+  myI2C->MCS = mcs;
+  
+  // Wait for the device to be free
+  while ( I2CMasterBusy(baseAddr)) {};
+  
+  // Check for error conditions, an address NACK first as it sets ERROR
+  status = myI2C->MCS;
+  if ( status & I2C_MCS_ADRACK )
+  {
+    if ( (mcs & I2C_MCS_STOP) == 0 )
+    {
+      myI2C->MCS = I2C_MCS_STOP;
+    }
+    i2cTxnNack(baseAddr);
+    return I2C_NO_ACK;
+  }
+  else if ( status & I2C_MCS_ERROR )
+  {
+    myI2C->MCS = I2C_MCS_STOP;
+    i2cTxnEnd(baseAddr, true);
+    return I2C_BUS_ERROR;
+  }
+  else
+  {
+    *data = myI2C->MDR;
+    if ( mcs & I2C_MCS_STOP )
+    {
+      i2cTxnEnd(baseAddr, false);
+    }
+    return I2C_OK;
+  }
+}
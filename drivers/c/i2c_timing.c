@@ -0,0 +1,66 @@
+#include "i2c_timing.h"
+#include <stddef.h>
+
+// SCL_LP + SCL_HP for the two timing modes of the master
+#define I2C_SCL_CYCLES      10
+#define I2C_SCL_CYCLES_HS   3
+
+//*****************************************************************************
+// Calculates the MTPR setting that gives the fastest SCL rate at or below
+// the requested rate.
+//*****************************************************************************
+bool i2cCalcTiming(
+  uint32_t sys_clk,
+  uint32_t scl_hz,
+  i2c_timing_t *timing
+)
+{
+  uint32_t cycles;
+  uint32_t divisor;
+  uint32_t tpr;
+  
+  if ( timing == NULL || scl_hz == 0 || scl_hz > I2C_SCL_HIGH_SPEED)
+  {
+    return false;
+  }
+  
+  cycles = (scl_hz > I2C_SCL_FAST_PLUS) ? I2C_SCL_CYCLES_HS : I2C_SCL_CYCLES;
+  
+  // Round the divisor up so the bus is never faster than requested
+  divisor = 2 * cycles * scl_hz;
+  tpr = (sys_clk + divisor - 1) / divisor;
+  if ( tpr == 0 || tpr - 1 > I2C_TPR_MAX)
+  {
+    return false;
+  }
+  tpr = tpr - 1;
+  
+  timing->tpr = tpr;
+  timing->high_speed = (cycles == I2C_SCL_CYCLES_HS);
+  timing->scl_hz = sys_clk / (2 * cycles * (tpr + 1));
+  
+  return true;
+}
+
+//*****************************************************************************
+// High-speed mode is only used when it is asked for, it needs every device
+// on the bus to answer the master code.
+//*****************************************************************************
+uint32_t i2cBusRate(
+  uint32_t scl_request,
+  uint32_t slowest_hz
+)
+{
+  uint32_t scl_hz = scl_request;
+  
+  if ( scl_hz == 0 )
+  {
+    scl_hz = (slowest_hz == 0) ? I2C_SCL_STANDARD : I2C_SCL_FAST_PLUS;
+  }
+  if ( slowest_hz != 0 && slowest_hz < scl_hz )
+  {
+    scl_hz = slowest_hz;
+  }
+  
+  return scl_hz;
+}
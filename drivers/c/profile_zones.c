@@ -0,0 +1,212 @@
+#include <string.h>
+#include "profile_zones.h"
+
+#ifdef PROFILE_ZONES_HOST
+#define PROFILE_ZONES_NOW()           profile_zones_host_clock()
+#define PROFILE_ZONES_CLZ(value)      __builtin_clz(value)
+#define PROFILE_ZONES_LOCK(key)       ((key) = 0)
+#define PROFILE_ZONES_UNLOCK(key)     ((void)(key))
+#else
+#include "TM4C123GH6PM.h"
+#include "cycle_counter.h"
+#define PROFILE_ZONES_NOW()           cycle_counter_read()
+#define PROFILE_ZONES_CLZ(value)      __CLZ(value)
+#define PROFILE_ZONES_LOCK(key)       do { (key) = __get_PRIMASK(); __disable_irq(); } while (0)
+#define PROFILE_ZONES_UNLOCK(key)     __set_PRIMASK(key)
+#endif
+
+static const char *const zoneNames[PROFILE_NUM_ZONES] = {
+#define PROFILE_ZONE_NAME(id, name)  name,
+  PROFILE_ZONE_LIST(PROFILE_ZONE_NAME)
+#undef PROFILE_ZONE_NAME
+};
+
+#if PROFILE_ZONES_ENABLED
+
+typedef struct {
+  profile_zone_t zone;
+  uint32_t start;
+  uint32_t nested;          // cycles of the zones that closed inside
+} profile_frame_t;
+
+static profile_frame_t zoneStack[PROFILE_ZONES_DEPTH];
+
+// Open zones, past PROFILE_ZONES_DEPTH they are counted but not timed
+static uint8_t zoneDepth;
+
+static profile_zone_stats_t zoneStats[PROFILE_NUM_ZONES];
+static uint32_t zoneErrors;
+
+//*****************************************************************************
+// Adds one time to the statistics of a zone
+//*****************************************************************************
+static void profile_zone_record(profile_zone_stats_t *stats, uint32_t cycles, uint32_t self)
+{
+  uint32_t bucket = 31 - PROFILE_ZONES_CLZ(cycles | 1);
+
+  if ( bucket >= PROFILE_ZONES_BUCKETS )
+  {
+    bucket = PROFILE_ZONES_BUCKETS - 1;
+  }
+
+  if ( stats->count == 0 || cycles < stats->min )
+  {
+    stats->min = cycles;
+  }
+  if ( cycles > stats->max )
+  {
+    stats->max = cycles;
+  }
+  stats->count++;
+  stats->total += cycles;
+  stats->self += self;
+  stats->histogram[bucket]++;
+}
+
+//*****************************************************************************
+// The start time is read last, so pushing the frame is not part of the zone
+//*****************************************************************************
+void profile_zone_begin(profile_zone_t zone)
+{
+  uint32_t primask;
+  profile_frame_t *frame;
+
+  PROFILE_ZONES_LOCK(primask);
+  if ( zoneDepth < PROFILE_ZONES_DEPTH )
+  {
+    frame = &zoneStack[zoneDepth];
+    frame->zone = zone;
+    frame->nested = 0;
+    frame->start = PROFILE_ZONES_NOW();
+  }
+  else
+  {
+    zoneErrors++;
+  }
+  if ( zoneDepth < UINT8_MAX )
+  {
+    zoneDepth++;
+  }
+  PROFILE_ZONES_UNLOCK(primask);
+}
+
+//*****************************************************************************
+// The time of the zone is charged to the one it was opened in as nested
+// time, which takes it off that zone's self time.
+//*****************************************************************************
+void profile_zone_end(profile_zone_t zone)
+{
+  uint32_t primask;
+  uint32_t now;
+  uint32_t cycles;
+  int i;
+
+  PROFILE_ZONES_LOCK(primask);
+  now = PROFILE_ZONES_NOW();
+
+  // the matching begin was too deep to time
+  if ( zoneDepth > PROFILE_ZONES_DEPTH )
+  {
+    zoneDepth--;
+    PROFILE_ZONES_UNLOCK(primask);
+    return;
+  }
+
+  for ( i = zoneDepth - 1; i >= 0 && zoneStack[i].zone != zone; i--) {};
+
+  if ( i < 0 )
+  {
+    zoneErrors++;
+    PROFILE_ZONES_UNLOCK(primask);
+    return;
+  }
+
+  // zones opened inside this one and never closed are thrown away
+  if ( i != zoneDepth - 1 )
+  {
+    zoneErrors++;
+  }
+
+  cycles = now - zoneStack[i].start;
+  profile_zone_record(&zoneStats[zone], cycles, cycles - zoneStack[i].nested);
+  zoneDepth = i;
+  if ( i > 0 )
+  {
+    zoneStack[i - 1].nested += cycles;
+  }
+  PROFILE_ZONES_UNLOCK(primask);
+}
+
+void profile_zones_init(void)
+{
+#ifndef PROFILE_ZONES_HOST
+  cycle_counter_init();
+#endif
+  profile_zones_reset();
+}
+
+void profile_zones_reset(void)
+{
+  uint32_t primask;
+
+  PROFILE_ZONES_LOCK(primask);
+  memset(zoneStats, 0, sizeof(zoneStats));
+  zoneErrors = 0;
+  PROFILE_ZONES_UNLOCK(primask);
+}
+
+//*****************************************************************************
+// Copied with interrupts masked so a handler's zone cannot tear the copy
+//*****************************************************************************
+bool profile_zones_get(profile_zone_t zone, profile_zone_stats_t *stats)
+{
+  uint32_t primask;
+
+  if ( zone >= PROFILE_NUM_ZONES || stats == NULL )
+  {
+    return false;
+  }
+
+  PROFILE_ZONES_LOCK(primask);
+  *stats = zoneStats[zone];
+  PROFILE_ZONES_UNLOCK(primask);
+  return true;
+}
+
+uint32_t profile_zones_errors(void)
+{
+  return zoneErrors;
+}
+
+#else
+
+void profile_zones_init(void)
+{
+}
+
+void profile_zones_reset(void)
+{
+}
+
+bool profile_zones_get(profile_zone_t zone, profile_zone_stats_t *stats)
+{
+  (void)zone;
+  (void)stats;
+  return false;
+}
+
+uint32_t profile_zones_errors(void)
+{
+  return 0;
+}
+
+#endif
+
+const char *profile_zones_name(profile_zone_t zone)
+{
+  if ( zone >= PROFILE_NUM_ZONES )
+  {
+    return "?";
+  }
+  return zoneNames[zone];
+}
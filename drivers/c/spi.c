@@ -1,178 +1,447 @@
-// Copyright (c) 2014, Joe Krachey
-// All rights reserved.
-//
-// Redistribution and use in binary form, with or without modification, 
-// are permitted provided that the following conditions are met:
-//
-// 1. Redistributions in binary form must reproduce the above copyright 
-//    notice, this list of conditions and the following disclaimer in 
-//    the documentation and/or other materials provided with the distribution.
-//
-// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" 
-// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
-// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR 
-// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR 
-// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, 
-// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, 
-// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; 
-// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
-// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING 
-// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, 
-// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
-
-#include "spi.h"
-
-/****************************************************************************
- * This routine transmits a character out the SPI1 port.
- ****************************************************************************/
-bool 
-spiVerifyBaseAddr(uint32_t base)
-{
-  if ( base == SSI0_BASE ||
-        base == SSI1_BASE ||
-        base == SSI2_BASE ||
-        base == SSI3_BASE
-  )
-  {
-    return true;
-  }
-  else
-  {
-    return false;
-  }
-}
-
-//*****************************************************************************
-// Configure the given SPI peripheral to be the given SPI mode
-//*****************************************************************************
-bool initialize_spi( uint32_t base_addr, uint8_t spi_mode, uint32_t cpsr)
-{
-    SSI0_Type *mySSI = (SSI0_Type *)base_addr;
-  
-    // Validate that a correct base address has been passed
-    // Turn on the Clock Gating Register
-    switch (base_addr) 
-    {
-      case SSI0_BASE :
-      {
-          SYSCTL->RCGCSSI |= SYSCTL_RCGCSSI_R0;
-          while ((SYSCTL->PRSSI & SYSCTL_PRSSI_R0) == 0){}    /* wait until SSI is ready */
-          break;
-      }
-      case SSI1_BASE :
-      {
-          SYSCTL->RCGCSSI |= SYSCTL_RCGCSSI_R1;
-          while ((SYSCTL->PRSSI & SYSCTL_PRSSI_R1) == 0){}    /* wait until SSI is ready */
-          break;
-      }
-      case SSI2_BASE :
-      {
-          SYSCTL->RCGCSSI |= SYSCTL_RCGCSSI_R2;
-          while ((SYSCTL->PRSSI & SYSCTL_PRSSI_R2) == 0){}    /* wait until SSI is ready */
-          break;
-      }
-      case SSI3_BASE :
-      {
-          SYSCTL->RCGCSSI |= SYSCTL_RCGCSSI_R3;
-          while ((SYSCTL->PRSSI & SYSCTL_PRSSI_R3) == 0){}    /* wait until SSI is ready */
-          break;
-      }
-      default:
-      {
-          return false;
-      }
-    }
-    
-    // ************* ADD CODE *********************** //
-    // Disable the SSI interface (Set entire register to 0).
-		mySSI->CR1 = 0;
-    
-    // ************* ADD CODE *********************** //
-    // Assume that we have a 50MHz clock
-    // FSSIClk = FSysClk / (CPSDVSR * (1 + SCR))
-    // Use the cpsr parameter passed into the function to set the CPSDVSR bits.  
-    // Set the SCR CR0 to 0.
-		mySSI->CPSR = cpsr;//(cpsr & 0xFF);
-		mySSI->CR0 &= ~SSI_CR0_SCR_M;
-
-    // ************* ADD CODE *********************** //
-    // Configure SPI control for freescale format, data width of 8 bits
-    mySSI -> CR0 &= ~(SSI_CR0_DSS_8 | SSI_CR0_DSS_M);
-		mySSI -> CR0 |=   SSI_CR0_FRF_MOTO | SSI_CR0_DSS_8;
-    //mySSI->CR0 = (SSI_CR0_FRF_MOTO | SSI_CR0_DSS_8);
-		
-    // ************* ADD CODE *********************** //
-    // Configure the SPI MODE in CR0
-    switch (spi_mode)
-    {
-      case 0:
-      {
-        mySSI->CR0 |=  (0x0 << 6);
-        break;
-      }
-      case 1:
-      {
-        mySSI->CR0 |=  (0x2 << 6);
-        break;
-      }
-      case 2:
-      {
-        mySSI->CR0 |=  (0x1 << 6);
-        break;
-      }
-      case 3:
-      {
-        mySSI->CR0 |=  (0x3 << 6);
-        break;
-      }
-    }
-    
-    // ************* ADD CODE *********************** //
-    //Enable SSI peripheral in master mode
-    // 0 is master
-		mySSI->CR1 &= ~SSI_CR1_MS;
-
-  return true;
-}
-
-
-//*****************************************************************************
-// Transmits the array of bytes found at tx_data to the specified SPI peripheral
-// The number of bytes transmitted is determined by num_bytes.
-//
-// The data received by the SPI ternimal is placed in an array of bytes 
-// starting at the address found at rx_data
-//*****************************************************************************
-void spiTx(uint32_t base, uint8_t *tx_data, int num_bytes, uint8_t *rx_data)
-{
-  uint8_t count = 0;
-  SSI0_Type *mySSI = (SSI0_Type *) base;
-  
-  // Wait until the transmit is finished
-  while((mySSI->SR & SSI_SR_TFE)!= 1){};
-
-  // Disable the SSI interface
-  mySSI->CR1 &= ~SSI_CR1_SSE;
-    
-  // Fill the Transmit FIFO  
-  while((mySSI->SR & SSI_SR_TNF)!= 0 && (count < num_bytes) )
-  {
-    // Send out the first byte
-    mySSI->DR = *tx_data; 
-    tx_data++;
-    count++;
-  }
-                  
-  //Enable SSI
-  mySSI->CR1 |= SSI_CR1_SSE;
-  
-  for( count = 0; count < num_bytes; count++)
-  {
-    // Wait until the recieve has finished  
-    while((mySSI->SR & SSI_SR_RNE)==0){};// wait until response
-
-    // Store the results  
-    *rx_data =  mySSI->DR;
-    rx_data++;
-  }
-}
+// Copyright (c) 2014, Joe Krachey
+// All rights reserved.
+//
+// Redistribution and use in binary form, with or without modification, 
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions in binary form must reproduce the above copyright 
+//    notice, this list of conditions and the following disclaimer in 
+//    the documentation and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" 
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR 
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR 
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, 
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, 
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; 
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING 
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, 
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "spi.h"
+
+#ifdef SPI_HOST
+#define SPI_SR(base)              spi_host_sr(base)
+#define SPI_DR_READ(base)         spi_host_dr_read(base)
+#define SPI_DR_WRITE(base, data)  spi_host_dr_write(base, data)
+#else
+#include "udma.h"
+#include "cycle_counter.h"
+#define SPI_SR(base)              (((SSI0_Type *)(base))->SR)
+#define SPI_DR_READ(base)         (((SSI0_Type *)(base))->DR)
+#define SPI_DR_WRITE(base, data)  (((SSI0_Type *)(base))->DR = (data))
+#endif
+
+// On the PC (SPI_HOST) only spiTx() is built, against the SSI model of
+// tools/spi_fifo_check.c
+#ifndef SPI_HOST
+
+//*****************************************************************************
+// uDMA channels of each SSI peripheral
+//*****************************************************************************
+typedef struct {
+  uint32_t base;
+  IRQn_Type irq;
+  uint8_t rxChannel;
+  uint8_t txChannel;
+  uint8_t encoding;
+} spi_dma_port_t;
+
+static const spi_dma_port_t spiDmaPorts[] = {
+  { SSI0_BASE, SSI0_IRQn, 10, 11, 0 },
+  { SSI1_BASE, SSI1_IRQn, 24, 25, 0 },
+  { SSI2_BASE, SSI2_IRQn, 12, 13, 2 },
+  { SSI3_BASE, SSI3_IRQn, 14, 15, 2 },
+};
+
+#define SPI_NUM_PORTS   (sizeof(spiDmaPorts) / sizeof(spiDmaPorts[0]))
+
+//*****************************************************************************
+// State of the asynchronous transfer on each SSI peripheral
+//*****************************************************************************
+typedef struct {
+  volatile bool busy;
+  uint8_t *txData;
+  uint8_t *rxData;
+  uint32_t remaining;
+  uint32_t blockBytes;
+  spi_callback_t callback;
+  void *context;
+} spi_async_t;
+
+static spi_async_t spiAsync[SPI_NUM_PORTS];
+
+// Source of the zeros clocked out, and sink of the bytes thrown away, when
+// the caller passes NULL
+static uint8_t spiDmaZero = 0;
+static uint8_t spiDmaDiscard;
+
+/****************************************************************************
+ * This routine transmits a character out the SPI1 port.
+ ****************************************************************************/
+bool 
+spiVerifyBaseAddr(uint32_t base)
+{
+  if ( base == SSI0_BASE ||
+        base == SSI1_BASE ||
+        base == SSI2_BASE ||
+        base == SSI3_BASE
+  )
+  {
+    return true;
+  }
+  else
+  {
+    return false;
+  }
+}
+
+//*****************************************************************************
+// Configure the given SPI peripheral to be the given SPI mode
+//*****************************************************************************
+bool initialize_spi( uint32_t base_addr, uint8_t spi_mode, uint32_t cpsr)
+{
+    SSI0_Type *mySSI = (SSI0_Type *)base_addr;
+  
+    // Validate that a correct base address has been passed
+    // Turn on the Clock Gating Register
+    switch (base_addr) 
+    {
+      case SSI0_BASE :
+      {
+          SYSCTL->RCGCSSI |= SYSCTL_RCGCSSI_R0;
+          while ((SYSCTL->PRSSI & SYSCTL_PRSSI_R0) == 0){}    /* wait until SSI is ready */
+          break;
+      }
+      case SSI1_BASE :
+      {
+          SYSCTL->RCGCSSI |= SYSCTL_RCGCSSI_R1;
+          while ((SYSCTL->PRSSI & SYSCTL_PRSSI_R1) == 0){}    /* wait until SSI is ready */
+          break;
+      }
+      case SSI2_BASE :
+      {
+          SYSCTL->RCGCSSI |= SYSCTL_RCGCSSI_R2;
+          while ((SYSCTL->PRSSI & SYSCTL_PRSSI_R2) == 0){}    /* wait until SSI is ready */
+          break;
+      }
+      case SSI3_BASE :
+      {
+          SYSCTL->RCGCSSI |= SYSCTL_RCGCSSI_R3;
+          while ((SYSCTL->PRSSI & SYSCTL_PRSSI_R3) == 0){}    /* wait until SSI is ready */
+          break;
+      }
+      default:
+      {
+          return false;
+      }
+    }
+    
+    // ************* ADD CODE *********************** //
+    // Disable the SSI interface (Set entire register to 0).
+		mySSI->CR1 = 0;
+    
+    // ************* ADD CODE *********************** //
+    // Assume that we have a 50MHz clock
+    // FSSIClk = FSysClk / (CPSDVSR * (1 + SCR))
+    // Use the cpsr parameter passed into the function to set the CPSDVSR bits.  
+    // Set the SCR CR0 to 0.
+		mySSI->CPSR = cpsr;//(cpsr & 0xFF);
+		mySSI->CR0 &= ~SSI_CR0_SCR_M;
+
+    // ************* ADD CODE *********************** //
+    // Configure SPI control for freescale format, data width of 8 bits
+    mySSI -> CR0 &= ~(SSI_CR0_DSS_8 | SSI_CR0_DSS_M);
+		mySSI -> CR0 |=   SSI_CR0_FRF_MOTO | SSI_CR0_DSS_8;
+    //mySSI->CR0 = (SSI_CR0_FRF_MOTO | SSI_CR0_DSS_8);
+		
+    // ************* ADD CODE *********************** //
+    // Configure the SPI MODE in CR0.  The old mode is cleared first, SSI0 
+    // is switched between devices that use different modes.
+    mySSI->CR0 &= ~(SSI_CR0_SPO | SSI_CR0_SPH);
+    switch (spi_mode)
+    {
+      case 0:
+      {
+        mySSI->CR0 |=  (0x0 << 6);
+        break;
+      }
+      case 1:
+      {
+        mySSI->CR0 |=  (0x2 << 6);
+        break;
+      }
+      case 2:
+      {
+        mySSI->CR0 |=  (0x1 << 6);
+        break;
+      }
+      case 3:
+      {
+        mySSI->CR0 |=  (0x3 << 6);
+        break;
+      }
+    }
+    
+    // ************* ADD CODE *********************** //
+    //Enable SSI peripheral in master mode
+    // 0 is master
+		mySSI->CR1 &= ~SSI_CR1_MS;
+    
+    // The SSI stays enabled from here on.  spiTx() streams bytes through the
+    // FIFOs instead of toggling SSE for every transfer.
+    mySSI->CR1 |= SSI_CR1_SSE;
+
+  return true;
+}
+#endif
+
+
+//*****************************************************************************
+// Transmits the array of bytes found at tx_data to the specified SPI peripheral
+// The number of bytes transmitted is determined by num_bytes.
+//
+// The data received by the SPI ternimal is placed in an array of bytes 
+// starting at the address found at rx_data.  rx_data may be NULL if the 
+// received bytes are not needed.
+//
+// Any number of bytes can be sent.  The transmit FIFO is kept fed while 
+// received bytes are drained, and no more than SPI_FIFO_DEPTH bytes are in
+// flight so the receive FIFO can never overflow.
+//*****************************************************************************
+void spiTx(uint32_t base, uint8_t *tx_data, uint32_t num_bytes, uint8_t *rx_data)
+{
+  uint32_t tx_count = 0;
+  uint32_t rx_count = 0;
+  
+  // Throw away anything left in the receive FIFO
+  while((SPI_SR(base) & SSI_SR_RNE)!= 0)
+  {
+    (void)SPI_DR_READ(base);
+  }
+  
+  while( rx_count < num_bytes)
+  {
+    // Fill the Transmit FIFO
+    if( tx_count < num_bytes && 
+        (tx_count - rx_count) < SPI_FIFO_DEPTH && 
+        (SPI_SR(base) & SSI_SR_TNF)!= 0 
+    )
+    {
+      SPI_DR_WRITE(base, tx_data[tx_count]);
+      tx_count++;
+    }
+    
+    // Store the results  
+    if((SPI_SR(base) & SSI_SR_RNE)!= 0)
+    {
+      if( rx_data != NULL)
+      {
+        rx_data[rx_count] = SPI_DR_READ(base);
+      }
+      else
+      {
+        (void)SPI_DR_READ(base);
+      }
+      rx_count++;
+    }
+  }
+}
+
+#ifndef SPI_HOST
+
+//*****************************************************************************
+// Returns the index of an SSI peripheral in spiDmaPorts, or SPI_NUM_PORTS
+//*****************************************************************************
+static uint32_t spiPortIndex(uint32_t base)
+{
+  uint32_t i;
+  
+  for ( i = 0; i < SPI_NUM_PORTS; i++)
+  {
+    if ( spiDmaPorts[i].base == base)
+    {
+      break;
+    }
+  }
+  return i;
+}
+
+//*****************************************************************************
+// Programs both channels for the next block of a transfer and starts them.
+// The receive channel has the higher priority so the RX FIFO cannot overrun.
+//*****************************************************************************
+static void spiDmaStartBlock(uint32_t index)
+{
+  const spi_dma_port_t *port = &spiDmaPorts[index];
+  spi_async_t *xfer = &spiAsync[index];
+  SSI0_Type *mySSI = (SSI0_Type *) port->base;
+  uint32_t rxInc = UDMA_CHCTL_DSTINC_8;
+  uint32_t txInc = UDMA_CHCTL_SRCINC_8;
+  uint8_t *rx = xfer->rxData;
+  uint8_t *tx = xfer->txData;
+  uint8_t data;
+  
+  xfer->blockBytes = xfer->remaining;
+  if ( xfer->blockBytes > UDMA_MAX_TRANSFER)
+  {
+    xfer->blockBytes = UDMA_MAX_TRANSFER;
+  }
+  
+  if ( rx == NULL)
+  {
+    rx = &spiDmaDiscard;
+    rxInc = UDMA_CHCTL_DSTINC_NONE;
+  }
+  if ( tx == NULL)
+  {
+    tx = &spiDmaZero;
+    txInc = UDMA_CHCTL_SRCINC_NONE;
+  }
+  
+  // Throw away anything left in the receive FIFO
+  while((mySSI->SR & SSI_SR_RNE)!= 0)
+  {
+    data = mySSI->DR;
+  }
+  (void)data;
+  
+  udma_setup(port->rxChannel, false, &mySSI->DR, rx, xfer->blockBytes,
+             rxInc | UDMA_CHCTL_DSTSIZE_8 | UDMA_CHCTL_SRCINC_NONE | UDMA_CHCTL_SRCSIZE_8 | 
+             UDMA_CHCTL_ARBSIZE_4 | UDMA_CHCTL_XFERMODE_BASIC);
+  udma_setup(port->txChannel, false, tx, &mySSI->DR, xfer->blockBytes,
+             UDMA_CHCTL_DSTINC_NONE | UDMA_CHCTL_DSTSIZE_8 | txInc | UDMA_CHCTL_SRCSIZE_8 | 
+             UDMA_CHCTL_ARBSIZE_4 | UDMA_CHCTL_XFERMODE_BASIC);
+  
+  udma_enable(port->rxChannel, true);
+  udma_enable(port->txChannel, false);
+  mySSI->DMACTL = SSI_DMACTL_TXDMAE | SSI_DMACTL_RXDMAE;
+}
+
+//*****************************************************************************
+// Starts an asynchronous transfer
+//*****************************************************************************
+bool spiTxAsync(
+  uint32_t base, 
+  uint8_t *tx_data, 
+  uint32_t num_bytes, 
+  uint8_t *rx_data, 
+  spi_callback_t callback, 
+  void *context
+)
+{
+  uint32_t index = spiPortIndex(base);
+  spi_async_t *xfer;
+  
+  if ( index >= SPI_NUM_PORTS || spiAsync[index].busy)
+  {
+    return false;
+  }
+  
+  if ( num_bytes < SPI_DMA_MIN_BYTES)
+  {
+    spiTx(base, tx_data, num_bytes, rx_data);
+    if ( callback != NULL)
+    {
+      callback(context);
+    }
+    return true;
+  }
+  
+  udma_init();
+  udma_channel_assign(spiDmaPorts[index].rxChannel, spiDmaPorts[index].encoding);
+  udma_channel_assign(spiDmaPorts[index].txChannel, spiDmaPorts[index].encoding);
+  NVIC_SetPriority(spiDmaPorts[index].irq, SPI_IRQ_PRIORITY);
+  NVIC_EnableIRQ(spiDmaPorts[index].irq);
+  
+  xfer = &spiAsync[index];
+  xfer->busy = true;
+  xfer->txData = tx_data;
+  xfer->rxData = rx_data;
+  xfer->remaining = num_bytes;
+  xfer->callback = callback;
+  xfer->context = context;
+  
+  spiDmaStartBlock(index);
+  return true;
+}
+
+//*****************************************************************************
+// Returns true while an asynchronous transfer is running
+//*****************************************************************************
+bool spiBusy(uint32_t base)
+{
+  uint32_t index = spiPortIndex(base);
+  
+  return index < SPI_NUM_PORTS && spiAsync[index].busy;
+}
+
+//*****************************************************************************
+// Handles the uDMA completion interrupt of one SSI peripheral.  The transmit
+// channel finishes first and is ignored, the transfer is done once the 
+// receive channel has stored the last byte.
+//*****************************************************************************
+static void spiDmaService(uint32_t index)
+{
+  const spi_dma_port_t *port = &spiDmaPorts[index];
+  spi_async_t *xfer = &spiAsync[index];
+  
+  udma_done(port->txChannel);
+  if ( !udma_done(port->rxChannel))
+  {
+    return;
+  }
+  
+  xfer->remaining -= xfer->blockBytes;
+  if ( xfer->txData != NULL)
+  {
+    xfer->txData += xfer->blockBytes;
+  }
+  if ( xfer->rxData != NULL)
+  {
+    xfer->rxData += xfer->blockBytes;
+  }
+  
+  if ( xfer->remaining > 0)
+  {
+    spiDmaStartBlock(index);
+    return;
+  }
+  
+  ((SSI0_Type *) port->base)->DMACTL = 0;
+  xfer->busy = false;
+  if ( xfer->callback != NULL)
+  {
+    xfer->callback(xfer->context);
+  }
+}
+
+void SSI0_Handler(void) { spiDmaService(0); }
+void SSI1_Handler(void) { spiDmaService(1); }
+void SSI2_Handler(void) { spiDmaService(2); }
+void SSI3_Handler(void) { spiDmaService(3); }
+
+//*****************************************************************************
+// Throughput of the polled and uDMA transfer paths
+//*****************************************************************************
+void spiBenchmark(uint32_t base, uint8_t *buffer, uint32_t num_bytes, spi_benchmark_t *result)
+{
+  uint32_t start;
+  
+  cycle_counter_init();
+  result->bytes = num_bytes;
+  
+  start = cycle_counter_read();
+  spiTx(base, buffer, num_bytes, NULL);
+  result->polledCycles = cycle_counter_read() - start;
+  
+  start = cycle_counter_read();
+  if ( spiTxAsync(base, buffer, num_bytes, NULL, NULL, NULL))
+  {
+    while ( spiBusy(base)) {}
+  }
+  result->dmaCycles = cycle_counter_read() - start;
+}
+#endif
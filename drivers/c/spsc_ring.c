@@ -0,0 +1,169 @@
+#include "spsc_ring.h"
+
+// Every access to the storage is ordered against the counter that publishes
+// it.  The producer fills bytes before moving head, the consumer reads bytes
+// before moving tail.
+
+//*****************************************************************************
+// Number of bytes waiting to be removed
+//*****************************************************************************
+uint32_t spsc_ring_count(const spsc_ring_t *ring)
+{
+  return ring->head - ring->tail;
+}
+
+//*****************************************************************************
+// Room left to add bytes
+//*****************************************************************************
+uint32_t spsc_ring_space(const spsc_ring_t *ring)
+{
+  return (ring->mask + 1) - (ring->head - ring->tail);
+}
+
+//*****************************************************************************
+// Adds one byte
+//*****************************************************************************
+bool spsc_ring_push(spsc_ring_t *ring, uint8_t data)
+{
+  uint32_t head = ring->head;
+  
+  if ( (head - ring->tail) > ring->mask)
+  {
+    return false;
+  }
+  
+  ring->data[head & ring->mask] = data;
+  __DMB();
+  ring->head = head + 1;
+  return true;
+}
+
+//*****************************************************************************
+// Removes one byte
+//*****************************************************************************
+bool spsc_ring_pop(spsc_ring_t *ring, uint8_t *data)
+{
+  uint32_t tail = ring->tail;
+  
+  if ( tail == ring->head)
+  {
+    return false;
+  }
+  
+  __DMB();
+  *data = ring->data[tail & ring->mask];
+  __DMB();
+  ring->tail = tail + 1;
+  return true;
+}
+
+//*****************************************************************************
+// Largest contiguous block of free space
+//*****************************************************************************
+uint32_t spsc_ring_write_span(spsc_ring_t *ring, uint8_t **span)
+{
+  uint32_t head = ring->head;
+  uint32_t offset = head & ring->mask;
+  uint32_t space = (ring->mask + 1) - (head - ring->tail);
+  uint32_t toEnd = (ring->mask + 1) - offset;
+  
+  *span = &ring->data[offset];
+  return (space < toEnd) ? space : toEnd;
+}
+
+//*****************************************************************************
+// Publishes bytes filled in through a write span
+//*****************************************************************************
+void spsc_ring_commit(spsc_ring_t *ring, uint32_t num_bytes)
+{
+  __DMB();
+  ring->head += num_bytes;
+}
+
+//*****************************************************************************
+// Largest contiguous block of waiting bytes
+//*****************************************************************************
+uint32_t spsc_ring_read_span(spsc_ring_t *ring, uint8_t **span)
+{
+  uint32_t tail = ring->tail;
+  uint32_t offset = tail & ring->mask;
+  uint32_t count = ring->head - tail;
+  uint32_t toEnd = (ring->mask + 1) - offset;
+  
+  __DMB();
+  *span = &ring->data[offset];
+  return (count < toEnd) ? count : toEnd;
+}
+
+//*****************************************************************************
+// Frees bytes used through a read span
+//*****************************************************************************
+void spsc_ring_release(spsc_ring_t *ring, uint32_t num_bytes)
+{
+  __DMB();
+  ring->tail += num_bytes;
+}
+
+//*****************************************************************************
+// Adds as many bytes as fit, in at most two copies
+//*****************************************************************************
+uint32_t spsc_ring_write(spsc_ring_t *ring, const uint8_t *data, uint32_t num_bytes)
+{
+  uint8_t *span;
+  uint32_t length;
+  uint32_t total = 0;
+  uint32_t i;
+  
+  while ( total < num_bytes)
+  {
+    length = spsc_ring_write_span(ring, &span);
+    if ( length == 0)
+    {
+      break;
+    }
+    if ( length > num_bytes - total)
+    {
+      length = num_bytes - total;
+    }
+    for ( i = 0; i < length; i++)
+    {
+      span[i] = data[total + i];
+    }
+    spsc_ring_commit(ring, length);
+    total += length;
+  }
+  
+  return total;
+}
+
+//*****************************************************************************
+// Removes up to num_bytes, in at most two copies
+//*****************************************************************************
+uint32_t spsc_ring_read(spsc_ring_t *ring, uint8_t *data, uint32_t num_bytes)
+{
+  uint8_t *span;
+  uint32_t length;
+  uint32_t total = 0;
+  uint32_t i;
+  
+  while ( total < num_bytes)
+  {
+    length = spsc_ring_read_span(ring, &span);
+    if ( length == 0)
+    {
+      break;
+    }
+    if ( length > num_bytes - total)
+    {
+      length = num_bytes - total;
+    }
+    for ( i = 0; i < length; i++)
+    {
+      data[total + i] = span[i];
+    }
+    spsc_ring_release(ring, length);
+    total += length;
+  }
+  
+  return total;
+}
@@ -0,0 +1,91 @@
+#include "timebase.h"
+
+// Set from SystemCoreClock when the timebase starts
+static uint32_t cyclesPerUs;
+static uint32_t cyclesPerMs;
+
+//*****************************************************************************
+// Configures WTIMER0 as a 64-bit periodic timer counting up to its maximum.
+// In 64-bit mode Timer A holds the lower half and Timer B the upper one.
+//*****************************************************************************
+void timebase_init(void)
+{
+  cyclesPerUs = SystemCoreClock / 1000000;
+  cyclesPerMs = SystemCoreClock / 1000;
+
+  if ( (SYSCTL->RCGCWTIMER & SYSCTL_RCGCWTIMER_R0) != 0 )
+  {
+    return;
+  }
+
+  SYSCTL->RCGCWTIMER |= SYSCTL_RCGCWTIMER_R0;
+  while( (SYSCTL->PRWTIMER & SYSCTL_PRWTIMER_R0) == 0) {};
+
+  TIMEBASE_TIMER->CTL &= ~(TIMER_CTL_TAEN | TIMER_CTL_TBEN);
+  TIMEBASE_TIMER->CFG = TIMER_CFG_32_BIT_TIMER;   // 64-bit on a wide timer
+  TIMEBASE_TIMER->TAMR = TIMER_TAMR_TAMR_PERIOD | TIMER_TAMR_TACDIR;
+  TIMEBASE_TIMER->TAILR = 0xFFFFFFFF;
+  TIMEBASE_TIMER->TBILR = 0xFFFFFFFF;
+  TIMEBASE_TIMER->IMR = 0;
+  TIMEBASE_TIMER->TAV = 0;
+  TIMEBASE_TIMER->TBV = 0;
+  TIMEBASE_TIMER->CTL |= TIMER_CTL_TAEN;
+}
+
+//*****************************************************************************
+// Reads both halves.  If the upper half changed while the lower one was
+// read, the lower one wrapped in between and the read is repeated.
+//*****************************************************************************
+uint64_t timebase_now(void)
+{
+  uint32_t high;
+  uint32_t low;
+
+  do
+  {
+    high = TIMEBASE_TIMER->TBV;
+    low = TIMEBASE_TIMER->TAV;
+  } while ( high != TIMEBASE_TIMER->TBV);
+
+  return ((uint64_t)high << 32) | low;
+}
+
+//*****************************************************************************
+// The stamp is the lower half of a time at most 2^32 cycles before now
+//*****************************************************************************
+uint64_t timebase_extend(uint32_t cycles)
+{
+  uint64_t now = timebase_now();
+
+  return now - (uint32_t)((uint32_t)now - cycles);
+}
+
+uint64_t timebase_to_us(uint64_t cycles)
+{
+  return cycles / cyclesPerUs;
+}
+
+uint64_t timebase_to_ms(uint64_t cycles)
+{
+  return cycles / cyclesPerMs;
+}
+
+uint64_t timebase_from_us(uint64_t us)
+{
+  return us * cyclesPerUs;
+}
+
+uint32_t timebase_cycles_to_us(uint32_t cycles)
+{
+  return cycles / cyclesPerUs;
+}
+
+uint64_t timebase_now_us(void)
+{
+  return timebase_to_us(timebase_now());
+}
+
+uint32_t timebase_now_ms(void)
+{
+  return (uint32_t)timebase_to_ms(timebase_now());
+}
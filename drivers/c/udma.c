@@ -0,0 +1,121 @@
+#include "udma.h"
+
+// Primary structures for all 32 channels followed by the alternates.  The 
+// controller requires the table to be aligned on 1024 bytes.
+static udma_control_t udmaTable[UDMA_NUM_CHANNELS * 2] __attribute__((aligned(1024)));
+
+//*****************************************************************************
+// Turns on the uDMA controller
+//*****************************************************************************
+void udma_init(void)
+{
+  if ( (SYSCTL->RCGCDMA & SYSCTL_RCGCDMA_R0) != 0 )
+  {
+    return;
+  }
+  
+  SYSCTL->RCGCDMA |= SYSCTL_RCGCDMA_R0;
+  while ((SYSCTL->PRDMA & SYSCTL_PRDMA_R0) == 0){}
+  
+  UDMA->CFG = UDMA_CFG_MASTEN;
+  UDMA->CTLBASE = (uint32_t)udmaTable;
+}
+
+//*****************************************************************************
+// Selects which peripheral drives a channel, four bits per channel spread
+// over CHMAP0-CHMAP3
+//*****************************************************************************
+void udma_channel_assign(uint8_t channel, uint8_t encoding)
+{
+  volatile uint32_t *chmap = &UDMA->CHMAP0 + (channel / 8);
+  uint32_t shift = (channel % 8) * 4;
+  
+  *chmap = (*chmap & ~(0xFu << shift)) | ((uint32_t)(encoding & 0xF) << shift);
+}
+
+//*****************************************************************************
+// Returns the offset of the last item for an increment setting
+//*****************************************************************************
+static uint32_t udma_end_offset(uint32_t inc, uint16_t count)
+{
+  switch (inc)
+  {
+    case 0:   return (count - 1);
+    case 1:   return (count - 1) * 2;
+    case 2:   return (count - 1) * 4;
+    default:  return 0;   // address does not increment
+  }
+}
+
+//*****************************************************************************
+// Fills in a channel control structure
+//*****************************************************************************
+bool udma_setup(
+  uint8_t channel, 
+  bool alternate, 
+  const volatile void *src, 
+  volatile void *dst, 
+  uint16_t count, 
+  uint32_t control
+)
+{
+  udma_control_t *entry;
+  
+  if ( channel >= UDMA_NUM_CHANNELS || count == 0 || count > UDMA_MAX_TRANSFER)
+  {
+    return false;
+  }
+  
+  entry = &udmaTable[channel + (alternate ? UDMA_NUM_CHANNELS : 0)];
+  
+  entry->srcEnd = (uint8_t *)src + udma_end_offset((control & UDMA_CHCTL_SRCINC_M) >> 26, count);
+  entry->dstEnd = (uint8_t *)dst + udma_end_offset((control & UDMA_CHCTL_DSTINC_M) >> 30, count);
+  entry->control = (control & ~UDMA_CHCTL_XFERSIZE_M) | 
+                   ((uint32_t)(count - 1) << UDMA_CHCTL_XFERSIZE_S);
+  
+  return true;
+}
+
+//*****************************************************************************
+// Starts a channel on its primary control structure
+//*****************************************************************************
+void udma_enable(uint8_t channel, bool high_priority)
+{
+  uint32_t mask = 1u << channel;
+  
+  UDMA->ALTCLR = mask;
+  UDMA->USEBURSTCLR = mask;
+  UDMA->REQMASKCLR = mask;
+  if ( high_priority )
+  {
+    UDMA->PRIOSET = mask;
+  }
+  else
+  {
+    UDMA->PRIOCLR = mask;
+  }
+  UDMA->ENASET = mask;
+}
+
+//*****************************************************************************
+// Returns true while a channel is enabled
+//*****************************************************************************
+bool udma_is_enabled(uint8_t channel)
+{
+  return (UDMA->ENASET & (1u << channel)) != 0;
+}
+
+//*****************************************************************************
+// Reads and clears the completion flag of a channel
+//*****************************************************************************
+bool udma_done(uint8_t channel)
+{
+  uint32_t mask = 1u << channel;
+  
+  if ( (UDMA->CHIS & mask) == 0 )
+  {
+    return false;
+  }
+  UDMA->CHIS = mask;
+  return true;
+}
@@ -1,57 +1,112 @@
-// Copyright (c) 2014, Joe Krachey
-// All rights reserved.
-//
-// Redistribution and use in binary form, with or without modification, 
-// are permitted provided that the following conditions are met:
-//
-// 1. Redistributions in binary form must reproduce the above copyright 
-//    notice, this list of conditions and the following disclaimer in 
-//    the documentation and/or other materials provided with the distribution.
-//
-// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" 
-// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
-// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR 
-// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR 
-// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, 
-// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, 
-// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; 
-// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
-// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING 
-// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, 
-// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
-
-#ifndef __ADC_H__
-#define __ADC_H__
-
-#include <stdint.h>
-#include <stdbool.h>
-#include "TM4C123GH6PM.h"
-#include "driver_defines.h"
-
-
-/******************************************************************************
- * Initializes ADC to use Sample Sequencer #3, triggered by software, no IRQs
- *
- * Parameters:
- *  adc_base - The user must pass ADC0_BASE or ADC1_BASE.
- *
- * Returns:
- *  true  - if an valid base address was passed in
- *  false - if an invalid base address was passed in
- *****************************************************************************/
-bool initialize_adc(  uint32_t adc_base );
-
-
-/******************************************************************************
- * Returns the analog reading for a given AIN channel.
- *
- * Parameters:
- *  adc_base - The user must pass ADC0_BASE or ADC1_BASE.
- *  channel  - Which channel to convert
- *
- * Returns:
- *   analog reading
- *****************************************************************************/
-uint32_t get_adc_value( uint32_t adc_base, uint8_t channel);
-
-#endif
+// Copyright (c) 2014, Joe Krachey
+// All rights reserved.
+//
+// Redistribution and use in binary form, with or without modification, 
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions in binary form must reproduce the above copyright 
+//    notice, this list of conditions and the following disclaimer in 
+//    the documentation and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" 
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR 
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR 
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, 
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, 
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; 
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING 
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, 
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef __ADC_H__
+#define __ADC_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "TM4C123GH6PM.h"
+#include "driver_defines.h"
+#include "timers.h"
+
+// Sample Sequencer #2 has a four step FIFO
+#define ADC_SERVICE_MAX_CHANNELS    4
+
+// Priority of the Sample Sequencer #2 interrupt
+#define ADC_SERVICE_IRQ_PRIORITY    3
+
+//*****************************************************************************
+// One conversion of every channel of the ADC service
+//*****************************************************************************
+typedef struct {
+  uint16_t value[ADC_SERVICE_MAX_CHANNELS];  // 12-bit results, in channel order
+  uint32_t timestamp;                        // timebase_cycles() at the interrupt
+  uint32_t sequence;                         // 1 for the first sample
+} adc_sample_t;
+
+
+/******************************************************************************
+ * Initializes ADC to use Sample Sequencer #3, triggered by software, no IRQs
+ *
+ * Parameters:
+ *  adc_base - The user must pass ADC0_BASE or ADC1_BASE.
+ *
+ * Returns:
+ *  true  - if an valid base address was passed in
+ *  false - if an invalid base address was passed in
+ *****************************************************************************/
+bool initialize_adc(  uint32_t adc_base );
+
+
+/******************************************************************************
+ * Returns the analog reading for a given AIN channel.
+ *
+ * Parameters:
+ *  adc_base - The user must pass ADC0_BASE or ADC1_BASE.
+ *  channel  - Which channel to convert
+ *
+ * Returns:
+ *   analog reading
+ *****************************************************************************/
+uint32_t get_adc_value( uint32_t adc_base, uint8_t channel);
+
+
+/******************************************************************************
+ * Starts converting a group of channels in the background with Sample 
+ * Sequencer #2.  A general purpose timer triggers the sequencer rate_hz times
+ * a second and every channel is hardware averaged.  The interrupt handler 
+ * stores each result in the slot not being read, so adc_service_read() never
+ * waits for a conversion.
+ *
+ * Only one ADC service can run at a time.  The hardware averaging applies to
+ * every sequencer of the ADC, including the one used by get_adc_value().
+ *
+ * Parameters:
+ *  adc_base     - ADC0_BASE or ADC1_BASE, initialized with initialize_adc()
+ *  timer_base   - general purpose timer used as the trigger
+ *  channels     - AIN channel of each step
+ *  num_channels - 1 to ADC_SERVICE_MAX_CHANNELS
+ *  rate_hz      - conversions per second
+ *  averaging    - ADC_SAC_AVG_ value
+ *
+ * Returns:
+ *  false if a parameter is invalid
+ *****************************************************************************/
+bool adc_service_start(
+  uint32_t adc_base, 
+  uint32_t timer_base, 
+  const uint8_t *channels, 
+  uint8_t num_channels, 
+  uint32_t rate_hz,
+  uint32_t averaging
+);
+
+/******************************************************************************
+ * Copies the most recent conversion to sample.
+ *
+ * Returns:
+ *  false if no conversion has completed yet
+ *****************************************************************************/
+bool adc_service_read(adc_sample_t *sample);
+
+#endif
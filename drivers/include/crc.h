@@ -0,0 +1,22 @@
+#ifndef __CRC_H__
+#define __CRC_H__
+
+#include <stdint.h>
+
+#define CRC16_INIT    0xFFFF
+
+//*****************************************************************************
+// Computes the CRC-16/CCITT (polynomial 0x1021) of a block of data.  
+//
+// Paramters
+//    crc:        CRC16_INIT for a new calculation, or the result of a 
+//                previous call to continue over more data.
+//    data:       the data to check
+//    num_bytes:  number of bytes in data
+//
+// Returns
+//    the updated CRC
+//*****************************************************************************
+uint16_t crc16_ccitt(uint16_t crc, const uint8_t *data, uint32_t num_bytes);
+
+#endif
@@ -0,0 +1,27 @@
+#ifndef __CYCLE_COUNTER_H__
+#define __CYCLE_COUNTER_H__
+
+#include <stdint.h>
+#include "TM4C123GH6PM.h"
+
+//*****************************************************************************
+// Turns on the Cortex-M4 DWT cycle counter.  It runs at the core clock and 
+// wraps every 2^32 cycles (~85 seconds at 50MHz), so it is only used to time
+// short intervals.  Calling this more than once is harmless.
+//*****************************************************************************
+static __INLINE void cycle_counter_init(void)
+{
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+//*****************************************************************************
+// Returns the current value of the cycle counter.  Subtracting two readings
+// as uint32_t gives the correct interval even across a wrap.
+//*****************************************************************************
+static __INLINE uint32_t cycle_counter_read(void)
+{
+  return DWT->CYCCNT;
+}
+
+#endif
@@ -1,213 +1,297 @@
-//*****************************************************************************
-// i2c.h
-// Author: jkrachey@wisc.edu
-//*****************************************************************************
-
-#ifndef __I2C_H__
-#define __I2C_H__
-
-#include <stdint.h>
-#include <stdbool.h>
-#include "TM4C123GH6PM.h"
-#include "driver_defines.h"
-
-
-typedef enum {
-  I2C_OK, 
-  I2C_NULL_PTR, 
-  I2C_BUS_ERROR,
-  I2C_ARBLST,
-  I2C_ACK_RXED,
-  I2C_NO_ACK,
-  I2C_INVALID_BASE,
-  I2C_INVALID_PARAM
-} i2c_status_t;
-
-typedef enum {
-  I2C_READ  = I2C_MSA_RX,
-  I2C_WRITE = I2C_MSA_TX
-} i2c_read_write_t;
-
-
-typedef struct {
-  uint32_t    BaseAddr;
-} I2C_CONFIG;
-
-//*****************************************************************************
-// Initializes a given I2C peripheral to operate at 100KHz.  This assumes
-// MCU core is running at 50MHz
-//
-// Paramters:
-//    base_addr:  The base address of the I2C peripheral that is being
-//                configured
-//
-// Return Value:
-//    Returns I2C_OK if the base address is a valid I2C peripheral
-//    Returns I2C_INVALID_BASE if the base address is not a valid I2C address
-//*****************************************************************************
-i2c_status_t initializeI2CMaster(uint32_t base_addr);
-
-//*****************************************************************************
-// Sets the slave address that is currently being addressed.
-//
-// Paramters:
-//    baseAddr:  The base address of the I2C peripheral that is being
-//                configured
-//    slaveAddr: The address of the slave device being accessed.  This is a 
-//                7-bit slave address
-//    readWrite: If the the transaction will be a read or write operation.
-//               read = 0x01.  write = 0x00
-// Return Value:
-//    Returns I2C_OK if the base address is a valid I2C peripheral
-//    Returns I2C_INVALID_BASE if the base address is not a valid I2C address
-//*****************************************************************************
-i2c_status_t i2cSetSlaveAddr(
-  uint32_t baseAddr, 
-  uint8_t slaveAddr,
-  i2c_read_write_t readWrite
-);
-
-
-//*****************************************************************************
-// Initiates a stop condition.  This function is used when the master does
-// not receive and ACK.
-//
-// Paramters:
-//    baseAddr:  The base address of the I2C peripheral that is being
-//                configured
-// Return Value:
-//    Returns I2C_OK if the base address is a valid I2C peripheral
-//    Returns I2C_INVALID_BASE if the base address is not a valid I2C address
-//*****************************************************************************
-i2c_status_t i2cStop(
-  uint32_t baseAddr
-)  ;
-
-//*****************************************************************************
-// Sends one byte of data over a I2C bus.  
-//
-// Paramters:
-//    baseAddr:  The base address of the I2C peripheral that is being
-//                configured
-//    byte:      The next byte of the data transaction.
-//    mcs:       Sets master control register of the I2C peripheral. Since a
-//               data transaction can consist of multiple bytes, the value
-//               of mcs is used to determine when start and stop bits are 
-//               generated.
-//
-// Examples:
-//    Sending control word (i2c address) + write 1st byte of data. This
-//    assumes that additional bytes will follow in the transaction
-//    i2cSendByte(I2C0_BASE, byte, I2C_MCS_START | I2C_MCS_RUN);
-//
-//    Sending a byte in the middle of a multi-byte operation. (> 2 bytes)
-//    i2cSendByte(I2C0_BASE, byte, I2C_MCS_RUN);
-//
-//    Sending final byte  of data
-//    i2cSendByte(I2C0_BASE, byte, I2C_MCS_RUN | I2C_MCS_STOP);
-//
-//    Sending control word (i2c address) + a single byte transaction.
-//    i2cSendByte(I2C0_BASE, byte, I2C_MCS_START | I2C_MCS_RUN | I2C_MCS_STOP);
-//
-// Return Value:
-//    Returns I2C_OK if the base address is a valid and the data was 
-//    transmitted sucessfully.
-//*****************************************************************************
-i2c_status_t i2cSendByte(
-  uint32_t baseAddr, 
-  uint8_t byte, 
-  uint8_t mcs
-);
-
-//*****************************************************************************
-// Reads one byte of data over a I2C bus.  
-//
-// Paramters:
-//    baseAddr:  The base address of the I2C peripheral that is being
-//                configured
-//    data:      The data read by the transaction.
-//    mcs:       Sets master control register of the I2C peripheral. Since a
-//               data transaction can consist of multiple bytes, the value
-//               of mcs is used to determine when start and stop bits are 
-//               generated.
-//
-// Examples:
-//    * Sending control word (i2c address) + read 1st byte of data. This
-//    * assumes that additional bytes be read after this byte.  This
-//    * would be used for reading multiple bytes at consecutive addresses
-//    * in the slave address.  
-//    i2cGetByte(I2C0_BASE, byte, I2C_MCS_START | I2C_MCS_RUN);
-//
-//    * Reading a byte in the middle of a multi-byte operation. (> 2 bytes)
-//    i2cGetByte(I2C0_BASE, byte, I2C_MCS_RUN);
-//
-//    * Reading final byte of data in a multi-byte read 
-//    i2cGetByte(I2C0_BASE, byte, I2C_MCS_RUN | I2C_MCS_STOP);
-//
-//    * Sending control word (i2c address) + reading a single byte read.
-//    i2cGetByte(I2C0_BASE, byte, I2C_MCS_START | I2C_MCS_RUN | I2C_MCS_STOP);
-//
-// Return Value:
-//    Returns I2C_OK if the base address is a valid and the data was 
-//    transmitted sucessfully.
-//*****************************************************************************
-i2c_status_t i2cGetByte(
-  uint32_t baseAddr, 
-  uint8_t *data, 
-  uint8_t mcs
-) ;
-
-//*****************************************************************************
-// Determines if the last byte of data transmitted was ACKed.  
-//
-// Paramters:
-//    baseAddr:  The base address of the I2C peripheral that is being accessed
-//
-// Returns
-//    Returns true if the data was ACKed
-//    Returns false if the data was not ACKed or i2c_base is invalid
-//*****************************************************************************
-bool
-I2CMasterDatAck(
-uint32_t i2c_base
-);
-
-//*****************************************************************************
-// Determines if the address (control word) was ACKed.  
-//
-// Paramters:
-//    baseAddr:  The base address of the I2C peripheral that is being accessed
-//
-// Returns
-//    Returns true if the address was ACKed
-//    Returns false if the address was not ACKed or i2c_base is invalid
-//*****************************************************************************
-bool
-I2CMasterAdrAck(
-uint32_t i2c_base
-);
-
-//*****************************************************************************
-// Determines if the I2C device is busy transmitting data.  
-//
-// Paramters:
-//    baseAddr:  The base address of the I2C peripheral that is being accessed
-//
-// Returns
-//    Returns true if the I2C device is busy
-//    Returns false if the I2C device is NOT busy or i2c_base is invalid
-//*****************************************************************************
-bool
-I2CMasterBusy(
-uint32_t i2c_base
-);
-
-//*****************************************************************************
-// verifies if the base addressed passed to a function is a valid I2C address
-//*****************************************************************************
-bool
-i2cVerifyBaseAddr(
-  uint32_t i2c_base
-);
-
-#endif
+//*****************************************************************************
+// i2c.h
+// Author: jkrachey@wisc.edu
+//*****************************************************************************
+
+#ifndef __I2C_H__
+#define __I2C_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "TM4C123GH6PM.h"
+#include "driver_defines.h"
+#include "i2c_timing.h"
+
+
+typedef enum {
+  I2C_OK, 
+  I2C_NULL_PTR, 
+  I2C_BUS_ERROR,
+  I2C_ARBLST,
+  I2C_ACK_RXED,
+  I2C_NO_ACK,
+  I2C_INVALID_BASE,
+  I2C_INVALID_PARAM,
+  I2C_BUS_BUSY            // an interrupt handler found the shared bus held
+} i2c_status_t;
+
+typedef enum {
+  I2C_READ  = I2C_MSA_RX,
+  I2C_WRITE = I2C_MSA_TX
+} i2c_read_write_t;
+
+
+typedef struct {
+  uint32_t    BaseAddr;
+} I2C_CONFIG;
+
+// Number of slave devices that can be registered across all I2C peripherals
+#define I2C_MAX_DEVICES         8
+
+typedef struct {
+  uint32_t    transactions; // START to STOP sequences completed
+  uint32_t    errors;       // transactions that ended in an error
+  uint32_t    nacks;        // address NACKs, not counted as transactions
+  uint32_t    lastCycles;   // core clock cycles of the last transaction
+  uint32_t    maxCycles;    // longest transaction
+  uint64_t    totalCycles;  // sum of all transactions, for the mean
+} i2c_device_stats_t;
+
+//*****************************************************************************
+// Sets the SCL rate of an I2C peripheral from SystemCoreClock.  The rate 
+// is capped at the slowest device registered on the peripheral.  A rate of
+// 0 goes back to the default picked by i2cBusRate().
+//
+// Paramters:
+//    baseAddr:  The base address of the I2C peripheral
+//    scl_hz:    The requested SCL rate in Hz
+//
+// Return Value:
+//    Returns I2C_OK if the rate was applied
+//    Returns I2C_INVALID_BASE if the base address is not a valid I2C address
+//    Returns I2C_INVALID_PARAM if the rate cannot be produced
+//*****************************************************************************
+i2c_status_t i2cSetBusSpeed(
+  uint32_t baseAddr,
+  uint32_t scl_hz
+);
+
+//*****************************************************************************
+// Returns the timing the I2C peripheral is currently running at.
+//*****************************************************************************
+i2c_status_t i2cGetBusSpeed(
+  uint32_t baseAddr,
+  i2c_timing_t *timing
+);
+
+//*****************************************************************************
+// Declares a slave device on an I2C peripheral and the fastest SCL rate it
+// supports.  Unless a rate was set with i2cSetBusSpeed() the peripheral 
+// runs at the slowest max_scl_hz of its devices, capped at fast-mode plus
+// since high-speed mode has to be asked for.  Transactions addressed to a 
+// registered device are timed, see i2cGetDeviceStats().
+//
+// Paramters:
+//    baseAddr:   The base address of the I2C peripheral
+//    slaveAddr:  7-bit slave address of the device
+//    max_scl_hz: The fastest SCL rate the device supports
+//
+// Return Value:
+//    Returns I2C_OK if the device was registered
+//    Returns I2C_INVALID_BASE if the base address is not a valid I2C address
+//    Returns I2C_INVALID_PARAM if the device table is full
+//*****************************************************************************
+i2c_status_t i2cRegisterDevice(
+  uint32_t baseAddr,
+  uint8_t slaveAddr,
+  uint32_t max_scl_hz
+);
+
+//*****************************************************************************
+// Returns the transaction timing measured for a registered device.  Times 
+// are in core clock cycles, from the START condition to the STOP condition.
+//
+// Return Value:
+//    Returns I2C_OK if the device is registered
+//    Returns I2C_INVALID_PARAM if it is not
+//*****************************************************************************
+i2c_status_t i2cGetDeviceStats(
+  uint32_t baseAddr,
+  uint8_t slaveAddr,
+  i2c_device_stats_t *stats
+);
+
+//*****************************************************************************
+// Initializes a given I2C peripheral as a master.  The SCL rate is picked
+// by i2cBusRate(), the slowest rate of the devices registered on the 
+// peripheral up to fast-mode plus, 100KHz if no device has been registered
+// yet.  The TPR value is derived from SystemCoreClock.
+//
+// Paramters:
+//    base_addr:  The base address of the I2C peripheral that is being
+//                configured
+//
+// Return Value:
+//    Returns I2C_OK if the base address is a valid I2C peripheral
+//    Returns I2C_INVALID_BASE if the base address is not a valid I2C address
+//*****************************************************************************
+i2c_status_t initializeI2CMaster(uint32_t base_addr);
+
+//*****************************************************************************
+// Sets the slave address that is currently being addressed.
+//
+// Paramters:
+//    baseAddr:  The base address of the I2C peripheral that is being
+//                configured
+//    slaveAddr: The address of the slave device being accessed.  This is a 
+//                7-bit slave address
+//    readWrite: If the the transaction will be a read or write operation.
+//               read = 0x01.  write = 0x00
+// Return Value:
+//    Returns I2C_OK if the base address is a valid I2C peripheral
+//    Returns I2C_INVALID_BASE if the base address is not a valid I2C address
+//*****************************************************************************
+i2c_status_t i2cSetSlaveAddr(
+  uint32_t baseAddr, 
+  uint8_t slaveAddr,
+  i2c_read_write_t readWrite
+);
+
+
+//*****************************************************************************
+// Initiates a stop condition.  This function is used when the master does
+// not receive and ACK.
+//
+// Paramters:
+//    baseAddr:  The base address of the I2C peripheral that is being
+//                configured
+// Return Value:
+//    Returns I2C_OK if the base address is a valid I2C peripheral
+//    Returns I2C_INVALID_BASE if the base address is not a valid I2C address
+//*****************************************************************************
+i2c_status_t i2cStop(
+  uint32_t baseAddr
+)  ;
+
+//*****************************************************************************
+// Sends one byte of data over a I2C bus.  
+//
+// Paramters:
+//    baseAddr:  The base address of the I2C peripheral that is being
+//                configured
+//    byte:      The next byte of the data transaction.
+//    mcs:       Sets master control register of the I2C peripheral. Since a
+//               data transaction can consist of multiple bytes, the value
+//               of mcs is used to determine when start and stop bits are 
+//               generated.
+//
+// Examples:
+//    Sending control word (i2c address) + write 1st byte of data. This
+//    assumes that additional bytes will follow in the transaction
+//    i2cSendByte(I2C0_BASE, byte, I2C_MCS_START | I2C_MCS_RUN);
+//
+//    Sending a byte in the middle of a multi-byte operation. (> 2 bytes)
+//    i2cSendByte(I2C0_BASE, byte, I2C_MCS_RUN);
+//
+//    Sending final byte  of data
+//    i2cSendByte(I2C0_BASE, byte, I2C_MCS_RUN | I2C_MCS_STOP);
+//
+//    Sending control word (i2c address) + a single byte transaction.
+//    i2cSendByte(I2C0_BASE, byte, I2C_MCS_START | I2C_MCS_RUN | I2C_MCS_STOP);
+//
+// Return Value:
+//    Returns I2C_OK if the base address is a valid and the data was 
+//    transmitted sucessfully.
+//    Returns I2C_NO_ACK if the address or the data was not ACKed.  The 
+//    STOP has been sent.
+//    Returns I2C_ARBLST if another master won the bus.
+//    Returns I2C_BUS_ERROR for any other error.
+//*****************************************************************************
+i2c_status_t i2cSendByte(
+  uint32_t baseAddr, 
+  uint8_t byte, 
+  uint8_t mcs
+);
+
+//*****************************************************************************
+// Reads one byte of data over a I2C bus.  
+//
+// Paramters:
+//    baseAddr:  The base address of the I2C peripheral that is being
+//                configured
+//    data:      The data read by the transaction.
+//    mcs:       Sets master control register of the I2C peripheral. Since a
+//               data transaction can consist of multiple bytes, the value
+//               of mcs is used to determine when start and stop bits are 
+//               generated.
+//
+// Examples:
+//    * Sending control word (i2c address) + read 1st byte of data. This
+//    * assumes that additional bytes be read after this byte.  This
+//    * would be used for reading multiple bytes at consecutive addresses
+//    * in the slave address.  
+//    i2cGetByte(I2C0_BASE, byte, I2C_MCS_START | I2C_MCS_RUN);
+//
+//    * Reading a byte in the middle of a multi-byte operation. (> 2 bytes)
+//    i2cGetByte(I2C0_BASE, byte, I2C_MCS_RUN);
+//
+//    * Reading final byte of data in a multi-byte read 
+//    i2cGetByte(I2C0_BASE, byte, I2C_MCS_RUN | I2C_MCS_STOP);
+//
+//    * Sending control word (i2c address) + reading a single byte read.
+//    i2cGetByte(I2C0_BASE, byte, I2C_MCS_START | I2C_MCS_RUN | I2C_MCS_STOP);
+//
+// Return Value:
+//    Returns I2C_OK if the base address is a valid and the data was 
+//    transmitted sucessfully.
+//*****************************************************************************
+i2c_status_t i2cGetByte(
+  uint32_t baseAddr, 
+  uint8_t *data, 
+  uint8_t mcs
+) ;
+
+//*****************************************************************************
+// Determines if the last byte of data transmitted was ACKed.  
+//
+// Paramters:
+//    baseAddr:  The base address of the I2C peripheral that is being accessed
+//
+// Returns
+//    Returns true if the data was ACKed
+//    Returns false if the data was not ACKed or i2c_base is invalid
+//*****************************************************************************
+bool
+I2CMasterDatAck(
+uint32_t i2c_base
+);
+
+//*****************************************************************************
+// Determines if the address (control word) was ACKed.  
+//
+// Paramters:
+//    baseAddr:  The base address of the I2C peripheral that is being accessed
+//
+// Returns
+//    Returns true if the address was ACKed
+//    Returns false if the address was not ACKed or i2c_base is invalid
+//*****************************************************************************
+bool
+I2CMasterAdrAck(
+uint32_t i2c_base
+);
+
+//*****************************************************************************
+// Determines if the I2C device is busy transmitting data.  
+//
+// Paramters:
+//    baseAddr:  The base address of the I2C peripheral that is being accessed
+//
+// Returns
+//    Returns true if the I2C device is busy
+//    Returns false if the I2C device is NOT busy or i2c_base is invalid
+//*****************************************************************************
+bool
+I2CMasterBusy(
+uint32_t i2c_base
+);
+
+//*****************************************************************************
+// verifies if the base addressed passed to a function is a valid I2C address
+//*****************************************************************************
+bool
+i2cVerifyBaseAddr(
+  uint32_t i2c_base
+);
+
+#endif
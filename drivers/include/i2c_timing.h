@@ -0,0 +1,70 @@
+#ifndef __I2C_TIMING_H__
+#define __I2C_TIMING_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+//*****************************************************************************
+// SCL rate arithmetic for the I2C master.  Nothing in here touches the 
+// hardware, so tools/i2c_timing_check.c builds it on the PC and checks the
+// TPR table.
+//*****************************************************************************
+
+// Standard SCL rates
+#define I2C_SCL_STANDARD        100000
+#define I2C_SCL_FAST            400000
+#define I2C_SCL_FAST_PLUS       1000000
+#define I2C_SCL_HIGH_SPEED      3333333
+
+// Largest value of the 7 bit TPR field of MTPR
+#define I2C_TPR_MAX             0x7F
+
+typedef struct {
+  uint8_t     tpr;          // value for the TPR field of MTPR
+  bool        high_speed;   // MTPR.HS is set, SCL_LP=2 and SCL_HP=1
+  uint32_t    scl_hz;       // resulting SCL rate, never above the request
+} i2c_timing_t;
+
+//*****************************************************************************
+// Calculates the MTPR setting that gives the fastest SCL rate at or below
+// the requested rate.  Standard, fast and fast-mode plus rates use 
+// SCL_LP=6 and SCL_HP=4 so
+//    SCL = sys_clk / (2 * (1 + TPR) * 10)
+// Rates above I2C_SCL_FAST_PLUS use high-speed mode where SCL_LP=2 and 
+// SCL_HP=1 so
+//    SCL = sys_clk / (2 * (1 + TPR) * 3)
+//
+// Paramters:
+//    sys_clk:    The system clock in Hz
+//    scl_hz:     The requested SCL rate in Hz
+//    timing:     The calculated setting
+//
+// Return Value:
+//    Returns true if the rate can be produced from sys_clk
+//    Returns false if scl_hz is 0, above I2C_SCL_HIGH_SPEED or too slow for
+//    the 7 bit TPR field
+//*****************************************************************************
+bool i2cCalcTiming(
+  uint32_t sys_clk,
+  uint32_t scl_hz,
+  i2c_timing_t *timing
+);
+
+//*****************************************************************************
+// Picks the SCL rate of a bus.  A rate asked for with i2cSetBusSpeed() is
+// used as it is.  With no request the bus runs as fast as it can without
+// high-speed mode, I2C_SCL_FAST_PLUS.  Either way the rate is capped at 
+// the slowest device registered on the bus.  A bus with no request and no 
+// devices runs at I2C_SCL_STANDARD.
+//
+// Paramters:
+//    scl_request:  The rate asked for, 0 if none
+//    slowest_hz:   The lowest max_scl_hz of the devices on the bus, 0 if 
+//                  none are registered
+//*****************************************************************************
+uint32_t i2cBusRate(
+  uint32_t scl_request,
+  uint32_t slowest_hz
+);
+
+#endif
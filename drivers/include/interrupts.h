@@ -1,8 +1,8 @@
-#ifndef __ECE353_INTERRUPTS_H__
-#define __ECE353_INTERRUPTS_H__
-
-#include <stdint.h>
-#include <stdbool.h>
-#include "TM4C123.h"
-
-#endif
+#ifndef __ECE353_INTERRUPTS_H__
+#define __ECE353_INTERRUPTS_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "TM4C123.h"
+
+#endif
@@ -0,0 +1,129 @@
+#ifndef __PROFILE_ZONES_H__
+#define __PROFILE_ZONES_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+//*****************************************************************************
+// Profiling zones on the DWT cycle counter.  A zone is a named stretch of
+// code between PROFILE_BEGIN() and PROFILE_END():
+//
+//    PROFILE_BEGIN(PROFILE_ZONE_LCD);
+//    ...
+//    PROFILE_END(PROFILE_ZONE_LCD);
+//
+// Every zone keeps its count, min, max and total cycles and a histogram of
+// its times in powers of two, all in RAM.  Zones nest.  Each zone also
+// keeps its self time, the total less the zones that ran inside it, so
+// the self times of the zones in a tick add up to the tick.
+//
+// Zones can be used in interrupt handlers as well as the main loop.  A
+// handler's zones are complete before it returns, so they nest inside
+// whatever zone they interrupted and their time comes off its self time.
+// The zone stack is only changed with interrupts masked.
+//
+// Build with PROFILE_ZONES_ENABLED 0 and PROFILE_BEGIN()/PROFILE_END()
+// compile to nothing, the statistics take no RAM and profile_zones_get()
+// always returns false.
+//
+// With PROFILE_ZONES_HOST defined the file builds on the PC with no
+// hardware, the caller provides profile_zones_host_clock() in place of
+// the cycle counter.  tools/profile_zones_check.c tests it that way.
+//*****************************************************************************
+
+#ifndef PROFILE_ZONES_ENABLED
+#define PROFILE_ZONES_ENABLED     1
+#endif
+
+// Every zone, ID and the name the console prints
+#define PROFILE_ZONE_LIST(ZONE) \
+  ZONE(PROFILE_ZONE_TICK,     "tick")       /* game tick, main.c */ \
+  ZONE(PROFILE_ZONE_TOUCH,    "touch")      /* ft6x06_read_*() */ \
+  ZONE(PROFILE_ZONE_ACCEL,    "accel")      /* accelerometer SPI burst */ \
+  ZONE(PROFILE_ZONE_ADC,      "adc")        /* ADC sequence interrupt */ \
+  ZONE(PROFILE_ZONE_LCD,      "lcd")        /* lcd_draw_image(), lcd_clear_screen() */ \
+  ZONE(PROFILE_ZONE_EEPROM,   "eeprom")     /* EEPROM writes */
+
+typedef enum {
+#define PROFILE_ZONE_ID(id, name)  id,
+  PROFILE_ZONE_LIST(PROFILE_ZONE_ID)
+#undef PROFILE_ZONE_ID
+  PROFILE_NUM_ZONES
+} profile_zone_t;
+
+// Deepest nesting, zones opened past it are not timed
+#define PROFILE_ZONES_DEPTH       8
+
+// Histogram bucket b counts times of 2^b to 2^(b+1) - 1 cycles, bucket 0
+// also counts 0.  The last bucket takes everything longer, 2^23 cycles is
+// 168ms at 50MHz.
+#define PROFILE_ZONES_BUCKETS     24
+
+typedef struct {
+  uint32_t count;
+  uint32_t min;
+  uint32_t max;
+  uint64_t total;
+  uint64_t self;            // total less the zones nested inside
+  uint32_t histogram[PROFILE_ZONES_BUCKETS];
+} profile_zone_stats_t;
+
+//*****************************************************************************
+// Turns on the cycle counter and clears the statistics.
+//*****************************************************************************
+void profile_zones_init(void);
+
+#if PROFILE_ZONES_ENABLED
+
+//*****************************************************************************
+// Opens a zone.  Use PROFILE_BEGIN() so it compiles out.
+//*****************************************************************************
+void profile_zone_begin(profile_zone_t zone);
+
+//*****************************************************************************
+// Closes the innermost open zone, which should be zone.  If zone is open
+// further out, the zones inside it were never closed and are dropped.  If
+// it is not open at all nothing is recorded.  Both count as errors.
+//*****************************************************************************
+void profile_zone_end(profile_zone_t zone);
+
+#define PROFILE_BEGIN(zone)       profile_zone_begin(zone)
+#define PROFILE_END(zone)         profile_zone_end(zone)
+
+#else
+
+// The zone is still evaluated so a zone ID passed in as a parameter does 
+// not become unused
+#define PROFILE_BEGIN(zone)       ((void)(zone))
+#define PROFILE_END(zone)         ((void)(zone))
+
+#endif
+
+//*****************************************************************************
+// Clears the statistics.  Zones that are open carry on and are recorded
+// when they close.
+//*****************************************************************************
+void profile_zones_reset(void);
+
+//*****************************************************************************
+// Copies the statistics of a zone.  Returns false if the zones are
+// compiled out.
+//*****************************************************************************
+bool profile_zones_get(profile_zone_t zone, profile_zone_stats_t *stats);
+
+//*****************************************************************************
+// Unbalanced PROFILE_END() calls and zones nested too deep since the last
+// reset
+//*****************************************************************************
+uint32_t profile_zones_errors(void);
+
+//*****************************************************************************
+// Name of a zone, as in PROFILE_ZONE_LIST
+//*****************************************************************************
+const char *profile_zones_name(profile_zone_t zone);
+
+#ifdef PROFILE_ZONES_HOST
+uint32_t profile_zones_host_clock(void);
+#endif
+
+#endif
@@ -1,56 +1,122 @@
-// Copyright (c) 2014, Joe Krachey
-// All rights reserved.
-//
-// Redistribution and use in binary form, with or without modification, 
-// are permitted provided that the following conditions are met:
-//
-// 1. Redistributions in binary form must reproduce the above copyright 
-//    notice, this list of conditions and the following disclaimer in 
-//    the documentation and/or other materials provided with the distribution.
-//
-// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" 
-// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
-// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR 
-// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR 
-// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, 
-// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, 
-// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; 
-// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
-// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING 
-// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, 
-// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
-
-/************************************************************************/
-/* FILE NAME    - SPI.h                                                 */
-/* AUTHOR       - Joe Krachey                                           */
-/* DATE CREATED - 24-Jun-2013                                           */
-/* DESCRIPTION  - Header file for SPI.c                                 */
-/*                                                                      */
-/* (c) ECE Department, University of Wisconsin - Madison                */
-/************************************************************************/
-#ifndef __ECE453_SPI_H__
-#define __ECE453_SPI_H__
-
-#include "driver_defines.h"
-
-
-//*****************************************************************************
-// Function Prototypes
-//*****************************************************************************
-
-//*****************************************************************************
-// Configure the given SPI peripheral to be 5Mhz and the given SPI mode
-//*****************************************************************************
-bool initialize_spi( uint32_t base_addr, uint8_t spi_mode, uint32_t cpsr);
-
-
-//*****************************************************************************
-// Transmits the array of bytes found at txData to the specified SPI peripheral
-// The number of bytes transmitted is determined by numBytes.
-//
-// The data received by the SPI ternimal is placed in an array of bytes 
-// starting at the address found at rxData
-//*****************************************************************************
-void spiTx(uint32_t base, uint8_t *tx_data, int num_bytes, uint8_t *rx_data);
-
-#endif
+// Copyright (c) 2014, Joe Krachey
+// All rights reserved.
+//
+// Redistribution and use in binary form, with or without modification, 
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions in binary form must reproduce the above copyright 
+//    notice, this list of conditions and the following disclaimer in 
+//    the documentation and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" 
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR 
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR 
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, 
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, 
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; 
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING 
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, 
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+/************************************************************************/
+/* FILE NAME    - SPI.h                                                 */
+/* AUTHOR       - Joe Krachey                                           */
+/* DATE CREATED - 24-Jun-2013                                           */
+/* DESCRIPTION  - Header file for SPI.c                                 */
+/*                                                                      */
+/* (c) ECE Department, University of Wisconsin - Madison                */
+/************************************************************************/
+#ifndef __ECE453_SPI_H__
+#define __ECE453_SPI_H__
+
+#include "driver_defines.h"
+
+// Depth of the SSI transmit and receive FIFOs
+#define SPI_FIFO_DEPTH      8
+
+// spiTxAsync() moves transfers of at least this many bytes with the uDMA.
+// Shorter ones finish faster from the CPU than the DMA setup takes.
+#define SPI_DMA_MIN_BYTES   16
+
+// Priority of the SSI interrupts that signal uDMA completion
+#define SPI_IRQ_PRIORITY    2
+
+// Called when an asynchronous transfer completes.  For uDMA transfers it 
+// runs from the SSI interrupt handler.
+typedef void (*spi_callback_t)(void *context);
+
+typedef struct {
+  uint32_t bytes;
+  uint32_t polledCycles;    // spiTx()
+  uint32_t dmaCycles;       // spiTxAsync() until the callback
+} spi_benchmark_t;
+
+
+//*****************************************************************************
+// Function Prototypes
+//*****************************************************************************
+
+//*****************************************************************************
+// Configure the given SPI peripheral to be 5Mhz and the given SPI mode
+//*****************************************************************************
+bool initialize_spi( uint32_t base_addr, uint8_t spi_mode, uint32_t cpsr);
+
+
+//*****************************************************************************
+// Transmits the array of bytes found at txData to the specified SPI peripheral
+// The number of bytes transmitted is determined by numBytes.
+//
+// The data received by the SPI ternimal is placed in an array of bytes 
+// starting at the address found at rxData.  rxData may be NULL.  Any number
+// of bytes can be sent in one call.
+//*****************************************************************************
+void spiTx(uint32_t base, uint8_t *tx_data, uint32_t num_bytes, uint8_t *rx_data);
+
+//*****************************************************************************
+// Starts a transfer of any length and returns.  callback(context) runs when
+// the last byte has been received.  The caller must not touch tx_data, 
+// rx_data or the chip select until then.
+//
+// tx_data may be NULL to clock out zeros and rx_data may be NULL to throw the
+// received bytes away.  Transfers shorter than SPI_DMA_MIN_BYTES are done 
+// with spiTx() and the callback runs before spiTxAsync() returns.  Longer
+// ones are moved by the uDMA in blocks of up to UDMA_MAX_TRANSFER bytes.
+//
+// Returns
+//    false if base is not an SSI peripheral or a transfer is already running
+//*****************************************************************************
+bool spiTxAsync(
+  uint32_t base, 
+  uint8_t *tx_data, 
+  uint32_t num_bytes, 
+  uint8_t *rx_data, 
+  spi_callback_t callback, 
+  void *context
+);
+
+//*****************************************************************************
+// Returns true while an asynchronous transfer is running
+//*****************************************************************************
+bool spiBusy(uint32_t base);
+
+//*****************************************************************************
+// Measures the time to move num_bytes from buffer with spiTx() and with 
+// spiTxAsync().  Bytes are clocked out on the bus, so no device may be 
+// selected.  Throughput is bytes * SystemCoreClock / cycles bytes per second.
+//*****************************************************************************
+void spiBenchmark(uint32_t base, uint8_t *buffer, uint32_t num_bytes, spi_benchmark_t *result);
+
+//*****************************************************************************
+// With SPI_HOST defined only spiTx() is built, on the PC.  The caller 
+// provides the SSI status and data registers, tools/spi_fifo_check.c checks
+// it against a model of the FIFOs that way.
+//*****************************************************************************
+#ifdef SPI_HOST
+uint32_t spi_host_sr(uint32_t base);
+uint8_t spi_host_dr_read(uint32_t base);
+void spi_host_dr_write(uint32_t base, uint8_t data);
+#endif
+
+#endif
@@ -0,0 +1,87 @@
+#ifndef __SPSC_RING_H__
+#define __SPSC_RING_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "TM4C123GH6PM.h"
+
+//*****************************************************************************
+// Single producer, single consumer byte ring.
+//
+// One context (an interrupt handler or the main loop) only ever adds bytes
+// and one other context only ever removes them.  The producer alone writes
+// head and the consumer alone writes tail, so neither side has to mask 
+// interrupts.  Both counters run freely and are masked into the storage, 
+// which is why the capacity must be a power of two.  tools/spsc_ring_check.c
+// runs it with a producer and a consumer thread on the PC.
+//
+// Storage is static and sized at compile time:
+//
+//    SPSC_RING_STORAGE(txRing, 128);
+//    spsc_ring_t txRing = SPSC_RING_INIT(txRing);
+//*****************************************************************************
+
+typedef struct {
+  uint8_t *data;
+  uint32_t mask;            // capacity - 1
+  volatile uint32_t head;   // bytes ever added, written by the producer
+  volatile uint32_t tail;   // bytes ever removed, written by the consumer
+} spsc_ring_t;
+
+// Fails to compile unless size is a power of two
+#define SPSC_RING_CHECK_SIZE(size) \
+  ((size) + 0 * sizeof(char[(((size) & ((size) - 1)) == 0 && (size) > 0) ? 1 : -1]))
+
+#define SPSC_RING_STORAGE(name, size) \
+  static uint8_t name##_storage[SPSC_RING_CHECK_SIZE(size)]
+
+#define SPSC_RING_INIT(name) \
+  { name##_storage, sizeof(name##_storage) - 1, 0, 0 }
+
+//*****************************************************************************
+// Number of bytes waiting to be removed, and the room left to add more.  
+// Either side may call these; the answer is conservative for the caller.
+//*****************************************************************************
+uint32_t spsc_ring_count(const spsc_ring_t *ring);
+uint32_t spsc_ring_space(const spsc_ring_t *ring);
+
+static __INLINE bool spsc_ring_empty(const spsc_ring_t *ring)
+{
+  return ring->head == ring->tail;
+}
+
+static __INLINE bool spsc_ring_full(const spsc_ring_t *ring)
+{
+  return (ring->head - ring->tail) > ring->mask;
+}
+
+//*****************************************************************************
+// Producer side.  push() returns false if the ring is full.  write() adds as
+// many of num_bytes as fit and returns how many were added.
+//*****************************************************************************
+bool spsc_ring_push(spsc_ring_t *ring, uint8_t data);
+uint32_t spsc_ring_write(spsc_ring_t *ring, const uint8_t *data, uint32_t num_bytes);
+
+//*****************************************************************************
+// Consumer side.  pop() returns false if the ring is empty.  read() removes
+// up to num_bytes and returns how many were removed.
+//*****************************************************************************
+bool spsc_ring_pop(spsc_ring_t *ring, uint8_t *data);
+uint32_t spsc_ring_read(spsc_ring_t *ring, uint8_t *data, uint32_t num_bytes);
+
+//*****************************************************************************
+// Zero copy access.  A span is the largest contiguous block that can be used
+// in place, it stops at the end of the storage.
+//
+// Producer: fill up to spsc_ring_write_span() bytes at *span, then publish 
+// them with spsc_ring_commit().
+//
+// Consumer: use up to spsc_ring_read_span() bytes at *span, for example as a
+// DMA source, then free them with spsc_ring_release().
+//*****************************************************************************
+uint32_t spsc_ring_write_span(spsc_ring_t *ring, uint8_t **span);
+void spsc_ring_commit(spsc_ring_t *ring, uint32_t num_bytes);
+uint32_t spsc_ring_read_span(spsc_ring_t *ring, uint8_t **span);
+void spsc_ring_release(spsc_ring_t *ring, uint32_t num_bytes);
+
+#endif
@@ -0,0 +1,79 @@
+#ifndef __TIMEBASE_H__
+#define __TIMEBASE_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "TM4C123GH6PM.h"
+
+#include "driver_defines.h"
+
+//*****************************************************************************
+// Free running time since boot in system clock cycles.  WTIMER0 is
+// configured as one 64-bit timer counting up from 0, which takes over
+// 11000 years to wrap at 50MHz.  Unlike the DWT cycle counter it keeps
+// counting while the core sleeps or is halted by the debugger.
+//
+// timebase_now() can be called from interrupt handlers and the main loop
+// alike.  The upper half is read before and after the lower one and the
+// read is repeated if it changed, so a carry between the halves cannot
+// tear the value.
+//
+// Short intervals only need the lower 32 bits, a single register read.
+// Two of them subtracted as uint32_t give the right interval across a wrap
+// for anything under 2^32 cycles (85 seconds at 50MHz).  A 32-bit stamp
+// taken in an interrupt handler can be turned back into the full time with
+// timebase_extend() for as long as it is less than that old.
+//*****************************************************************************
+
+#define TIMEBASE_TIMER        WTIMER0
+
+//*****************************************************************************
+// Starts the timebase at 0.  Calling this more than once is harmless, the
+// time keeps running.
+//*****************************************************************************
+void timebase_init(void);
+
+//*****************************************************************************
+// Cycles since timebase_init()
+//*****************************************************************************
+uint64_t timebase_now(void);
+
+//*****************************************************************************
+// Lower 32 bits of timebase_now(), for timing short intervals
+//*****************************************************************************
+static __INLINE uint32_t timebase_cycles(void)
+{
+  return TIMEBASE_TIMER->TAV;
+}
+
+//*****************************************************************************
+// Cycles since a timebase_cycles() reading
+//*****************************************************************************
+static __INLINE uint32_t timebase_cycles_since(uint32_t start)
+{
+  return timebase_cycles() - start;
+}
+
+//*****************************************************************************
+// Full time of a timebase_cycles() reading less than 2^32 cycles old
+//*****************************************************************************
+uint64_t timebase_extend(uint32_t cycles);
+
+//*****************************************************************************
+// Conversions between cycles and microseconds or milliseconds, rounded down.
+// The 32-bit versions are for intervals and avoid a 64-bit division.
+//*****************************************************************************
+uint64_t timebase_to_us(uint64_t cycles);
+uint64_t timebase_to_ms(uint64_t cycles);
+uint64_t timebase_from_us(uint64_t us);
+uint32_t timebase_cycles_to_us(uint32_t cycles);
+
+//*****************************************************************************
+// Time since timebase_init() in microseconds, and in milliseconds truncated
+// to 32 bits.  The milliseconds wrap after 49 days, subtract them as
+// uint32_t.
+//*****************************************************************************
+uint64_t timebase_now_us(void);
+uint32_t timebase_now_ms(void);
+
+#endif
@@ -0,0 +1,77 @@
+#ifndef __UDMA_H__
+#define __UDMA_H__
+
+#include "driver_defines.h"
+
+#define UDMA_NUM_CHANNELS     32
+
+// Items moved by one basic transfer, XFERSIZE is 10 bits
+#define UDMA_MAX_TRANSFER     1024
+
+//*****************************************************************************
+// One entry of the uDMA channel control table.  The source and destination
+// pointers address the LAST item of the transfer.
+//*****************************************************************************
+typedef struct {
+  volatile void *srcEnd;
+  volatile void *dstEnd;
+  volatile uint32_t control;
+  uint32_t spare;
+} udma_control_t;
+
+//*****************************************************************************
+// Turns on the uDMA controller and points it at the channel control table.
+// Calling this more than once is harmless.
+//*****************************************************************************
+void udma_init(void);
+
+//*****************************************************************************
+// Selects which peripheral drives a channel.  The encodings are listed in 
+// the uDMA channel assignments table of the data sheet.
+//*****************************************************************************
+void udma_channel_assign(uint8_t channel, uint8_t encoding);
+
+//*****************************************************************************
+// Fills in the primary or alternate control structure of a channel.
+//
+// Paramters
+//    channel:    uDMA channel 0-31
+//    alternate:  true for the alternate structure (ping-pong)
+//    src:        address of the first source item
+//    dst:        address of the first destination item
+//    count:      number of items, 1 to UDMA_MAX_TRANSFER
+//    control:    UDMA_CHCTL_ increment, size, arbitration and mode bits.  
+//                XFERSIZE is filled in from count.
+//
+// Returns
+//    false if the channel or count is out of range
+//*****************************************************************************
+bool udma_setup(
+  uint8_t channel, 
+  bool alternate, 
+  const volatile void *src, 
+  volatile void *dst, 
+  uint16_t count, 
+  uint32_t control
+);
+
+//*****************************************************************************
+// Starts a channel using its primary control structure.  Single and burst
+// requests from the peripheral are both serviced.
+//*****************************************************************************
+void udma_enable(uint8_t channel, bool high_priority);
+
+//*****************************************************************************
+// Returns true while a channel is enabled.  The controller disables a 
+// channel when a basic transfer completes.
+//*****************************************************************************
+bool udma_is_enabled(uint8_t channel);
+
+//*****************************************************************************
+// Returns true, and clears the flag, if the channel has completed a transfer
+// since the last call.  Peripheral channels signal completion on the 
+// peripheral's interrupt vector, so this is called from that handler.
+//*****************************************************************************
+bool udma_done(uint8_t channel);
+
+#endif
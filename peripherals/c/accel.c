@@ -1,148 +1,456 @@
-#include "accel.h"
-
-extern void spiTx(uint32_t base, uint8_t *tx_data, int size, uint8_t *rx_data);
-extern bool spiVerifyBaseAddr(uint32_t base);
-
-
-//*****************************************************************************
-// Manually sets the SPI chip select line low
-//*****************************************************************************
-static __INLINE void  accel_CSN_low(void)
-{
-  // ADD CODE
-	ACCEL_CS_PORT->DATA &= ~ACCEL_CS_PIN;
-}
-
-//*****************************************************************************
-// Manually sets the SPI chip select line high
-//*****************************************************************************
-static __INLINE void  accel_CSN_high(void)
-{
-  // ADD CODE
-	ACCEL_CS_PORT->DATA |= ACCEL_CS_PIN;
-}
-
-
-
-//*****************************************************************************
-// Read a register from the LSM6DS3H
-//*****************************************************************************
-static __INLINE uint8_t accel_reg_read(uint8_t reg)
-{
-	uint8_t sentData[2];
-	uint8_t returnedData[2];
-	sentData[0] = (0x80) | reg; 
-	sentData[1] = 0x00;
-  // ADD CODE
-	accel_CSN_low();
-	spiTx(ACCEL_SPI_BASE, sentData, 2, returnedData); 
-	accel_CSN_high();
-  return returnedData[1]; // Modify to return the register value
-}
-
-//*****************************************************************************
-// Write a register from the LSM6DS3H
-//*****************************************************************************
-static __INLINE void accel_reg_write(uint8_t reg, uint8_t data)
-{
-	uint8_t sentData[2];
-	uint8_t returnedData[2];
-	sentData[0] = (0x7F) & reg; 
-	sentData[1] = data;
-  // ADD CODE
-	accel_CSN_low();
-	spiTx(ACCEL_SPI_BASE, sentData, 2, returnedData); 
-	accel_CSN_high();
-}
-
-
-//*****************************************************************************
-// Read the X acceleration reading.
-//*****************************************************************************
-int16_t accel_read_x(void)
-{
-  // ADD CODE
-	uint8_t OUTX_L_XL = accel_reg_read(ACCEL_OUTX_L_XL); 
-	uint8_t OUTX_H_XL = accel_reg_read(ACCEL_OUTX_H_XL);
-
-  return OUTX_L_XL | (OUTX_H_XL << 8); // Modify to return the x value
-  
-} 
-
-//*****************************************************************************
-// Read the Y acceleration reading.
-//*****************************************************************************
-int16_t accel_read_y(void)
-{
-  // ADD CODE
-	uint8_t OUTY_L_XL = accel_reg_read(ACCEL_OUTY_L_XL);
-	uint8_t OUTY_H_XL = accel_reg_read(ACCEL_OUTY_H_XL);
-	
-  return OUTY_L_XL | (OUTY_H_XL << 8); // Modify to return the Y value
-}
-
-//*****************************************************************************
-// Read the Z acceleration reading.
-//*****************************************************************************
-int16_t accel_read_z(void)
-{
-  // ADD CODE
-	uint8_t OUTZ_L_XL = accel_reg_read(ACCEL_OUTZ_L_XL);
-	uint8_t OUTZ_H_XL = accel_reg_read(ACCEL_OUTZ_H_XL);
-	
-  return OUTZ_L_XL | (OUTZ_H_XL << 8); // Modify to return the Z value
-  
-}
-
-//*****************************************************************************
-// Used to initialize the GPIO pins used to connect to the LSM6DS3H.
-//
-// Configuration Info
-//		Fill out relevant information in accel.h.  accel.h defines 
-//		how various peripherals are physically connected to the board.
-//  
-//*****************************************************************************
-void accel_initialize(void)
-{  
-  int i = 0;
-	spi_select_init();
-	spi_select(MODULE_1);
-	
-  gpio_enable_port(ACCEL_GPIO_BASE);
-  
-  // Configure SPI CLK
-  gpio_config_digital_enable(ACCEL_GPIO_BASE, ACCEL_CLK_PIN);
-  gpio_config_alternate_function(ACCEL_GPIO_BASE, ACCEL_CLK_PIN);
-  gpio_config_port_control(ACCEL_GPIO_BASE, ACCEL_SPI_CLK_PCTL_M, ACCEL_CLK_PIN_PCTL);
-  
-  // Configure SPI MISO
-  gpio_config_digital_enable(ACCEL_GPIO_BASE, ACCEL_MISO_PIN);
-  gpio_config_alternate_function(ACCEL_GPIO_BASE, ACCEL_MISO_PIN);
-  gpio_config_port_control(ACCEL_GPIO_BASE, ACCEL_SPI_MISO_PCTL_M, ACCEL_MISO_PIN_PCTL);
-  
-  // Configure SPI MOSI
-  gpio_config_digital_enable(ACCEL_GPIO_BASE, ACCEL_MOSI_PIN);
-  gpio_config_alternate_function(ACCEL_GPIO_BASE, ACCEL_MOSI_PIN);
-  gpio_config_port_control(ACCEL_GPIO_BASE, ACCEL_SPI_MOSI_PCTL_M, ACCEL_MOSI_PIN_PCTL);
-  
-  // Configure CS to be a normal GPIO pin that is controlled 
-  // explicitly by software
-  gpio_enable_port(ACCEL_CS_BASE);
-  gpio_config_digital_enable(ACCEL_CS_BASE,ACCEL_CS_PIN);
-  gpio_config_enable_output(ACCEL_CS_BASE,ACCEL_CS_PIN);
-
-  initialize_spi( ACCEL_SPI_BASE, ACCEL_SPI_MODE, 10);
-	
-	while( accel_reg_read(ACCEL_WHO_AM_I_R) != 0x69)
-	{
-			for(i=0; i < 1000; i++)
-			{};
-	}
-
-	accel_reg_write(ACCEL_INT1_CTRL_R, 0x00);  // For now, disable interrupts
-	
-	accel_reg_write(ACCEL_CTRL1_XL_R, ACCEL_CTRL1_XL_ODR_208HZ | ACCEL_CTRL1_XL_2G | ACCEL_CTRL1_XL_ANTI_ALIAS_50HZ);
-	accel_reg_write(ACCEL_CTRL2_G_R, ACCEL_CTRL2_G_ODR_416HZ | ACCEL_CTRL2_G_FS_245_DPS | ACCEL_CTRL2_G_FS_125);
-	accel_reg_write(ACCEL_CTRL5_C_R, ACCEL_CTRL5_SLEEP_G | ACCEL_CTRL5_INT2_ON_INT1);
-	
-}
+#include "accel.h"
+#include "cycle_counter.h"
+#include "profile_zones.h"
+
+extern bool spiVerifyBaseAddr(uint32_t base);
+
+static accel_stats_t accelStats;
+
+// Transmitted while clocking in burst reads
+static uint8_t accelDummyTx[ACCEL_MAX_BURST];
+
+// PD3 interrupt mask saved while CS is low
+static uint32_t accelIrqSaved;
+
+// Samples drained from the sensor FIFO.  Written only by the INT1 handler and
+// read only by the main loop.
+static accel_sample_t accelRing[ACCEL_FIFO_RING_SIZE];
+static volatile uint16_t accelRingHead;
+static volatile uint16_t accelRingTail;
+
+
+//*****************************************************************************
+// Manually sets the SPI chip select line low.  The FIFO interrupt is masked 
+// while CS is low so the handler cannot start a transfer in the middle of 
+// one issued from the main loop.
+//*****************************************************************************
+static __INLINE void  accel_CSN_low(void)
+{
+  // ADD CODE
+	accelIrqSaved = ACCEL_IRQ_PORT->IM & ACCEL_IRQ_PIN;
+	ACCEL_IRQ_PORT->IM &= ~ACCEL_IRQ_PIN;
+	ACCEL_CS_PORT->DATA &= ~ACCEL_CS_PIN;
+}
+
+//*****************************************************************************
+// Manually sets the SPI chip select line high
+//*****************************************************************************
+static __INLINE void  accel_CSN_high(void)
+{
+  // ADD CODE
+	ACCEL_CS_PORT->DATA |= ACCEL_CS_PIN;
+	ACCEL_IRQ_PORT->IM |= accelIrqSaved;
+}
+
+
+
+//*****************************************************************************
+// Read a register from the LSM6DS3H
+//*****************************************************************************
+static __INLINE uint8_t accel_reg_read(uint8_t reg)
+{
+	uint8_t sentData[2];
+	uint8_t returnedData[2];
+	sentData[0] = (0x80) | reg; 
+	sentData[1] = 0x00;
+  // ADD CODE
+	accel_CSN_low();
+	spiTx(ACCEL_SPI_BASE, sentData, 2, returnedData); 
+	accel_CSN_high();
+  return returnedData[1]; // Modify to return the register value
+}
+
+//*****************************************************************************
+// Reads consecutive registers from the LSM6DS3H in a single CS window.  The
+// register address auto increments (CTRL3_C IF_INC) after every byte, and 
+// rolls back from FIFO_DATA_OUT_H to FIFO_DATA_OUT_L so a burst there reads
+// consecutive FIFO words.  num_regs is at most ACCEL_MAX_BURST.
+//*****************************************************************************
+static void accel_reg_read_burst(uint8_t reg, uint8_t *data, uint16_t num_regs)
+{
+	uint8_t address;
+	uint32_t start;
+	uint32_t cycles;
+	uint32_t primask;
+	
+	address = ACCEL_SPI_READ | reg;
+	
+	PROFILE_BEGIN(PROFILE_ZONE_ACCEL);
+	start = cycle_counter_read();
+	accel_CSN_low();
+	spiTx(ACCEL_SPI_BASE, &address, 1, NULL);
+	spiTx(ACCEL_SPI_BASE, accelDummyTx, num_regs, data);
+	accel_CSN_high();
+	cycles = cycle_counter_read() - start;
+	PROFILE_END(PROFILE_ZONE_ACCEL);
+	
+	// Bursts come from the main loop and from the FIFO interrupt
+	primask = __get_PRIMASK();
+	__disable_irq();
+	accelStats.samples++;
+	accelStats.lastCycles = cycles;
+	accelStats.totalCycles += cycles;
+	if (cycles > accelStats.maxCycles)
+		accelStats.maxCycles = cycles;
+	__set_PRIMASK(primask);
+}
+
+//*****************************************************************************
+// Write a register from the LSM6DS3H
+//*****************************************************************************
+static __INLINE void accel_reg_write(uint8_t reg, uint8_t data)
+{
+	uint8_t sentData[2];
+	uint8_t returnedData[2];
+	sentData[0] = (0x7F) & reg; 
+	sentData[1] = data;
+  // ADD CODE
+	accel_CSN_low();
+	spiTx(ACCEL_SPI_BASE, sentData, 2, returnedData); 
+	accel_CSN_high();
+}
+
+
+//*****************************************************************************
+// Read the X acceleration reading.
+//*****************************************************************************
+int16_t accel_read_x(void)
+{
+	uint8_t data[2];
+	
+	accel_reg_read_burst(ACCEL_OUTX_L_XL, data, 2);
+  return data[0] | (data[1] << 8);
+} 
+
+//*****************************************************************************
+// Read the Y acceleration reading.
+//*****************************************************************************
+int16_t accel_read_y(void)
+{
+	uint8_t data[2];
+	
+	accel_reg_read_burst(ACCEL_OUTY_L_XL, data, 2);
+  return data[0] | (data[1] << 8);
+}
+
+//*****************************************************************************
+// Read the Z acceleration reading.
+//*****************************************************************************
+int16_t accel_read_z(void)
+{
+	uint8_t data[2];
+	
+	accel_reg_read_burst(ACCEL_OUTZ_L_XL, data, 2);
+  return data[0] | (data[1] << 8);
+}
+
+//*****************************************************************************
+// Read all three acceleration axes, OUTX_L_XL through OUTZ_H_XL, in one 
+// SPI transaction.
+//*****************************************************************************
+void accel_read_xyz(accel_xyz_t *accel)
+{
+	uint8_t data[6];
+	
+	accel_reg_read_burst(ACCEL_OUTX_L_XL, data, 6);
+	accel->x = data[0] | (data[1] << 8);
+	accel->y = data[2] | (data[3] << 8);
+	accel->z = data[4] | (data[5] << 8);
+}
+
+//*****************************************************************************
+// Read the gyro and acceleration axes, OUTX_L_G through OUTZ_H_XL, in one
+// SPI transaction.
+//*****************************************************************************
+void accel_read_imu(accel_xyz_t *gyro, accel_xyz_t *accel)
+{
+	uint8_t data[12];
+	
+	accel_reg_read_burst(ACCEL_OUTX_L_G, data, 12);
+	gyro->x = data[0] | (data[1] << 8);
+	gyro->y = data[2] | (data[3] << 8);
+	gyro->z = data[4] | (data[5] << 8);
+	accel->x = data[6] | (data[7] << 8);
+	accel->y = data[8] | (data[9] << 8);
+	accel->z = data[10] | (data[11] << 8);
+}
+
+//*****************************************************************************
+// Returns the SPI time spent reading samples.  Copied with interrupts masked
+// so the FIFO interrupt cannot tear the copy.
+//*****************************************************************************
+void accel_get_stats(accel_stats_t *stats)
+{
+	uint32_t primask;
+	
+	primask = __get_PRIMASK();
+	__disable_irq();
+	*stats = accelStats;
+	__set_PRIMASK(primask);
+}
+
+//*****************************************************************************
+// Queues one sample for the main loop, or counts it as dropped if the main 
+// loop has fallen ACCEL_FIFO_RING_SIZE samples behind.
+//*****************************************************************************
+static void accel_ring_push(const accel_sample_t *sample)
+{
+	uint16_t head = accelRingHead;
+	
+	if ((uint16_t)(head - accelRingTail) >= ACCEL_FIFO_RING_SIZE)
+	{
+		accelStats.fifoDropped++;
+		return;
+	}
+	
+	accelRing[head & (ACCEL_FIFO_RING_SIZE - 1)] = *sample;
+	accelRingHead = head + 1;
+}
+
+//*****************************************************************************
+// Moves every complete sample in the sensor FIFO into the ring, up to 
+// ACCEL_FIFO_MAX_DRAIN samples per SPI burst.  The FIFO is left with less 
+// than the watermark so the next crossing produces a new INT1 edge.
+//*****************************************************************************
+void accel_fifo_service(void)
+{
+	uint8_t status[4];
+	uint8_t data[ACCEL_MAX_BURST];
+	accel_sample_t sample;
+	uint16_t words;
+	uint16_t pattern;
+	uint16_t samples;
+	uint16_t i;
+	
+	accelStats.fifoIrqs++;
+	
+	while (1)
+	{
+		accel_reg_read_burst(ACCEL_FIFO_STATUS1_R, status, 4);
+		
+		words = status[0] | ((status[1] & ACCEL_FIFO_STATUS2_DIFF_H_M) << 8);
+		pattern = status[2] | ((status[3] & ACCEL_FIFO_STATUS4_PATTERN_H_M) << 8);
+		
+		if (status[1] & ACCEL_FIFO_STATUS2_OVER_RUN)
+			accelStats.fifoOverruns++;
+		
+		// After an overrun the next word may be in the middle of a sample.
+		// Discard the rest of it so the burst below starts at gyro X.
+		if (pattern != 0)
+		{
+			pattern = ACCEL_FIFO_WORDS_PER_SAMPLE - pattern;
+			if (words < pattern)
+				return;
+			accel_reg_read_burst(ACCEL_FIFO_DATA_OUT_L, data, pattern * 2);
+			words -= pattern;
+		}
+		
+		samples = words / ACCEL_FIFO_WORDS_PER_SAMPLE;
+		if (samples == 0)
+			return;
+		if (samples > ACCEL_FIFO_MAX_DRAIN)
+			samples = ACCEL_FIFO_MAX_DRAIN;
+		
+		accel_reg_read_burst(ACCEL_FIFO_DATA_OUT_L, data, samples * ACCEL_FIFO_WORDS_PER_SAMPLE * 2);
+		
+		for (i = 0; i < samples; i++)
+		{
+			uint8_t *word = &data[i * ACCEL_FIFO_WORDS_PER_SAMPLE * 2];
+			
+			sample.gyro.x = word[0] | (word[1] << 8);
+			sample.gyro.y = word[2] | (word[3] << 8);
+			sample.gyro.z = word[4] | (word[5] << 8);
+			sample.accel.x = word[6] | (word[7] << 8);
+			sample.accel.y = word[8] | (word[9] << 8);
+			sample.accel.z = word[10] | (word[11] << 8);
+			accel_ring_push(&sample);
+		}
+		accelStats.fifoSamples += samples;
+		
+		// Anything that arrived during the burst is below the watermark
+		if (words < (ACCEL_FIFO_MAX_DRAIN + 1) * ACCEL_FIFO_WORDS_PER_SAMPLE)
+			return;
+	}
+}
+
+//*****************************************************************************
+// INT1 FIFO watermark interrupt, called by GPIOD_Handler while the 
+// accelerometer is selected
+//*****************************************************************************
+static void accel_fifo_irq(void)
+{
+	ACCEL_IRQ_PORT->ICR = ACCEL_IRQ_PIN;
+	accel_fifo_service();
+}
+
+//*****************************************************************************
+// Copies samples out of the FIFO ring
+//*****************************************************************************
+uint16_t accel_fifo_get(accel_sample_t *samples, uint16_t max)
+{
+	uint16_t tail = accelRingTail;
+	uint16_t count = 0;
+	
+	while (count < max && tail != accelRingHead)
+	{
+		samples[count++] = accelRing[tail & (ACCEL_FIFO_RING_SIZE - 1)];
+		tail++;
+	}
+	accelRingTail = tail;
+	
+	return count;
+}
+
+//*****************************************************************************
+// Averages every sample queued since the last call
+//*****************************************************************************
+uint16_t accel_fifo_average(accel_sample_t *avg)
+{
+	int32_t sum[6] = {0, 0, 0, 0, 0, 0};
+	accel_sample_t *sample;
+	uint16_t tail = accelRingTail;
+	uint16_t count = 0;
+	
+	while (tail != accelRingHead)
+	{
+		sample = &accelRing[tail & (ACCEL_FIFO_RING_SIZE - 1)];
+		sum[0] += sample->gyro.x;
+		sum[1] += sample->gyro.y;
+		sum[2] += sample->gyro.z;
+		sum[3] += sample->accel.x;
+		sum[4] += sample->accel.y;
+		sum[5] += sample->accel.z;
+		tail++;
+		count++;
+	}
+	accelRingTail = tail;
+	
+	if (count == 0)
+		return 0;
+	
+	avg->gyro.x = sum[0] / count;
+	avg->gyro.y = sum[1] / count;
+	avg->gyro.z = sum[2] / count;
+	avg->accel.x = sum[3] / count;
+	avg->accel.y = sum[4] / count;
+	avg->accel.z = sum[5] / count;
+	
+	return count;
+}
+
+//*****************************************************************************
+// Takes SSI0 and PD3 back from the radio.  Samples queued before the radio
+// took them are stale and dropped.  The sensor FIFO kept filling in the 
+// meantime, so INT1 is already high and gives no new rising edge until 
+// the FIFO is drained once.  That drain runs with PD3 masked so the handler
+// cannot start a burst in the middle of it, an edge it causes stays pending
+// and is taken as soon as PD3 is unmasked.
+//*****************************************************************************
+void accel_resume(void)
+{
+	ACCEL_IRQ_PORT->IM &= ~ACCEL_IRQ_PIN;
+	spi_select(MODULE_1);
+	spi_select_set_irq_handler(MODULE_1, accel_fifo_irq);
+	initialize_spi(ACCEL_SPI_BASE, ACCEL_SPI_MODE, 10);
+	
+	gpio_config_rising_edge_irq(ACCEL_IRQ_GPIO_BASE, ACCEL_IRQ_PIN);
+	ACCEL_IRQ_PORT->IM &= ~ACCEL_IRQ_PIN;
+	
+	accelRingTail = accelRingHead;
+	accel_fifo_service();
+	ACCEL_IRQ_PORT->IM |= ACCEL_IRQ_PIN;
+}
+
+//*****************************************************************************
+// CS stays high so the sensor ignores the bytes, and the FIFO interrupt is 
+// masked so the handler cannot use the SSI in the middle of a measurement.
+//*****************************************************************************
+bool accel_spi_benchmark(spi_benchmark_t *result)
+{
+	if (spi_select_current() != MODULE_1)
+		return false;
+	
+	accelIrqSaved = ACCEL_IRQ_PORT->IM & ACCEL_IRQ_PIN;
+	ACCEL_IRQ_PORT->IM &= ~ACCEL_IRQ_PIN;
+	spiBenchmark(ACCEL_SPI_BASE, accelDummyTx, ACCEL_MAX_BURST, result);
+	ACCEL_IRQ_PORT->IM |= accelIrqSaved;
+	return true;
+}
+
+//*****************************************************************************
+// Used to initialize the GPIO pins used to connect to the LSM6DS3H.
+//
+// Configuration Info
+//		Fill out relevant information in accel.h.  accel.h defines 
+//		how various peripherals are physically connected to the board.
+//  
+//*****************************************************************************
+void accel_initialize(void)
+{  
+  int i = 0;
+	spi_select_init();
+	spi_select(MODULE_1);
+	spi_select_set_irq_handler(MODULE_1, accel_fifo_irq);
+	
+  gpio_enable_port(ACCEL_GPIO_BASE);
+  
+  // Configure SPI CLK
+  gpio_config_digital_enable(ACCEL_GPIO_BASE, ACCEL_CLK_PIN);
+  gpio_config_alternate_function(ACCEL_GPIO_BASE, ACCEL_CLK_PIN);
+  gpio_config_port_control(ACCEL_GPIO_BASE, ACCEL_SPI_CLK_PCTL_M, ACCEL_CLK_PIN_PCTL);
+  
+  // Configure SPI MISO
+  gpio_config_digital_enable(ACCEL_GPIO_BASE, ACCEL_MISO_PIN);
+  gpio_config_alternate_function(ACCEL_GPIO_BASE, ACCEL_MISO_PIN);
+  gpio_config_port_control(ACCEL_GPIO_BASE, ACCEL_SPI_MISO_PCTL_M, ACCEL_MISO_PIN_PCTL);
+  
+  // Configure SPI MOSI
+  gpio_config_digital_enable(ACCEL_GPIO_BASE, ACCEL_MOSI_PIN);
+  gpio_config_alternate_function(ACCEL_GPIO_BASE, ACCEL_MOSI_PIN);
+  gpio_config_port_control(ACCEL_GPIO_BASE, ACCEL_SPI_MOSI_PCTL_M, ACCEL_MOSI_PIN_PCTL);
+  
+  // Configure CS to be a normal GPIO pin that is controlled 
+  // explicitly by software
+  gpio_enable_port(ACCEL_CS_BASE);
+  gpio_config_digital_enable(ACCEL_CS_BASE,ACCEL_CS_PIN);
+  gpio_config_enable_output(ACCEL_CS_BASE,ACCEL_CS_PIN);
+  
+  // SPI time per sample is measured with the cycle counter
+  cycle_counter_init();
+
+  initialize_spi( ACCEL_SPI_BASE, ACCEL_SPI_MODE, 10);
+	
+	while( accel_reg_read(ACCEL_WHO_AM_I_R) != 0x69)
+	{
+			for(i=0; i < 1000; i++)
+			{};
+	}
+
+	accel_reg_write(ACCEL_INT1_CTRL_R, 0x00);  // Enabled once the FIFO is set up
+	
+	// Burst reads: auto increment the register address and never mix the 
+	// low and high bytes of two different samples
+	accel_reg_write(ACCEL_CTRL3_C_R, ACCEL_CTRL3_C_BDU | ACCEL_CTRL3_C_IF_INC);
+	
+	accel_reg_write(ACCEL_CTRL1_XL_R, ACCEL_CTRL1_XL_ODR_208HZ | ACCEL_CTRL1_XL_2G | ACCEL_CTRL1_XL_ANTI_ALIAS_50HZ);
+	accel_reg_write(ACCEL_CTRL2_G_R, ACCEL_CTRL2_G_ODR_416HZ | ACCEL_CTRL2_G_FS_245_DPS | ACCEL_CTRL2_G_FS_125);
+	accel_reg_write(ACCEL_CTRL5_C_R, ACCEL_CTRL5_SLEEP_G | ACCEL_CTRL5_INT2_ON_INT1);
+	
+	// Batch samples in the sensor FIFO.  Going through bypass first empties 
+	// anything left from before a reset.
+	accel_reg_write(ACCEL_FIFO_CTRL5_R, ACCEL_FIFO_CTRL5_BYPASS);
+	accel_reg_write(ACCEL_FIFO_CTRL1_R, (ACCEL_FIFO_WATERMARK * ACCEL_FIFO_WORDS_PER_SAMPLE) & 0xFF);
+	accel_reg_write(ACCEL_FIFO_CTRL2_R, ((ACCEL_FIFO_WATERMARK * ACCEL_FIFO_WORDS_PER_SAMPLE) >> 8) & ACCEL_FIFO_CTRL2_FTH_H_M);
+	accel_reg_write(ACCEL_FIFO_CTRL3_R, ACCEL_FIFO_CTRL3_DEC_G_NONE | ACCEL_FIFO_CTRL3_DEC_XL_NONE);
+	accel_reg_write(ACCEL_FIFO_CTRL5_R, ACCEL_FIFO_CTRL5_ODR_208HZ | ACCEL_FIFO_CTRL5_CONTINUOUS);
+	
+	// INT1 (push-pull, active high) goes high at the watermark
+	gpio_enable_port(ACCEL_IRQ_GPIO_BASE);
+	gpio_config_digital_enable(ACCEL_IRQ_GPIO_BASE, ACCEL_IRQ_PIN);
+	gpio_config_enable_input(ACCEL_IRQ_GPIO_BASE, ACCEL_IRQ_PIN);
+	gpio_config_rising_edge_irq(ACCEL_IRQ_GPIO_BASE, ACCEL_IRQ_PIN);
+	NVIC_SetPriority(ACCEL_IRQ_NUM, ACCEL_IRQ_PRIORITY);
+	NVIC_EnableIRQ(ACCEL_IRQ_NUM);
+	
+	accel_reg_write(ACCEL_INT1_CTRL_R, ACCEL_INT1_CTRL_INT1_FTH);
+}
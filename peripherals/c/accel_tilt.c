@@ -0,0 +1,135 @@
+#include "accel_tilt.h"
+#include "cycle_counter.h"
+
+static int32_t tiltAngle;             // ACCEL_TILT_FRAC_BITS fractional bits
+static int32_t gyroBias;
+static int32_t biasSum;
+static uint16_t biasSamples;
+static accel_tilt_stats_t tiltStats;
+
+
+//*****************************************************************************
+// Arctangent of z / 32768 for 0 <= z <= 32768, as a binary angle from 0 to
+// 8192 (45 degrees).  atan(z) ~= pi/4 z + 0.273 z (1 - z), within 0.22 
+// degrees.
+//*****************************************************************************
+static __INLINE int32_t accel_tilt_atan(int32_t z)
+{
+	return (z * (8192 + ((2847 * (32768 - z)) >> 15))) >> 15;
+}
+
+//*****************************************************************************
+// Four quadrant arctangent of y / x as a binary angle.  One divide.
+//*****************************************************************************
+static int32_t accel_tilt_atan2(int32_t y, int32_t x)
+{
+	int32_t ax = (x < 0) ? -x : x;
+	int32_t ay = (y < 0) ? -y : y;
+	int32_t angle;
+	
+	if (ax == 0 && ay == 0)
+		return 0;
+	
+	// fold into the first octant so the ratio is at most 1
+	if (ay <= ax)
+		angle = accel_tilt_atan((ay << 15) / ax);
+	else
+		angle = 16384 - accel_tilt_atan((ax << 15) / ay);
+	
+	if (x < 0)
+		angle = 32768 - angle;
+	if (y < 0)
+		angle = -angle;
+	
+	return angle;
+}
+
+//*****************************************************************************
+// Resets the filter
+//*****************************************************************************
+void accel_tilt_init(void)
+{
+	tiltAngle = 0;
+	gyroBias = 0;
+	biasSum = 0;
+	biasSamples = 0;
+	
+	cycle_counter_init();
+}
+
+//*****************************************************************************
+// One filter step.  Rotating about +Y by theta reads 
+// ax = -g sin(theta) and az = g cos(theta), and the gyro Y rate is 
+// d(theta)/dt.
+//*****************************************************************************
+void accel_tilt_sample(const accel_sample_t *sample)
+{
+	uint32_t start = cycle_counter_read();
+	uint32_t cycles;
+	int32_t accelAngle;
+	
+	accelAngle = accel_tilt_atan2(-sample->accel.x, sample->accel.z) << ACCEL_TILT_FRAC_BITS;
+	
+	if (biasSamples < ACCEL_TILT_BIAS_SAMPLES)
+	{
+		// measuring the gyro offset, low pass the accelerometer alone
+		if (biasSamples == 0)
+			tiltAngle = accelAngle;
+		else
+			tiltAngle += (accelAngle - tiltAngle) >> ACCEL_TILT_ALPHA_SHIFT;
+		biasSum += sample->gyro.y;
+		biasSamples++;
+		if (biasSamples == ACCEL_TILT_BIAS_SAMPLES)
+			gyroBias = biasSum / ACCEL_TILT_BIAS_SAMPLES;
+	}
+	else
+	{
+		// predict with the gyro, then correct toward the accelerometer.  The
+		// saturating adds keep a bad sample from wrapping the angle.
+		tiltAngle = __QADD(tiltAngle, (sample->gyro.y - gyroBias) * ACCEL_TILT_GYRO_SCALE);
+		tiltAngle = __QADD(tiltAngle, (accelAngle - tiltAngle) >> ACCEL_TILT_ALPHA_SHIFT);
+	}
+	
+	cycles = cycle_counter_read() - start;
+	tiltStats.samples++;
+	tiltStats.lastCycles = cycles;
+	if (cycles > tiltStats.maxCycles)
+		tiltStats.maxCycles = cycles;
+	if (cycles > ACCEL_TILT_BUDGET_CYCLES)
+		tiltStats.overBudget++;
+}
+
+//*****************************************************************************
+// Filters everything in the FIFO ring
+//*****************************************************************************
+int16_t accel_tilt_update(void)
+{
+	accel_sample_t samples[ACCEL_FIFO_MAX_DRAIN];
+	uint16_t count;
+	uint16_t i;
+	
+	do
+	{
+		count = accel_fifo_get(samples, ACCEL_FIFO_MAX_DRAIN);
+		for (i = 0; i < count; i++)
+			accel_tilt_sample(&samples[i]);
+	} while (count == ACCEL_FIFO_MAX_DRAIN);
+	
+	return accel_tilt_angle();
+}
+
+//*****************************************************************************
+// Returns the filtered tilt
+//*****************************************************************************
+int16_t accel_tilt_angle(void)
+{
+	return __SSAT(tiltAngle >> ACCEL_TILT_FRAC_BITS, 16);
+}
+
+//*****************************************************************************
+// Returns the time spent in the filter
+//*****************************************************************************
+void accel_tilt_get_stats(accel_tilt_stats_t *stats)
+{
+	*stats = tiltStats;
+}
@@ -1,511 +1,511 @@
-// Copyright (c) 2014-2016, Joe Krachey
-// All rights reserved.
-//
-// Redistribution and use in binary form, with or without modification, 
-// are permitted provided that the following conditions are met:
-//
-// 1. Redistributions in binary form must reproduce the above copyright 
-//    notice, this list of conditions and the following disclaimer in 
-//    the documentation and/or other materials provided with the distribution.
-//
-// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" 
-// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
-// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR 
-// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR 
-// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, 
-// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, 
-// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; 
-// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
-// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING 
-// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, 
-// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
-
-#include "ece353_images.h"
-
-/* 
-**  Image data for right_arrow
-*/
-
-const uint8_t right_arrowBitmaps []=
-{
-	0x00, 0x00, 0x7E, 0x00, 0x00, //                  ######                
-	0x00, 0x07, 0xFF, 0xC0, 0x00, //              #############             
-	0x00, 0x3F, 0xFF, 0xF8, 0x00, //           ###################          
-	0x00, 0x7F, 0xFF, 0xFC, 0x00, //          #####################         
-	0x01, 0xFF, 0xFF, 0xFF, 0x00, //        #########################       
-	0x03, 0xFF, 0x01, 0xFF, 0x80, //       ##########       ##########      
-	0x07, 0xF8, 0x00, 0x3F, 0xC0, //      ########             ########     
-	0x0F, 0xF0, 0x00, 0x0F, 0xE0, //     ########                #######    
-	0x0F, 0xC0, 0x00, 0x07, 0xE0, //     ######                   ######    
-	0x1F, 0x80, 0x70, 0x03, 0xF0, //    ######        ###          ######   
-	0x3F, 0x01, 0xF8, 0x01, 0xF8, //   ######       ######          ######  
-	0x3F, 0x01, 0xFC, 0x00, 0xF8, //   ######       #######          #####  
-	0x3E, 0x03, 0xFC, 0x00, 0xFC, //   #####       ########          ###### 
-	0x7C, 0x0F, 0xF8, 0x00, 0x7C, //  #####      #########            ##### 
-	0x7C, 0x1F, 0xF8, 0x00, 0x7C, //  #####     ##########            ##### 
-	0x7C, 0x3F, 0xF0, 0x00, 0x3C, //  #####    ##########              #### 
-	0x78, 0x7F, 0xC0, 0x00, 0x3E, //  ####    #########                #####
-	0xF8, 0xFF, 0xFF, 0xFE, 0x3E, // #####   #######################   #####
-	0xF8, 0xFF, 0xFF, 0xFE, 0x3E, // #####   #######################   #####
-	0xF8, 0xFF, 0xFF, 0xFE, 0x3E, // #####   #######################   #####
-	0xF8, 0xFF, 0xFF, 0xFE, 0x3E, // #####   #######################   #####
-	0xF8, 0xFF, 0xFF, 0xFE, 0x3E, // #####   #######################   #####
-	0xF8, 0x7F, 0xFF, 0xF8, 0x3E, // #####    ####################     #####
-	0x7C, 0x3F, 0xE0, 0x00, 0x3C, //  #####    #########               #### 
-	0x7C, 0x1F, 0xF0, 0x00, 0x7C, //  #####     #########             ##### 
-	0x7C, 0x0F, 0xF8, 0x00, 0x7C, //  #####      #########            ##### 
-	0x3E, 0x07, 0xFC, 0x00, 0xFC, //   #####      #########          ###### 
-	0x3E, 0x03, 0xFC, 0x00, 0xF8, //   #####       ########          #####  
-	0x3F, 0x01, 0xF8, 0x01, 0xF8, //   ######       ######          ######  
-	0x1F, 0x80, 0x70, 0x03, 0xF0, //    ######        ###          ######   
-	0x0F, 0xC0, 0x00, 0x07, 0xF0, //     ######                   #######   
-	0x0F, 0xE0, 0x00, 0x0F, 0xE0, //     #######                 #######    
-	0x07, 0xF8, 0x00, 0x3F, 0xC0, //      ########             ########     
-	0x03, 0xFE, 0x00, 0xFF, 0x80, //       #########         #########      
-	0x01, 0xFF, 0xFF, 0xFF, 0x00, //        #########################       
-	0x00, 0x7F, 0xFF, 0xFE, 0x00, //          ######################        
-	0x00, 0x3F, 0xFF, 0xF8, 0x00, //           ###################          
-	0x00, 0x0F, 0xFF, 0xE0, 0x00, //             ###############            
-	0x00, 0x00, 0xFE, 0x00, 0x00, //                 #######                
-};
-
-/* 
-**  Image data for up_arrow
-*/
-
-const uint8_t down_arrowBitmaps [] =
-{
-	0x00, 0x00, 0xFC, 0x00, 0x00, //                 ######                 
-	0x00, 0x07, 0xFF, 0xC0, 0x00, //              #############             
-	0x00, 0x3F, 0xFF, 0xF8, 0x00, //           ###################          
-	0x00, 0x7F, 0xFF, 0xFC, 0x00, //          #####################         
-	0x01, 0xFF, 0xFF, 0xFF, 0x00, //        #########################       
-	0x03, 0xFF, 0x01, 0xFF, 0x80, //       ##########       ##########      
-	0x07, 0xF8, 0x00, 0x3F, 0xC0, //      ########             ########     
-	0x0F, 0xE0, 0x00, 0x1F, 0xE0, //     #######                ########    
-	0x0F, 0xC0, 0x7C, 0x07, 0xE0, //     ######       #####       ######    
-	0x1F, 0x80, 0xFE, 0x03, 0xF0, //    ######       #######       ######   
-	0x3F, 0x01, 0xFF, 0x01, 0xF8, //   ######       #########       ######  
-	0x3E, 0x03, 0xFF, 0x81, 0xF8, //   #####       ###########      ######  
-	0x7E, 0x07, 0xFF, 0xC0, 0xF8, //  ######      #############      #####  
-	0x7C, 0x0F, 0xFF, 0xC0, 0x7C, //  #####      ##############       ##### 
-	0x7C, 0x1F, 0xFF, 0xE0, 0x7C, //  #####     ################      ##### 
-	0x78, 0x3F, 0xFF, 0xF8, 0x7C, //  ####     ###################    ##### 
-	0xF8, 0x3F, 0xFF, 0xF8, 0x3C, // #####     ###################     #### 
-	0xF8, 0x7F, 0xFF, 0xFC, 0x3E, // #####    #####################    #####
-	0xF8, 0x7F, 0xFD, 0xFC, 0x3E, // #####    ############# #######    #####
-	0xF8, 0x7E, 0xFD, 0xFC, 0x3E, // #####    ###### ###### #######    #####
-	0xF8, 0x3C, 0xFC, 0xF8, 0x3E, // #####     ####  ######  #####     #####
-	0xF8, 0x18, 0xFC, 0x30, 0x3E, // #####      ##   ######    ##      #####
-	0xF8, 0x00, 0xFC, 0x00, 0x3E, // #####           ######            #####
-	0x78, 0x00, 0xFC, 0x00, 0x7C, //  ####           ######           ##### 
-	0x7C, 0x00, 0xFC, 0x00, 0x7C, //  #####          ######           ##### 
-	0x7C, 0x00, 0xFC, 0x00, 0x7C, //  #####          ######           ##### 
-	0x7E, 0x00, 0xFC, 0x00, 0xF8, //  ######         ######          #####  
-	0x3E, 0x00, 0xFC, 0x00, 0xF8, //   #####         ######          #####  
-	0x3F, 0x00, 0xFC, 0x01, 0xF8, //   ######        ######         ######  
-	0x1F, 0x80, 0x7C, 0x03, 0xF0, //    ######        #####        ######   
-	0x1F, 0xC0, 0x7C, 0x07, 0xE0, //    #######       #####       ######    
-	0x0F, 0xE0, 0x00, 0x0F, 0xE0, //     #######                 #######    
-	0x07, 0xF8, 0x00, 0x3F, 0xC0, //      ########             ########     
-	0x03, 0xFE, 0x00, 0xFF, 0x80, //       #########         #########      
-	0x01, 0xFF, 0xFF, 0xFF, 0x00, //        #########################       
-	0x00, 0xFF, 0xFF, 0xFC, 0x00, //         ######################         
-	0x00, 0x3F, 0xFF, 0xF8, 0x00, //           ###################          
-	0x00, 0x0F, 0xFF, 0xE0, 0x00, //             ###############            
-	0x00, 0x00, 0xFE, 0x00, 0x00, //                 #######                
-};
-
-/* 
-**  Image data for down_arrow
-*/
-
-const uint8_t up_arrowBitmaps [] =
-{
-	0x00, 0x00, 0xFE, 0x00, 0x00, //                 #######                
-	0x00, 0x0F, 0xFF, 0xE0, 0x00, //             ###############            
-	0x00, 0x3F, 0xFF, 0xF8, 0x00, //           ###################          
-	0x00, 0x7F, 0xFF, 0xFE, 0x00, //          ######################        
-	0x01, 0xFF, 0xFF, 0xFF, 0x00, //        #########################       
-	0x03, 0xFE, 0x00, 0xFF, 0x80, //       #########         #########      
-	0x07, 0xF8, 0x00, 0x3F, 0xC0, //      ########             ########     
-	0x0F, 0xE0, 0x00, 0x0F, 0xE0, //     #######                 #######    
-	0x0F, 0xC0, 0x7C, 0x07, 0xF0, //     ######       #####       #######   
-	0x1F, 0x80, 0x7C, 0x03, 0xF0, //    ######        #####        ######   
-	0x3F, 0x00, 0x7E, 0x01, 0xF8, //   ######         ######        ######  
-	0x3E, 0x00, 0x7E, 0x00, 0xF8, //   #####          ######         #####  
-	0x3E, 0x00, 0x7E, 0x00, 0xFC, //   #####          ######         ###### 
-	0x7C, 0x00, 0x7E, 0x00, 0x7C, //  #####           ######          ##### 
-	0x7C, 0x00, 0x7E, 0x00, 0x7C, //  #####           ######          ##### 
-	0x7C, 0x00, 0x7E, 0x00, 0x3C, //  #####           ######           #### 
-	0xF8, 0x00, 0x7E, 0x00, 0x3E, // #####            ######           #####
-	0xF8, 0x18, 0x7E, 0x30, 0x3E, // #####      ##    ######   ##      #####
-	0xF8, 0x3E, 0x7E, 0x78, 0x3E, // #####     #####  ######  ####     #####
-	0xF8, 0x7F, 0x7E, 0xFC, 0x3E, // #####    ####### ###### ######    #####
-	0xF8, 0x7F, 0x7F, 0xFC, 0x3E, // #####    ####### #############    #####
-	0xF8, 0x7F, 0xFF, 0xFC, 0x3E, // #####    #####################    #####
-	0x78, 0x3F, 0xFF, 0xF8, 0x3E, //  ####     ###################     #####
-	0x7C, 0x3F, 0xFF, 0xF8, 0x3C, //  #####    ###################     #### 
-	0x7C, 0x0F, 0xFF, 0xF0, 0x7C, //  #####      ################     ##### 
-	0x7C, 0x07, 0xFF, 0xE0, 0x7C, //  #####       ##############      ##### 
-	0x3E, 0x07, 0xFF, 0xC0, 0xFC, //   #####      #############      ###### 
-	0x3F, 0x03, 0xFF, 0x80, 0xF8, //   ######      ###########       #####  
-	0x3F, 0x01, 0xFF, 0x01, 0xF8, //   ######       #########       ######  
-	0x1F, 0x80, 0xFE, 0x03, 0xF0, //    ######       #######       ######   
-	0x0F, 0xC0, 0x7C, 0x07, 0xE0, //     ######       #####       ######    
-	0x0F, 0xF0, 0x00, 0x0F, 0xE0, //     ########                #######    
-	0x07, 0xF8, 0x00, 0x3F, 0xC0, //      ########             ########     
-	0x03, 0xFF, 0x01, 0xFF, 0x80, //       ##########       ##########      
-	0x01, 0xFF, 0xFF, 0xFF, 0x00, //        #########################       
-	0x00, 0x7F, 0xFF, 0xFC, 0x00, //          #####################         
-	0x00, 0x3F, 0xFF, 0xF8, 0x00, //           ###################          
-	0x00, 0x07, 0xFF, 0xC0, 0x00, //              #############             
-	0x00, 0x00, 0x7E, 0x00, 0x00, //                  ######                
-};
-
-/* 
-**  Image data for left_arrow
-*/
-
-const uint8_t left_arrowBitmaps [] =
-{
-	0x00, 0x00, 0xFE, 0x00, 0x00, //                 #######                
-	0x00, 0x0F, 0xFF, 0xE0, 0x00, //             ###############            
-	0x00, 0x3F, 0xFF, 0xF8, 0x00, //           ###################          
-	0x00, 0xFF, 0xFF, 0xFC, 0x00, //         ######################         
-	0x01, 0xFF, 0xFF, 0xFF, 0x00, //        #########################       
-	0x03, 0xFE, 0x00, 0xFF, 0x80, //       #########         #########      
-	0x07, 0xF8, 0x00, 0x3F, 0xC0, //      ########             ########     
-	0x0F, 0xE0, 0x00, 0x0F, 0xE0, //     #######                 #######    
-	0x1F, 0xC0, 0x00, 0x07, 0xE0, //    #######                   ######    
-	0x1F, 0x80, 0x1C, 0x03, 0xF0, //    ######          ###        ######   
-	0x3F, 0x00, 0x3F, 0x01, 0xF8, //   ######          ######       ######  
-	0x3E, 0x00, 0x7F, 0x80, 0xF8, //   #####          ########       #####  
-	0x7E, 0x00, 0x7F, 0xC0, 0xF8, //  ######          #########      #####  
-	0x7C, 0x00, 0x3F, 0xE0, 0x7C, //  #####            #########      ##### 
-	0x7C, 0x00, 0x1F, 0xF0, 0x7C, //  #####             #########     ##### 
-	0x78, 0x00, 0x0F, 0xF8, 0x7C, //  ####               #########    ##### 
-	0xF8, 0x3F, 0xFF, 0xFC, 0x3E, // #####     ####################    #####
-	0xF8, 0xFF, 0xFF, 0xFE, 0x3E, // #####   #######################   #####
-	0xF8, 0xFF, 0xFF, 0xFE, 0x3E, // #####   #######################   #####
-	0xF8, 0xFF, 0xFF, 0xFE, 0x3E, // #####   #######################   #####
-	0xF8, 0xFF, 0xFF, 0xFE, 0x3E, // #####   #######################   #####
-	0xF8, 0xFF, 0xFF, 0xFE, 0x3E, // #####   #######################   #####
-	0xF8, 0x00, 0x07, 0xFC, 0x3C, // #####                #########    #### 
-	0x78, 0x00, 0x1F, 0xF8, 0x7C, //  ####              ##########    ##### 
-	0x7C, 0x00, 0x3F, 0xF0, 0x7C, //  #####            ##########     ##### 
-	0x7C, 0x00, 0x3F, 0xE0, 0x7C, //  #####            #########      ##### 
-	0x7E, 0x00, 0x7F, 0x80, 0xF8, //  ######          ########       #####  
-	0x3E, 0x00, 0x7F, 0x01, 0xF8, //   #####          #######       ######  
-	0x3F, 0x00, 0x3F, 0x01, 0xF8, //   ######          ######       ######  
-	0x1F, 0x80, 0x1C, 0x03, 0xF0, //    ######          ###        ######   
-	0x0F, 0xC0, 0x00, 0x07, 0xE0, //     ######                   ######    
-	0x0F, 0xE0, 0x00, 0x1F, 0xE0, //     #######                ########    
-	0x07, 0xF8, 0x00, 0x3F, 0xC0, //      ########             ########     
-	0x03, 0xFF, 0x01, 0xFF, 0x80, //       ##########       ##########      
-	0x01, 0xFF, 0xFF, 0xFF, 0x00, //        #########################       
-	0x00, 0x7F, 0xFF, 0xFC, 0x00, //          #####################         
-	0x00, 0x3F, 0xFF, 0xF8, 0x00, //           ###################          
-	0x00, 0x07, 0xFF, 0xC0, 0x00, //              #############             
-	0x00, 0x00, 0xFC, 0x00, 0x00, //                 ######                 
-};
-
-
-/* 
-**  Image data for rxMode
-*/
-
-const uint8_t rxModeBitmaps[] =
-{
-	0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, // ################################################################################################################        ########
-	0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, // ###################################################################################################################     ########
-	0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, // ####################################################################################################################    ########
-	0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, // #####################################################################################################################   ########
-	0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, // ######################################################################################################################  ########
-	0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, // ####################################################################################################################### ########
-	0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, // ####################################################################################################################### ########
-	0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, // ####################################################################################################################### ########
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, // ################################################################################################################################
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, // ################################################################################################################################
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, // ################################################################################################################################
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, // ################################################################################################################################
-	0xFF, 0xFC, 0x07, 0xC8, 0x3F, 0x81, 0xF1, 0xE3, 0xC3, 0xF0, 0xE1, 0x0F, 0x0F, 0xFF, 0xFE, // ##############       #####  #     #######      #####   ####   ####    ######    ###    #    ####    ############################
-	0xFF, 0xF8, 0x03, 0xC0, 0x1E, 0x00, 0xF1, 0xE1, 0xC3, 0xF8, 0x63, 0x0F, 0x0F, 0xFF, 0xFE, // #############         ####         ####         ####   ####    ###    #######    ##   ##    ####    ############################
-	0xFF, 0xF9, 0xE1, 0xC1, 0x0E, 0x18, 0x71, 0xC1, 0xC3, 0xF8, 0x43, 0x8F, 0x0F, 0xFF, 0xFE, // #############  ####    ###     #    ###    ##    ###   ###     ###    #######    #    ###   ####    ############################
-	0xFF, 0xFF, 0xF1, 0xC7, 0x8C, 0x3C, 0x71, 0xC1, 0xC3, 0xFC, 0x47, 0x87, 0x0F, 0xFF, 0xFE, // ####################   ###   ####   ##    ####   ###   ###     ###    ########   #   ####    ###    ############################
-	0xFF, 0xFF, 0xF1, 0xC7, 0x8C, 0x7C, 0x71, 0xC0, 0xC3, 0xFE, 0x07, 0xC7, 0x0F, 0xFF, 0xFE, // ####################   ###   ####   ##   #####   ###   ###      ##    #########      #####   ###    ############################
-	0xFF, 0xF8, 0x01, 0xC7, 0x8C, 0x7C, 0x71, 0x88, 0xC3, 0xFE, 0x0F, 0xC3, 0x0F, 0xFF, 0xFE, // #############          ###   ####   ##   #####   ###   ##   #   ##    #########     ######    ##    ############################
-	0xFF, 0xF8, 0x01, 0xC7, 0x8C, 0x7C, 0x71, 0x88, 0x43, 0xFE, 0x0F, 0xE0, 0x0F, 0xFF, 0xFE, // #############          ###   ####   ##   #####   ###   ##   #    #    #########     #######         ############################
-	0xFF, 0xF8, 0xF1, 0xC7, 0x8C, 0x3C, 0x71, 0x0C, 0x43, 0xFC, 0x07, 0xE0, 0x0F, 0xFF, 0xFE, // #############   ####   ###   ####   ##    ####   ###   #    ##   #    ########       ######         ############################
-	0xFF, 0xF8, 0xF1, 0xC3, 0x0C, 0x38, 0x71, 0x1C, 0x43, 0xFC, 0x47, 0xC0, 0x0F, 0xFF, 0xFE, // #############   ####   ###    ##    ##    ###    ###   #   ###   #    ########   #   #####          ############################
-	0xFF, 0xFC, 0x03, 0xC0, 0x1E, 0x00, 0xF1, 0x1C, 0x43, 0xF8, 0x43, 0x87, 0x0F, 0xFF, 0xFE, // ##############        ####         ####         ####   #   ###   #    #######    #    ###    ###    ############################
-	0xFF, 0xFC, 0x07, 0xC0, 0x1E, 0x01, 0xF0, 0x3E, 0x03, 0xF8, 0xE1, 0x8F, 0x0F, 0xFF, 0xFE, // ##############       #####         ####        #####      #####       #######   ###    ##   ####    ############################
-	0xFF, 0xFF, 0x0F, 0xC4, 0x7F, 0x83, 0xF0, 0x3E, 0x03, 0xF9, 0xF3, 0x8F, 0x0F, 0xFF, 0xFE, // ################    ######   #   ########     ######      #####       #######  #####  ###   ####    ############################
-	0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xF0, 0x3E, 0x03, 0xFF, 0xFF, 0x87, 0x0F, 0xFF, 0xFE, // ##########################   #######################      #####       ###################    ###    ############################
-	0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xF0, 0x7F, 0x03, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFE, // ##########################   #######################     #######      ###################           ############################
-	0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xF0, 0x7F, 0x03, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFE, // ##########################   #######################     #######      ####################          ############################
-	0xFF, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xF9, 0xFF, 0xCF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFE, // #########################    ########################  ###########  ##########################    ##############################
-	0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, // ##########################  ####################################################################################################
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, // ################################################################################################################################
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, // ################################################################################################################################
-	0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, // ####################################################################################################################### ########
-	0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, // ####################################################################################################################### ########
-	0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, // ####################################################################################################################### ########
-	0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, // ######################################################################################################################  ########
-	0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, // ######################################################################################################################  ########
-	0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, // #####################################################################################################################   ########
-	0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, // ####################################################################################################################    ########
-};
-
-/* Bitmap sizes for rxMode */
-const uint8_t rxModeWidthPixels = 120;
-const uint8_t rxModeHeightPixels = 38;
-
-/* 
-**  Image data for txMode
-*/
-
-const uint8_t txModeBitmaps[] =
-{
-	0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, //         ###############################################################################################################        
-	0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, //      #####################################################################################################################     
-	0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, //     #######################################################################################################################    
-	0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, //    #########################################################################################################################   
-	0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, //   ###########################################################################################################################  
-	0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, //  ############################################################################################################################# 
-	0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, //  ############################################################################################################################# 
-	0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, //  ############################################################################################################################# 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, // ###############################################################################################################################
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, // ###############################################################################################################################
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, // ###############################################################################################################################
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, // ###############################################################################################################################
-	0xFF, 0xFF, 0xFC, 0x07, 0xC8, 0x3F, 0x81, 0xF1, 0xE3, 0xC3, 0xF0, 0xE1, 0xF1, 0xFF, 0xFE, // ######################       #####  #     #######      #####   ####   ####    ######    ###    #####   ########################
-	0xFF, 0xFF, 0xF8, 0x03, 0xC0, 0x1E, 0x00, 0xF1, 0xE1, 0xC3, 0xF8, 0x63, 0xF1, 0xFF, 0xFE, // #####################         ####         ####         ####   ####    ###    #######    ##   ######   ########################
-	0xFF, 0xFF, 0xF9, 0xE1, 0xC1, 0x0E, 0x18, 0x71, 0xC1, 0xC3, 0xF8, 0x43, 0xF1, 0xFF, 0xFE, // #####################  ####    ###     #    ###    ##    ###   ###     ###    #######    #    ######   ########################
-	0xFF, 0xFF, 0xFF, 0xF1, 0xC7, 0x8C, 0x3C, 0x71, 0xC1, 0xC3, 0xFC, 0x47, 0xF1, 0xFF, 0xFE, // ############################   ###   ####   ##    ####   ###   ###     ###    ########   #   #######   ########################
-	0xFF, 0xFF, 0xFF, 0xF1, 0xC7, 0x8C, 0x7C, 0x71, 0xC0, 0xC3, 0xFE, 0x07, 0xF1, 0xFF, 0xFE, // ############################   ###   ####   ##   #####   ###   ###      ##    #########      #######   ########################
-	0xFF, 0xFF, 0xF8, 0x01, 0xC7, 0x8C, 0x7C, 0x71, 0x88, 0xC3, 0xFE, 0x0F, 0xF1, 0xFF, 0xFE, // #####################          ###   ####   ##   #####   ###   ##   #   ##    #########     ########   ########################
-	0xFF, 0xFF, 0xF8, 0x01, 0xC7, 0x8C, 0x7C, 0x71, 0x88, 0x43, 0xFE, 0x0F, 0xF1, 0xFF, 0xFE, // #####################          ###   ####   ##   #####   ###   ##   #    #    #########     ########   ########################
-	0xFF, 0xFF, 0xF8, 0xF1, 0xC7, 0x8C, 0x3C, 0x71, 0x0C, 0x43, 0xFC, 0x07, 0xF1, 0xFF, 0xFE, // #####################   ####   ###   ####   ##    ####   ###   #    ##   #    ########       #######   ########################
-	0xFF, 0xFF, 0xF8, 0xF1, 0xC3, 0x0C, 0x38, 0x71, 0x1C, 0x43, 0xFC, 0x47, 0xF1, 0xFF, 0xFE, // #####################   ####   ###    ##    ##    ###    ###   #   ###   #    ########   #   #######   ########################
-	0xFF, 0xFF, 0xFC, 0x03, 0xC0, 0x1E, 0x00, 0xF1, 0x1C, 0x43, 0xF8, 0x43, 0xF1, 0xFF, 0xFE, // ######################        ####         ####         ####   #   ###   #    #######    #    ######   ########################
-	0xFF, 0xFF, 0xFC, 0x07, 0xC0, 0x1E, 0x01, 0xF0, 0x3E, 0x03, 0xF8, 0xE1, 0xF1, 0xFF, 0xFE, // ######################       #####         ####        #####      #####       #######   ###    #####   ########################
-	0xFF, 0xFF, 0xFF, 0x0F, 0xC4, 0x7F, 0x83, 0xF0, 0x3E, 0x03, 0xF9, 0xF3, 0xF1, 0xFF, 0xFE, // ########################    ######   #   ########     ######      #####       #######  #####  ######   ########################
-	0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xF0, 0x3E, 0x03, 0xFF, 0xFF, 0xE1, 0xDF, 0xFE, // ##################################   #######################      #####       #####################    ### ####################
-	0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xF0, 0x7F, 0x03, 0xFF, 0xFE, 0x00, 0x1F, 0xFE, // ##################################   #######################     #######      #################            ####################
-	0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xF0, 0x7F, 0x03, 0xFF, 0xFE, 0x00, 0x1F, 0xFE, // ##################################   #######################     #######      #################            ####################
-	0xFF, 0xFF, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xF9, 0xFF, 0xCF, 0xFF, 0xFF, 0x00, 0x3F, 0xFE, // #################################    ########################  ###########  ####################          #####################
-	0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, // ##################################  ###########################################################################################
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, // ###############################################################################################################################
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, // ###############################################################################################################################
-	0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, //  ############################################################################################################################# 
-	0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, //  ############################################################################################################################# 
-	0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, //  ############################################################################################################################# 
-	0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, //   ###########################################################################################################################  
-	0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, //   ###########################################################################################################################  
-	0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, //    #########################################################################################################################   
-	0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, //     #######################################################################################################################    
-};
-
-/* Bitmap sizes for txMode */
-const uint8_t txModeWidthPixels = 119;
-const uint8_t txModeHeightPixels = 38;
-
-const uint8_t config2Bitmaps[] =
-{
-	 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, // #############################################################################################   ########
-	 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, // ##############################################################################################  ########
-	 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, // ############################################################################################### ########
-	 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, // ########################################################################################################
-	 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, // ########################################################################################################
-	 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, // ########################################################################################################
-	 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, // ########################################################################################################
-	 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, // ########################################################################################################
-	 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, // ##############        ##################################################################################
-	 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, // #############          #################################################################################
-	 0xFF, 0xF0, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, // ############    ####   #################################################################################
-	 0xFF, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, // ############   #####   #################################################################################
-	 0xFF, 0xF0, 0x03, 0x8F, 0x1E, 0x3C, 0x7C, 0x0F, 0x80, 0xFF, 0xFE, // ############          ###   ####   ####   ####   #####      #####       ################################
-	 0xFF, 0xF8, 0x03, 0x8F, 0x1E, 0x3C, 0x70, 0x07, 0x00, 0x7F, 0xFE, // #############         ###   ####   ####   ####   ###         ###         ###############################
-	 0xFF, 0xFE, 0x03, 0x8F, 0x1E, 0x3C, 0x70, 0xC3, 0x00, 0x3F, 0xFE, // ###############       ###   ####   ####   ####   ###    ##    ##          ##############################
-	 0xFF, 0xFF, 0xF3, 0x8F, 0x1E, 0x3C, 0x61, 0xE3, 0x7E, 0x1F, 0xFE, // ####################  ###   ####   ####   ####   ##    ####   ## ######    #############################
-	 0xFF, 0xFE, 0x03, 0x8F, 0x1E, 0x3C, 0x63, 0xE3, 0xFE, 0x1F, 0xFE, // ###############       ###   ####   ####   ####   ##   #####   #########    #############################
-	 0xFF, 0xFC, 0x03, 0x8F, 0x1E, 0x3C, 0x63, 0xE3, 0xFF, 0x1F, 0xFE, // ##############        ###   ####   ####   ####   ##   #####   ##########   #############################
-	 0xFF, 0xF8, 0x63, 0x8F, 0x1E, 0x3C, 0x63, 0xE3, 0xFF, 0x1F, 0xFE, // #############    ##   ###   ####   ####   ####   ##   #####   ##########   #############################
-	 0xFF, 0xF8, 0xE3, 0x8F, 0x1E, 0x38, 0x61, 0xE3, 0xFF, 0x1F, 0xFE, // #############   ###   ###   ####   ####   ###    ##    ####   ##########   #############################
-	 0xFF, 0xFC, 0xE3, 0x8F, 0x1E, 0x30, 0x61, 0xC3, 0xFF, 0x1F, 0xFE, // ##############  ###   ###   ####   ####   ##     ##    ###    ##########   #############################
-	 0xFF, 0xF0, 0x03, 0x8C, 0x06, 0x00, 0x70, 0x07, 0xFF, 0x1F, 0xFE, // ############          ###   ##       ##          ###         ###########   #############################
-	 0xFF, 0xF0, 0x07, 0x08, 0x06, 0x04, 0x70, 0x0F, 0xFE, 0x1F, 0xFE, // ############         ###    #        ##      #   ###        ###########    #############################
-	 0xFF, 0xF8, 0x1F, 0x9D, 0x0F, 0x8C, 0xFC, 0x1F, 0xFE, 0x1F, 0xFE, // #############      ######  ### #    #####   ##  ######     ############    #############################
-	 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0x38, 0x3F, 0xFE, // ################################   #############################  ###     ##############################
-	 0xFF, 0xFF, 0xFF, 0x8F, 0x1F, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFE, // #########################   ####   #############################         ###############################
-	 0xFF, 0xFF, 0xFF, 0x08, 0x1F, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFE, // ########################    #      #############################        ################################
-	 0xFF, 0xFF, 0xFF, 0x08, 0x3F, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFE, // ########################    #     ################################    ##################################
-	 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, // ##############################   #######################################################################
-	 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, // ########################################################################################################
-	 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, // ########################################################################################################
-	 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, // ########################################################################################################
-	 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, // ########################################################################################################
-	 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, // ########################################################################################################
-	 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, // ########################################################################################################
-	 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, // ############################################################################################### ########
-	 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, // ############################################################################################### ########
-	 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, // ##############################################################################################  ########
-};
-
-/* Bitmap sizes for config2 */
-const uint8_t config2WidthPixels = 88;
-const uint8_t config2HeightPixels = 38;
-
-/* 
-**  Image data for bucky2
-*/
-
-const uint8_t bucky2Bitmaps[] =
-{
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //                                                                                ######################                                                                                                               
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //                                                                           #################################                                                                                                         
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //                                                                        ########################################                                                                                                     
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //                                                                     ###############################################                                                                                                 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //                                                                   ###################################################                                                                                               
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //                                                                 ####################### ################################                                                                                            
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x1C, 0x79, 0xEF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //                                                                #################   ###   ####  #### ######################                                                                                          
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xEF, 0x1E, 0x79, 0xC7, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //                                                              ############## ####   ####  ####  ###   #######################                                                                                        
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xE7, 0x9E, 0x79, 0xC7, 0x9F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //                                                             ###############  ####  ####  ####  ###   ####  ###################                                                                                      
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0xE3, 0x8E, 0x71, 0xC7, 0x1C, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //                                                             ########## ####   ###   ###  ###   ###   ###   ###  ###############                                                                                     
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0xF3, 0x8E, 0x71, 0xC7, 0x3C, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //                                                            ##########   ####  ###   ###  ###   ###   ###  ####  ################                                                                                    
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xBC, 0xF3, 0x9F, 0xFB, 0xCF, 0x3C, 0xF3, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //                                                            ###### ####  ####  ###  ########## ####  ####  ####  ####  ###########                                                                                   
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1C, 0x73, 0xFF, 0xFF, 0xCE, 0x3C, 0xE3, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //                                                            #####   ###   ###  ####################  ###   ####  ###   ###########                                                                                   
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x9E, 0x7B, 0xFF, 0xFF, 0xCE, 0x38, 0xE3, 0x8F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //                                                            ######  ####  #### ####################  ###   ###   ###   ###   ######                                                                                  
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x8E, 0x3F, 0xF8, 0x0F, 0xFE, 0x38, 0xE7, 0x9F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //                                                            ######   ###   ###########       ###########   ###   ###  ####  #######                                                                                  
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xCE, 0x3F, 0xE0, 0x01, 0xFE, 0x39, 0xE7, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //                                                            #######  ###   #########            ########   ###  ####  ###   #######                                                                                  
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC7, 0x7F, 0xE0, 0x00, 0x7F, 0xF9, 0xC7, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //                                                            #######   ### ##########              ############  ###   ###  ########                                                                                  
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC7, 0xF1, 0xF0, 0x00, 0x3F, 0xF9, 0xC7, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //                                                            #######   #######   #####              ###########  ###   ###  #######                                                                                   
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE7, 0xE0, 0x7C, 0x00, 0x1F, 0xF9, 0xCF, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //                                                             #######  ######      #####             ##########  ###  ####  #######                                                                                   
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE7, 0xE0, 0x3F, 0x00, 0x3C, 0xFD, 0xCE, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //                                                              ######  ######       ######          ####  ###### ###  ###   #######                                                                                   
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE7, 0xE0, 0x07, 0xF8, 0x20, 0x3D, 0xCE, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //                                                             #######  ######          ########     #       #### ###  ###  #######                                                                                    
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE3, 0xE0, 0xC1, 0xE0, 0x00, 0x1F, 0xCE, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //                                                             #######   #####     ##     ####                #######  ###  #######                                                                                    
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE3, 0xE0, 0xF0, 0x00, 0x00, 0x1F, 0xFE, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //                                                             #######   #####     ####                       ############  #######                                                                                    
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF3, 0xF0, 0xFE, 0x01, 0xF8, 0x1F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //                                                             ########  ######    #######        ######      #####################                                                                                    
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF7, 0xF8, 0x3F, 0xFF, 0xFC, 0x1B, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //                                                             ######## ########     ####################     ## #######################                                                                               
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x1F, 0xFF, 0xF8, 0x18, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //                                                              ################      ##################      ##       ######################                                                                          
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x03, 0xFF, 0xF0, 0x30, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //                                                              ################         ##############      ##                #################                                                                       
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x38, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //                                                         ###############   ###             ######                                  ##########                                                                        
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //                                                     ################      ###                                                           ######                                                                      
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x18, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //                                                   ##############           ##         #####                                             #########                                                                   
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x18, 0x0F, 0xFC, 0x00, 0x00, 0x30, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //                                                 ###########                ##       ##########                    ##                    ###########                                                                 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x0C, 0x1F, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //                                                #######                      ##     #############                    ########                ##########                                                              
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x04, 0x1F, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //                                                #####                         #     ##############                      #########               #########                                                            
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x08, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //                                                 ####                #             #################                      ###########             #########                                                          
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x60, 0x00, 0x73, 0x1D, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //                                               #######            ##              ###  ##   ### ######                      #############            ########                                                        
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x03, 0xC0, 0x03, 0xF2, 0x09, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xE0, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //                                              #######          ####            ######  #     #  ###############               ##############           ########                                                      
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x0F, 0x80, 0x1F, 0xF8, 0x01, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //                                             ######          #####          ##########          #################               ###############           ######                                                     
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x7F, 0x00, 0x7F, 0xF8, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //                                           ######         #######         ############         ####################               ###############           #####                                                    
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x01, 0xFC, 0x00, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xC0, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //                                          ######        #######          ################     ######################               ################        #####                                                     
-	0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x07, 0xFC, 0x00, 0x93, 0xFF, 0xFF, 0xFF, 0xFE, 0x20, 0x00, 0x0F, 0xFF, 0xF0, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //                                         #####        #########          #  #  #################################   #                 ################     ######                                                     
-	0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x1F, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //                                        #####       ##########                 ###############################                        ###############      ######                                                    
-	0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x3F, 0xF0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //                                       #####       ##########                     #########################                            #############        ######                                                   
-	0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //                                      #####      ###########                        ###################                                  ############         #####                                                  
-	0x00, 0x00, 0x00, 0x00, 0x0F, 0x81, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //                                     #####      ###########                         ####################                                  ############         ######                                                
-	0x00, 0x00, 0x00, 0x00, 0x0F, 0x81, 0xFF, 0xC0, 0x00, 0x70, 0x0F, 0xFF, 0xF8, 0x00, 0x3C, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //                                     #####      ###########               ###        #################             ####                    #############         #####                                               
-	0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0xFF, 0x80, 0x01, 0xFC, 0x00, 0xFF, 0xE0, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //                                      ######     #########              #######          ###########              ######                   ###############        #####                                              
-	0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0xFF, 0x80, 0x01, 0xFE, 0x00, 0x09, 0x01, 0xC0, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //                                      #####      #########              ########             #  #       ###      ########                   ###############        #####                                             
-	0x00, 0x00, 0x00, 0x00, 0x07, 0x81, 0xFF, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x07, 0xF0, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xE0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //                                      ####      #########              #########                      #######    #########                   ###############        #####                                            
-	0x00, 0x00, 0x00, 0x00, 0x0F, 0x03, 0xFF, 0x00, 0x03, 0xFE, 0x3E, 0x00, 0x0F, 0xF8, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xF0, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, //                                     ####      ##########              #########   #####             #########   #########                   ################        #####                                           
-	0x00, 0x00, 0x00, 0x00, 0x1F, 0x07, 0xFF, 0x00, 0x03, 0xFE, 0xFF, 0x00, 0x1F, 0xFE, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xF8, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, //                                    #####     ###########              ######### ########           ############ #########                    ################        ####                                           
-	0x00, 0x00, 0x00, 0x00, 0x1E, 0x0F, 0xFF, 0x00, 0x01, 0xDD, 0xFF, 0x80, 0x1F, 0xFF, 0x77, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, //                                    ####     ############               ### ### ##########          ############# ### ###                     ################        #####                                          
-	0x00, 0x00, 0x00, 0x00, 0x3C, 0x1F, 0xFE, 0x00, 0x01, 0xDB, 0xFF, 0xC0, 0x18, 0x3F, 0xA7, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, //                                   ####     ############                ### ## ############         ##     ####### #  ###                      ##############        #####                                           
-	0x00, 0x00, 0x00, 0x00, 0x78, 0x1F, 0xFE, 0x00, 0x00, 0xCF, 0xF0, 0xC0, 0x10, 0x0F, 0xC6, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //                                  ####      ############                 ##  ########    ##         #        ######   ##                       ##############      ######                                            
-	0x30, 0x00, 0x00, 0x00, 0x78, 0x3F, 0xFE, 0x00, 0x00, 0x07, 0xE2, 0x40, 0x03, 0xC7, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //   ##                             ####     #############                      ######   #  #            ####   ######                           #############      ######                                             
-	0x3E, 0x00, 0x00, 0x00, 0xF0, 0x3F, 0xFF, 0x00, 0x00, 0x0F, 0xCF, 0x00, 0x07, 0xF3, 0xF0, 0x00, 0x40, 0x03, 0xFF, 0xC0, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //   #####                         ####      ##############                    ######  ####             #######  ######             #            ############      ######                                              
-	0x3F, 0x80, 0x00, 0x00, 0xF8, 0x0F, 0xFF, 0x00, 0x10, 0x1F, 0x9F, 0x00, 0x03, 0xF9, 0xF8, 0x00, 0xC0, 0x01, 0xFF, 0x80, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, //   #######                       #####       ############           #       ######  #####              #######  ######           ##             ##########        #####                                     #        
-	0x3F, 0xF0, 0x00, 0x00, 0x7C, 0x07, 0xFF, 0x00, 0x10, 0x3F, 0x3F, 0x00, 0x03, 0xFC, 0xFE, 0x01, 0x80, 0x01, 0xFF, 0xC0, 0x3E, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, //   ##########                     #####       ###########           #      ######  ######              ########  #######        ##              ###########        #####                                 ####        
-	0x3F, 0xFE, 0x00, 0x00, 0x3E, 0x01, 0xFF, 0x00, 0x18, 0x7E, 0x7F, 0x80, 0x03, 0xFE, 0x7F, 0xEF, 0x80, 0x01, 0xFF, 0xE0, 0x1F, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, //   #############                   #####        #########           ##    ######  ########             #########  ########## #####              ############        #####                             ########       
-	0x38, 0xFF, 0x80, 0x00, 0x1F, 0x00, 0xFF, 0x80, 0x1F, 0xFC, 0xFF, 0x80, 0x03, 0xFF, 0x3F, 0xFF, 0x80, 0x01, 0xFF, 0xC0, 0x3E, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, //   ###   #########                  #####        #########          ###########  #########             ##########  ###############              ###########        #####                            ##########       
-	0x38, 0x3F, 0xF0, 0x00, 0x0F, 0xC0, 0x3F, 0x80, 0x1F, 0xF8, 0xFF, 0x80, 0x03, 0xFF, 0x8F, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, //   ###     ##########                ######        #######          ##########   #########             ###########   #############             ##########        ######                          #############       
-	0x38, 0x07, 0xFE, 0x00, 0x07, 0xE0, 0x0F, 0xC0, 0x0F, 0xF1, 0xFF, 0x80, 0x01, 0xFF, 0xC7, 0xFF, 0x00, 0x03, 0xFE, 0x01, 0xF8, 0x00, 0x00, 0x07, 0xFE, 0x38, 0x00, //   ###        ##########              ######         ######          ########   ##########              ###########   ###########              #########        ######                        ##########   ###       
-	0x38, 0x00, 0xFF, 0xC0, 0x01, 0xF8, 0x07, 0xC0, 0x07, 0xC1, 0xFF, 0x80, 0x01, 0xFF, 0xE3, 0xFE, 0x00, 0x03, 0xFC, 0x03, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x38, 0x00, //   ###           ##########             ######        #####           #####     ##########              ############   #########               ########        #####                       ##########      ###       
-	0x38, 0x18, 0x1F, 0xFC, 0x00, 0xFE, 0x07, 0xE0, 0x00, 0x03, 0xFF, 0xC0, 0x01, 0xFF, 0xF0, 0x38, 0x00, 0x03, 0xF0, 0x07, 0xC0, 0x00, 0x03, 0xFF, 0x80, 0x38, 0x00, //   ###      ##      ###########          #######      ######                   ############             #############      ###                 ######         #####                    ###########         ###       
-	0x38, 0x7E, 0x07, 0xFF, 0x80, 0x3E, 0x0F, 0xF0, 0x00, 0x03, 0xFF, 0xC0, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x07, 0xC0, 0x03, 0xC0, 0x00, 0x1F, 0xFE, 0x01, 0x3C, 0x00, //   ###    ######      ############         #####     ########                  ############             ###############                       #####            ####                 ############        #  ####      
-	0x38, 0x3F, 0x80, 0xFF, 0xF0, 0x3C, 0x03, 0xF8, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x07, 0x80, 0x01, 0xE0, 0x00, 0xFF, 0xF0, 0x07, 0x3C, 0x00, //   ###     #######       ############      ####        #######                #############              ###############                      ####              ####             ############         ###  ####      
-	0x38, 0x3F, 0xF0, 0x1F, 0xFF, 0x7F, 0x00, 0x7C, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x0E, 0x00, 0x61, 0xE0, 0x0F, 0xFF, 0x80, 0x3F, 0x1C, 0x00, //   ###     ##########       ############# #######         #####              ###############             #################                   ###          ##    ####         #############         ######   ###      
-	0x38, 0x3F, 0xF0, 0x01, 0xFF, 0x3F, 0xC0, 0x1F, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x08, 0x00, 0xE0, 0xF0, 0xFF, 0xFC, 0x00, 0xFF, 0x1C, 0x00, //   ###     ##########           #########  ########         #####            ###############             ##################                  #           ###     ####    ##############          ########   ###      
-	0x38, 0x3F, 0xF0, 0x80, 0x3F, 0x0F, 0xF8, 0x01, 0x80, 0x1F, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x00, 0x03, 0xF0, 0x71, 0xFF, 0xC0, 0x01, 0xFF, 0x1C, 0x00, //   ###     ##########    #         ######    #########          ##          ################              ####################                         ######     ###   ###########             #########   ###      
-	0x38, 0x3F, 0xF1, 0xE0, 0x07, 0x03, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xF8, 0x79, 0xFC, 0x00, 0x03, 0xFF, 0x1E, 0x00, //   ###     ##########   ####          ###      #########                   ##################             ######################                     #########    ####  #######                ##########   ####     
-	0x38, 0x3F, 0xF9, 0xFC, 0x07, 0x00, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xF8, 0x39, 0xE0, 0x01, 0xC3, 0xFF, 0x9E, 0x00, //   ###     ###########  #######       ###        #######                 ####################              ########################                    #######     ###  ####            ###    ###########  ####     
-	0x38, 0x3F, 0xF9, 0xFF, 0x87, 0x80, 0x1E, 0x38, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x78, 0x3D, 0xE0, 0x0F, 0xC3, 0xFF, 0x8E, 0x00, //   ###     ###########  ##########    ####          ####   ###          ######################             ###################################            ####     #### ####         ######    ###########   ###     
-	0x38, 0x3F, 0xF9, 0xFF, 0x87, 0xF8, 0x3C, 0x7E, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x3C, 0x3D, 0xE0, 0x7F, 0xC3, 0xFF, 0x8E, 0x00, //   ###     ###########  ##########    ########     ####   ######      ########################              #######################################        ####    #### ####      #########    ###########   ###     
-	0x38, 0x3F, 0xFD, 0xFF, 0x87, 0xFF, 0x3C, 0xFC, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1C, 0x1F, 0xE0, 0x7F, 0xC3, 0xFF, 0x8E, 0x00, //   ###     ############ ##########    ###########  ####  ######     ###########################             ##########################################      ###     ########      #########    ###########   ###     
-	0x38, 0x3F, 0xFD, 0xFF, 0x81, 0xFF, 0xF8, 0xF0, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C, 0x1F, 0xE0, 0xFF, 0xC3, 0xFF, 0x8F, 0x00, //   ###     ############ ##########      ##############   ####    ##############################              ############################################    ##     ########     ##########    ###########   ####    
-	0x38, 0x3F, 0xFD, 0xFF, 0x88, 0x3F, 0xF8, 0xE1, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC4, 0x1F, 0xC0, 0xFF, 0xE7, 0xFF, 0xCF, 0x00, //   ###     ############ ##########   #     ###########   ###    ################################              #############################################   #     #######      ###########  #############  ####    
-	0x38, 0x3F, 0xFE, 0xFF, 0x8F, 0x01, 0xF8, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x1E, 0x00, 0xFF, 0xE7, 0xFF, 0xCF, 0x00, //   ###     ############# #########   ####       ######   ##   ###################################             ###############################################       ####         ###########  #############  ####    
-	0x38, 0x3F, 0xFE, 0xFF, 0x9F, 0xE0, 0x70, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFE, 0x01, 0xFF, 0xF8, 0x1E, 0x00, 0xFF, 0xE7, 0xFF, 0xC7, 0x00, //   ###     ############# #########  ########      ###    #   #####################################             #########################        ##############      ####         ###########  #############   ###    
-	0x38, 0x3F, 0xFE, 0xFF, 0x1F, 0xFC, 0x71, 0x1F, 0xFF, 0x80, 0xE7, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0x10, 0x00, 0x0F, 0xFC, 0x1F, 0xC1, 0xFF, 0xE7, 0xFF, 0xC7, 0x00, //   ###     ############# ########   ###########   ###   #   ##############       ###  ############              #################   #                ##########     #######     ############  #############   ###    
-	0x38, 0x3F, 0xFF, 0xFF, 0x1F, 0xFC, 0x70, 0x3F, 0xFE, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0xFF, 0x7C, 0x00, 0x00, 0x03, 0xFE, 0x1F, 0xC1, 0xFF, 0xE7, 0xFF, 0xC7, 0x00, //   ###     ######################   ###########   ###      #############                ###########              ######## #####                        #########    #######     ############  #############   ###    
-	0x38, 0x3F, 0xFF, 0xFF, 0x1F, 0xFC, 0x70, 0x3F, 0xF0, 0x3F, 0x00, 0x39, 0xE0, 0x00, 0xFC, 0x70, 0x1F, 0xFF, 0xC0, 0x3E, 0x1F, 0xC1, 0xFF, 0xE7, 0xFF, 0xC7, 0x80, //   ###     ######################   ###########   ###      ##########      ######          ###  ####             ######   ###       ###############        #####    #######     ############  #############   ####   
-	0x38, 0x3F, 0xFF, 0xFF, 0x1F, 0xFC, 0x70, 0x7F, 0x81, 0xFF, 0xF8, 0x00, 0x30, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xC1, 0xFF, 0xF7, 0xFF, 0xE7, 0x80, //   ###     ######################   ###########   ###     ########      ##############             ##                            #####################             ########     ############# ##############  ####   
-	0x38, 0x3F, 0xFF, 0xFF, 0x1F, 0xFC, 0x70, 0x7C, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xC1, 0xFF, 0xF7, 0xFF, 0xE3, 0x80, //   ###     ######################   ###########   ###     #####       ###################                                    ############################        ##########     ############# ##############   ###   
-	0x38, 0x3F, 0xFF, 0xFF, 0x1F, 0xFC, 0xF8, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xFF, 0xE3, 0x80, //   ###     ######################   ###########  #####              ##########################                          ##############          ###########################     ############################   ###   
-	0x38, 0x3F, 0xFF, 0xFF, 0x0F, 0xFD, 0xFE, 0x00, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0xFF, 0xE3, 0x80, //   ###     ######################    ########## ########         #############     ################################################            ###########################      ############################   ###   
-	0x38, 0x3F, 0xFF, 0xFF, 0x0F, 0xF9, 0xFF, 0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0xFF, 0xE3, 0xC0, //   ###     ######################    #########  ################################    ################################################          ############################      ############################   ####  
-	0x38, 0x3F, 0xFF, 0xFF, 0x0F, 0xF9, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xFF, 0xE3, 0xE0, //   ###     ######################    #########  ################################   ###################################################      ##############################     #############################   ##### 
-	0x78, 0x3F, 0xFF, 0xFF, 0x0F, 0xFB, 0xFF, 0xFF, 0xF7, 0xFF, 0x3F, 0xF0, 0xFF, 0xFF, 0xE7, 0xFF, 0xFC, 0x3F, 0xFF, 0xF9, 0xFF, 0x83, 0xFF, 0xFF, 0xFF, 0xE1, 0xF0, //  ####     ######################    ######### ###################### ###########  ##########    ###################  #################    ###################  ##########     #############################    #####
-	0xF8, 0x3F, 0xFF, 0xFF, 0x0F, 0xFB, 0xFF, 0x7F, 0xF7, 0xFF, 0x3F, 0xF0, 0xFF, 0xFF, 0x0F, 0xFF, 0xFE, 0x3F, 0xFF, 0xF9, 0xFF, 0x83, 0xFF, 0xFF, 0xFF, 0xF0, 0xF0, // #####     ######################    ######### ########## ########### ###########  ##########    ################    ###################   ###################  ##########     ##############################    ####
-	0xF8, 0x3F, 0xFF, 0xFF, 0x0F, 0xFB, 0xFF, 0x3F, 0xF7, 0xFF, 0x3F, 0xF3, 0xFF, 0xFF, 0x1F, 0xFF, 0xFE, 0x7F, 0xFF, 0xF9, 0xFF, 0x83, 0xFF, 0xFF, 0x7F, 0xF0, 0x70, // #####     ######################    ######### ##########  ########## ###########  ##########  ##################   ####################  ####################  ##########     ################## ###########     ###
-	0xE0, 0x3F, 0xFF, 0xFF, 0x0F, 0xFB, 0xFF, 0x3F, 0xF7, 0xFF, 0xBF, 0xF3, 0xFF, 0xFF, 0xBF, 0xFF, 0xFE, 0x7F, 0xDF, 0xF9, 0xFF, 0x83, 0xFF, 0xFF, 0x7F, 0xF0, 0x70, // ###       ######################    ######### ##########  ########## ############ ##########  ################### #####################  ######### ##########  ##########     ################## ###########     ###
-	0xE0, 0x7F, 0xFF, 0xFF, 0x0F, 0xFB, 0xFF, 0x3F, 0xF7, 0xFF, 0xBF, 0xF7, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xCF, 0xF9, 0xFF, 0x83, 0xFF, 0xFF, 0x7F, 0xF8, 0x70, // ###      #######################    ######### ##########  ########## ############ ########## ##################### ###############################  #########  ##########     ################## ############    ###
-	0xE0, 0x7F, 0xDF, 0xFF, 0x0F, 0xFB, 0xFF, 0xBF, 0xF7, 0xFF, 0xDF, 0xEF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xCF, 0xF9, 0xFF, 0x87, 0xFF, 0xFF, 0x7F, 0xF8, 0x70, // ###      ######### #############    ######### ########### ########## ############# ######## ###################### ###############################  #########  ##########    ################### ############    ###
-	0xE0, 0x7F, 0xDF, 0xFF, 0x0F, 0xF9, 0xFF, 0xFF, 0xF7, 0xFF, 0xDF, 0xEF, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xCF, 0xF1, 0xFF, 0x87, 0xF7, 0xFF, 0x7F, 0xF8, 0x70, // ###      ######### #############    #########  ##################### ############# ######## ################################  ####################  ########   ##########    ####### ########### ############    ###
-	0xE0, 0x7F, 0xDF, 0xFF, 0x0F, 0xF9, 0xFF, 0xF3, 0xC7, 0xFF, 0xDF, 0xEF, 0xFC, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xCC, 0x01, 0xFF, 0x87, 0xF7, 0xFF, 0x7F, 0xF8, 0x70, // ###      ######### #############    #########  #############  ####   ############# ######## ##########  ####################  ####################  ##         ##########    ####### ########### ############    ###
-	0xE0, 0x7F, 0xEF, 0xFF, 0x0F, 0xF9, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xEF, 0xFC, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0x87, 0xF3, 0xFF, 0x3F, 0xF8, 0x70, // ###      ########## ############    #########  ###############       ###################### ##########  ####################  ######################           ##########    #######  ##########  ###########    ###
-	0xE0, 0x7F, 0xEF, 0xFF, 0x0F, 0xF8, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xEF, 0xFC, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0x81, 0xFF, 0x87, 0xF3, 0xFF, 0x7F, 0xF8, 0x70, // ###      ########## ############    #########   ################     ###################### ##########  ####################  ###########################      ##########    #######  ########## ############    ###
-	0xE0, 0x7F, 0xEF, 0xFF, 0x0F, 0xF8, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xEF, 0xFC, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xE1, 0xFF, 0x87, 0xF3, 0xFF, 0x7F, 0xF8, 0x70, // ###      ########## ############    #########   #################    ###################### ##########  ####################  #############################    ##########    #######  ########## ############    ###
-	0xE0, 0x7F, 0xEF, 0xFF, 0x0F, 0xF8, 0x7F, 0xFF, 0xC7, 0xFF, 0xFF, 0xEF, 0xFC, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0x8F, 0xF3, 0xFF, 0x7F, 0xF0, 0x70, // ###      ########## ############    #########    #################   ###################### ##########  ####################  ##############################   ##########   ########  ########## ###########     ###
-	0xE0, 0x1F, 0xE7, 0xFF, 0x8F, 0xF8, 0x1F, 0xFF, 0xC7, 0xFF, 0xFF, 0xEF, 0xFC, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0x8F, 0xF3, 0xFF, 0x7F, 0xC0, 0x70, // ###        ########  ############   #########      ###############   ###################### ##########  ###################   ###############################  ##########   ########  ########## #########       ###
-	0xF0, 0x07, 0xE7, 0xFF, 0x8F, 0xF8, 0x0F, 0xFF, 0xE7, 0xFF, 0xFF, 0xEF, 0xFC, 0xFF, 0xFE, 0x03, 0xFF, 0x7F, 0xFF, 0xF9, 0xFF, 0x8F, 0xFB, 0xFF, 0x7F, 0x00, 0xF0, // ####         ######  ############   #########       ###############  ###################### ##########  ###############       ########## ####################  ##########   ######### ########## #######        ####
-	0xFC, 0x01, 0xE7, 0xFF, 0x9F, 0xF8, 0xF7, 0xFF, 0xE7, 0xFF, 0xFF, 0xEF, 0xFC, 0xFF, 0xC0, 0x03, 0xFF, 0x7F, 0xFF, 0xFD, 0xFF, 0x8F, 0xFB, 0xFF, 0x78, 0x03, 0xF0, // ######         ####  ############  ##########   #### ##############  ###################### ##########  ##########            ########## ##################### ##########   ######### ########## ####         ######
-	0xFF, 0x80, 0x07, 0xFF, 0x9F, 0xF9, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xEF, 0xFC, 0xFF, 0xC0, 0x03, 0xFF, 0x3F, 0xFF, 0xFD, 0xFF, 0x8F, 0xFB, 0xFF, 0x60, 0x1F, 0xF0, // #########            ############  ##########  ##################### ###################### ##########  ##########            ##########  #################### ##########   ######### ########## ##        #########
-	0x3F, 0xF0, 0x03, 0xFF, 0x9F, 0xFD, 0xFF, 0x7F, 0xF7, 0xFF, 0xFF, 0xEF, 0xFC, 0xFF, 0xC0, 0x03, 0xFF, 0x1F, 0xFF, 0xFD, 0xFF, 0x9F, 0xFB, 0xFE, 0x00, 0xFF, 0xC0, //   ##########          ###########  ########### ######### ########### ###################### ##########  ##########            ##########   ################### ##########  ########## #########         ##########  
-	0x07, 0xFC, 0x01, 0xFF, 0x9F, 0xFD, 0xFF, 0x3F, 0xF7, 0xFF, 0xFF, 0xEF, 0xFC, 0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x7F, 0xFD, 0xFF, 0xDF, 0xFB, 0xFC, 0x03, 0xFE, 0x00, //      #########         ##########  ########### #########  ########## ###################### ##########  ##########            ##########         ############# ########### ########## ########        #########     
-	0x01, 0xFF, 0x80, 0x3F, 0x9F, 0xFD, 0xFF, 0x3F, 0xF7, 0xFF, 0xFF, 0xEF, 0xFC, 0xFF, 0xC0, 0x03, 0xFF, 0x01, 0xDF, 0xFD, 0xFF, 0xFF, 0xFB, 0xE0, 0x1F, 0xF8, 0x00, //        ##########         #######  ########### #########  ########## ###################### ##########  ##########            ##########       ### ########### ###################### #####        ##########       
-	0x00, 0x3F, 0xF0, 0x0F, 0x9F, 0xFD, 0xFF, 0xBF, 0xF7, 0xFF, 0xFF, 0xEF, 0xFC, 0xFF, 0xCF, 0xF3, 0xFF, 0x7F, 0xCF, 0xFD, 0xFF, 0xFF, 0xFB, 0x00, 0xFF, 0xC0, 0x00, //           ##########        #####  ########### ########## ########## ###################### ##########  ##########  ########  ########## #########  ########## ###################### ##        ##########          
-	0x00, 0x07, 0xFC, 0x00, 0x1F, 0xFD, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xEF, 0xFC, 0xFF, 0xDF, 0xF3, 0xFF, 0x7F, 0xCF, 0xF9, 0xFF, 0xFF, 0xF0, 0x03, 0xFE, 0x00, 0x00, //              #########             ########### ##################### ###################### ##########  ########## #########  ########## #########  #########  #####################          #########             
-	0x00, 0x01, 0xFF, 0x80, 0x1F, 0xFD, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xEF, 0xFC, 0xFF, 0xFF, 0xF3, 0xFF, 0x7F, 0xCF, 0xFB, 0xFF, 0xFF, 0xC0, 0x3F, 0xF8, 0x00, 0x00, //                ##########          ########### ##################### ###################### ##########  ####################  ########## #########  ######### ####################        ###########               
-	0x00, 0x00, 0x3F, 0xC0, 0x03, 0xFD, 0xFF, 0xFF, 0xF7, 0xFB, 0xFF, 0xEF, 0xFC, 0xFF, 0xFF, 0xF3, 0xFF, 0x7F, 0xFF, 0xFB, 0xFF, 0xFE, 0x00, 0x7F, 0xC0, 0x00, 0x00, //                   ########            ######## ##################### ######## ############# ##########  ####################  ########## #################### #################          #########                  
-	0x00, 0x00, 0x07, 0xC0, 0x00, 0x38, 0xFF, 0xFF, 0xF7, 0xFD, 0xFF, 0xEF, 0xFC, 0xFF, 0xFF, 0xF3, 0xFF, 0x7F, 0xFF, 0xF3, 0xFF, 0xA0, 0x30, 0x7E, 0x00, 0x00, 0x00, //                      #####                ###   #################### ######### ############ ##########  ####################  ########## ###################  ########### #       ##     ######                     
-	0x00, 0x00, 0x01, 0xC0, 0x18, 0x00, 0x3F, 0xFF, 0xEF, 0xFD, 0xFF, 0xEF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xF3, 0xFE, 0x03, 0xFC, 0x70, 0x00, 0x00, 0x00, //                        ###         ##             ################# ########## ############ ########### ###############################  ###################  #########       ########   ###                        
-	0x00, 0x00, 0x01, 0xC2, 0x1F, 0x00, 0x1F, 0xFF, 0xCF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFE, 0xFF, 0xFF, 0xE3, 0xE0, 0x0F, 0xFC, 0x70, 0x00, 0x00, 0x00, //                        ###    #    #####           ###############  ########## ################################### #################### ###################   #####         ##########   ###                        
-	0x00, 0x00, 0x01, 0xC3, 0xDE, 0x00, 0x07, 0xFF, 0x8F, 0xFC, 0xFF, 0xF7, 0xFF, 0xFF, 0xDF, 0xFF, 0xFE, 0xFF, 0xFF, 0x82, 0x03, 0x1F, 0xBC, 0x70, 0x00, 0x00, 0x00, //                        ###    #### ####              ############   ##########  ############ ##################### #################### #################     #       ##   ###### ####   ###                        
-	0x00, 0x00, 0x01, 0xC3, 0xFE, 0x3F, 0x81, 0xFF, 0x0F, 0xFC, 0xFF, 0xF7, 0xFF, 0xFF, 0xBF, 0xFF, 0xFC, 0xFF, 0xFF, 0x00, 0x1E, 0x3E, 0x3C, 0x70, 0x00, 0x00, 0x00, //                        ###    #########   #######      #########    ##########  ############ #################### ####################  ################           ####   #####   ####   ###                        
-	0x00, 0x00, 0x01, 0xCB, 0xFE, 0x7F, 0xE0, 0x00, 0x0F, 0xFC, 0xFF, 0xF7, 0xFF, 0xFF, 0x3F, 0xFF, 0xF8, 0x7F, 0xFE, 0x02, 0x1E, 0x3C, 0x3C, 0x70, 0x00, 0x00, 0x00, //                        ###  # #########  ##########                 ##########  ############ ###################  ###################    ##############       #    ####   ####    ####   ###                        
-	0x00, 0x00, 0x01, 0xCF, 0x9E, 0x7F, 0xF0, 0x00, 0x03, 0xFC, 0x7F, 0xF3, 0xFF, 0xFE, 0x3F, 0xFF, 0xF0, 0x0F, 0xE0, 0x3E, 0x1E, 0x3C, 0x3C, 0x70, 0x00, 0x00, 0x00, //                        ###  #####  ####  ###########                  ########   ###########  #################   ##################        #######       #####    ####   ####    ####   ###                        
-	0x00, 0x00, 0x01, 0xCF, 0xFE, 0x78, 0x78, 0x01, 0x00, 0x08, 0x7F, 0xF1, 0xFF, 0xFC, 0x0F, 0xFF, 0xE0, 0x00, 0x0F, 0x9F, 0x9E, 0x3C, 0x3E, 0x70, 0x00, 0x00, 0x00, //                        ###  ###########  ####    ####          #            #    ###########   ###############      ###############                 #####  ######  ####   ####    #####  ###                        
-	0x00, 0x00, 0x01, 0xCF, 0xFE, 0x78, 0x3C, 0x01, 0xF0, 0x00, 0x07, 0xC0, 0xFF, 0xF8, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0x1F, 0xDE, 0x3C, 0x3C, 0x70, 0x00, 0x00, 0x00, //                        ###  ###########  ####     ####         #####                 #####      #############         ##########                    ####   ####### ####   ####    ####   ###                        
-	0x00, 0x00, 0x01, 0xC0, 0x7E, 0x78, 0x3C, 0x01, 0xE0, 0x04, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x7C, 0x0F, 0x1F, 0xFE, 0x3C, 0x00, 0x70, 0x00, 0x00, 0x00, //                        ###       ######  ####     ####         ####          #                     #######                               #####      ####   ############   ####           ###                        
-	0x00, 0x00, 0x01, 0xC0, 0x0F, 0x3E, 0x3C, 0x01, 0xE0, 0x07, 0xC3, 0x00, 0x00, 0x00, 0x00, 0x47, 0xF0, 0x7C, 0x0F, 0x1F, 0xFE, 0x3C, 0x00, 0x70, 0x00, 0x00, 0x00, //                        ###          ####  #####   ####         ####          #####    ##                                 #   #######     #####      ####   ############   ####           ###                        
-	0x00, 0x00, 0x01, 0xC0, 0x01, 0x1F, 0xFC, 0x01, 0xE0, 0x07, 0x83, 0xE1, 0xFE, 0x1F, 0x3E, 0x7F, 0xE0, 0xFE, 0x0F, 0x1C, 0xFE, 0x70, 0x00, 0x70, 0x00, 0x00, 0x00, //                        ###             #   ###########         ####          ####     #####    ########    #####  #####  ##########     #######     ####   ###  #######  ###             ###                        
-	0x00, 0x00, 0x01, 0xC0, 0x00, 0x0F, 0xF8, 0x03, 0xF0, 0x07, 0x81, 0xC7, 0xFF, 0x9F, 0x1E, 0x7F, 0xE0, 0xFF, 0x0F, 0x1C, 0x3E, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, //                        ###                  #########         ######         ####      ###   ############  #####   ####  ##########     ########    ####   ###    #####                  ###                        
-	0x00, 0x00, 0x01, 0xFF, 0xF8, 0x01, 0xF0, 0x07, 0xF8, 0x07, 0x81, 0xC7, 0xFF, 0x87, 0x9E, 0x41, 0xE1, 0xFF, 0x0F, 0x1E, 0x30, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, //                        ##############          #####         ########        ####      ###   ############    ####  ####  #     ####    #########    ####   ####   ##           #############                        
-	0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0x7C, 0x07, 0x81, 0xC7, 0x83, 0x07, 0xFE, 0x7F, 0xE1, 0xCF, 0x8F, 0x3E, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x00, //                        #################                   ##### #####       ####      ###   ####     ##     ##########  ##########    ###  #####   ####  #####            #################                        
-	0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0x3C, 0x67, 0x81, 0xC7, 0xFF, 0x1F, 0xFE, 0x7F, 0xE3, 0xC7, 0x8F, 0x80, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, //                        ######################              #####  ####   ##  ####      ###   ###########   ############  ##########   ####   ####   #####              #####################                        
-	0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x02, 0x3E, 0x7F, 0xE9, 0xC3, 0xFF, 0x9F, 0xFE, 0x69, 0xE3, 0x87, 0xC8, 0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, //                        ##########################             #   #####  ########## #  ###    ###########  ############  ## #  ####   ###    #####  #              #########################                        
-	0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x0F, 0x7F, 0xF9, 0xC3, 0x9F, 0x9E, 0x1E, 0x7F, 0xE7, 0x84, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, //                                        ##############               #### ############  ###    ###  ######  ####    ####  ##########  ####    #                 ##############                                       
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x6F, 0xFB, 0xE7, 0xFF, 0x9F, 0xFE, 0x7F, 0xF7, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, //                                            ################              ## ######### #####  ############  ############  ########### ###                 ################                                           
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x0B, 0xE7, 0xFF, 0x0F, 0xFE, 0x7C, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //                                                ##################                   # #####  ###########    ###########  #####                     ##################                                               
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //                                                     ###################                                                                      ###################                                                    
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //                                                          ########################                                                  ########################                                                         
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //                                                                ################################                      ################################                                                               
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //                                                                      ##########################################################################                                                                     
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //                                                                              ##########################################################                                                                             
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //                                                                                            ##############################                                                                                           
-};
-
-/* Bitmap sizes for bucky2 */
-const uint8_t bucky2WidthPixels = 212;
-const uint8_t bucky2HeightPixels = 135;
-
-
-
-
-
-
+// Copyright (c) 2014-2016, Joe Krachey
+// All rights reserved.
+//
+// Redistribution and use in binary form, with or without modification, 
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions in binary form must reproduce the above copyright 
+//    notice, this list of conditions and the following disclaimer in 
+//    the documentation and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" 
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR 
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR 
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, 
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, 
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; 
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING 
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, 
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "ece353_images.h"
+
+/* 
+**  Image data for right_arrow
+*/
+
+const uint8_t right_arrowBitmaps []=
+{
+	0x00, 0x00, 0x7E, 0x00, 0x00, //                  ######                
+	0x00, 0x07, 0xFF, 0xC0, 0x00, //              #############             
+	0x00, 0x3F, 0xFF, 0xF8, 0x00, //           ###################          
+	0x00, 0x7F, 0xFF, 0xFC, 0x00, //          #####################         
+	0x01, 0xFF, 0xFF, 0xFF, 0x00, //        #########################       
+	0x03, 0xFF, 0x01, 0xFF, 0x80, //       ##########       ##########      
+	0x07, 0xF8, 0x00, 0x3F, 0xC0, //      ########             ########     
+	0x0F, 0xF0, 0x00, 0x0F, 0xE0, //     ########                #######    
+	0x0F, 0xC0, 0x00, 0x07, 0xE0, //     ######                   ######    
+	0x1F, 0x80, 0x70, 0x03, 0xF0, //    ######        ###          ######   
+	0x3F, 0x01, 0xF8, 0x01, 0xF8, //   ######       ######          ######  
+	0x3F, 0x01, 0xFC, 0x00, 0xF8, //   ######       #######          #####  
+	0x3E, 0x03, 0xFC, 0x00, 0xFC, //   #####       ########          ###### 
+	0x7C, 0x0F, 0xF8, 0x00, 0x7C, //  #####      #########            ##### 
+	0x7C, 0x1F, 0xF8, 0x00, 0x7C, //  #####     ##########            ##### 
+	0x7C, 0x3F, 0xF0, 0x00, 0x3C, //  #####    ##########              #### 
+	0x78, 0x7F, 0xC0, 0x00, 0x3E, //  ####    #########                #####
+	0xF8, 0xFF, 0xFF, 0xFE, 0x3E, // #####   #######################   #####
+	0xF8, 0xFF, 0xFF, 0xFE, 0x3E, // #####   #######################   #####
+	0xF8, 0xFF, 0xFF, 0xFE, 0x3E, // #####   #######################   #####
+	0xF8, 0xFF, 0xFF, 0xFE, 0x3E, // #####   #######################   #####
+	0xF8, 0xFF, 0xFF, 0xFE, 0x3E, // #####   #######################   #####
+	0xF8, 0x7F, 0xFF, 0xF8, 0x3E, // #####    ####################     #####
+	0x7C, 0x3F, 0xE0, 0x00, 0x3C, //  #####    #########               #### 
+	0x7C, 0x1F, 0xF0, 0x00, 0x7C, //  #####     #########             ##### 
+	0x7C, 0x0F, 0xF8, 0x00, 0x7C, //  #####      #########            ##### 
+	0x3E, 0x07, 0xFC, 0x00, 0xFC, //   #####      #########          ###### 
+	0x3E, 0x03, 0xFC, 0x00, 0xF8, //   #####       ########          #####  
+	0x3F, 0x01, 0xF8, 0x01, 0xF8, //   ######       ######          ######  
+	0x1F, 0x80, 0x70, 0x03, 0xF0, //    ######        ###          ######   
+	0x0F, 0xC0, 0x00, 0x07, 0xF0, //     ######                   #######   
+	0x0F, 0xE0, 0x00, 0x0F, 0xE0, //     #######                 #######    
+	0x07, 0xF8, 0x00, 0x3F, 0xC0, //      ########             ########     
+	0x03, 0xFE, 0x00, 0xFF, 0x80, //       #########         #########      
+	0x01, 0xFF, 0xFF, 0xFF, 0x00, //        #########################       
+	0x00, 0x7F, 0xFF, 0xFE, 0x00, //          ######################        
+	0x00, 0x3F, 0xFF, 0xF8, 0x00, //           ###################          
+	0x00, 0x0F, 0xFF, 0xE0, 0x00, //             ###############            
+	0x00, 0x00, 0xFE, 0x00, 0x00, //                 #######                
+};
+
+/* 
+**  Image data for up_arrow
+*/
+
+const uint8_t down_arrowBitmaps [] =
+{
+	0x00, 0x00, 0xFC, 0x00, 0x00, //                 ######                 
+	0x00, 0x07, 0xFF, 0xC0, 0x00, //              #############             
+	0x00, 0x3F, 0xFF, 0xF8, 0x00, //           ###################          
+	0x00, 0x7F, 0xFF, 0xFC, 0x00, //          #####################         
+	0x01, 0xFF, 0xFF, 0xFF, 0x00, //        #########################       
+	0x03, 0xFF, 0x01, 0xFF, 0x80, //       ##########       ##########      
+	0x07, 0xF8, 0x00, 0x3F, 0xC0, //      ########             ########     
+	0x0F, 0xE0, 0x00, 0x1F, 0xE0, //     #######                ########    
+	0x0F, 0xC0, 0x7C, 0x07, 0xE0, //     ######       #####       ######    
+	0x1F, 0x80, 0xFE, 0x03, 0xF0, //    ######       #######       ######   
+	0x3F, 0x01, 0xFF, 0x01, 0xF8, //   ######       #########       ######  
+	0x3E, 0x03, 0xFF, 0x81, 0xF8, //   #####       ###########      ######  
+	0x7E, 0x07, 0xFF, 0xC0, 0xF8, //  ######      #############      #####  
+	0x7C, 0x0F, 0xFF, 0xC0, 0x7C, //  #####      ##############       ##### 
+	0x7C, 0x1F, 0xFF, 0xE0, 0x7C, //  #####     ################      ##### 
+	0x78, 0x3F, 0xFF, 0xF8, 0x7C, //  ####     ###################    ##### 
+	0xF8, 0x3F, 0xFF, 0xF8, 0x3C, // #####     ###################     #### 
+	0xF8, 0x7F, 0xFF, 0xFC, 0x3E, // #####    #####################    #####
+	0xF8, 0x7F, 0xFD, 0xFC, 0x3E, // #####    ############# #######    #####
+	0xF8, 0x7E, 0xFD, 0xFC, 0x3E, // #####    ###### ###### #######    #####
+	0xF8, 0x3C, 0xFC, 0xF8, 0x3E, // #####     ####  ######  #####     #####
+	0xF8, 0x18, 0xFC, 0x30, 0x3E, // #####      ##   ######    ##      #####
+	0xF8, 0x00, 0xFC, 0x00, 0x3E, // #####           ######            #####
+	0x78, 0x00, 0xFC, 0x00, 0x7C, //  ####           ######           ##### 
+	0x7C, 0x00, 0xFC, 0x00, 0x7C, //  #####          ######           ##### 
+	0x7C, 0x00, 0xFC, 0x00, 0x7C, //  #####          ######           ##### 
+	0x7E, 0x00, 0xFC, 0x00, 0xF8, //  ######         ######          #####  
+	0x3E, 0x00, 0xFC, 0x00, 0xF8, //   #####         ######          #####  
+	0x3F, 0x00, 0xFC, 0x01, 0xF8, //   ######        ######         ######  
+	0x1F, 0x80, 0x7C, 0x03, 0xF0, //    ######        #####        ######   
+	0x1F, 0xC0, 0x7C, 0x07, 0xE0, //    #######       #####       ######    
+	0x0F, 0xE0, 0x00, 0x0F, 0xE0, //     #######                 #######    
+	0x07, 0xF8, 0x00, 0x3F, 0xC0, //      ########             ########     
+	0x03, 0xFE, 0x00, 0xFF, 0x80, //       #########         #########      
+	0x01, 0xFF, 0xFF, 0xFF, 0x00, //        #########################       
+	0x00, 0xFF, 0xFF, 0xFC, 0x00, //         ######################         
+	0x00, 0x3F, 0xFF, 0xF8, 0x00, //           ###################          
+	0x00, 0x0F, 0xFF, 0xE0, 0x00, //             ###############            
+	0x00, 0x00, 0xFE, 0x00, 0x00, //                 #######                
+};
+
+/* 
+**  Image data for down_arrow
+*/
+
+const uint8_t up_arrowBitmaps [] =
+{
+	0x00, 0x00, 0xFE, 0x00, 0x00, //                 #######                
+	0x00, 0x0F, 0xFF, 0xE0, 0x00, //             ###############            
+	0x00, 0x3F, 0xFF, 0xF8, 0x00, //           ###################          
+	0x00, 0x7F, 0xFF, 0xFE, 0x00, //          ######################        
+	0x01, 0xFF, 0xFF, 0xFF, 0x00, //        #########################       
+	0x03, 0xFE, 0x00, 0xFF, 0x80, //       #########         #########      
+	0x07, 0xF8, 0x00, 0x3F, 0xC0, //      ########             ########     
+	0x0F, 0xE0, 0x00, 0x0F, 0xE0, //     #######                 #######    
+	0x0F, 0xC0, 0x7C, 0x07, 0xF0, //     ######       #####       #######   
+	0x1F, 0x80, 0x7C, 0x03, 0xF0, //    ######        #####        ######   
+	0x3F, 0x00, 0x7E, 0x01, 0xF8, //   ######         ######        ######  
+	0x3E, 0x00, 0x7E, 0x00, 0xF8, //   #####          ######         #####  
+	0x3E, 0x00, 0x7E, 0x00, 0xFC, //   #####          ######         ###### 
+	0x7C, 0x00, 0x7E, 0x00, 0x7C, //  #####           ######          ##### 
+	0x7C, 0x00, 0x7E, 0x00, 0x7C, //  #####           ######          ##### 
+	0x7C, 0x00, 0x7E, 0x00, 0x3C, //  #####           ######           #### 
+	0xF8, 0x00, 0x7E, 0x00, 0x3E, // #####            ######           #####
+	0xF8, 0x18, 0x7E, 0x30, 0x3E, // #####      ##    ######   ##      #####
+	0xF8, 0x3E, 0x7E, 0x78, 0x3E, // #####     #####  ######  ####     #####
+	0xF8, 0x7F, 0x7E, 0xFC, 0x3E, // #####    ####### ###### ######    #####
+	0xF8, 0x7F, 0x7F, 0xFC, 0x3E, // #####    ####### #############    #####
+	0xF8, 0x7F, 0xFF, 0xFC, 0x3E, // #####    #####################    #####
+	0x78, 0x3F, 0xFF, 0xF8, 0x3E, //  ####     ###################     #####
+	0x7C, 0x3F, 0xFF, 0xF8, 0x3C, //  #####    ###################     #### 
+	0x7C, 0x0F, 0xFF, 0xF0, 0x7C, //  #####      ################     ##### 
+	0x7C, 0x07, 0xFF, 0xE0, 0x7C, //  #####       ##############      ##### 
+	0x3E, 0x07, 0xFF, 0xC0, 0xFC, //   #####      #############      ###### 
+	0x3F, 0x03, 0xFF, 0x80, 0xF8, //   ######      ###########       #####  
+	0x3F, 0x01, 0xFF, 0x01, 0xF8, //   ######       #########       ######  
+	0x1F, 0x80, 0xFE, 0x03, 0xF0, //    ######       #######       ######   
+	0x0F, 0xC0, 0x7C, 0x07, 0xE0, //     ######       #####       ######    
+	0x0F, 0xF0, 0x00, 0x0F, 0xE0, //     ########                #######    
+	0x07, 0xF8, 0x00, 0x3F, 0xC0, //      ########             ########     
+	0x03, 0xFF, 0x01, 0xFF, 0x80, //       ##########       ##########      
+	0x01, 0xFF, 0xFF, 0xFF, 0x00, //        #########################       
+	0x00, 0x7F, 0xFF, 0xFC, 0x00, //          #####################         
+	0x00, 0x3F, 0xFF, 0xF8, 0x00, //           ###################          
+	0x00, 0x07, 0xFF, 0xC0, 0x00, //              #############             
+	0x00, 0x00, 0x7E, 0x00, 0x00, //                  ######                
+};
+
+/* 
+**  Image data for left_arrow
+*/
+
+const uint8_t left_arrowBitmaps [] =
+{
+	0x00, 0x00, 0xFE, 0x00, 0x00, //                 #######                
+	0x00, 0x0F, 0xFF, 0xE0, 0x00, //             ###############            
+	0x00, 0x3F, 0xFF, 0xF8, 0x00, //           ###################          
+	0x00, 0xFF, 0xFF, 0xFC, 0x00, //         ######################         
+	0x01, 0xFF, 0xFF, 0xFF, 0x00, //        #########################       
+	0x03, 0xFE, 0x00, 0xFF, 0x80, //       #########         #########      
+	0x07, 0xF8, 0x00, 0x3F, 0xC0, //      ########             ########     
+	0x0F, 0xE0, 0x00, 0x0F, 0xE0, //     #######                 #######    
+	0x1F, 0xC0, 0x00, 0x07, 0xE0, //    #######                   ######    
+	0x1F, 0x80, 0x1C, 0x03, 0xF0, //    ######          ###        ######   
+	0x3F, 0x00, 0x3F, 0x01, 0xF8, //   ######          ######       ######  
+	0x3E, 0x00, 0x7F, 0x80, 0xF8, //   #####          ########       #####  
+	0x7E, 0x00, 0x7F, 0xC0, 0xF8, //  ######          #########      #####  
+	0x7C, 0x00, 0x3F, 0xE0, 0x7C, //  #####            #########      ##### 
+	0x7C, 0x00, 0x1F, 0xF0, 0x7C, //  #####             #########     ##### 
+	0x78, 0x00, 0x0F, 0xF8, 0x7C, //  ####               #########    ##### 
+	0xF8, 0x3F, 0xFF, 0xFC, 0x3E, // #####     ####################    #####
+	0xF8, 0xFF, 0xFF, 0xFE, 0x3E, // #####   #######################   #####
+	0xF8, 0xFF, 0xFF, 0xFE, 0x3E, // #####   #######################   #####
+	0xF8, 0xFF, 0xFF, 0xFE, 0x3E, // #####   #######################   #####
+	0xF8, 0xFF, 0xFF, 0xFE, 0x3E, // #####   #######################   #####
+	0xF8, 0xFF, 0xFF, 0xFE, 0x3E, // #####   #######################   #####
+	0xF8, 0x00, 0x07, 0xFC, 0x3C, // #####                #########    #### 
+	0x78, 0x00, 0x1F, 0xF8, 0x7C, //  ####              ##########    ##### 
+	0x7C, 0x00, 0x3F, 0xF0, 0x7C, //  #####            ##########     ##### 
+	0x7C, 0x00, 0x3F, 0xE0, 0x7C, //  #####            #########      ##### 
+	0x7E, 0x00, 0x7F, 0x80, 0xF8, //  ######          ########       #####  
+	0x3E, 0x00, 0x7F, 0x01, 0xF8, //   #####          #######       ######  
+	0x3F, 0x00, 0x3F, 0x01, 0xF8, //   ######          ######       ######  
+	0x1F, 0x80, 0x1C, 0x03, 0xF0, //    ######          ###        ######   
+	0x0F, 0xC0, 0x00, 0x07, 0xE0, //     ######                   ######    
+	0x0F, 0xE0, 0x00, 0x1F, 0xE0, //     #######                ########    
+	0x07, 0xF8, 0x00, 0x3F, 0xC0, //      ########             ########     
+	0x03, 0xFF, 0x01, 0xFF, 0x80, //       ##########       ##########      
+	0x01, 0xFF, 0xFF, 0xFF, 0x00, //        #########################       
+	0x00, 0x7F, 0xFF, 0xFC, 0x00, //          #####################         
+	0x00, 0x3F, 0xFF, 0xF8, 0x00, //           ###################          
+	0x00, 0x07, 0xFF, 0xC0, 0x00, //              #############             
+	0x00, 0x00, 0xFC, 0x00, 0x00, //                 ######                 
+};
+
+
+/* 
+**  Image data for rxMode
+*/
+
+const uint8_t rxModeBitmaps[] =
+{
+	0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, // ################################################################################################################        ########
+	0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, // ###################################################################################################################     ########
+	0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, // ####################################################################################################################    ########
+	0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, // #####################################################################################################################   ########
+	0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, // ######################################################################################################################  ########
+	0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, // ####################################################################################################################### ########
+	0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, // ####################################################################################################################### ########
+	0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, // ####################################################################################################################### ########
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, // ################################################################################################################################
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, // ################################################################################################################################
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, // ################################################################################################################################
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, // ################################################################################################################################
+	0xFF, 0xFC, 0x07, 0xC8, 0x3F, 0x81, 0xF1, 0xE3, 0xC3, 0xF0, 0xE1, 0x0F, 0x0F, 0xFF, 0xFE, // ##############       #####  #     #######      #####   ####   ####    ######    ###    #    ####    ############################
+	0xFF, 0xF8, 0x03, 0xC0, 0x1E, 0x00, 0xF1, 0xE1, 0xC3, 0xF8, 0x63, 0x0F, 0x0F, 0xFF, 0xFE, // #############         ####         ####         ####   ####    ###    #######    ##   ##    ####    ############################
+	0xFF, 0xF9, 0xE1, 0xC1, 0x0E, 0x18, 0x71, 0xC1, 0xC3, 0xF8, 0x43, 0x8F, 0x0F, 0xFF, 0xFE, // #############  ####    ###     #    ###    ##    ###   ###     ###    #######    #    ###   ####    ############################
+	0xFF, 0xFF, 0xF1, 0xC7, 0x8C, 0x3C, 0x71, 0xC1, 0xC3, 0xFC, 0x47, 0x87, 0x0F, 0xFF, 0xFE, // ####################   ###   ####   ##    ####   ###   ###     ###    ########   #   ####    ###    ############################
+	0xFF, 0xFF, 0xF1, 0xC7, 0x8C, 0x7C, 0x71, 0xC0, 0xC3, 0xFE, 0x07, 0xC7, 0x0F, 0xFF, 0xFE, // ####################   ###   ####   ##   #####   ###   ###      ##    #########      #####   ###    ############################
+	0xFF, 0xF8, 0x01, 0xC7, 0x8C, 0x7C, 0x71, 0x88, 0xC3, 0xFE, 0x0F, 0xC3, 0x0F, 0xFF, 0xFE, // #############          ###   ####   ##   #####   ###   ##   #   ##    #########     ######    ##    ############################
+	0xFF, 0xF8, 0x01, 0xC7, 0x8C, 0x7C, 0x71, 0x88, 0x43, 0xFE, 0x0F, 0xE0, 0x0F, 0xFF, 0xFE, // #############          ###   ####   ##   #####   ###   ##   #    #    #########     #######         ############################
+	0xFF, 0xF8, 0xF1, 0xC7, 0x8C, 0x3C, 0x71, 0x0C, 0x43, 0xFC, 0x07, 0xE0, 0x0F, 0xFF, 0xFE, // #############   ####   ###   ####   ##    ####   ###   #    ##   #    ########       ######         ############################
+	0xFF, 0xF8, 0xF1, 0xC3, 0x0C, 0x38, 0x71, 0x1C, 0x43, 0xFC, 0x47, 0xC0, 0x0F, 0xFF, 0xFE, // #############   ####   ###    ##    ##    ###    ###   #   ###   #    ########   #   #####          ############################
+	0xFF, 0xFC, 0x03, 0xC0, 0x1E, 0x00, 0xF1, 0x1C, 0x43, 0xF8, 0x43, 0x87, 0x0F, 0xFF, 0xFE, // ##############        ####         ####         ####   #   ###   #    #######    #    ###    ###    ############################
+	0xFF, 0xFC, 0x07, 0xC0, 0x1E, 0x01, 0xF0, 0x3E, 0x03, 0xF8, 0xE1, 0x8F, 0x0F, 0xFF, 0xFE, // ##############       #####         ####        #####      #####       #######   ###    ##   ####    ############################
+	0xFF, 0xFF, 0x0F, 0xC4, 0x7F, 0x83, 0xF0, 0x3E, 0x03, 0xF9, 0xF3, 0x8F, 0x0F, 0xFF, 0xFE, // ################    ######   #   ########     ######      #####       #######  #####  ###   ####    ############################
+	0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xF0, 0x3E, 0x03, 0xFF, 0xFF, 0x87, 0x0F, 0xFF, 0xFE, // ##########################   #######################      #####       ###################    ###    ############################
+	0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xF0, 0x7F, 0x03, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFE, // ##########################   #######################     #######      ###################           ############################
+	0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xF0, 0x7F, 0x03, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFE, // ##########################   #######################     #######      ####################          ############################
+	0xFF, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xF9, 0xFF, 0xCF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFE, // #########################    ########################  ###########  ##########################    ##############################
+	0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, // ##########################  ####################################################################################################
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, // ################################################################################################################################
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, // ################################################################################################################################
+	0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, // ####################################################################################################################### ########
+	0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, // ####################################################################################################################### ########
+	0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, // ####################################################################################################################### ########
+	0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, // ######################################################################################################################  ########
+	0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, // ######################################################################################################################  ########
+	0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, // #####################################################################################################################   ########
+	0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, // ####################################################################################################################    ########
+};
+
+/* Bitmap sizes for rxMode */
+const uint8_t rxModeWidthPixels = 120;
+const uint8_t rxModeHeightPixels = 38;
+
+/* 
+**  Image data for txMode
+*/
+
+const uint8_t txModeBitmaps[] =
+{
+	0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, //         ###############################################################################################################        
+	0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, //      #####################################################################################################################     
+	0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, //     #######################################################################################################################    
+	0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, //    #########################################################################################################################   
+	0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, //   ###########################################################################################################################  
+	0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, //  ############################################################################################################################# 
+	0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, //  ############################################################################################################################# 
+	0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, //  ############################################################################################################################# 
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, // ###############################################################################################################################
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, // ###############################################################################################################################
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, // ###############################################################################################################################
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, // ###############################################################################################################################
+	0xFF, 0xFF, 0xFC, 0x07, 0xC8, 0x3F, 0x81, 0xF1, 0xE3, 0xC3, 0xF0, 0xE1, 0xF1, 0xFF, 0xFE, // ######################       #####  #     #######      #####   ####   ####    ######    ###    #####   ########################
+	0xFF, 0xFF, 0xF8, 0x03, 0xC0, 0x1E, 0x00, 0xF1, 0xE1, 0xC3, 0xF8, 0x63, 0xF1, 0xFF, 0xFE, // #####################         ####         ####         ####   ####    ###    #######    ##   ######   ########################
+	0xFF, 0xFF, 0xF9, 0xE1, 0xC1, 0x0E, 0x18, 0x71, 0xC1, 0xC3, 0xF8, 0x43, 0xF1, 0xFF, 0xFE, // #####################  ####    ###     #    ###    ##    ###   ###     ###    #######    #    ######   ########################
+	0xFF, 0xFF, 0xFF, 0xF1, 0xC7, 0x8C, 0x3C, 0x71, 0xC1, 0xC3, 0xFC, 0x47, 0xF1, 0xFF, 0xFE, // ############################   ###   ####   ##    ####   ###   ###     ###    ########   #   #######   ########################
+	0xFF, 0xFF, 0xFF, 0xF1, 0xC7, 0x8C, 0x7C, 0x71, 0xC0, 0xC3, 0xFE, 0x07, 0xF1, 0xFF, 0xFE, // ############################   ###   ####   ##   #####   ###   ###      ##    #########      #######   ########################
+	0xFF, 0xFF, 0xF8, 0x01, 0xC7, 0x8C, 0x7C, 0x71, 0x88, 0xC3, 0xFE, 0x0F, 0xF1, 0xFF, 0xFE, // #####################          ###   ####   ##   #####   ###   ##   #   ##    #########     ########   ########################
+	0xFF, 0xFF, 0xF8, 0x01, 0xC7, 0x8C, 0x7C, 0x71, 0x88, 0x43, 0xFE, 0x0F, 0xF1, 0xFF, 0xFE, // #####################          ###   ####   ##   #####   ###   ##   #    #    #########     ########   ########################
+	0xFF, 0xFF, 0xF8, 0xF1, 0xC7, 0x8C, 0x3C, 0x71, 0x0C, 0x43, 0xFC, 0x07, 0xF1, 0xFF, 0xFE, // #####################   ####   ###   ####   ##    ####   ###   #    ##   #    ########       #######   ########################
+	0xFF, 0xFF, 0xF8, 0xF1, 0xC3, 0x0C, 0x38, 0x71, 0x1C, 0x43, 0xFC, 0x47, 0xF1, 0xFF, 0xFE, // #####################   ####   ###    ##    ##    ###    ###   #   ###   #    ########   #   #######   ########################
+	0xFF, 0xFF, 0xFC, 0x03, 0xC0, 0x1E, 0x00, 0xF1, 0x1C, 0x43, 0xF8, 0x43, 0xF1, 0xFF, 0xFE, // ######################        ####         ####         ####   #   ###   #    #######    #    ######   ########################
+	0xFF, 0xFF, 0xFC, 0x07, 0xC0, 0x1E, 0x01, 0xF0, 0x3E, 0x03, 0xF8, 0xE1, 0xF1, 0xFF, 0xFE, // ######################       #####         ####        #####      #####       #######   ###    #####   ########################
+	0xFF, 0xFF, 0xFF, 0x0F, 0xC4, 0x7F, 0x83, 0xF0, 0x3E, 0x03, 0xF9, 0xF3, 0xF1, 0xFF, 0xFE, // ########################    ######   #   ########     ######      #####       #######  #####  ######   ########################
+	0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xF0, 0x3E, 0x03, 0xFF, 0xFF, 0xE1, 0xDF, 0xFE, // ##################################   #######################      #####       #####################    ### ####################
+	0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xF0, 0x7F, 0x03, 0xFF, 0xFE, 0x00, 0x1F, 0xFE, // ##################################   #######################     #######      #################            ####################
+	0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xF0, 0x7F, 0x03, 0xFF, 0xFE, 0x00, 0x1F, 0xFE, // ##################################   #######################     #######      #################            ####################
+	0xFF, 0xFF, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xF9, 0xFF, 0xCF, 0xFF, 0xFF, 0x00, 0x3F, 0xFE, // #################################    ########################  ###########  ####################          #####################
+	0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, // ##################################  ###########################################################################################
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, // ###############################################################################################################################
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, // ###############################################################################################################################
+	0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, //  ############################################################################################################################# 
+	0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, //  ############################################################################################################################# 
+	0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, //  ############################################################################################################################# 
+	0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, //   ###########################################################################################################################  
+	0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, //   ###########################################################################################################################  
+	0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, //    #########################################################################################################################   
+	0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, //     #######################################################################################################################    
+};
+
+/* Bitmap sizes for txMode */
+const uint8_t txModeWidthPixels = 119;
+const uint8_t txModeHeightPixels = 38;
+
+const uint8_t config2Bitmaps[] =
+{
+	 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, // #############################################################################################   ########
+	 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, // ##############################################################################################  ########
+	 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, // ############################################################################################### ########
+	 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, // ########################################################################################################
+	 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, // ########################################################################################################
+	 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, // ########################################################################################################
+	 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, // ########################################################################################################
+	 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, // ########################################################################################################
+	 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, // ##############        ##################################################################################
+	 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, // #############          #################################################################################
+	 0xFF, 0xF0, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, // ############    ####   #################################################################################
+	 0xFF, 0xF1, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, // ############   #####   #################################################################################
+	 0xFF, 0xF0, 0x03, 0x8F, 0x1E, 0x3C, 0x7C, 0x0F, 0x80, 0xFF, 0xFE, // ############          ###   ####   ####   ####   #####      #####       ################################
+	 0xFF, 0xF8, 0x03, 0x8F, 0x1E, 0x3C, 0x70, 0x07, 0x00, 0x7F, 0xFE, // #############         ###   ####   ####   ####   ###         ###         ###############################
+	 0xFF, 0xFE, 0x03, 0x8F, 0x1E, 0x3C, 0x70, 0xC3, 0x00, 0x3F, 0xFE, // ###############       ###   ####   ####   ####   ###    ##    ##          ##############################
+	 0xFF, 0xFF, 0xF3, 0x8F, 0x1E, 0x3C, 0x61, 0xE3, 0x7E, 0x1F, 0xFE, // ####################  ###   ####   ####   ####   ##    ####   ## ######    #############################
+	 0xFF, 0xFE, 0x03, 0x8F, 0x1E, 0x3C, 0x63, 0xE3, 0xFE, 0x1F, 0xFE, // ###############       ###   ####   ####   ####   ##   #####   #########    #############################
+	 0xFF, 0xFC, 0x03, 0x8F, 0x1E, 0x3C, 0x63, 0xE3, 0xFF, 0x1F, 0xFE, // ##############        ###   ####   ####   ####   ##   #####   ##########   #############################
+	 0xFF, 0xF8, 0x63, 0x8F, 0x1E, 0x3C, 0x63, 0xE3, 0xFF, 0x1F, 0xFE, // #############    ##   ###   ####   ####   ####   ##   #####   ##########   #############################
+	 0xFF, 0xF8, 0xE3, 0x8F, 0x1E, 0x38, 0x61, 0xE3, 0xFF, 0x1F, 0xFE, // #############   ###   ###   ####   ####   ###    ##    ####   ##########   #############################
+	 0xFF, 0xFC, 0xE3, 0x8F, 0x1E, 0x30, 0x61, 0xC3, 0xFF, 0x1F, 0xFE, // ##############  ###   ###   ####   ####   ##     ##    ###    ##########   #############################
+	 0xFF, 0xF0, 0x03, 0x8C, 0x06, 0x00, 0x70, 0x07, 0xFF, 0x1F, 0xFE, // ############          ###   ##       ##          ###         ###########   #############################
+	 0xFF, 0xF0, 0x07, 0x08, 0x06, 0x04, 0x70, 0x0F, 0xFE, 0x1F, 0xFE, // ############         ###    #        ##      #   ###        ###########    #############################
+	 0xFF, 0xF8, 0x1F, 0x9D, 0x0F, 0x8C, 0xFC, 0x1F, 0xFE, 0x1F, 0xFE, // #############      ######  ### #    #####   ##  ######     ############    #############################
+	 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0x38, 0x3F, 0xFE, // ################################   #############################  ###     ##############################
+	 0xFF, 0xFF, 0xFF, 0x8F, 0x1F, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFE, // #########################   ####   #############################         ###############################
+	 0xFF, 0xFF, 0xFF, 0x08, 0x1F, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFE, // ########################    #      #############################        ################################
+	 0xFF, 0xFF, 0xFF, 0x08, 0x3F, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFE, // ########################    #     ################################    ##################################
+	 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, // ##############################   #######################################################################
+	 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, // ########################################################################################################
+	 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, // ########################################################################################################
+	 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, // ########################################################################################################
+	 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, // ########################################################################################################
+	 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, // ########################################################################################################
+	 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, // ########################################################################################################
+	 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, // ############################################################################################### ########
+	 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, // ############################################################################################### ########
+	 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, // ##############################################################################################  ########
+};
+
+/* Bitmap sizes for config2 */
+const uint8_t config2WidthPixels = 88;
+const uint8_t config2HeightPixels = 38;
+
+/* 
+**  Image data for bucky2
+*/
+
+const uint8_t bucky2Bitmaps[] =
+{
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //                                                                                ######################                                                                                                               
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //                                                                           #################################                                                                                                         
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //                                                                        ########################################                                                                                                     
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //                                                                     ###############################################                                                                                                 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //                                                                   ###################################################                                                                                               
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //                                                                 ####################### ################################                                                                                            
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x1C, 0x79, 0xEF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //                                                                #################   ###   ####  #### ######################                                                                                          
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xEF, 0x1E, 0x79, 0xC7, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //                                                              ############## ####   ####  ####  ###   #######################                                                                                        
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xE7, 0x9E, 0x79, 0xC7, 0x9F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //                                                             ###############  ####  ####  ####  ###   ####  ###################                                                                                      
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0xE3, 0x8E, 0x71, 0xC7, 0x1C, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //                                                             ########## ####   ###   ###  ###   ###   ###   ###  ###############                                                                                     
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0xF3, 0x8E, 0x71, 0xC7, 0x3C, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //                                                            ##########   ####  ###   ###  ###   ###   ###  ####  ################                                                                                    
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xBC, 0xF3, 0x9F, 0xFB, 0xCF, 0x3C, 0xF3, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //                                                            ###### ####  ####  ###  ########## ####  ####  ####  ####  ###########                                                                                   
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1C, 0x73, 0xFF, 0xFF, 0xCE, 0x3C, 0xE3, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //                                                            #####   ###   ###  ####################  ###   ####  ###   ###########                                                                                   
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x9E, 0x7B, 0xFF, 0xFF, 0xCE, 0x38, 0xE3, 0x8F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //                                                            ######  ####  #### ####################  ###   ###   ###   ###   ######                                                                                  
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x8E, 0x3F, 0xF8, 0x0F, 0xFE, 0x38, 0xE7, 0x9F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //                                                            ######   ###   ###########       ###########   ###   ###  ####  #######                                                                                  
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xCE, 0x3F, 0xE0, 0x01, 0xFE, 0x39, 0xE7, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //                                                            #######  ###   #########            ########   ###  ####  ###   #######                                                                                  
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC7, 0x7F, 0xE0, 0x00, 0x7F, 0xF9, 0xC7, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //                                                            #######   ### ##########              ############  ###   ###  ########                                                                                  
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC7, 0xF1, 0xF0, 0x00, 0x3F, 0xF9, 0xC7, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //                                                            #######   #######   #####              ###########  ###   ###  #######                                                                                   
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE7, 0xE0, 0x7C, 0x00, 0x1F, 0xF9, 0xCF, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //                                                             #######  ######      #####             ##########  ###  ####  #######                                                                                   
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE7, 0xE0, 0x3F, 0x00, 0x3C, 0xFD, 0xCE, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //                                                              ######  ######       ######          ####  ###### ###  ###   #######                                                                                   
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE7, 0xE0, 0x07, 0xF8, 0x20, 0x3D, 0xCE, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //                                                             #######  ######          ########     #       #### ###  ###  #######                                                                                    
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE3, 0xE0, 0xC1, 0xE0, 0x00, 0x1F, 0xCE, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //                                                             #######   #####     ##     ####                #######  ###  #######                                                                                    
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE3, 0xE0, 0xF0, 0x00, 0x00, 0x1F, 0xFE, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //                                                             #######   #####     ####                       ############  #######                                                                                    
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF3, 0xF0, 0xFE, 0x01, 0xF8, 0x1F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //                                                             ########  ######    #######        ######      #####################                                                                                    
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF7, 0xF8, 0x3F, 0xFF, 0xFC, 0x1B, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //                                                             ######## ########     ####################     ## #######################                                                                               
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x1F, 0xFF, 0xF8, 0x18, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //                                                              ################      ##################      ##       ######################                                                                          
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x03, 0xFF, 0xF0, 0x30, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //                                                              ################         ##############      ##                #################                                                                       
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x38, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //                                                         ###############   ###             ######                                  ##########                                                                        
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //                                                     ################      ###                                                           ######                                                                      
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x18, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //                                                   ##############           ##         #####                                             #########                                                                   
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x18, 0x0F, 0xFC, 0x00, 0x00, 0x30, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //                                                 ###########                ##       ##########                    ##                    ###########                                                                 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x0C, 0x1F, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //                                                #######                      ##     #############                    ########                ##########                                                              
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x04, 0x1F, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //                                                #####                         #     ##############                      #########               #########                                                            
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x08, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //                                                 ####                #             #################                      ###########             #########                                                          
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x60, 0x00, 0x73, 0x1D, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //                                               #######            ##              ###  ##   ### ######                      #############            ########                                                        
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x03, 0xC0, 0x03, 0xF2, 0x09, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xE0, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //                                              #######          ####            ######  #     #  ###############               ##############           ########                                                      
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x0F, 0x80, 0x1F, 0xF8, 0x01, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //                                             ######          #####          ##########          #################               ###############           ######                                                     
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x7F, 0x00, 0x7F, 0xF8, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //                                           ######         #######         ############         ####################               ###############           #####                                                    
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x01, 0xFC, 0x00, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xC0, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //                                          ######        #######          ################     ######################               ################        #####                                                     
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x07, 0xFC, 0x00, 0x93, 0xFF, 0xFF, 0xFF, 0xFE, 0x20, 0x00, 0x0F, 0xFF, 0xF0, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //                                         #####        #########          #  #  #################################   #                 ################     ######                                                     
+	0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x1F, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //                                        #####       ##########                 ###############################                        ###############      ######                                                    
+	0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x3F, 0xF0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //                                       #####       ##########                     #########################                            #############        ######                                                   
+	0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //                                      #####      ###########                        ###################                                  ############         #####                                                  
+	0x00, 0x00, 0x00, 0x00, 0x0F, 0x81, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //                                     #####      ###########                         ####################                                  ############         ######                                                
+	0x00, 0x00, 0x00, 0x00, 0x0F, 0x81, 0xFF, 0xC0, 0x00, 0x70, 0x0F, 0xFF, 0xF8, 0x00, 0x3C, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //                                     #####      ###########               ###        #################             ####                    #############         #####                                               
+	0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0xFF, 0x80, 0x01, 0xFC, 0x00, 0xFF, 0xE0, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //                                      ######     #########              #######          ###########              ######                   ###############        #####                                              
+	0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0xFF, 0x80, 0x01, 0xFE, 0x00, 0x09, 0x01, 0xC0, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //                                      #####      #########              ########             #  #       ###      ########                   ###############        #####                                             
+	0x00, 0x00, 0x00, 0x00, 0x07, 0x81, 0xFF, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x07, 0xF0, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xE0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //                                      ####      #########              #########                      #######    #########                   ###############        #####                                            
+	0x00, 0x00, 0x00, 0x00, 0x0F, 0x03, 0xFF, 0x00, 0x03, 0xFE, 0x3E, 0x00, 0x0F, 0xF8, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xF0, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, //                                     ####      ##########              #########   #####             #########   #########                   ################        #####                                           
+	0x00, 0x00, 0x00, 0x00, 0x1F, 0x07, 0xFF, 0x00, 0x03, 0xFE, 0xFF, 0x00, 0x1F, 0xFE, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xF8, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, //                                    #####     ###########              ######### ########           ############ #########                    ################        ####                                           
+	0x00, 0x00, 0x00, 0x00, 0x1E, 0x0F, 0xFF, 0x00, 0x01, 0xDD, 0xFF, 0x80, 0x1F, 0xFF, 0x77, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, //                                    ####     ############               ### ### ##########          ############# ### ###                     ################        #####                                          
+	0x00, 0x00, 0x00, 0x00, 0x3C, 0x1F, 0xFE, 0x00, 0x01, 0xDB, 0xFF, 0xC0, 0x18, 0x3F, 0xA7, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, //                                   ####     ############                ### ## ############         ##     ####### #  ###                      ##############        #####                                           
+	0x00, 0x00, 0x00, 0x00, 0x78, 0x1F, 0xFE, 0x00, 0x00, 0xCF, 0xF0, 0xC0, 0x10, 0x0F, 0xC6, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //                                  ####      ############                 ##  ########    ##         #        ######   ##                       ##############      ######                                            
+	0x30, 0x00, 0x00, 0x00, 0x78, 0x3F, 0xFE, 0x00, 0x00, 0x07, 0xE2, 0x40, 0x03, 0xC7, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //   ##                             ####     #############                      ######   #  #            ####   ######                           #############      ######                                             
+	0x3E, 0x00, 0x00, 0x00, 0xF0, 0x3F, 0xFF, 0x00, 0x00, 0x0F, 0xCF, 0x00, 0x07, 0xF3, 0xF0, 0x00, 0x40, 0x03, 0xFF, 0xC0, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //   #####                         ####      ##############                    ######  ####             #######  ######             #            ############      ######                                              
+	0x3F, 0x80, 0x00, 0x00, 0xF8, 0x0F, 0xFF, 0x00, 0x10, 0x1F, 0x9F, 0x00, 0x03, 0xF9, 0xF8, 0x00, 0xC0, 0x01, 0xFF, 0x80, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, //   #######                       #####       ############           #       ######  #####              #######  ######           ##             ##########        #####                                     #        
+	0x3F, 0xF0, 0x00, 0x00, 0x7C, 0x07, 0xFF, 0x00, 0x10, 0x3F, 0x3F, 0x00, 0x03, 0xFC, 0xFE, 0x01, 0x80, 0x01, 0xFF, 0xC0, 0x3E, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, //   ##########                     #####       ###########           #      ######  ######              ########  #######        ##              ###########        #####                                 ####        
+	0x3F, 0xFE, 0x00, 0x00, 0x3E, 0x01, 0xFF, 0x00, 0x18, 0x7E, 0x7F, 0x80, 0x03, 0xFE, 0x7F, 0xEF, 0x80, 0x01, 0xFF, 0xE0, 0x1F, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, //   #############                   #####        #########           ##    ######  ########             #########  ########## #####              ############        #####                             ########       
+	0x38, 0xFF, 0x80, 0x00, 0x1F, 0x00, 0xFF, 0x80, 0x1F, 0xFC, 0xFF, 0x80, 0x03, 0xFF, 0x3F, 0xFF, 0x80, 0x01, 0xFF, 0xC0, 0x3E, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, //   ###   #########                  #####        #########          ###########  #########             ##########  ###############              ###########        #####                            ##########       
+	0x38, 0x3F, 0xF0, 0x00, 0x0F, 0xC0, 0x3F, 0x80, 0x1F, 0xF8, 0xFF, 0x80, 0x03, 0xFF, 0x8F, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, //   ###     ##########                ######        #######          ##########   #########             ###########   #############             ##########        ######                          #############       
+	0x38, 0x07, 0xFE, 0x00, 0x07, 0xE0, 0x0F, 0xC0, 0x0F, 0xF1, 0xFF, 0x80, 0x01, 0xFF, 0xC7, 0xFF, 0x00, 0x03, 0xFE, 0x01, 0xF8, 0x00, 0x00, 0x07, 0xFE, 0x38, 0x00, //   ###        ##########              ######         ######          ########   ##########              ###########   ###########              #########        ######                        ##########   ###       
+	0x38, 0x00, 0xFF, 0xC0, 0x01, 0xF8, 0x07, 0xC0, 0x07, 0xC1, 0xFF, 0x80, 0x01, 0xFF, 0xE3, 0xFE, 0x00, 0x03, 0xFC, 0x03, 0xE0, 0x00, 0x00, 0x3F, 0xF0, 0x38, 0x00, //   ###           ##########             ######        #####           #####     ##########              ############   #########               ########        #####                       ##########      ###       
+	0x38, 0x18, 0x1F, 0xFC, 0x00, 0xFE, 0x07, 0xE0, 0x00, 0x03, 0xFF, 0xC0, 0x01, 0xFF, 0xF0, 0x38, 0x00, 0x03, 0xF0, 0x07, 0xC0, 0x00, 0x03, 0xFF, 0x80, 0x38, 0x00, //   ###      ##      ###########          #######      ######                   ############             #############      ###                 ######         #####                    ###########         ###       
+	0x38, 0x7E, 0x07, 0xFF, 0x80, 0x3E, 0x0F, 0xF0, 0x00, 0x03, 0xFF, 0xC0, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x07, 0xC0, 0x03, 0xC0, 0x00, 0x1F, 0xFE, 0x01, 0x3C, 0x00, //   ###    ######      ############         #####     ########                  ############             ###############                       #####            ####                 ############        #  ####      
+	0x38, 0x3F, 0x80, 0xFF, 0xF0, 0x3C, 0x03, 0xF8, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x07, 0x80, 0x01, 0xE0, 0x00, 0xFF, 0xF0, 0x07, 0x3C, 0x00, //   ###     #######       ############      ####        #######                #############              ###############                      ####              ####             ############         ###  ####      
+	0x38, 0x3F, 0xF0, 0x1F, 0xFF, 0x7F, 0x00, 0x7C, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x0E, 0x00, 0x61, 0xE0, 0x0F, 0xFF, 0x80, 0x3F, 0x1C, 0x00, //   ###     ##########       ############# #######         #####              ###############             #################                   ###          ##    ####         #############         ######   ###      
+	0x38, 0x3F, 0xF0, 0x01, 0xFF, 0x3F, 0xC0, 0x1F, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x08, 0x00, 0xE0, 0xF0, 0xFF, 0xFC, 0x00, 0xFF, 0x1C, 0x00, //   ###     ##########           #########  ########         #####            ###############             ##################                  #           ###     ####    ##############          ########   ###      
+	0x38, 0x3F, 0xF0, 0x80, 0x3F, 0x0F, 0xF8, 0x01, 0x80, 0x1F, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x00, 0x03, 0xF0, 0x71, 0xFF, 0xC0, 0x01, 0xFF, 0x1C, 0x00, //   ###     ##########    #         ######    #########          ##          ################              ####################                         ######     ###   ###########             #########   ###      
+	0x38, 0x3F, 0xF1, 0xE0, 0x07, 0x03, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xF8, 0x79, 0xFC, 0x00, 0x03, 0xFF, 0x1E, 0x00, //   ###     ##########   ####          ###      #########                   ##################             ######################                     #########    ####  #######                ##########   ####     
+	0x38, 0x3F, 0xF9, 0xFC, 0x07, 0x00, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xF8, 0x39, 0xE0, 0x01, 0xC3, 0xFF, 0x9E, 0x00, //   ###     ###########  #######       ###        #######                 ####################              ########################                    #######     ###  ####            ###    ###########  ####     
+	0x38, 0x3F, 0xF9, 0xFF, 0x87, 0x80, 0x1E, 0x38, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x78, 0x3D, 0xE0, 0x0F, 0xC3, 0xFF, 0x8E, 0x00, //   ###     ###########  ##########    ####          ####   ###          ######################             ###################################            ####     #### ####         ######    ###########   ###     
+	0x38, 0x3F, 0xF9, 0xFF, 0x87, 0xF8, 0x3C, 0x7E, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x3C, 0x3D, 0xE0, 0x7F, 0xC3, 0xFF, 0x8E, 0x00, //   ###     ###########  ##########    ########     ####   ######      ########################              #######################################        ####    #### ####      #########    ###########   ###     
+	0x38, 0x3F, 0xFD, 0xFF, 0x87, 0xFF, 0x3C, 0xFC, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1C, 0x1F, 0xE0, 0x7F, 0xC3, 0xFF, 0x8E, 0x00, //   ###     ############ ##########    ###########  ####  ######     ###########################             ##########################################      ###     ########      #########    ###########   ###     
+	0x38, 0x3F, 0xFD, 0xFF, 0x81, 0xFF, 0xF8, 0xF0, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C, 0x1F, 0xE0, 0xFF, 0xC3, 0xFF, 0x8F, 0x00, //   ###     ############ ##########      ##############   ####    ##############################              ############################################    ##     ########     ##########    ###########   ####    
+	0x38, 0x3F, 0xFD, 0xFF, 0x88, 0x3F, 0xF8, 0xE1, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC4, 0x1F, 0xC0, 0xFF, 0xE7, 0xFF, 0xCF, 0x00, //   ###     ############ ##########   #     ###########   ###    ################################              #############################################   #     #######      ###########  #############  ####    
+	0x38, 0x3F, 0xFE, 0xFF, 0x8F, 0x01, 0xF8, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x1E, 0x00, 0xFF, 0xE7, 0xFF, 0xCF, 0x00, //   ###     ############# #########   ####       ######   ##   ###################################             ###############################################       ####         ###########  #############  ####    
+	0x38, 0x3F, 0xFE, 0xFF, 0x9F, 0xE0, 0x70, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFE, 0x01, 0xFF, 0xF8, 0x1E, 0x00, 0xFF, 0xE7, 0xFF, 0xC7, 0x00, //   ###     ############# #########  ########      ###    #   #####################################             #########################        ##############      ####         ###########  #############   ###    
+	0x38, 0x3F, 0xFE, 0xFF, 0x1F, 0xFC, 0x71, 0x1F, 0xFF, 0x80, 0xE7, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0x10, 0x00, 0x0F, 0xFC, 0x1F, 0xC1, 0xFF, 0xE7, 0xFF, 0xC7, 0x00, //   ###     ############# ########   ###########   ###   #   ##############       ###  ############              #################   #                ##########     #######     ############  #############   ###    
+	0x38, 0x3F, 0xFF, 0xFF, 0x1F, 0xFC, 0x70, 0x3F, 0xFE, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0xFF, 0x7C, 0x00, 0x00, 0x03, 0xFE, 0x1F, 0xC1, 0xFF, 0xE7, 0xFF, 0xC7, 0x00, //   ###     ######################   ###########   ###      #############                ###########              ######## #####                        #########    #######     ############  #############   ###    
+	0x38, 0x3F, 0xFF, 0xFF, 0x1F, 0xFC, 0x70, 0x3F, 0xF0, 0x3F, 0x00, 0x39, 0xE0, 0x00, 0xFC, 0x70, 0x1F, 0xFF, 0xC0, 0x3E, 0x1F, 0xC1, 0xFF, 0xE7, 0xFF, 0xC7, 0x80, //   ###     ######################   ###########   ###      ##########      ######          ###  ####             ######   ###       ###############        #####    #######     ############  #############   ####   
+	0x38, 0x3F, 0xFF, 0xFF, 0x1F, 0xFC, 0x70, 0x7F, 0x81, 0xFF, 0xF8, 0x00, 0x30, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xC1, 0xFF, 0xF7, 0xFF, 0xE7, 0x80, //   ###     ######################   ###########   ###     ########      ##############             ##                            #####################             ########     ############# ##############  ####   
+	0x38, 0x3F, 0xFF, 0xFF, 0x1F, 0xFC, 0x70, 0x7C, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xC1, 0xFF, 0xF7, 0xFF, 0xE3, 0x80, //   ###     ######################   ###########   ###     #####       ###################                                    ############################        ##########     ############# ##############   ###   
+	0x38, 0x3F, 0xFF, 0xFF, 0x1F, 0xFC, 0xF8, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xFF, 0xE3, 0x80, //   ###     ######################   ###########  #####              ##########################                          ##############          ###########################     ############################   ###   
+	0x38, 0x3F, 0xFF, 0xFF, 0x0F, 0xFD, 0xFE, 0x00, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0xFF, 0xE3, 0x80, //   ###     ######################    ########## ########         #############     ################################################            ###########################      ############################   ###   
+	0x38, 0x3F, 0xFF, 0xFF, 0x0F, 0xF9, 0xFF, 0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0xFF, 0xE3, 0xC0, //   ###     ######################    #########  ################################    ################################################          ############################      ############################   ####  
+	0x38, 0x3F, 0xFF, 0xFF, 0x0F, 0xF9, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xFF, 0xE3, 0xE0, //   ###     ######################    #########  ################################   ###################################################      ##############################     #############################   ##### 
+	0x78, 0x3F, 0xFF, 0xFF, 0x0F, 0xFB, 0xFF, 0xFF, 0xF7, 0xFF, 0x3F, 0xF0, 0xFF, 0xFF, 0xE7, 0xFF, 0xFC, 0x3F, 0xFF, 0xF9, 0xFF, 0x83, 0xFF, 0xFF, 0xFF, 0xE1, 0xF0, //  ####     ######################    ######### ###################### ###########  ##########    ###################  #################    ###################  ##########     #############################    #####
+	0xF8, 0x3F, 0xFF, 0xFF, 0x0F, 0xFB, 0xFF, 0x7F, 0xF7, 0xFF, 0x3F, 0xF0, 0xFF, 0xFF, 0x0F, 0xFF, 0xFE, 0x3F, 0xFF, 0xF9, 0xFF, 0x83, 0xFF, 0xFF, 0xFF, 0xF0, 0xF0, // #####     ######################    ######### ########## ########### ###########  ##########    ################    ###################   ###################  ##########     ##############################    ####
+	0xF8, 0x3F, 0xFF, 0xFF, 0x0F, 0xFB, 0xFF, 0x3F, 0xF7, 0xFF, 0x3F, 0xF3, 0xFF, 0xFF, 0x1F, 0xFF, 0xFE, 0x7F, 0xFF, 0xF9, 0xFF, 0x83, 0xFF, 0xFF, 0x7F, 0xF0, 0x70, // #####     ######################    ######### ##########  ########## ###########  ##########  ##################   ####################  ####################  ##########     ################## ###########     ###
+	0xE0, 0x3F, 0xFF, 0xFF, 0x0F, 0xFB, 0xFF, 0x3F, 0xF7, 0xFF, 0xBF, 0xF3, 0xFF, 0xFF, 0xBF, 0xFF, 0xFE, 0x7F, 0xDF, 0xF9, 0xFF, 0x83, 0xFF, 0xFF, 0x7F, 0xF0, 0x70, // ###       ######################    ######### ##########  ########## ############ ##########  ################### #####################  ######### ##########  ##########     ################## ###########     ###
+	0xE0, 0x7F, 0xFF, 0xFF, 0x0F, 0xFB, 0xFF, 0x3F, 0xF7, 0xFF, 0xBF, 0xF7, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xCF, 0xF9, 0xFF, 0x83, 0xFF, 0xFF, 0x7F, 0xF8, 0x70, // ###      #######################    ######### ##########  ########## ############ ########## ##################### ###############################  #########  ##########     ################## ############    ###
+	0xE0, 0x7F, 0xDF, 0xFF, 0x0F, 0xFB, 0xFF, 0xBF, 0xF7, 0xFF, 0xDF, 0xEF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xCF, 0xF9, 0xFF, 0x87, 0xFF, 0xFF, 0x7F, 0xF8, 0x70, // ###      ######### #############    ######### ########### ########## ############# ######## ###################### ###############################  #########  ##########    ################### ############    ###
+	0xE0, 0x7F, 0xDF, 0xFF, 0x0F, 0xF9, 0xFF, 0xFF, 0xF7, 0xFF, 0xDF, 0xEF, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xCF, 0xF1, 0xFF, 0x87, 0xF7, 0xFF, 0x7F, 0xF8, 0x70, // ###      ######### #############    #########  ##################### ############# ######## ################################  ####################  ########   ##########    ####### ########### ############    ###
+	0xE0, 0x7F, 0xDF, 0xFF, 0x0F, 0xF9, 0xFF, 0xF3, 0xC7, 0xFF, 0xDF, 0xEF, 0xFC, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xCC, 0x01, 0xFF, 0x87, 0xF7, 0xFF, 0x7F, 0xF8, 0x70, // ###      ######### #############    #########  #############  ####   ############# ######## ##########  ####################  ####################  ##         ##########    ####### ########### ############    ###
+	0xE0, 0x7F, 0xEF, 0xFF, 0x0F, 0xF9, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xEF, 0xFC, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0x87, 0xF3, 0xFF, 0x3F, 0xF8, 0x70, // ###      ########## ############    #########  ###############       ###################### ##########  ####################  ######################           ##########    #######  ##########  ###########    ###
+	0xE0, 0x7F, 0xEF, 0xFF, 0x0F, 0xF8, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xEF, 0xFC, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0x81, 0xFF, 0x87, 0xF3, 0xFF, 0x7F, 0xF8, 0x70, // ###      ########## ############    #########   ################     ###################### ##########  ####################  ###########################      ##########    #######  ########## ############    ###
+	0xE0, 0x7F, 0xEF, 0xFF, 0x0F, 0xF8, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xEF, 0xFC, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xE1, 0xFF, 0x87, 0xF3, 0xFF, 0x7F, 0xF8, 0x70, // ###      ########## ############    #########   #################    ###################### ##########  ####################  #############################    ##########    #######  ########## ############    ###
+	0xE0, 0x7F, 0xEF, 0xFF, 0x0F, 0xF8, 0x7F, 0xFF, 0xC7, 0xFF, 0xFF, 0xEF, 0xFC, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0x8F, 0xF3, 0xFF, 0x7F, 0xF0, 0x70, // ###      ########## ############    #########    #################   ###################### ##########  ####################  ##############################   ##########   ########  ########## ###########     ###
+	0xE0, 0x1F, 0xE7, 0xFF, 0x8F, 0xF8, 0x1F, 0xFF, 0xC7, 0xFF, 0xFF, 0xEF, 0xFC, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0x8F, 0xF3, 0xFF, 0x7F, 0xC0, 0x70, // ###        ########  ############   #########      ###############   ###################### ##########  ###################   ###############################  ##########   ########  ########## #########       ###
+	0xF0, 0x07, 0xE7, 0xFF, 0x8F, 0xF8, 0x0F, 0xFF, 0xE7, 0xFF, 0xFF, 0xEF, 0xFC, 0xFF, 0xFE, 0x03, 0xFF, 0x7F, 0xFF, 0xF9, 0xFF, 0x8F, 0xFB, 0xFF, 0x7F, 0x00, 0xF0, // ####         ######  ############   #########       ###############  ###################### ##########  ###############       ########## ####################  ##########   ######### ########## #######        ####
+	0xFC, 0x01, 0xE7, 0xFF, 0x9F, 0xF8, 0xF7, 0xFF, 0xE7, 0xFF, 0xFF, 0xEF, 0xFC, 0xFF, 0xC0, 0x03, 0xFF, 0x7F, 0xFF, 0xFD, 0xFF, 0x8F, 0xFB, 0xFF, 0x78, 0x03, 0xF0, // ######         ####  ############  ##########   #### ##############  ###################### ##########  ##########            ########## ##################### ##########   ######### ########## ####         ######
+	0xFF, 0x80, 0x07, 0xFF, 0x9F, 0xF9, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xEF, 0xFC, 0xFF, 0xC0, 0x03, 0xFF, 0x3F, 0xFF, 0xFD, 0xFF, 0x8F, 0xFB, 0xFF, 0x60, 0x1F, 0xF0, // #########            ############  ##########  ##################### ###################### ##########  ##########            ##########  #################### ##########   ######### ########## ##        #########
+	0x3F, 0xF0, 0x03, 0xFF, 0x9F, 0xFD, 0xFF, 0x7F, 0xF7, 0xFF, 0xFF, 0xEF, 0xFC, 0xFF, 0xC0, 0x03, 0xFF, 0x1F, 0xFF, 0xFD, 0xFF, 0x9F, 0xFB, 0xFE, 0x00, 0xFF, 0xC0, //   ##########          ###########  ########### ######### ########### ###################### ##########  ##########            ##########   ################### ##########  ########## #########         ##########  
+	0x07, 0xFC, 0x01, 0xFF, 0x9F, 0xFD, 0xFF, 0x3F, 0xF7, 0xFF, 0xFF, 0xEF, 0xFC, 0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x7F, 0xFD, 0xFF, 0xDF, 0xFB, 0xFC, 0x03, 0xFE, 0x00, //      #########         ##########  ########### #########  ########## ###################### ##########  ##########            ##########         ############# ########### ########## ########        #########     
+	0x01, 0xFF, 0x80, 0x3F, 0x9F, 0xFD, 0xFF, 0x3F, 0xF7, 0xFF, 0xFF, 0xEF, 0xFC, 0xFF, 0xC0, 0x03, 0xFF, 0x01, 0xDF, 0xFD, 0xFF, 0xFF, 0xFB, 0xE0, 0x1F, 0xF8, 0x00, //        ##########         #######  ########### #########  ########## ###################### ##########  ##########            ##########       ### ########### ###################### #####        ##########       
+	0x00, 0x3F, 0xF0, 0x0F, 0x9F, 0xFD, 0xFF, 0xBF, 0xF7, 0xFF, 0xFF, 0xEF, 0xFC, 0xFF, 0xCF, 0xF3, 0xFF, 0x7F, 0xCF, 0xFD, 0xFF, 0xFF, 0xFB, 0x00, 0xFF, 0xC0, 0x00, //           ##########        #####  ########### ########## ########## ###################### ##########  ##########  ########  ########## #########  ########## ###################### ##        ##########          
+	0x00, 0x07, 0xFC, 0x00, 0x1F, 0xFD, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xEF, 0xFC, 0xFF, 0xDF, 0xF3, 0xFF, 0x7F, 0xCF, 0xF9, 0xFF, 0xFF, 0xF0, 0x03, 0xFE, 0x00, 0x00, //              #########             ########### ##################### ###################### ##########  ########## #########  ########## #########  #########  #####################          #########             
+	0x00, 0x01, 0xFF, 0x80, 0x1F, 0xFD, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xEF, 0xFC, 0xFF, 0xFF, 0xF3, 0xFF, 0x7F, 0xCF, 0xFB, 0xFF, 0xFF, 0xC0, 0x3F, 0xF8, 0x00, 0x00, //                ##########          ########### ##################### ###################### ##########  ####################  ########## #########  ######### ####################        ###########               
+	0x00, 0x00, 0x3F, 0xC0, 0x03, 0xFD, 0xFF, 0xFF, 0xF7, 0xFB, 0xFF, 0xEF, 0xFC, 0xFF, 0xFF, 0xF3, 0xFF, 0x7F, 0xFF, 0xFB, 0xFF, 0xFE, 0x00, 0x7F, 0xC0, 0x00, 0x00, //                   ########            ######## ##################### ######## ############# ##########  ####################  ########## #################### #################          #########                  
+	0x00, 0x00, 0x07, 0xC0, 0x00, 0x38, 0xFF, 0xFF, 0xF7, 0xFD, 0xFF, 0xEF, 0xFC, 0xFF, 0xFF, 0xF3, 0xFF, 0x7F, 0xFF, 0xF3, 0xFF, 0xA0, 0x30, 0x7E, 0x00, 0x00, 0x00, //                      #####                ###   #################### ######### ############ ##########  ####################  ########## ###################  ########### #       ##     ######                     
+	0x00, 0x00, 0x01, 0xC0, 0x18, 0x00, 0x3F, 0xFF, 0xEF, 0xFD, 0xFF, 0xEF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xF3, 0xFE, 0x03, 0xFC, 0x70, 0x00, 0x00, 0x00, //                        ###         ##             ################# ########## ############ ########### ###############################  ###################  #########       ########   ###                        
+	0x00, 0x00, 0x01, 0xC2, 0x1F, 0x00, 0x1F, 0xFF, 0xCF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFE, 0xFF, 0xFF, 0xE3, 0xE0, 0x0F, 0xFC, 0x70, 0x00, 0x00, 0x00, //                        ###    #    #####           ###############  ########## ################################### #################### ###################   #####         ##########   ###                        
+	0x00, 0x00, 0x01, 0xC3, 0xDE, 0x00, 0x07, 0xFF, 0x8F, 0xFC, 0xFF, 0xF7, 0xFF, 0xFF, 0xDF, 0xFF, 0xFE, 0xFF, 0xFF, 0x82, 0x03, 0x1F, 0xBC, 0x70, 0x00, 0x00, 0x00, //                        ###    #### ####              ############   ##########  ############ ##################### #################### #################     #       ##   ###### ####   ###                        
+	0x00, 0x00, 0x01, 0xC3, 0xFE, 0x3F, 0x81, 0xFF, 0x0F, 0xFC, 0xFF, 0xF7, 0xFF, 0xFF, 0xBF, 0xFF, 0xFC, 0xFF, 0xFF, 0x00, 0x1E, 0x3E, 0x3C, 0x70, 0x00, 0x00, 0x00, //                        ###    #########   #######      #########    ##########  ############ #################### ####################  ################           ####   #####   ####   ###                        
+	0x00, 0x00, 0x01, 0xCB, 0xFE, 0x7F, 0xE0, 0x00, 0x0F, 0xFC, 0xFF, 0xF7, 0xFF, 0xFF, 0x3F, 0xFF, 0xF8, 0x7F, 0xFE, 0x02, 0x1E, 0x3C, 0x3C, 0x70, 0x00, 0x00, 0x00, //                        ###  # #########  ##########                 ##########  ############ ###################  ###################    ##############       #    ####   ####    ####   ###                        
+	0x00, 0x00, 0x01, 0xCF, 0x9E, 0x7F, 0xF0, 0x00, 0x03, 0xFC, 0x7F, 0xF3, 0xFF, 0xFE, 0x3F, 0xFF, 0xF0, 0x0F, 0xE0, 0x3E, 0x1E, 0x3C, 0x3C, 0x70, 0x00, 0x00, 0x00, //                        ###  #####  ####  ###########                  ########   ###########  #################   ##################        #######       #####    ####   ####    ####   ###                        
+	0x00, 0x00, 0x01, 0xCF, 0xFE, 0x78, 0x78, 0x01, 0x00, 0x08, 0x7F, 0xF1, 0xFF, 0xFC, 0x0F, 0xFF, 0xE0, 0x00, 0x0F, 0x9F, 0x9E, 0x3C, 0x3E, 0x70, 0x00, 0x00, 0x00, //                        ###  ###########  ####    ####          #            #    ###########   ###############      ###############                 #####  ######  ####   ####    #####  ###                        
+	0x00, 0x00, 0x01, 0xCF, 0xFE, 0x78, 0x3C, 0x01, 0xF0, 0x00, 0x07, 0xC0, 0xFF, 0xF8, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0x1F, 0xDE, 0x3C, 0x3C, 0x70, 0x00, 0x00, 0x00, //                        ###  ###########  ####     ####         #####                 #####      #############         ##########                    ####   ####### ####   ####    ####   ###                        
+	0x00, 0x00, 0x01, 0xC0, 0x7E, 0x78, 0x3C, 0x01, 0xE0, 0x04, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x7C, 0x0F, 0x1F, 0xFE, 0x3C, 0x00, 0x70, 0x00, 0x00, 0x00, //                        ###       ######  ####     ####         ####          #                     #######                               #####      ####   ############   ####           ###                        
+	0x00, 0x00, 0x01, 0xC0, 0x0F, 0x3E, 0x3C, 0x01, 0xE0, 0x07, 0xC3, 0x00, 0x00, 0x00, 0x00, 0x47, 0xF0, 0x7C, 0x0F, 0x1F, 0xFE, 0x3C, 0x00, 0x70, 0x00, 0x00, 0x00, //                        ###          ####  #####   ####         ####          #####    ##                                 #   #######     #####      ####   ############   ####           ###                        
+	0x00, 0x00, 0x01, 0xC0, 0x01, 0x1F, 0xFC, 0x01, 0xE0, 0x07, 0x83, 0xE1, 0xFE, 0x1F, 0x3E, 0x7F, 0xE0, 0xFE, 0x0F, 0x1C, 0xFE, 0x70, 0x00, 0x70, 0x00, 0x00, 0x00, //                        ###             #   ###########         ####          ####     #####    ########    #####  #####  ##########     #######     ####   ###  #######  ###             ###                        
+	0x00, 0x00, 0x01, 0xC0, 0x00, 0x0F, 0xF8, 0x03, 0xF0, 0x07, 0x81, 0xC7, 0xFF, 0x9F, 0x1E, 0x7F, 0xE0, 0xFF, 0x0F, 0x1C, 0x3E, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, //                        ###                  #########         ######         ####      ###   ############  #####   ####  ##########     ########    ####   ###    #####                  ###                        
+	0x00, 0x00, 0x01, 0xFF, 0xF8, 0x01, 0xF0, 0x07, 0xF8, 0x07, 0x81, 0xC7, 0xFF, 0x87, 0x9E, 0x41, 0xE1, 0xFF, 0x0F, 0x1E, 0x30, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, //                        ##############          #####         ########        ####      ###   ############    ####  ####  #     ####    #########    ####   ####   ##           #############                        
+	0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0x7C, 0x07, 0x81, 0xC7, 0x83, 0x07, 0xFE, 0x7F, 0xE1, 0xCF, 0x8F, 0x3E, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x00, //                        #################                   ##### #####       ####      ###   ####     ##     ##########  ##########    ###  #####   ####  #####            #################                        
+	0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0x3C, 0x67, 0x81, 0xC7, 0xFF, 0x1F, 0xFE, 0x7F, 0xE3, 0xC7, 0x8F, 0x80, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, //                        ######################              #####  ####   ##  ####      ###   ###########   ############  ##########   ####   ####   #####              #####################                        
+	0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x02, 0x3E, 0x7F, 0xE9, 0xC3, 0xFF, 0x9F, 0xFE, 0x69, 0xE3, 0x87, 0xC8, 0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, //                        ##########################             #   #####  ########## #  ###    ###########  ############  ## #  ####   ###    #####  #              #########################                        
+	0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x0F, 0x7F, 0xF9, 0xC3, 0x9F, 0x9E, 0x1E, 0x7F, 0xE7, 0x84, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, //                                        ##############               #### ############  ###    ###  ######  ####    ####  ##########  ####    #                 ##############                                       
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x6F, 0xFB, 0xE7, 0xFF, 0x9F, 0xFE, 0x7F, 0xF7, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, //                                            ################              ## ######### #####  ############  ############  ########### ###                 ################                                           
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x0B, 0xE7, 0xFF, 0x0F, 0xFE, 0x7C, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //                                                ##################                   # #####  ###########    ###########  #####                     ##################                                               
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //                                                     ###################                                                                      ###################                                                    
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //                                                          ########################                                                  ########################                                                         
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //                                                                ################################                      ################################                                                               
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //                                                                      ##########################################################################                                                                     
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //                                                                              ##########################################################                                                                             
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //                                                                                            ##############################                                                                                           
+};
+
+/* Bitmap sizes for bucky2 */
+const uint8_t bucky2WidthPixels = 212;
+const uint8_t bucky2HeightPixels = 135;
+
+
+
+
+
+
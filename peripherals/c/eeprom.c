@@ -1,267 +1,558 @@
-#include "eeprom.h"
-
-//*****************************************************************************
-// Used to determine if the EEPROM is busy writing the last transaction to 
-// non-volatile storage
-//
-// Paramters
-//    i2c_base:   a valid base address of an I2C peripheral
-//
-// Returns
-// I2C_OK is returned one the EEPROM is ready to write the next byte
-//*****************************************************************************
-static 
-i2c_status_t eeprom_wait_for_write( int32_t  i2c_base)
-{
-  
-  i2c_status_t status;
-  
-  if( !i2cVerifyBaseAddr(i2c_base) )
-  {
-    return  I2C_INVALID_BASE;
-  }
-
-  // Set the I2C address to be the EEPROM and in Write Mode
-  status = i2cSetSlaveAddr(i2c_base, MCP24LC32AT_DEV_ID, I2C_WRITE);
-
-  // Poll while the device is busy.  The  MCP24LC32AT will not ACK
-  // writing an address while the write has not finished.
-  do 
-  {
-    // The data we send does not matter.  This has been set to 0x00, but could
-    // be set to anything
-    status = i2cSendByte( i2c_base, 0x00, I2C_MCS_START | I2C_MCS_RUN | I2C_MCS_STOP);
-    
-    // Wait for the address to finish transmitting
-    while ( I2CMasterBusy(i2c_base)) {};
-    
-    // If the address was not ACKed, try again.
-  } while (I2CMasterAdrAck(i2c_base) == false);
-
-  return  status;
-}
-  
-  
-//*****************************************************************************
-// Writes a single byte of data out to the  MCP24LC32AT EEPROM.  
-//
-// Paramters
-//    i2c_base:   a valid base address of an I2C peripheral
-//
-//    address:    16-bit address of the byte being written.  Only the lower
-//                12 bits is used by the EEPROM
-//
-//    data:       Data written to the EEPROM.
-//
-// Returns
-// I2C_OK if the byte was written to the EEPROM.
-//*****************************************************************************
-i2c_status_t eeprom_byte_write
-( 
-  uint32_t  i2c_base,
-  uint16_t  address,
-  uint8_t   data
-)
-{
-  i2c_status_t status;
-  
-  // Before doing anything, make sure the I2C device is idle
-  while ( I2CMasterBusy(i2c_base)) {};
-
-  //==============================================================
-  // Set the I2C address to be the EEPROM
-	// ADD CODE
-  //==============================================================
-	status = i2cSetSlaveAddr(i2c_base, MCP24LC32AT_DEV_ID, I2C_WRITE);
-	if ( status != I2C_OK )
-     return status;
-	
-		
-  // If the EEPROM is still writing the last byte written, wait
-  eeprom_wait_for_write(i2c_base);
-  
-  //==============================================================
-  // Send the Upper byte of the address
-	// ADD CODE	
-  //==============================================================
-	// send control byte and 1st data byte
-	status = i2cSendByte(
-     i2c_base,
-     (address>>8) & 0x0F , // mask
-     I2C_MCS_START | I2C_MCS_RUN
-	);
-	if ( status != I2C_OK )
-     return status;
-  
-  //==============================================================
-  // Send the Lower byte of the address
-	// ADD CODE
-  //==============================================================
-	i2cSendByte(
-     i2c_base,
-     address & 0xFF ,
-     I2C_MCS_RUN
-	);
-	if ( status != I2C_OK )
-     return status;
-	
-  //==============================================================
-  // Send the Byte of data to write
-	// ADD CODE
-  //==============================================================
-	i2cSendByte(
-     i2c_base,
-     data,
-     I2C_MCS_RUN | I2C_MCS_STOP
-	);
-	
-  return status;
-}
-
-//*****************************************************************************
-// Reads a single byte of data from the  MCP24LC32AT EEPROM.  
-//
-// Paramters
-//    i2c_base:   a valid base address of an I2C peripheral
-//
-//    address:    16-bit address of the byte being read.  Only the lower
-//                12 bits is used by the EEPROM
-//
-//    data:       data read from the EEPROM is returned to a uint8_t pointer.
-//
-// Returns
-// I2C_OK if the byte was read from the EEPROM.
-//*****************************************************************************
-i2c_status_t eeprom_byte_read
-( 
-  uint32_t  i2c_base,
-  uint16_t  address,
-  uint8_t   *data
-)
-{
-  i2c_status_t status;
-  
-  // Before doing anything, make sure the I2C device is idle
-  while ( I2CMasterBusy(i2c_base)) {};
-
-  // If the EEPROM is still writing the last byte written, wait
-  eeprom_wait_for_write(i2c_base);
-
-  //==============================================================
-  // Set the I2C slave address to be the EEPROM and in Write Mode
-	// ADD CODE
-  //==============================================================
-	status = i2cSetSlaveAddr(i2c_base, MCP24LC32AT_DEV_ID, I2C_WRITE);
-	if ( status != I2C_OK )
-     return status;
-  
-
-  //==============================================================
-  // Send the Upper byte of the address
-	// ADD CODE	
-  //==============================================================
-	// send control byte and 1st data byte
-	status = i2cSendByte(
-     i2c_base,
-     (address>>8) & 0x0F , // mask
-     I2C_MCS_START | I2C_MCS_RUN
-	);
-	if ( status != I2C_OK )
-     return status;
-  
-  //==============================================================
-  // Send the Lower byte of the address
-	// ADD CODE
-  //==============================================================
-	i2cSendByte(
-     i2c_base,
-     address & 0xFF ,
-     I2C_MCS_RUN
-	);
-	if ( status != I2C_OK )
-     return status;
-
-  //==============================================================
-  // Set the I2C slave address to be the EEPROM and in Read Mode
-	// ADD CODE
-  //==============================================================
-	status = i2cSetSlaveAddr(i2c_base, MCP24LC32AT_DEV_ID, I2C_READ);
-	if ( status != I2C_OK )
-     return status;
-  
-
-  //==============================================================
-  // Read the data returned by the EEPROM
-	// ADD CODE
-  //==============================================================
-  status = i2cGetByte(
-     i2c_base,
-     data,
-     I2C_MCS_START | I2C_MCS_RUN | I2C_MCS_STOP
-	);
-	if ( status != I2C_OK )
-     return status;
-  
-  return I2C_OK;
-}
-
-//*****************************************************************************
-// Initialize the I2C peripheral
-//*****************************************************************************
-bool eeprom_init(void)
-{
-  
-  if(gpio_enable_port(EEPROM_GPIO_BASE) == false)
-  {
-    return false;
-  }
-  
-  // Configure SCL 
-  if(gpio_config_digital_enable(EEPROM_GPIO_BASE, EEPROM_I2C_SCL_PIN)== false)
-  {
-    return false;
-  }
-    
-  if(gpio_config_alternate_function(EEPROM_GPIO_BASE, EEPROM_I2C_SCL_PIN)== false)
-  {
-    return false;
-  }
-    
-  if(gpio_config_port_control(EEPROM_GPIO_BASE, EEPROM_I2C_SCL_PCTL_M, EEPROM_I2C_SCL_PIN_PCTL)== false)
-  {
-    return false;
-  }
-    
-
-  
-  // Configure SDA 
-  if(gpio_config_digital_enable(EEPROM_GPIO_BASE, EEPROM_I2C_SDA_PIN)== false)
-  {
-    return false;
-  }
-    
-  if(gpio_config_open_drain(EEPROM_GPIO_BASE, EEPROM_I2C_SDA_PIN)== false)
-  {
-    return false;
-  }
-    
-  if(gpio_config_alternate_function(EEPROM_GPIO_BASE, EEPROM_I2C_SDA_PIN)== false)
-  {
-    return false;
-  }
-    
-  if(gpio_config_port_control(EEPROM_GPIO_BASE, EEPROM_I2C_SDA_PCTL_M, EEPROM_I2C_SDA_PIN_PCTL)== false)
-  {
-    return false;
-  }
-    
-  //  Initialize the I2C peripheral
-  if( initializeI2CMaster(EEPROM_I2C_BASE)!= I2C_OK)
-  {
-    return false;
-  }
-  
-  return true;
-  
-}
-
+#include "eeprom.h"
+#include "i2c_bus.h"
+#include "profile_zones.h"
+
+//*****************************************************************************
+// Gives up the I2C bus at the end of an EEPROM operation and passes the 
+// status through.
+//*****************************************************************************
+static i2c_status_t eeprom_release(i2c_status_t status)
+{
+  i2c_bus_release(I2C_BUS_PERSIST);
+  return status;
+}
+
+//*****************************************************************************
+// Ends a write, which is timed as PROFILE_ZONE_EEPROM including any wait 
+// for the previous write cycle.
+//*****************************************************************************
+static i2c_status_t eeprom_write_done(i2c_status_t status)
+{
+  PROFILE_END(PROFILE_ZONE_EEPROM);
+  return eeprom_release(status);
+}
+
+//*****************************************************************************
+// Used to determine if the EEPROM is busy writing the last transaction to 
+// non-volatile storage
+//
+// Paramters
+//    i2c_base:   a valid base address of an I2C peripheral
+//
+// Returns
+// I2C_OK is returned one the EEPROM is ready to write the next byte
+//*****************************************************************************
+static 
+i2c_status_t eeprom_wait_for_write( int32_t  i2c_base)
+{
+  
+  i2c_status_t status;
+  bool acked;
+  
+  if( !i2cVerifyBaseAddr(i2c_base) )
+  {
+    return  I2C_INVALID_BASE;
+  }
+
+  // Set the I2C address to be the EEPROM and in Write Mode
+  status = i2cSetSlaveAddr(i2c_base, MCP24LC32AT_DEV_ID, I2C_WRITE);
+
+  // Poll while the device is busy.  The  MCP24LC32AT will not ACK
+  // writing an address while the write has not finished.
+  do 
+  {
+    // The data we send does not matter.  This has been set to 0x00, but could
+    // be set to anything
+    status = i2cSendByte( i2c_base, 0x00, I2C_MCS_START | I2C_MCS_RUN | I2C_MCS_STOP);
+    
+    // Wait for the address to finish transmitting
+    while ( I2CMasterBusy(i2c_base)) {};
+    
+    // If the address was not ACKed, let higher priority bus clients in and
+    // try again.  A write cycle takes up to 5ms.
+    acked = I2CMasterAdrAck(i2c_base);
+    if ( !acked )
+      i2c_bus_yield(I2C_BUS_PERSIST);
+  } while ( !acked );
+
+  return  status;
+}
+  
+  
+//*****************************************************************************
+// Writes a single byte of data out to the  MCP24LC32AT EEPROM.  
+//
+// Paramters
+//    i2c_base:   a valid base address of an I2C peripheral
+//
+//    address:    16-bit address of the byte being written.  Only the lower
+//                12 bits is used by the EEPROM
+//
+//    data:       Data written to the EEPROM.
+//
+// Returns
+// I2C_OK if the byte was written to the EEPROM.
+//*****************************************************************************
+i2c_status_t eeprom_byte_write
+( 
+  uint32_t  i2c_base,
+  uint16_t  address,
+  uint8_t   data
+)
+{
+  i2c_status_t status;
+  
+  PROFILE_BEGIN(PROFILE_ZONE_EEPROM);
+  if ( !i2c_bus_acquire(I2C_BUS_PERSIST) )
+  {
+    PROFILE_END(PROFILE_ZONE_EEPROM);
+    return I2C_BUS_BUSY;
+  }
+  
+  // Before doing anything, make sure the I2C device is idle
+  while ( I2CMasterBusy(i2c_base)) {};
+
+  //==============================================================
+  // Set the I2C address to be the EEPROM
+	// ADD CODE
+  //==============================================================
+	status = i2cSetSlaveAddr(i2c_base, MCP24LC32AT_DEV_ID, I2C_WRITE);
+	if ( status != I2C_OK )
+     return eeprom_write_done(status);
+	
+		
+  // If the EEPROM is still writing the last byte written, wait
+  eeprom_wait_for_write(i2c_base);
+  
+  //==============================================================
+  // Send the Upper byte of the address
+	// ADD CODE	
+  //==============================================================
+	// send control byte and 1st data byte
+	status = i2cSendByte(
+     i2c_base,
+     (address>>8) & 0x0F , // mask
+     I2C_MCS_START | I2C_MCS_RUN
+	);
+	if ( status != I2C_OK )
+     return eeprom_write_done(status);
+  
+  //==============================================================
+  // Send the Lower byte of the address
+	// ADD CODE
+  //==============================================================
+	i2cSendByte(
+     i2c_base,
+     address & 0xFF ,
+     I2C_MCS_RUN
+	);
+	if ( status != I2C_OK )
+     return eeprom_write_done(status);
+	
+  //==============================================================
+  // Send the Byte of data to write
+	// ADD CODE
+  //==============================================================
+	i2cSendByte(
+     i2c_base,
+     data,
+     I2C_MCS_RUN | I2C_MCS_STOP
+	);
+	
+  return eeprom_write_done(status);
+}
+
+//*****************************************************************************
+// Reads a single byte of data from the  MCP24LC32AT EEPROM.  
+//
+// Paramters
+//    i2c_base:   a valid base address of an I2C peripheral
+//
+//    address:    16-bit address of the byte being read.  Only the lower
+//                12 bits is used by the EEPROM
+//
+//    data:       data read from the EEPROM is returned to a uint8_t pointer.
+//
+// Returns
+// I2C_OK if the byte was read from the EEPROM.
+//*****************************************************************************
+i2c_status_t eeprom_byte_read
+( 
+  uint32_t  i2c_base,
+  uint16_t  address,
+  uint8_t   *data
+)
+{
+  i2c_status_t status;
+  
+  if ( !i2c_bus_acquire(I2C_BUS_PERSIST) )
+  {
+    return I2C_BUS_BUSY;
+  }
+  
+  // Before doing anything, make sure the I2C device is idle
+  while ( I2CMasterBusy(i2c_base)) {};
+
+  // If the EEPROM is still writing the last byte written, wait
+  eeprom_wait_for_write(i2c_base);
+
+  //==============================================================
+  // Set the I2C slave address to be the EEPROM and in Write Mode
+	// ADD CODE
+  //==============================================================
+	status = i2cSetSlaveAddr(i2c_base, MCP24LC32AT_DEV_ID, I2C_WRITE);
+	if ( status != I2C_OK )
+     return eeprom_release(status);
+  
+
+  //==============================================================
+  // Send the Upper byte of the address
+	// ADD CODE	
+  //==============================================================
+	// send control byte and 1st data byte
+	status = i2cSendByte(
+     i2c_base,
+     (address>>8) & 0x0F , // mask
+     I2C_MCS_START | I2C_MCS_RUN
+	);
+	if ( status != I2C_OK )
+     return eeprom_release(status);
+  
+  //==============================================================
+  // Send the Lower byte of the address
+	// ADD CODE
+  //==============================================================
+	i2cSendByte(
+     i2c_base,
+     address & 0xFF ,
+     I2C_MCS_RUN
+	);
+	if ( status != I2C_OK )
+     return eeprom_release(status);
+
+  //==============================================================
+  // Set the I2C slave address to be the EEPROM and in Read Mode
+	// ADD CODE
+  //==============================================================
+	status = i2cSetSlaveAddr(i2c_base, MCP24LC32AT_DEV_ID, I2C_READ);
+	if ( status != I2C_OK )
+     return eeprom_release(status);
+  
+
+  //==============================================================
+  // Read the data returned by the EEPROM
+	// ADD CODE
+  //==============================================================
+  status = i2cGetByte(
+     i2c_base,
+     data,
+     I2C_MCS_START | I2C_MCS_RUN | I2C_MCS_STOP
+	);
+	if ( status != I2C_OK )
+     return eeprom_release(status);
+  
+  return eeprom_release(I2C_OK);
+}
+
+//*****************************************************************************
+// Checks once if the MCP24LC32AT is still busy with an internal write cycle.
+// Unlike the read and write functions this never waits for the write cycle 
+// to finish.
+//
+// Paramters
+//    i2c_base:   a valid base address of an I2C peripheral
+//
+// Returns
+// true if the EEPROM did not acknowledge its address.
+//*****************************************************************************
+bool eeprom_busy(uint32_t i2c_base)
+{
+  bool busy;
+  
+  if( !i2cVerifyBaseAddr(i2c_base) )
+  {
+    return false;
+  }
+  
+  // a handler that cannot have the bus treats the part as busy
+  if ( !i2c_bus_acquire(I2C_BUS_PERSIST) )
+  {
+    return true;
+  }
+  
+  while ( I2CMasterBusy(i2c_base)) {};
+  
+  i2cSetSlaveAddr(i2c_base, MCP24LC32AT_DEV_ID, I2C_WRITE);
+  i2cSendByte( i2c_base, 0x00, I2C_MCS_START | I2C_MCS_RUN | I2C_MCS_STOP);
+  
+  busy = I2CMasterAdrAck(i2c_base) == false;
+  i2c_bus_release(I2C_BUS_PERSIST);
+  
+  return busy;
+}
+
+//*****************************************************************************
+// Sends the control byte and the 16-bit address that the next write or 
+// sequential read starts at.  The transaction is left open.
+//*****************************************************************************
+static 
+i2c_status_t eeprom_send_address( uint32_t  i2c_base, uint16_t address)
+{
+  i2c_status_t status;
+  
+  status = i2cSetSlaveAddr(i2c_base, MCP24LC32AT_DEV_ID, I2C_WRITE);
+  if ( status != I2C_OK )
+     return status;
+  
+  // Upper byte of the address.  This also sends the control byte
+  status = i2cSendByte(
+     i2c_base,
+     (address>>8) & 0x0F , // mask
+     I2C_MCS_START | I2C_MCS_RUN
+  );
+  if ( status != I2C_OK )
+     return status;
+  
+  // Lower byte of the address
+  return i2cSendByte(
+     i2c_base,
+     address & 0xFF ,
+     I2C_MCS_RUN
+  );
+}
+
+//*****************************************************************************
+// Writes a block of data out to the MCP24LC32AT EEPROM.  The block is split 
+// on 32-byte page boundaries and each piece is written using a single page
+// write, so a block that fits inside one page costs one write cycle.
+//
+// Paramters
+//    i2c_base:   a valid base address of an I2C peripheral
+//
+//    address:    16-bit address of the first byte being written.  Only the 
+//                lower 12 bits is used by the EEPROM
+//
+//    data:       Data written to the EEPROM.
+//
+//    num_bytes:  Number of bytes to write.
+//
+// Returns
+// I2C_OK if the block was written to the EEPROM.
+//*****************************************************************************
+i2c_status_t eeprom_write_block
+( 
+  uint32_t  i2c_base,
+  uint16_t  address,
+  uint8_t   *data,
+  uint16_t  num_bytes
+)
+{
+  i2c_status_t status;
+  uint16_t page_bytes;
+  uint16_t i;
+  
+  if ( data == NULL )
+    return I2C_NULL_PTR;
+  
+  if ( (uint32_t)address + num_bytes > EEPROM_SIZE_BYTES )
+    return I2C_INVALID_PARAM;
+  
+  PROFILE_BEGIN(PROFILE_ZONE_EEPROM);
+  if ( !i2c_bus_acquire(I2C_BUS_PERSIST) )
+  {
+    PROFILE_END(PROFILE_ZONE_EEPROM);
+    return I2C_BUS_BUSY;
+  }
+  
+  // Before doing anything, make sure the I2C device is idle
+  while ( I2CMasterBusy(i2c_base)) {};
+  
+  while ( num_bytes > 0 )
+  {
+    // Never let a page write cross a page boundary.  The EEPROM would wrap
+    // around to the start of the page and overwrite data.
+    page_bytes = EEPROM_PAGE_SIZE - (address % EEPROM_PAGE_SIZE);
+    if ( page_bytes > num_bytes )
+      page_bytes = num_bytes;
+    
+    // If the EEPROM is still writing the last page written, wait
+    eeprom_wait_for_write(i2c_base);
+    
+    status = eeprom_send_address(i2c_base, address);
+    if ( status != I2C_OK )
+      return eeprom_write_done(status);
+    
+    // Data bytes, the last one of the page generates the STOP that starts 
+    // the internal write cycle.
+    for ( i = 0; i < page_bytes; i++)
+    {
+      status = i2cSendByte(
+         i2c_base,
+         data[i],
+         (i == page_bytes - 1) ? (I2C_MCS_RUN | I2C_MCS_STOP) : I2C_MCS_RUN
+      );
+      if ( status != I2C_OK )
+        return eeprom_write_done(status);
+    }
+    
+    address   += page_bytes;
+    data      += page_bytes;
+    num_bytes -= page_bytes;
+  }
+  
+  return eeprom_write_done(I2C_OK);
+}
+
+//*****************************************************************************
+// Reads a block of data from the MCP24LC32AT EEPROM using sequential reads
+// of at most EEPROM_READ_CHUNK bytes.  Higher priority I2C bus clients can 
+// use the bus between chunks.
+//
+// Paramters
+//    i2c_base:   a valid base address of an I2C peripheral
+//
+//    address:    16-bit address of the first byte being read.  Only the 
+//                lower 12 bits is used by the EEPROM
+//
+//    data:       data read from the EEPROM is returned to a uint8_t array.
+//
+//    num_bytes:  Number of bytes to read.
+//
+// Returns
+// I2C_OK if the block was read from the EEPROM.
+//*****************************************************************************
+i2c_status_t eeprom_read_block
+( 
+  uint32_t  i2c_base,
+  uint16_t  address,
+  uint8_t   *data,
+  uint16_t  num_bytes
+)
+{
+  i2c_status_t status;
+  uint8_t mcs;
+  uint16_t chunk_bytes;
+  uint16_t i;
+  
+  if ( data == NULL )
+    return I2C_NULL_PTR;
+  
+  if ( (uint32_t)address + num_bytes > EEPROM_SIZE_BYTES )
+    return I2C_INVALID_PARAM;
+  
+  if ( num_bytes == 0 )
+    return I2C_OK;
+  
+  if ( !i2c_bus_acquire(I2C_BUS_PERSIST) )
+  {
+    return I2C_BUS_BUSY;
+  }
+  
+  // Before doing anything, make sure the I2C device is idle
+  while ( I2CMasterBusy(i2c_base)) {};
+
+  // If the EEPROM is still writing the last byte written, wait
+  eeprom_wait_for_write(i2c_base);
+  
+  while ( num_bytes > 0 )
+  {
+    chunk_bytes = num_bytes;
+    if ( chunk_bytes > EEPROM_READ_CHUNK )
+      chunk_bytes = EEPROM_READ_CHUNK;
+    
+    status = eeprom_send_address(i2c_base, address);
+    if ( status != I2C_OK )
+      return eeprom_release(status);
+    
+    // Repeated START in Read Mode
+    status = i2cSetSlaveAddr(i2c_base, MCP24LC32AT_DEV_ID, I2C_READ);
+    if ( status != I2C_OK )
+      return eeprom_release(status);
+    
+    // ACK every byte but the last one so the EEPROM keeps incrementing its 
+    // internal address pointer.  The last byte is NACKed and followed by a STOP
+    for ( i = 0; i < chunk_bytes; i++)
+    {
+      mcs = I2C_MCS_RUN;
+      
+      if ( i == 0 )
+        mcs |= I2C_MCS_START;
+      
+      if ( i == chunk_bytes - 1 )
+        mcs |= I2C_MCS_STOP;
+      else
+        mcs |= I2C_MCS_ACK;
+      
+      status = i2cGetByte( i2c_base, &data[i], mcs);
+      if ( status != I2C_OK )
+        return eeprom_release(status);
+    }
+    
+    address   += chunk_bytes;
+    data      += chunk_bytes;
+    num_bytes -= chunk_bytes;
+    
+    // Let higher priority bus clients in between chunks
+    if ( num_bytes > 0 )
+      i2c_bus_yield(I2C_BUS_PERSIST);
+  }
+  
+  return eeprom_release(I2C_OK);
+}
+
+//*****************************************************************************
+// Initialize the I2C peripheral
+//*****************************************************************************
+bool eeprom_init(void)
+{
+  
+  if(gpio_enable_port(EEPROM_GPIO_BASE) == false)
+  {
+    return false;
+  }
+  
+  // Configure SCL 
+  if(gpio_config_digital_enable(EEPROM_GPIO_BASE, EEPROM_I2C_SCL_PIN)== false)
+  {
+    return false;
+  }
+    
+  if(gpio_config_alternate_function(EEPROM_GPIO_BASE, EEPROM_I2C_SCL_PIN)== false)
+  {
+    return false;
+  }
+    
+  if(gpio_config_port_control(EEPROM_GPIO_BASE, EEPROM_I2C_SCL_PCTL_M, EEPROM_I2C_SCL_PIN_PCTL)== false)
+  {
+    return false;
+  }
+    
+
+  
+  // Configure SDA 
+  if(gpio_config_digital_enable(EEPROM_GPIO_BASE, EEPROM_I2C_SDA_PIN)== false)
+  {
+    return false;
+  }
+    
+  if(gpio_config_open_drain(EEPROM_GPIO_BASE, EEPROM_I2C_SDA_PIN)== false)
+  {
+    return false;
+  }
+    
+  if(gpio_config_alternate_function(EEPROM_GPIO_BASE, EEPROM_I2C_SDA_PIN)== false)
+  {
+    return false;
+  }
+    
+  if(gpio_config_port_control(EEPROM_GPIO_BASE, EEPROM_I2C_SDA_PCTL_M, EEPROM_I2C_SDA_PIN_PCTL)== false)
+  {
+    return false;
+  }
+    
+  //  Initialize the I2C peripheral
+  if( initializeI2CMaster(EEPROM_I2C_BASE)!= I2C_OK)
+  {
+    return false;
+  }
+  
+  // Run the bus as fast as the EEPROM and the other devices on it allow
+  if( i2cRegisterDevice(EEPROM_I2C_BASE, MCP24LC32AT_DEV_ID, MCP24LC32AT_MAX_SCL_HZ)!= I2C_OK)
+  {
+    return false;
+  }
+  
+  return true;
+  
+}
+
@@ -0,0 +1,138 @@
+#include <string.h>
+#include "eeprom_journal.h"
+#include "crc.h"
+
+//*****************************************************************************
+// Returns the EEPROM address of a slot
+//*****************************************************************************
+static uint16_t eeprom_journal_slot_addr(eeprom_journal_t *journal, uint16_t slot)
+{
+  return journal->start_addr + slot * EEPROM_PAGE_SIZE;
+}
+
+//*****************************************************************************
+// Configures a journal over a region of the EEPROM and scans the region for
+// the newest valid record.
+//*****************************************************************************
+bool eeprom_journal_init
+(
+  eeprom_journal_t  *journal,
+  uint32_t          i2c_base,
+  uint16_t          start_addr,
+  uint16_t          num_slots,
+  uint8_t           payload_size,
+  void              *payload,
+  uint8_t           *version
+)
+{
+  uint8_t record[EEPROM_PAGE_SIZE];
+  uint8_t record_size;
+  uint16_t crc;
+  uint32_t sequence;
+  uint16_t newest_slot = 0;
+  uint16_t slot;
+  
+  if ( journal == NULL || payload == NULL || version == NULL )
+    return false;
+  
+  if ( 
+      (start_addr % EEPROM_PAGE_SIZE) != 0 ||
+      num_slots == 0 ||
+      (uint32_t)start_addr + num_slots * EEPROM_PAGE_SIZE > EEPROM_SIZE_BYTES ||
+      payload_size == 0 ||
+      payload_size > EEPROM_JOURNAL_MAX_PAYLOAD
+  )
+  {
+    return false;
+  }
+  
+  journal->i2c_base = i2c_base;
+  journal->start_addr = start_addr;
+  journal->num_slots = num_slots;
+  journal->payload_size = payload_size;
+  journal->sequence = 0;
+  journal->next_slot = 0;
+  
+  record_size = payload_size + EEPROM_JOURNAL_OVERHEAD;
+  
+  // Only the used part of each slot is read
+  for ( slot = 0; slot < num_slots; slot++)
+  {
+    if ( eeprom_read_block(i2c_base, eeprom_journal_slot_addr(journal, slot), record, record_size) != I2C_OK )
+      continue;
+    
+    if ( record[0] != EEPROM_JOURNAL_MAGIC )
+      continue;
+    
+    crc = record[record_size - 2] | (record[record_size - 1] << 8);
+    if ( crc16_ccitt(CRC16_INIT, record, record_size - 2) != crc )
+      continue;
+    
+    sequence = record[2] | (record[3] << 8) | (record[4] << 16) | ((uint32_t)record[5] << 24);
+    if ( sequence > journal->sequence )
+    {
+      journal->sequence = sequence;
+      newest_slot = slot;
+      *version = record[1];
+      memcpy(payload, &record[6], payload_size);
+    }
+  }
+  
+  if ( journal->sequence == 0 )
+    return false;
+  
+  journal->next_slot = (newest_slot + 1) % num_slots;
+  return true;
+}
+
+//*****************************************************************************
+// Appends a new record to the journal.  This is a single page write.
+//*****************************************************************************
+i2c_status_t eeprom_journal_append
+(
+  eeprom_journal_t  *journal,
+  uint8_t           version,
+  const void        *payload
+)
+{
+  uint8_t record[EEPROM_PAGE_SIZE];
+  uint8_t record_size;
+  uint32_t sequence;
+  uint16_t crc;
+  i2c_status_t status;
+  
+  if ( journal == NULL || payload == NULL )
+    return I2C_NULL_PTR;
+  
+  if ( journal->num_slots == 0 )
+    return I2C_INVALID_PARAM;
+  
+  record_size = journal->payload_size + EEPROM_JOURNAL_OVERHEAD;
+  sequence = journal->sequence + 1;
+  
+  record[0] = EEPROM_JOURNAL_MAGIC;
+  record[1] = version;
+  record[2] = sequence & 0xFF;
+  record[3] = (sequence >> 8) & 0xFF;
+  record[4] = (sequence >> 16) & 0xFF;
+  record[5] = (sequence >> 24) & 0xFF;
+  memcpy(&record[6], payload, journal->payload_size);
+  
+  crc = crc16_ccitt(CRC16_INIT, record, record_size - 2);
+  record[record_size - 2] = crc & 0xFF;
+  record[record_size - 1] = (crc >> 8) & 0xFF;
+  
+  status = eeprom_write_block(
+    journal->i2c_base, 
+    eeprom_journal_slot_addr(journal, journal->next_slot), 
+    record, 
+    record_size
+  );
+  if ( status != I2C_OK )
+    return status;
+  
+  journal->sequence = sequence;
+  journal->next_slot = (journal->next_slot + 1) % journal->num_slots;
+  
+  return I2C_OK;
+}
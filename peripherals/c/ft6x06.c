@@ -1,209 +1,346 @@
-#include "ft6x06.h"
-
-//*****************************************************************************
-// Sets the address to read/write from in the FT6x06  
-//
-// Paramters
-//    i2c_base:   a valid base address of an I2C peripheral
-//
-//    reg_address:    8-bit address of which register is going to be accessed.
-//                    This is NOT the same as the I2C device address.
-//
-// Returns
-// I2C_OK if the byte was written to the FT6X06.
-//*****************************************************************************
-static i2c_status_t ft6x06_set_addr
-( 
-  uint32_t  i2c_base,
-  uint8_t  reg_address
-)
-{
-  i2c_status_t status;
-  
-  // Before doing anything, make sure the I2C device is idle
-  while ( I2CMasterBusy(i2c_base)) {};
-
-  //==============================================================
-  // ADD CODE
-  // Set the I2C device address 
-  //==============================================================
-  status = i2cSetSlaveAddr(i2c_base, FT6X06_DEV_ID, I2C_WRITE); 
-  
-    
-  if ( status != I2C_OK )
-  {
-    return status;
-  }
-  
-  //==============================================================
-  // ADD CODE
-  // Send the register address
-  //==============================================================
-	i2cSendByte(i2c_base, reg_address ,I2C_MCS_START | I2C_MCS_RUN | I2C_MCS_STOP);
-
-  return status;
-}
-
-//*****************************************************************************
-// Reads one byte of data from the current address of the FT6x06  
-//
-// Paramters
-//    i2c_base:   a valid base address of an I2C peripheral
-//
-//    data:       data to read.
-//
-// Returns
-// I2C_OK if the byte was written to the FT6X06.
-//*****************************************************************************
-static i2c_status_t ft6x06_read_data
-( 
-  uint32_t  i2c_base,
-  uint8_t *data
-)
-{
-  i2c_status_t status;
-  
-  // Before doing anything, make sure the I2C device is idle
-  while ( I2CMasterBusy(i2c_base)) {};
-
-  //==============================================================
-  // ADD CODE
-  // Set the I2C address 
-  //==============================================================
-  status = i2cSetSlaveAddr(i2c_base, FT6X06_DEV_ID, I2C_READ); 
-      
-  
-  if ( status != I2C_OK )
-  {
-    return status;
-  }
-
-  //==============================================================
-  // ADD CODE
-  // get the data
-  //==============================================================
-  status = i2cGetByte( i2c_base, data , I2C_MCS_START | I2C_MCS_RUN | I2C_MCS_STOP);
-
-
-  return status;
-}
-
-
-//*****************************************************************************
-// Read the number of active touch points.
-//*****************************************************************************
-uint8_t ft6x06_read_td_status(void)
-{ 
-	uint8_t data;
-  // ADD CODE
-  // Return the number of active touch points.  The only valid values of the 
-  // register will be 0, 1, or 2.
-	ft6x06_set_addr(FT6X06_I2C_BASE, FT6X06_TD_STATUS_R);
-	ft6x06_read_data(FT6X06_I2C_BASE, &data);
-	return data;
-} 
-
-
-//*****************************************************************************
-// Read the X value of last touch event
-//*****************************************************************************
-uint16_t ft6x06_read_x(void)
-{ 
-	uint8_t xh;
-	uint8_t xl;
-	uint16_t x;
-  // ADD CODE
-  // Return the X coordinate of the last touch point
-  // This will require reading P1_XH and P1_XL
-	ft6x06_set_addr(FT6X06_I2C_BASE, FT6X06_P1_XH_R);
-	ft6x06_read_data(FT6X06_I2C_BASE, &xh);
-	ft6x06_set_addr(FT6X06_I2C_BASE, FT6X06_P1_XL_R);
-	ft6x06_read_data(FT6X06_I2C_BASE, &xl);
-	x = ((xh & 0xF)<<8) | xl; // combine upper and lower bits
-	x = 239-x; // set 0 to left side
-	return x;
-} 
-
-//*****************************************************************************
-// Read the Y value of last touch event
-//*****************************************************************************
-uint16_t ft6x06_read_y(void)
-{ 
-	uint8_t yh;
-	uint8_t yl;
-	uint16_t y;
-  // ADD CODE
-  // Return the Y coordinate of the last touch point 
-  // This will require reading P1_YH and P1_YL
-	ft6x06_set_addr(FT6X06_I2C_BASE, FT6X06_P1_YH_R);
-	ft6x06_read_data(FT6X06_I2C_BASE, &yh);
-	ft6x06_set_addr(FT6X06_I2C_BASE, FT6X06_P1_YL_R);
-	ft6x06_read_data(FT6X06_I2C_BASE, &yl);
-	y = ((yh & 0xF)<<8) | yl; // combine upper and lower 8 bits
-	y = 319-y; // set 0 to left side
-	return y;
-} 
-
-//*****************************************************************************
-// Test the ft6x06
-//*****************************************************************************
-bool ft6x06_init(void)
-{ 
-  //==============================
-  // Configure I2C GPIO Pins
-  //==============================  
-  if(gpio_enable_port(FT6X06_GPIO_BASE) == false)
-  {
-    return false;
-  }
-  
-  // Configure SCL 
-  if(gpio_config_digital_enable(FT6X06_GPIO_BASE, FT6X06_I2C_SCL_PIN)== false)
-  {
-    return false;
-  }
-    
-  if(gpio_config_alternate_function(FT6X06_GPIO_BASE, FT6X06_I2C_SCL_PIN)== false)
-  {
-    return false;
-  }
-    
-  if(gpio_config_port_control(FT6X06_GPIO_BASE, FT6X06_I2C_SCL_PCTL_M, FT6X06_I2C_SCL_PIN_PCTL)== false)
-  {
-    return false;
-  }
-    
-
-  
-  // Configure SDA 
-  if(gpio_config_digital_enable(FT6X06_GPIO_BASE, FT6X06_I2C_SDA_PIN)== false)
-  {
-    return false;
-  }
-    
-  if(gpio_config_open_drain(FT6X06_GPIO_BASE, FT6X06_I2C_SDA_PIN)== false)
-  {
-    return false;
-  }
-    
-  if(gpio_config_alternate_function(FT6X06_GPIO_BASE, FT6X06_I2C_SDA_PIN)== false)
-  {
-    return false;
-  }
-    
-  if(gpio_config_port_control(FT6X06_GPIO_BASE, FT6X06_I2C_SDA_PCTL_M, FT6X06_I2C_SDA_PIN_PCTL)== false)
-  {
-    return false;
-  }
-  
-  
-  //  Initialize the I2C peripheral
-  if( initializeI2CMaster(FT6X06_I2C_BASE)!= I2C_OK)
-  {
-    return false;
-  }
-  
-  return true;
-  
-} 
-
+#include "ft6x06.h"
+#include "i2c_bus.h"
+#include "profile_zones.h"
+
+// Last reading of the posted touch job
+static volatile ft6x06_touch_t lastTouch;
+
+//*****************************************************************************
+// Sets the address to read/write from in the FT6x06  
+//
+// Paramters
+//    i2c_base:   a valid base address of an I2C peripheral
+//
+//    reg_address:    8-bit address of which register is going to be accessed.
+//                    This is NOT the same as the I2C device address.
+//
+// Returns
+// I2C_OK if the byte was written to the FT6X06.
+//*****************************************************************************
+static i2c_status_t ft6x06_set_addr
+( 
+  uint32_t  i2c_base,
+  uint8_t  reg_address
+)
+{
+  i2c_status_t status;
+  
+  // Before doing anything, make sure the I2C device is idle
+  while ( I2CMasterBusy(i2c_base)) {};
+
+  //==============================================================
+  // ADD CODE
+  // Set the I2C device address 
+  //==============================================================
+  status = i2cSetSlaveAddr(i2c_base, FT6X06_DEV_ID, I2C_WRITE); 
+  
+    
+  if ( status != I2C_OK )
+  {
+    return status;
+  }
+  
+  //==============================================================
+  // ADD CODE
+  // Send the register address
+  //==============================================================
+	i2cSendByte(i2c_base, reg_address ,I2C_MCS_START | I2C_MCS_RUN | I2C_MCS_STOP);
+
+  return status;
+}
+
+//*****************************************************************************
+// Reads one byte of data from the current address of the FT6x06  
+//
+// Paramters
+//    i2c_base:   a valid base address of an I2C peripheral
+//
+//    data:       data to read.
+//
+// Returns
+// I2C_OK if the byte was written to the FT6X06.
+//*****************************************************************************
+static i2c_status_t ft6x06_read_data
+( 
+  uint32_t  i2c_base,
+  uint8_t *data
+)
+{
+  i2c_status_t status;
+  
+  // Before doing anything, make sure the I2C device is idle
+  while ( I2CMasterBusy(i2c_base)) {};
+
+  //==============================================================
+  // ADD CODE
+  // Set the I2C address 
+  //==============================================================
+  status = i2cSetSlaveAddr(i2c_base, FT6X06_DEV_ID, I2C_READ); 
+      
+  
+  if ( status != I2C_OK )
+  {
+    return status;
+  }
+
+  //==============================================================
+  // ADD CODE
+  // get the data
+  //==============================================================
+  status = i2cGetByte( i2c_base, data , I2C_MCS_START | I2C_MCS_RUN | I2C_MCS_STOP);
+
+
+  return status;
+}
+
+
+//*****************************************************************************
+// Read the number of active touch points.
+//*****************************************************************************
+uint8_t ft6x06_read_td_status(void)
+{ 
+	uint8_t data;
+  // ADD CODE
+  // Return the number of active touch points.  The only valid values of the 
+  // register will be 0, 1, or 2.
+	PROFILE_BEGIN(PROFILE_ZONE_TOUCH);
+	if (!i2c_bus_acquire(I2C_BUS_TOUCH)) {
+		PROFILE_END(PROFILE_ZONE_TOUCH);
+		return 0;
+	}
+	ft6x06_set_addr(FT6X06_I2C_BASE, FT6X06_TD_STATUS_R);
+	ft6x06_read_data(FT6X06_I2C_BASE, &data);
+	i2c_bus_release(I2C_BUS_TOUCH);
+	PROFILE_END(PROFILE_ZONE_TOUCH);
+	return data;
+} 
+
+
+//*****************************************************************************
+// Read the X value of last touch event
+//*****************************************************************************
+uint16_t ft6x06_read_x(void)
+{ 
+	uint8_t xh;
+	uint8_t xl;
+	uint16_t x;
+  // ADD CODE
+  // Return the X coordinate of the last touch point
+  // This will require reading P1_XH and P1_XL
+	PROFILE_BEGIN(PROFILE_ZONE_TOUCH);
+	if (!i2c_bus_acquire(I2C_BUS_TOUCH)) {
+		PROFILE_END(PROFILE_ZONE_TOUCH);
+		return lastTouch.x;
+	}
+	ft6x06_set_addr(FT6X06_I2C_BASE, FT6X06_P1_XH_R);
+	ft6x06_read_data(FT6X06_I2C_BASE, &xh);
+	ft6x06_set_addr(FT6X06_I2C_BASE, FT6X06_P1_XL_R);
+	ft6x06_read_data(FT6X06_I2C_BASE, &xl);
+	i2c_bus_release(I2C_BUS_TOUCH);
+	PROFILE_END(PROFILE_ZONE_TOUCH);
+	x = ((xh & 0xF)<<8) | xl; // combine upper and lower bits
+	x = 239-x; // set 0 to left side
+	return x;
+} 
+
+//*****************************************************************************
+// Read the Y value of last touch event
+//*****************************************************************************
+uint16_t ft6x06_read_y(void)
+{ 
+	uint8_t yh;
+	uint8_t yl;
+	uint16_t y;
+  // ADD CODE
+  // Return the Y coordinate of the last touch point 
+  // This will require reading P1_YH and P1_YL
+	PROFILE_BEGIN(PROFILE_ZONE_TOUCH);
+	if (!i2c_bus_acquire(I2C_BUS_TOUCH)) {
+		PROFILE_END(PROFILE_ZONE_TOUCH);
+		return lastTouch.y;
+	}
+	ft6x06_set_addr(FT6X06_I2C_BASE, FT6X06_P1_YH_R);
+	ft6x06_read_data(FT6X06_I2C_BASE, &yh);
+	ft6x06_set_addr(FT6X06_I2C_BASE, FT6X06_P1_YL_R);
+	ft6x06_read_data(FT6X06_I2C_BASE, &yl);
+	i2c_bus_release(I2C_BUS_TOUCH);
+	PROFILE_END(PROFILE_ZONE_TOUCH);
+	y = ((yh & 0xF)<<8) | yl; // combine upper and lower 8 bits
+	y = 319-y; // set 0 to left side
+	return y;
+} 
+
+//*****************************************************************************
+// Reads consecutive registers in one transaction, the FT6x06 moves to the
+// next register after every byte.  The bus must be held.
+//*****************************************************************************
+static i2c_status_t ft6x06_read_regs(uint8_t reg, uint8_t *data, uint8_t num_regs)
+{
+	i2c_status_t status;
+	uint8_t mcs;
+	uint8_t i;
+	
+	status = ft6x06_set_addr(FT6X06_I2C_BASE, reg);
+	if ( status == I2C_OK )
+		status = i2cSetSlaveAddr(FT6X06_I2C_BASE, FT6X06_DEV_ID, I2C_READ);
+	
+	// ACK every byte but the last one
+	for (i = 0; i < num_regs && status == I2C_OK; i++) {
+		mcs = I2C_MCS_RUN;
+		if (i == 0)
+			mcs |= I2C_MCS_START;
+		if (i == num_regs - 1)
+			mcs |= I2C_MCS_STOP;
+		else
+			mcs |= I2C_MCS_ACK;
+		status = i2cGetByte(FT6X06_I2C_BASE, &data[i], mcs);
+	}
+	
+	return status;
+}
+
+//*****************************************************************************
+// Reads TD_STATUS and the first touch point in one burst.  Runs from 
+// i2c_bus_post(), in the handler when the bus was free or when the main 
+// loop releases it.
+//*****************************************************************************
+static void ft6x06_touch_job(void)
+{
+	uint8_t regs[FT6X06_P1_YL_R - FT6X06_TD_STATUS_R + 1];
+	i2c_status_t status;
+	uint32_t primask;
+	
+	PROFILE_BEGIN(PROFILE_ZONE_TOUCH);
+	if (!i2c_bus_acquire(I2C_BUS_TOUCH)) {
+		PROFILE_END(PROFILE_ZONE_TOUCH);
+		return;
+	}
+	status = ft6x06_read_regs(FT6X06_TD_STATUS_R, regs, sizeof(regs));
+	i2c_bus_release(I2C_BUS_TOUCH);
+	PROFILE_END(PROFILE_ZONE_TOUCH);
+	
+	if (status != I2C_OK)
+		return;
+	
+	primask = __get_PRIMASK();
+	__disable_irq();
+	lastTouch.touches = regs[0] & 0x0F;
+	lastTouch.x = 239 - (((regs[FT6X06_P1_XH_R - FT6X06_TD_STATUS_R] & 0xF) << 8) | 
+	                     regs[FT6X06_P1_XL_R - FT6X06_TD_STATUS_R]);
+	lastTouch.y = 319 - (((regs[FT6X06_P1_YH_R - FT6X06_TD_STATUS_R] & 0xF) << 8) | 
+	                     regs[FT6X06_P1_YL_R - FT6X06_TD_STATUS_R]);
+	lastTouch.sequence++;
+	__set_PRIMASK(primask);
+}
+
+//*****************************************************************************
+// Called by the port F interrupt service when PF4 (the FT6x06 interrupt) fires
+//*****************************************************************************
+void ft6x06_irq_service(void)
+{
+	i2c_bus_post(I2C_BUS_TOUCH, ft6x06_touch_job);
+}
+
+//*****************************************************************************
+// Copies the last reading of the posted touch job
+//*****************************************************************************
+bool ft6x06_get_touch(ft6x06_touch_t *touch)
+{
+	uint32_t primask;
+	
+	if (touch == NULL)
+		return false;
+	
+	primask = __get_PRIMASK();
+	__disable_irq();
+	*touch = lastTouch;
+	__set_PRIMASK(primask);
+	
+	return touch->sequence != 0;
+}
+
+//*****************************************************************************
+// Test the ft6x06
+//*****************************************************************************
+bool ft6x06_init(void)
+{ 
+  //==============================
+  // Configure I2C GPIO Pins
+  //==============================  
+  if(gpio_enable_port(FT6X06_GPIO_BASE) == false)
+  {
+    return false;
+  }
+  
+  // Configure SCL 
+  if(gpio_config_digital_enable(FT6X06_GPIO_BASE, FT6X06_I2C_SCL_PIN)== false)
+  {
+    return false;
+  }
+    
+  if(gpio_config_alternate_function(FT6X06_GPIO_BASE, FT6X06_I2C_SCL_PIN)== false)
+  {
+    return false;
+  }
+    
+  if(gpio_config_port_control(FT6X06_GPIO_BASE, FT6X06_I2C_SCL_PCTL_M, FT6X06_I2C_SCL_PIN_PCTL)== false)
+  {
+    return false;
+  }
+    
+
+  
+  // Configure SDA 
+  if(gpio_config_digital_enable(FT6X06_GPIO_BASE, FT6X06_I2C_SDA_PIN)== false)
+  {
+    return false;
+  }
+    
+  if(gpio_config_open_drain(FT6X06_GPIO_BASE, FT6X06_I2C_SDA_PIN)== false)
+  {
+    return false;
+  }
+    
+  if(gpio_config_alternate_function(FT6X06_GPIO_BASE, FT6X06_I2C_SDA_PIN)== false)
+  {
+    return false;
+  }
+    
+  if(gpio_config_port_control(FT6X06_GPIO_BASE, FT6X06_I2C_SDA_PCTL_M, FT6X06_I2C_SDA_PIN_PCTL)== false)
+  {
+    return false;
+  }
+  
+  
+  //  Initialize the I2C peripheral
+  if( initializeI2CMaster(FT6X06_I2C_BASE)!= I2C_OK)
+  {
+    return false;
+  }
+  
+  // Run the bus as fast as the touch controller and the other devices on it allow
+  if( i2cRegisterDevice(FT6X06_I2C_BASE, FT6X06_DEV_ID, FT6X06_MAX_SCL_HZ)!= I2C_OK)
+  {
+    return false;
+  }
+  
+  // Pulse INT low for every new reading rather than holding it low while
+  // the screen is touched
+  i2c_bus_acquire(I2C_BUS_TOUCH);
+  while ( I2CMasterBusy(FT6X06_I2C_BASE)) {};
+  i2cSetSlaveAddr(FT6X06_I2C_BASE, FT6X06_DEV_ID, I2C_WRITE);
+  i2cSendByte(FT6X06_I2C_BASE, FT6X06_G_MODE_R, I2C_MCS_START | I2C_MCS_RUN);
+  i2cSendByte(FT6X06_I2C_BASE, FT6X06_G_MODE_TRIGGER, I2C_MCS_RUN | I2C_MCS_STOP);
+  i2c_bus_release(I2C_BUS_TOUCH);
+  
+  // INT on PF4, io_expander_gpiof_service() posts the read.  The port F
+  // interrupt is enabled in the NVIC by io_expander_init().
+  gpio_enable_port(FT6X06_IRQ_GPIO_BASE);
+  gpio_config_digital_enable(FT6X06_IRQ_GPIO_BASE, FT6X06_IRQ_PIN_NUM);
+  gpio_config_enable_input(FT6X06_IRQ_GPIO_BASE, FT6X06_IRQ_PIN_NUM);
+  gpio_config_falling_edge_irq(FT6X06_IRQ_GPIO_BASE, FT6X06_IRQ_PIN_NUM);
+  
+  return true;
+  
+} 
+
@@ -0,0 +1,239 @@
+#include "i2c_bus.h"
+#include "cycle_counter.h"
+
+static volatile bool busHeld = false;
+static volatile i2c_bus_job_t pendingJob[I2C_BUS_NUM_CLIENTS];
+static volatile uint32_t pendingSince[I2C_BUS_NUM_CLIENTS];
+static volatile bool runningJobs = false;
+static i2c_bus_stats_t busStats[I2C_BUS_NUM_CLIENTS];
+
+//*****************************************************************************
+// Returns the histogram bucket of a wait time
+//*****************************************************************************
+static uint32_t i2c_bus_bucket(uint32_t cycles)
+{
+  // Number of significant bits, 0 for a wait of 0 cycles
+  uint32_t bucket = 32 - __CLZ(cycles);
+  
+  if ( bucket >= I2C_BUS_HIST_BUCKETS )
+  {
+    bucket = I2C_BUS_HIST_BUCKETS - 1;
+  }
+  return bucket;
+}
+
+//*****************************************************************************
+// Records the time a client waited for the bus
+//*****************************************************************************
+static void i2c_bus_record_wait(i2c_bus_client_t client, uint32_t cycles)
+{
+  i2c_bus_stats_t *stats = &busStats[client];
+  
+  stats->acquisitions++;
+  stats->waitHistogram[i2c_bus_bucket(cycles)]++;
+  if ( cycles > stats->maxWaitCycles )
+  {
+    stats->maxWaitCycles = cycles;
+  }
+}
+
+//*****************************************************************************
+// Records the time from posting a job to running it
+//*****************************************************************************
+static void i2c_bus_record_latency(i2c_bus_client_t client, uint32_t cycles)
+{
+  i2c_bus_stats_t *stats = &busStats[client];
+  
+  stats->jobs++;
+  stats->latencyHistogram[i2c_bus_bucket(cycles)]++;
+  if ( cycles > stats->maxLatencyCycles )
+  {
+    stats->maxLatencyCycles = cycles;
+  }
+}
+
+//*****************************************************************************
+// Takes the bus without recording any statistics
+//*****************************************************************************
+static bool i2c_bus_take(void)
+{
+  uint32_t primask;
+  bool taken = false;
+  
+  primask = __get_PRIMASK();
+  __disable_irq();
+  if ( !busHeld )
+  {
+    busHeld = true;
+    taken = true;
+  }
+  __set_PRIMASK(primask);
+  
+  return taken;
+}
+
+//*****************************************************************************
+// Runs the queued jobs, highest priority first.  The bus must be free.  Jobs
+// take the bus themselves through the drivers they call, and the releases 
+// inside a job do not start another pass.
+//*****************************************************************************
+static void i2c_bus_run_pending(void)
+{
+  i2c_bus_job_t job;
+  uint32_t primask;
+  uint32_t since;
+  int client;
+  
+  if ( runningJobs )
+  {
+    return;
+  }
+  runningJobs = true;
+  
+  for ( client = 0; client < I2C_BUS_NUM_CLIENTS; )
+  {
+    primask = __get_PRIMASK();
+    __disable_irq();
+    job = pendingJob[client];
+    since = pendingSince[client];
+    pendingJob[client] = NULL;
+    __set_PRIMASK(primask);
+    
+    if ( job == NULL )
+    {
+      client++;
+      continue;
+    }
+    
+    i2c_bus_record_latency((i2c_bus_client_t)client, cycle_counter_read() - since);
+    job();
+    
+    // A higher priority job may have been posted while this one ran
+    client = 0;
+  }
+  
+  runningJobs = false;
+}
+
+//*****************************************************************************
+// Takes the bus if it is free.
+//*****************************************************************************
+bool i2c_bus_try_acquire(i2c_bus_client_t client)
+{
+  if ( !i2c_bus_take() )
+  {
+    return false;
+  }
+  
+  i2c_bus_record_wait(client, 0);
+  return true;
+}
+
+//*****************************************************************************
+// Takes the bus, waiting if it is held.  IPSR is non zero in a handler.
+//*****************************************************************************
+bool i2c_bus_acquire(i2c_bus_client_t client)
+{
+  uint32_t start = cycle_counter_read();
+  
+  if ( __get_IPSR() != 0 )
+  {
+    if ( i2c_bus_try_acquire(client) )
+    {
+      return true;
+    }
+    busStats[client].refused++;
+    return false;
+  }
+  
+  while ( !i2c_bus_take() ) {};
+  
+  i2c_bus_record_wait(client, cycle_counter_read() - start);
+  return true;
+}
+
+//*****************************************************************************
+// Gives up the bus and runs any queued jobs.
+//*****************************************************************************
+void i2c_bus_release(i2c_bus_client_t client)
+{
+  busHeld = false;
+  i2c_bus_run_pending();
+}
+
+//*****************************************************************************
+// Lets queued jobs run in the middle of a long operation.
+//*****************************************************************************
+void i2c_bus_yield(i2c_bus_client_t client)
+{
+  bool queued = false;
+  int i;
+  
+  // Nothing to do unless someone is waiting
+  for ( i = 0; i < I2C_BUS_NUM_CLIENTS; i++)
+  {
+    if ( pendingJob[i] != NULL )
+    {
+      queued = true;
+    }
+  }
+  if ( !queued )
+  {
+    return;
+  }
+  
+  busHeld = false;
+  i2c_bus_run_pending();
+  while ( !i2c_bus_take() ) {};
+}
+
+//*****************************************************************************
+// Runs a job on the bus from an interrupt handler.
+//*****************************************************************************
+bool i2c_bus_post(i2c_bus_client_t client, i2c_bus_job_t job)
+{
+  uint32_t primask;
+  
+  if ( job == NULL || client >= I2C_BUS_NUM_CLIENTS )
+  {
+    return false;
+  }
+  
+  // Nothing running below this handler holds the bus, so the job can use
+  // it straight away
+  if ( !busHeld )
+  {
+    i2c_bus_record_latency(client, 0);
+    job();
+    return true;
+  }
+  
+  primask = __get_PRIMASK();
+  __disable_irq();
+  if ( pendingJob[client] != NULL )
+  {
+    busStats[client].dropped++;
+  }
+  else
+  {
+    pendingSince[client] = cycle_counter_read();
+  }
+  pendingJob[client] = job;
+  busStats[client].deferred++;
+  __set_PRIMASK(primask);
+  
+  return false;
+}
+
+//*****************************************************************************
+// Returns the wait time and job latency statistics of a client.
+//*****************************************************************************
+void i2c_bus_get_stats(i2c_bus_client_t client, i2c_bus_stats_t *stats)
+{
+  if ( stats == NULL || client >= I2C_BUS_NUM_CLIENTS )
+  {
+    return;
+  }
+  
+  *stats = busStats[client];
+}
@@ -1,259 +1,259 @@
-// Copyright (c) 2015-16, Joe Krachey
-// All rights reserved.
-//
-// Redistribution and use in source or binary form, with or without modification, 
-// are permitted provided that the following conditions are met:
-//
-// 1. Redistributions in source form must reproduce the above copyright 
-//    notice, this list of conditions and the following disclaimer in 
-//    the documentation and/or other materials provided with the distribution.
-//
-// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" 
-// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
-// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR 
-// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR 
-// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, 
-// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, 
-// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; 
-// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
-// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING 
-// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, 
-// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
-
-/* 
-**  Image data
-*/
-
-#include "lcd_images.h"
-
-const uint8_t imageBitmaps []=
-{
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xC0, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x03, 0xFC, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x0F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0xFE, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x07, 0xFC, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x0C, 0x10, 0x00, 0xE0, 0x1F, 0xFC, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0xFC, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x1C, 0x00, 0x0F, 0xBE, 0x00, 0x00, 0xFF, 0xF8, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0xF8, 0x00, 0x7F, 0xFF, 0xF0, 0x18, 0xFE, 0x00, 0x07, 0xFF, 0xCE, 0x03, 0xFF, 0xF8, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x01, 0xE0, 0x00, 0x07, 0xFF, 0x80, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xE1, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x01, 0xE3, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x01, 0xC1, 0xFF, 0xC0, 0x00, 0x77, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x87, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x03, 0xC0, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x1F, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x03, 0xC0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xFF, 0xF8, 0x3F, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x03, 0xC0, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x1E, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x01, 0xC1, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x04, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x01, 0xC1, 0x81, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x01, 0xC1, 0xC0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x01, 0xE0, 0xF0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0xC0, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x01, 0xE0, 0xF8, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x78, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x01, 0xE0, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x1F, 0x80, 0x1E, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0xF0, 0x7F, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x0F, 0xF0, 0x3E, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x78, 0x7E, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x07, 0xF0, 0x3F, 0x80, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x78, 0x38, 0x00, 0xC0, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x03, 0xE0, 0x0F, 0xC0, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x3C, 0x10, 0x03, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0x80, 0xE0, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x1E, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x03, 0xFF, 0x87, 0xF0, 0x01, 0xFC, 0x01, 0xF8, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x1E, 0x00, 0x1F, 0x80, 0x00, 0x7C, 0x1F, 0xFF, 0x00, 0x03, 0xFF, 0x0F, 0xF8, 0x01, 0xFE, 0x00, 0x7C, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x1F, 0x00, 0x3F, 0x00, 0x01, 0xFF, 0x8F, 0xFF, 0x80, 0x01, 0xFF, 0x3F, 0xF8, 0x00, 0xFF, 0x80, 0x3F, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x3F, 0x00, 0xFF, 0x00, 0x03, 0xFF, 0xE7, 0xFF, 0x80, 0x01, 0xFE, 0x7F, 0x38, 0x00, 0xFF, 0xE0, 0x1F, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x7C, 0x01, 0xFE, 0x00, 0x03, 0xFF, 0xF3, 0xFF, 0x80, 0x01, 0xFC, 0x7C, 0x18, 0x00, 0x7F, 0xF8, 0x07, 0x80, 0x00, 0x00, 
-	0x00, 0x00, 0x7C, 0x03, 0xFE, 0x00, 0x03, 0xFF, 0xF9, 0xFF, 0x80, 0x01, 0xFC, 0xFC, 0x08, 0x00, 0x7F, 0xFC, 0x07, 0x80, 0x00, 0x00, 
-	0x00, 0x01, 0xF0, 0x0F, 0xFE, 0x00, 0x07, 0xC7, 0xFC, 0xFF, 0x80, 0x01, 0xF9, 0xF8, 0x00, 0x00, 0x7F, 0xFE, 0x0F, 0x00, 0x00, 0x00, 
-	0x00, 0x03, 0xE0, 0x1F, 0xFE, 0x00, 0x07, 0x00, 0xFE, 0x3F, 0x80, 0x01, 0xF3, 0xF0, 0x00, 0x00, 0x7F, 0xFE, 0x0F, 0x00, 0x00, 0x00, 
-	0x00, 0x03, 0xE0, 0x1F, 0xFE, 0x00, 0x04, 0x00, 0x3F, 0x3F, 0xC0, 0x00, 0xC7, 0xE0, 0x00, 0x00, 0x7F, 0xFC, 0x1E, 0x00, 0x00, 0x00, 
-	0x00, 0x03, 0xE0, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0x87, 0x80, 0x02, 0x0F, 0xC3, 0x00, 0x00, 0x7F, 0xF8, 0x3E, 0x00, 0x00, 0x00, 
-	0x00, 0x01, 0xF0, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xBF, 0x93, 0x80, 0x00, 0x7F, 0xF0, 0x3C, 0x00, 0x00, 0x00, 
-	0x00, 0x01, 0xF8, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x83, 0xF0, 0x38, 0x03, 0xFF, 0xBB, 0x80, 0x00, 0x7F, 0xE0, 0x78, 0x00, 0x00, 0x00, 
-	0x00, 0x03, 0xF0, 0x3F, 0xFF, 0x00, 0x00, 0x01, 0xD9, 0xFF, 0xF0, 0x01, 0xFF, 0x7F, 0xC0, 0x00, 0x7F, 0xE0, 0xF8, 0x00, 0x00, 0x00, 
-	0x00, 0x07, 0xE0, 0x3F, 0xFF, 0x00, 0x00, 0x03, 0xDC, 0xFF, 0xF0, 0x00, 0xFC, 0x7F, 0xC0, 0x00, 0xFF, 0xC1, 0xF0, 0x00, 0x00, 0x00, 
-	0x00, 0x0F, 0xC0, 0x7F, 0xFF, 0x80, 0x00, 0x03, 0xFE, 0x7F, 0xE0, 0x00, 0x38, 0x7F, 0x80, 0x00, 0xFF, 0x81, 0xF0, 0x00, 0x00, 0x00, 
-	0x00, 0x1F, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x03, 0xFE, 0x3F, 0xC0, 0x00, 0x00, 0x7F, 0x80, 0x01, 0xFF, 0x83, 0xF8, 0x00, 0x00, 0x00, 
-	0x00, 0x1F, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x03, 0xFE, 0x0F, 0x00, 0xF0, 0x00, 0x3F, 0x80, 0x01, 0xFF, 0xC0, 0xF8, 0x00, 0x00, 0x00, 
-	0x00, 0x0F, 0x80, 0x3F, 0xFF, 0xC0, 0x00, 0x01, 0xFE, 0x00, 0x07, 0xFF, 0x00, 0x3F, 0x00, 0x03, 0xFF, 0xC0, 0xF0, 0x00, 0x00, 0x00, 
-	0x00, 0x07, 0xC0, 0x1F, 0xFF, 0xE0, 0x00, 0x01, 0xFC, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x01, 0xF0, 0x00, 0x00, 0x00, 
-	0x00, 0x03, 0xE0, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0xF8, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x00, 0x07, 0xFE, 0x03, 0xE0, 0x00, 0x00, 0x00, 
-	0x00, 0x01, 0xF0, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFC, 0x07, 0xC0, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0xF8, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xF0, 0x0F, 0x80, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x7E, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xE0, 0x3F, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x3F, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0x80, 0x7E, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x0F, 0xC0, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0xFF, 0xFE, 0x00, 0x7E, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x07, 0xE0, 0x3F, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x3F, 0xFC, 0x00, 0xF0, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x01, 0xF0, 0x3F, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x1F, 0xF0, 0x01, 0xC0, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x03, 0xE0, 0x07, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0x30, 0x1F, 0x80, 0x06, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x03, 0xE0, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0x30, 0xDE, 0x00, 0x08, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x07, 0xF8, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x01, 0xFE, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x30, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x18, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x1C, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x1C, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x10, 0x3F, 0xFF, 0xFC, 0x1F, 0xC7, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x30, 0x3F, 0xFF, 0xFE, 0x0F, 0xC7, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0x00, 0x3F, 0x07, 0xC7, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0x07, 0xC7, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x07, 0x80, 0x07, 0xE7, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0xC7, 0xF0, 0x00, 0x1F, 0xF0, 0x07, 0xE3, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF9, 0xC7, 0x78, 0x18, 0x00, 0xFC, 0x07, 0xE3, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF9, 0xC7, 0x3F, 0xF8, 0x00, 0x1F, 0x0F, 0xE3, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF9, 0xC7, 0x3F, 0xF0, 0x00, 0x1F, 0xFF, 0xE3, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF9, 0xC7, 0x3F, 0xFC, 0x00, 0x07, 0xFE, 0xF1, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF1, 0xC7, 0x3F, 0xFE, 0x00, 0x07, 0xFC, 0x71, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF1, 0xCF, 0x38, 0xFF, 0xC0, 0x3F, 0xFC, 0x79, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE3, 0x8E, 0x38, 0xEF, 0xFF, 0xFF, 0xCE, 0x38, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE3, 0x8E, 0x39, 0xE7, 0xFF, 0xFF, 0x8F, 0x3D, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xE7, 0x9E, 0x39, 0xE7, 0xFF, 0xF3, 0xCF, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x1E, 0x79, 0xE7, 0x1F, 0xF1, 0xC7, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x9C, 0x79, 0xC7, 0x1C, 0x71, 0xC7, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xE3, 0xFF, 0xFC, 0x71, 0xC7, 0x1C, 0x79, 0xE7, 0xFF, 0xEF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFE, 0xF1, 0xC7, 0x1E, 0x79, 0xE7, 0xFF, 0xC3, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xF3, 0xC7, 0x1E, 0x79, 0xFF, 0xFF, 0x81, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x03, 0xDF, 0xFF, 0xFF, 0xEF, 0xBE, 0x7F, 0xFF, 0xFE, 0x60, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x61, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x30, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xF0, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x1C, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x7F, 0xC0, 0x00, 0x0F, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x0C, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x7F, 0x80, 0x07, 0xFF, 0xF8, 0x78, 0x7B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x87, 0x0F, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0xFF, 0x87, 0xFF, 0xFF, 0xE0, 0x3C, 0x38, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xC3, 0x87, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x01, 0xFF, 0x9F, 0xFF, 0xFF, 0x80, 0x3E, 0x3C, 0x3C, 0x7F, 0xFF, 0xF8, 0xE1, 0xE3, 0xE3, 0x87, 0xF0, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x3C, 0x7C, 0x7C, 0x78, 0x7B, 0xFF, 0xFF, 0xC3, 0xF0, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0x1F, 0x0F, 0x1E, 0x3C, 0x3E, 0x38, 0xFF, 0xFF, 0xFD, 0xC3, 0xF8, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x8F, 0x8F, 0x1E, 0x1E, 0x3E, 0x1F, 0xF6, 0x00, 0x04, 0xE1, 0xF8, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x07, 0xFC, 0x18, 0x00, 0x07, 0xFF, 0x87, 0x87, 0x8F, 0x1F, 0x1F, 0x3F, 0x06, 0x00, 0x04, 0xF1, 0xFC, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x0F, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xC7, 0xC7, 0x8F, 0x0F, 0x1F, 0xF0, 0x07, 0x00, 0x06, 0x70, 0xFC, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x1F, 0xF8, 0x7C, 0xFF, 0xFF, 0xFF, 0xC3, 0xC3, 0xC7, 0x8F, 0x0F, 0xC0, 0x03, 0x00, 0x06, 0x70, 0xFE, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x1F, 0xF0, 0xF0, 0x00, 0x1E, 0x00, 0x03, 0xE3, 0xC7, 0x87, 0x8F, 0xC0, 0x03, 0x00, 0x02, 0x38, 0xFE, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x3F, 0xE1, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xE3, 0xE3, 0xC7, 0xF8, 0xE0, 0x03, 0x00, 0x03, 0x38, 0x7E, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x7F, 0xC3, 0xC1, 0x00, 0x00, 0x00, 0xF1, 0xF1, 0xE3, 0xC7, 0xF0, 0xE0, 0x03, 0x00, 0x03, 0x3C, 0x7F, 0x00, 0x00, 0x00, 0x00, 
-	0x01, 0xFF, 0x87, 0x83, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xE1, 0xE3, 0xC0, 0x60, 0x03, 0x00, 0x01, 0x3C, 0x7F, 0x00, 0x00, 0x00, 0x00, 
-	0x03, 0xFF, 0x0F, 0x87, 0xFF, 0xFF, 0xFF, 0xF1, 0xF0, 0xE1, 0xE3, 0x00, 0x60, 0x03, 0x00, 0x03, 0x3C, 0x3F, 0x00, 0x00, 0x00, 0x00, 
-	0x07, 0xFF, 0x1E, 0x0F, 0xFF, 0xFE, 0xFF, 0xF1, 0xF0, 0xF1, 0xEE, 0x00, 0x60, 0x03, 0x80, 0x03, 0x1C, 0x3F, 0xF8, 0x00, 0x00, 0x00, 
-	0x07, 0xFF, 0x1C, 0x18, 0xFF, 0xFC, 0x1F, 0x81, 0xF8, 0xF1, 0xFC, 0x00, 0x60, 0x01, 0x80, 0x03, 0x1E, 0x3F, 0xFE, 0x00, 0x00, 0x00, 
-	0x07, 0xFF, 0x3C, 0x30, 0xFF, 0xFC, 0x00, 0x01, 0xF8, 0xF9, 0xF8, 0x00, 0x60, 0x01, 0x80, 0x07, 0x1E, 0x3F, 0xFF, 0x00, 0x00, 0x00, 
-	0x07, 0xDF, 0xF8, 0x70, 0xFF, 0xFE, 0x00, 0x01, 0xF8, 0xF8, 0xF8, 0x00, 0x60, 0x01, 0xC0, 0x07, 0x1E, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 
-	0x0F, 0xCF, 0xF8, 0xE1, 0xBF, 0xFF, 0xF3, 0xF9, 0xFC, 0x78, 0xF8, 0x00, 0x20, 0x03, 0xC0, 0x07, 0x1E, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 
-	0x0F, 0xCF, 0xF1, 0xC3, 0x1F, 0xFF, 0xFF, 0xF9, 0xFC, 0x78, 0xF8, 0x00, 0x20, 0x03, 0xC0, 0x07, 0x0E, 0x3F, 0xE7, 0xF0, 0x00, 0x00, 
-	0x1F, 0xC7, 0xF1, 0xC6, 0x1F, 0xFF, 0xFF, 0xFB, 0xFC, 0x78, 0xF8, 0x00, 0x70, 0x03, 0xC0, 0x0F, 0x0E, 0x3F, 0xE3, 0xF0, 0x00, 0x00, 
-	0x1F, 0xC7, 0xF1, 0x86, 0x3F, 0x7F, 0xFF, 0xFF, 0xFC, 0x78, 0xF8, 0x00, 0x78, 0x01, 0xC0, 0x0F, 0x8E, 0x3F, 0x21, 0xFC, 0x00, 0x00, 
-	0x3F, 0x83, 0xFF, 0x8C, 0x7E, 0x0F, 0xFF, 0xFF, 0xFC, 0x78, 0x78, 0x00, 0x78, 0x01, 0x80, 0x0F, 0x8E, 0x3F, 0x11, 0xFE, 0x00, 0x00, 
-	0xFF, 0x11, 0xFF, 0x9C, 0x7E, 0x00, 0xFF, 0xFF, 0xFC, 0x78, 0x78, 0x00, 0xF8, 0x01, 0x80, 0x1F, 0x8E, 0x3F, 0x18, 0xFF, 0x00, 0x00, 
-	0xFE, 0x18, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFC, 0x78, 0x78, 0x00, 0xF8, 0x00, 0x80, 0x1F, 0x8C, 0x3F, 0x80, 0x3F, 0x80, 0x00, 
-	0xFC, 0x38, 0x7F, 0xFF, 0xF8, 0x00, 0x00, 0x1F, 0xFC, 0x78, 0x7C, 0x00, 0x70, 0x00, 0x80, 0x1F, 0x0C, 0x7F, 0x00, 0x0F, 0xE0, 0x00, 
-	0xFC, 0xF0, 0x3F, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFC, 0x78, 0x78, 0x00, 0x70, 0x00, 0x00, 0x1F, 0x1C, 0x7E, 0x00, 0x0F, 0xE0, 0x00, 
-	0xFF, 0xE3, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x07, 0xFC, 0x78, 0x78, 0x00, 0x70, 0x00, 0x00, 0x3F, 0x1C, 0x7E, 0x1F, 0xFF, 0xF0, 0x00, 
-	0xFF, 0xC3, 0x00, 0x00, 0x38, 0x00, 0x00, 0x07, 0xFC, 0x78, 0x7C, 0x00, 0x20, 0x00, 0x00, 0x37, 0x18, 0x7E, 0x7F, 0xFF, 0xF0, 0x00, 
-	0xFF, 0xCF, 0x18, 0x00, 0x78, 0x00, 0x00, 0x03, 0xFC, 0x78, 0xFE, 0x00, 0x20, 0x00, 0x00, 0x37, 0x18, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 
-	0xFF, 0x8E, 0x38, 0x03, 0xF8, 0x00, 0x00, 0x03, 0xFC, 0x78, 0xFF, 0x00, 0x20, 0x00, 0x00, 0x67, 0x18, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 
-	0x3F, 0xDC, 0x31, 0xC7, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x78, 0xFF, 0x00, 0x20, 0x40, 0x00, 0x67, 0x18, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 
-	0x3F, 0xFC, 0x71, 0x0F, 0xE0, 0x00, 0x00, 0x03, 0xFC, 0x78, 0xFF, 0x00, 0x00, 0x40, 0x00, 0x47, 0x38, 0xFF, 0xFC, 0x1F, 0xE0, 0x00, 
-	0x1F, 0xF8, 0xE3, 0x1F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0xF8, 0xFF, 0x00, 0x00, 0x40, 0x00, 0xC6, 0x30, 0xFF, 0xE0, 0x03, 0xF0, 0x00, 
-	0x0F, 0xFF, 0xE3, 0x9F, 0x80, 0x00, 0x00, 0x07, 0xF8, 0xF8, 0xFF, 0x00, 0x00, 0x40, 0x00, 0xCE, 0x31, 0xFF, 0x80, 0x01, 0xF0, 0x00, 
-	0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xF8, 0xF8, 0xFF, 0x80, 0x00, 0xC0, 0x01, 0x8E, 0x31, 0xFF, 0x18, 0x00, 0xF0, 0x00, 
-	0x07, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xF8, 0xF9, 0xFF, 0x80, 0x00, 0xC0, 0x01, 0x8C, 0x3F, 0xFF, 0x30, 0x00, 0xF8, 0x00, 
-	0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xF1, 0xF1, 0xF7, 0x80, 0x00, 0xC0, 0x01, 0x8C, 0x7F, 0xFE, 0x70, 0x00, 0x78, 0x00, 
-	0x07, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xF1, 0xF1, 0xF7, 0x80, 0x01, 0xE0, 0x03, 0x8C, 0x7F, 0xFE, 0x60, 0x00, 0x78, 0x00, 
-	0x07, 0xFF, 0xF8, 0x01, 0xE0, 0x00, 0x00, 0x3F, 0xF1, 0xF1, 0xE3, 0x80, 0x01, 0xFF, 0xFF, 0x9C, 0x7F, 0xFE, 0xE0, 0x00, 0x7C, 0x00, 
-	0x0F, 0xFF, 0xE0, 0x00, 0xF0, 0x00, 0x07, 0xFF, 0xF3, 0xE1, 0xE3, 0x80, 0x0F, 0xFF, 0xFF, 0x18, 0x7F, 0xFC, 0xE0, 0x00, 0x7C, 0x00, 
-	0x0F, 0xFF, 0x00, 0x00, 0x78, 0x00, 0x1F, 0xFF, 0xE3, 0xE3, 0xE3, 0x80, 0x3F, 0xFF, 0xFF, 0x18, 0xFF, 0xFC, 0xE0, 0x00, 0x3E, 0x00, 
-	0x0F, 0xFE, 0x0E, 0x00, 0x38, 0x00, 0x1F, 0xFF, 0xC3, 0xE3, 0xE3, 0xC0, 0xFF, 0xFF, 0xFF, 0x10, 0xFF, 0xFC, 0xE0, 0x80, 0x1E, 0x00, 
-	0x0F, 0xFE, 0x78, 0x00, 0x3C, 0x00, 0x3F, 0xFF, 0xC7, 0xE3, 0xC7, 0xC3, 0xFF, 0x87, 0x1E, 0x19, 0xFF, 0xFE, 0xE0, 0x80, 0x1F, 0x00, 
-	0x0F, 0xFF, 0xF0, 0x00, 0x1E, 0x00, 0x3F, 0xFF, 0xC7, 0xC7, 0xC7, 0xC7, 0xEF, 0x8F, 0x1E, 0x1F, 0xFF, 0xFE, 0x60, 0xD8, 0x0F, 0x80, 
-	0x0F, 0xFF, 0xE7, 0x00, 0x1E, 0x00, 0x7E, 0x7F, 0x8F, 0xC7, 0xC7, 0xCF, 0x87, 0x8F, 0x1E, 0x3F, 0xFF, 0xFE, 0x70, 0xF0, 0x07, 0x80, 
-	0x0F, 0xFF, 0xDE, 0x00, 0x0F, 0x00, 0xFE, 0x7F, 0x0F, 0x87, 0x87, 0xDF, 0x8F, 0x8F, 0x3E, 0x7F, 0xFC, 0xFF, 0x30, 0xE0, 0x07, 0xE0, 
-	0x07, 0xFF, 0xFE, 0x00, 0x07, 0x03, 0xFE, 0x7F, 0x1F, 0x8F, 0x8F, 0xFF, 0x8F, 0x9E, 0x3C, 0x7F, 0xF8, 0xFF, 0x90, 0xF8, 0x03, 0xE0, 
-	0x07, 0xFF, 0xFC, 0x00, 0x07, 0x03, 0xFE, 0x3F, 0x1F, 0x1F, 0x8F, 0xFF, 0x1F, 0x1E, 0x38, 0x7F, 0xF8, 0xFF, 0x10, 0xFF, 0x03, 0xE0, 
-	0x07, 0xFF, 0xFC, 0x10, 0x07, 0x07, 0xFF, 0x3F, 0x3F, 0x1F, 0x1F, 0xFF, 0x1F, 0x1C, 0x38, 0xFF, 0xF0, 0xFF, 0x3C, 0xFF, 0x01, 0xE0, 
-	0x07, 0xFF, 0xF8, 0x38, 0x07, 0x0F, 0xFE, 0x1F, 0xFE, 0x1F, 0x1F, 0xDE, 0x1E, 0x1C, 0x78, 0xFF, 0xE0, 0x7F, 0x7C, 0xF8, 0x01, 0xE0, 
-	0x03, 0xFF, 0xF8, 0x1C, 0x07, 0x0F, 0xFC, 0x1F, 0xFE, 0x3E, 0x1F, 0x9E, 0x3E, 0x3C, 0x7F, 0xFF, 0x80, 0x3E, 0x7D, 0xF8, 0x01, 0xE0, 
-	0x03, 0xFF, 0xE0, 0x1C, 0x0F, 0x1F, 0xF0, 0x0F, 0xFC, 0x3E, 0x3F, 0x1E, 0x3C, 0x38, 0xFF, 0xFF, 0x00, 0x3E, 0x79, 0xBC, 0x01, 0xE0, 
-	0x03, 0xFF, 0xC0, 0x1C, 0x0E, 0x1F, 0xE0, 0xC7, 0xFE, 0x7E, 0x3E, 0x3C, 0x7C, 0x78, 0xFF, 0xFE, 0x00, 0x7F, 0x7B, 0x0C, 0x03, 0xE0, 
-	0x01, 0xFF, 0x80, 0x7C, 0x0E, 0x1F, 0xC3, 0xE3, 0xFF, 0xFE, 0x7E, 0x7C, 0x7E, 0x7F, 0xFF, 0xF8, 0x00, 0x7F, 0x73, 0x04, 0x07, 0xC0, 
-	0x01, 0xFF, 0x80, 0x3C, 0x0E, 0x1F, 0xC7, 0xC1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0x33, 0x00, 0x0F, 0x80, 
-	0x00, 0xFF, 0xE0, 0x3E, 0x0E, 0x1F, 0xCF, 0x88, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0x86, 0x00, 0x3F, 0x00, 
-	0x00, 0xFF, 0xF0, 0x37, 0x1E, 0x0F, 0xFF, 0x0C, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xCE, 0x00, 0x3E, 0x00, 
-	0x00, 0xFF, 0xF0, 0x03, 0xFE, 0x0F, 0xFE, 0x1E, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x7C, 0x00, 
-	0x00, 0x7F, 0xE0, 0x01, 0xFE, 0x07, 0xFC, 0x3E, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xE1, 0xFC, 0x00, 
-	0x00, 0x7F, 0xF0, 0x00, 0xF8, 0x07, 0xF8, 0xFC, 0x70, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0xE0, 0x00, 0x00, 0x3F, 0xF7, 0xFF, 0xF0, 0x00, 
-	0x00, 0x7F, 0xF0, 0x01, 0xE0, 0x03, 0xFD, 0xFC, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x1F, 0xF3, 0xFF, 0xE0, 0x00, 
-	0x00, 0x3F, 0xF8, 0x01, 0xC0, 0x03, 0xFF, 0xF8, 0xFC, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x1F, 0xF8, 0xFF, 0xC0, 0x00, 
-	0x00, 0x3F, 0xFF, 0x03, 0xC0, 0x03, 0xFF, 0xF1, 0xF8, 0xF1, 0xE3, 0xCF, 0x1C, 0x7F, 0xC0, 0x00, 0x00, 0x07, 0xFE, 0x7F, 0x80, 0x00, 
-	0x00, 0x3F, 0xFF, 0xEF, 0x80, 0x07, 0xFF, 0xE3, 0xF1, 0xF3, 0xE3, 0x8F, 0x1C, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 
-	0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x07, 0xBF, 0xE7, 0xF3, 0xE3, 0xC7, 0x8E, 0x38, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 
-	0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x07, 0x3F, 0xFF, 0xE3, 0xE3, 0xC7, 0x9E, 0x38, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 
-	0x00, 0x07, 0xFF, 0xFE, 0x00, 0x0F, 0x1F, 0xFF, 0xC7, 0xC7, 0xC7, 0x1E, 0x38, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 
-	0x00, 0x01, 0xFF, 0xF8, 0x00, 0x0E, 0x07, 0xFF, 0xC7, 0xC7, 0x8F, 0x1C, 0x71, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x7F, 0xE0, 0x00, 0x0E, 0x03, 0xFF, 0xFF, 0xCF, 0x8F, 0x3C, 0x79, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0xFF, 0xFF, 0xCF, 0x9F, 0x3C, 0x79, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x7F, 0xFF, 0xFF, 0xDF, 0x3F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x0F, 0xBC, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x0F, 0x1C, 0x00, 0x0F, 0xFF, 0xE0, 0x07, 0xC0, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x1E, 0x1F, 0x80, 0x0F, 0xFF, 0xE0, 0x03, 0x80, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x1E, 0x1F, 0x00, 0x0F, 0xFF, 0xE0, 0x07, 0x80, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x1C, 0x1F, 0x00, 0x0B, 0xFF, 0xE0, 0x07, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x1C, 0x1F, 0x00, 0x01, 0xFF, 0xE0, 0x07, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x1C, 0x1F, 0x00, 0x01, 0xFF, 0xC0, 0x07, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x1C, 0x1F, 0x80, 0x01, 0xFF, 0xC0, 0x07, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x1C, 0x03, 0x80, 0x01, 0xFF, 0xC0, 0x0E, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x1C, 0x03, 0x80, 0x01, 0xFF, 0xC0, 0x0E, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x1C, 0x03, 0x80, 0x00, 0xFF, 0xC0, 0x0E, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x1C, 0x03, 0xD0, 0x00, 0xFF, 0xC0, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x1C, 0x01, 0xF8, 0x00, 0x7F, 0xC0, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0xF8, 0x00, 0x1F, 0xC0, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0xFC, 0x00, 0x1F, 0xC0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x38, 0x01, 0xFE, 0x00, 0x0F, 0xE0, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x38, 0x03, 0xFE, 0x00, 0x0F, 0xE0, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x38, 0x07, 0xFF, 0x30, 0x0F, 0xE0, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x78, 0x07, 0xFF, 0xF8, 0x07, 0xE0, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x70, 0x07, 0xFF, 0xF8, 0x03, 0xE0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x70, 0x0F, 0xE3, 0xFC, 0x03, 0xE0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x70, 0x0F, 0x00, 0xFE, 0x01, 0xE0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x70, 0x18, 0x00, 0x7E, 0x00, 0xF0, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x07, 0x00, 0x70, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x07, 0x80, 0x38, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x03, 0x80, 0x18, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x01, 0xC0, 0x08, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x08, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x1C, 0x7C, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x3E, 0xF8, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x3F, 0xF0, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x7F, 0xE0, 0x70, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x73, 0xFC, 0x70, 0x00, 0x00, 0x01, 0xFE, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0xF1, 0xFF, 0xF0, 0x00, 0x00, 0x01, 0xFE, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE1, 0xFF, 0xF0, 0x00, 0x00, 0x73, 0xFC, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xBE, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xE3, 0xF0, 0x00, 0x10, 0xFF, 0x9F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x78, 0x00, 0x3D, 0xFF, 0x87, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x38, 0x00, 0x7F, 0xC7, 0x83, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x3C, 0x00, 0x7F, 0xC3, 0x83, 0xC3, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x1E, 0x00, 0xF3, 0xC1, 0xC1, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0xE3, 0xC1, 0xE1, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE1, 0xE1, 0xE0, 0xE0, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF9, 0xE0, 0xF0, 0xF8, 0xF7, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x7E, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-};
-
-
-/* Bitmap sizes for imagefull */
-const uint8_t imageWidthPixels = 171;
-const uint8_t imageHeightPixels = 221;
-
-
+// Copyright (c) 2015-16, Joe Krachey
+// All rights reserved.
+//
+// Redistribution and use in source or binary form, with or without modification, 
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions in source form must reproduce the above copyright 
+//    notice, this list of conditions and the following disclaimer in 
+//    the documentation and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" 
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR 
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR 
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, 
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, 
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; 
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING 
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, 
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+/* 
+**  Image data
+*/
+
+#include "lcd_images.h"
+
+const uint8_t imageBitmaps []=
+{
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xC0, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x03, 0xFC, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x0F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0xFE, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x07, 0xFC, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x0C, 0x10, 0x00, 0xE0, 0x1F, 0xFC, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0xFC, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x1C, 0x00, 0x0F, 0xBE, 0x00, 0x00, 0xFF, 0xF8, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0xF8, 0x00, 0x7F, 0xFF, 0xF0, 0x18, 0xFE, 0x00, 0x07, 0xFF, 0xCE, 0x03, 0xFF, 0xF8, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x01, 0xE0, 0x00, 0x07, 0xFF, 0x80, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xE1, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x01, 0xE3, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x01, 0xC1, 0xFF, 0xC0, 0x00, 0x77, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x87, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x03, 0xC0, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x1F, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x03, 0xC0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xFF, 0xF8, 0x3F, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x03, 0xC0, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x1E, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x01, 0xC1, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x04, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x01, 0xC1, 0x81, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x01, 0xC1, 0xC0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x01, 0xE0, 0xF0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0xC0, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x01, 0xE0, 0xF8, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x78, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x01, 0xE0, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x1F, 0x80, 0x1E, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0xF0, 0x7F, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x0F, 0xF0, 0x3E, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x78, 0x7E, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x07, 0xF0, 0x3F, 0x80, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x78, 0x38, 0x00, 0xC0, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x03, 0xE0, 0x0F, 0xC0, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x3C, 0x10, 0x03, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0x80, 0xE0, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x1E, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x03, 0xFF, 0x87, 0xF0, 0x01, 0xFC, 0x01, 0xF8, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x1E, 0x00, 0x1F, 0x80, 0x00, 0x7C, 0x1F, 0xFF, 0x00, 0x03, 0xFF, 0x0F, 0xF8, 0x01, 0xFE, 0x00, 0x7C, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x1F, 0x00, 0x3F, 0x00, 0x01, 0xFF, 0x8F, 0xFF, 0x80, 0x01, 0xFF, 0x3F, 0xF8, 0x00, 0xFF, 0x80, 0x3F, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x3F, 0x00, 0xFF, 0x00, 0x03, 0xFF, 0xE7, 0xFF, 0x80, 0x01, 0xFE, 0x7F, 0x38, 0x00, 0xFF, 0xE0, 0x1F, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x7C, 0x01, 0xFE, 0x00, 0x03, 0xFF, 0xF3, 0xFF, 0x80, 0x01, 0xFC, 0x7C, 0x18, 0x00, 0x7F, 0xF8, 0x07, 0x80, 0x00, 0x00, 
+	0x00, 0x00, 0x7C, 0x03, 0xFE, 0x00, 0x03, 0xFF, 0xF9, 0xFF, 0x80, 0x01, 0xFC, 0xFC, 0x08, 0x00, 0x7F, 0xFC, 0x07, 0x80, 0x00, 0x00, 
+	0x00, 0x01, 0xF0, 0x0F, 0xFE, 0x00, 0x07, 0xC7, 0xFC, 0xFF, 0x80, 0x01, 0xF9, 0xF8, 0x00, 0x00, 0x7F, 0xFE, 0x0F, 0x00, 0x00, 0x00, 
+	0x00, 0x03, 0xE0, 0x1F, 0xFE, 0x00, 0x07, 0x00, 0xFE, 0x3F, 0x80, 0x01, 0xF3, 0xF0, 0x00, 0x00, 0x7F, 0xFE, 0x0F, 0x00, 0x00, 0x00, 
+	0x00, 0x03, 0xE0, 0x1F, 0xFE, 0x00, 0x04, 0x00, 0x3F, 0x3F, 0xC0, 0x00, 0xC7, 0xE0, 0x00, 0x00, 0x7F, 0xFC, 0x1E, 0x00, 0x00, 0x00, 
+	0x00, 0x03, 0xE0, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0x87, 0x80, 0x02, 0x0F, 0xC3, 0x00, 0x00, 0x7F, 0xF8, 0x3E, 0x00, 0x00, 0x00, 
+	0x00, 0x01, 0xF0, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x03, 0xBF, 0x93, 0x80, 0x00, 0x7F, 0xF0, 0x3C, 0x00, 0x00, 0x00, 
+	0x00, 0x01, 0xF8, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x83, 0xF0, 0x38, 0x03, 0xFF, 0xBB, 0x80, 0x00, 0x7F, 0xE0, 0x78, 0x00, 0x00, 0x00, 
+	0x00, 0x03, 0xF0, 0x3F, 0xFF, 0x00, 0x00, 0x01, 0xD9, 0xFF, 0xF0, 0x01, 0xFF, 0x7F, 0xC0, 0x00, 0x7F, 0xE0, 0xF8, 0x00, 0x00, 0x00, 
+	0x00, 0x07, 0xE0, 0x3F, 0xFF, 0x00, 0x00, 0x03, 0xDC, 0xFF, 0xF0, 0x00, 0xFC, 0x7F, 0xC0, 0x00, 0xFF, 0xC1, 0xF0, 0x00, 0x00, 0x00, 
+	0x00, 0x0F, 0xC0, 0x7F, 0xFF, 0x80, 0x00, 0x03, 0xFE, 0x7F, 0xE0, 0x00, 0x38, 0x7F, 0x80, 0x00, 0xFF, 0x81, 0xF0, 0x00, 0x00, 0x00, 
+	0x00, 0x1F, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x03, 0xFE, 0x3F, 0xC0, 0x00, 0x00, 0x7F, 0x80, 0x01, 0xFF, 0x83, 0xF8, 0x00, 0x00, 0x00, 
+	0x00, 0x1F, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x03, 0xFE, 0x0F, 0x00, 0xF0, 0x00, 0x3F, 0x80, 0x01, 0xFF, 0xC0, 0xF8, 0x00, 0x00, 0x00, 
+	0x00, 0x0F, 0x80, 0x3F, 0xFF, 0xC0, 0x00, 0x01, 0xFE, 0x00, 0x07, 0xFF, 0x00, 0x3F, 0x00, 0x03, 0xFF, 0xC0, 0xF0, 0x00, 0x00, 0x00, 
+	0x00, 0x07, 0xC0, 0x1F, 0xFF, 0xE0, 0x00, 0x01, 0xFC, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x01, 0xF0, 0x00, 0x00, 0x00, 
+	0x00, 0x03, 0xE0, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0xF8, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x00, 0x07, 0xFE, 0x03, 0xE0, 0x00, 0x00, 0x00, 
+	0x00, 0x01, 0xF0, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFC, 0x07, 0xC0, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0xF8, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x0F, 0xF0, 0x0F, 0x80, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x7E, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xE0, 0x3F, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x3F, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0x80, 0x7E, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x0F, 0xC0, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0xFF, 0xFE, 0x00, 0x7E, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x07, 0xE0, 0x3F, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x3F, 0xFC, 0x00, 0xF0, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x01, 0xF0, 0x3F, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x1F, 0xF0, 0x01, 0xC0, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x03, 0xE0, 0x07, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0x30, 0x1F, 0x80, 0x06, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x03, 0xE0, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0x30, 0xDE, 0x00, 0x08, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x07, 0xF8, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x01, 0xFE, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x30, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x18, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1F, 0xC0, 0x1C, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x1C, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x10, 0x3F, 0xFF, 0xFC, 0x1F, 0xC7, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x30, 0x3F, 0xFF, 0xFE, 0x0F, 0xC7, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0x00, 0x3F, 0x07, 0xC7, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0x07, 0xC7, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x07, 0x80, 0x07, 0xE7, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0xC7, 0xF0, 0x00, 0x1F, 0xF0, 0x07, 0xE3, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF9, 0xC7, 0x78, 0x18, 0x00, 0xFC, 0x07, 0xE3, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF9, 0xC7, 0x3F, 0xF8, 0x00, 0x1F, 0x0F, 0xE3, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF9, 0xC7, 0x3F, 0xF0, 0x00, 0x1F, 0xFF, 0xE3, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF9, 0xC7, 0x3F, 0xFC, 0x00, 0x07, 0xFE, 0xF1, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF1, 0xC7, 0x3F, 0xFE, 0x00, 0x07, 0xFC, 0x71, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF1, 0xCF, 0x38, 0xFF, 0xC0, 0x3F, 0xFC, 0x79, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE3, 0x8E, 0x38, 0xEF, 0xFF, 0xFF, 0xCE, 0x38, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE3, 0x8E, 0x39, 0xE7, 0xFF, 0xFF, 0x8F, 0x3D, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xE7, 0x9E, 0x39, 0xE7, 0xFF, 0xF3, 0xCF, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x1E, 0x79, 0xE7, 0x1F, 0xF1, 0xC7, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x9C, 0x79, 0xC7, 0x1C, 0x71, 0xC7, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xE3, 0xFF, 0xFC, 0x71, 0xC7, 0x1C, 0x79, 0xE7, 0xFF, 0xEF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFE, 0xF1, 0xC7, 0x1E, 0x79, 0xE7, 0xFF, 0xC3, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xF3, 0xC7, 0x1E, 0x79, 0xFF, 0xFF, 0x81, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x03, 0xDF, 0xFF, 0xFF, 0xEF, 0xBE, 0x7F, 0xFF, 0xFE, 0x60, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x61, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x30, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x3F, 0xF0, 0x00, 0x03, 0xF0, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x1C, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x7F, 0xC0, 0x00, 0x0F, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x0C, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x7F, 0x80, 0x07, 0xFF, 0xF8, 0x78, 0x7B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x87, 0x0F, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0xFF, 0x87, 0xFF, 0xFF, 0xE0, 0x3C, 0x38, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xC3, 0x87, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x01, 0xFF, 0x9F, 0xFF, 0xFF, 0x80, 0x3E, 0x3C, 0x3C, 0x7F, 0xFF, 0xF8, 0xE1, 0xE3, 0xE3, 0x87, 0xF0, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x3C, 0x7C, 0x7C, 0x78, 0x7B, 0xFF, 0xFF, 0xC3, 0xF0, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0x1F, 0x0F, 0x1E, 0x3C, 0x3E, 0x38, 0xFF, 0xFF, 0xFD, 0xC3, 0xF8, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x8F, 0x8F, 0x1E, 0x1E, 0x3E, 0x1F, 0xF6, 0x00, 0x04, 0xE1, 0xF8, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x07, 0xFC, 0x18, 0x00, 0x07, 0xFF, 0x87, 0x87, 0x8F, 0x1F, 0x1F, 0x3F, 0x06, 0x00, 0x04, 0xF1, 0xFC, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x0F, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xC7, 0xC7, 0x8F, 0x0F, 0x1F, 0xF0, 0x07, 0x00, 0x06, 0x70, 0xFC, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x1F, 0xF8, 0x7C, 0xFF, 0xFF, 0xFF, 0xC3, 0xC3, 0xC7, 0x8F, 0x0F, 0xC0, 0x03, 0x00, 0x06, 0x70, 0xFE, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x1F, 0xF0, 0xF0, 0x00, 0x1E, 0x00, 0x03, 0xE3, 0xC7, 0x87, 0x8F, 0xC0, 0x03, 0x00, 0x02, 0x38, 0xFE, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x3F, 0xE1, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xE3, 0xE3, 0xC7, 0xF8, 0xE0, 0x03, 0x00, 0x03, 0x38, 0x7E, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x7F, 0xC3, 0xC1, 0x00, 0x00, 0x00, 0xF1, 0xF1, 0xE3, 0xC7, 0xF0, 0xE0, 0x03, 0x00, 0x03, 0x3C, 0x7F, 0x00, 0x00, 0x00, 0x00, 
+	0x01, 0xFF, 0x87, 0x83, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xE1, 0xE3, 0xC0, 0x60, 0x03, 0x00, 0x01, 0x3C, 0x7F, 0x00, 0x00, 0x00, 0x00, 
+	0x03, 0xFF, 0x0F, 0x87, 0xFF, 0xFF, 0xFF, 0xF1, 0xF0, 0xE1, 0xE3, 0x00, 0x60, 0x03, 0x00, 0x03, 0x3C, 0x3F, 0x00, 0x00, 0x00, 0x00, 
+	0x07, 0xFF, 0x1E, 0x0F, 0xFF, 0xFE, 0xFF, 0xF1, 0xF0, 0xF1, 0xEE, 0x00, 0x60, 0x03, 0x80, 0x03, 0x1C, 0x3F, 0xF8, 0x00, 0x00, 0x00, 
+	0x07, 0xFF, 0x1C, 0x18, 0xFF, 0xFC, 0x1F, 0x81, 0xF8, 0xF1, 0xFC, 0x00, 0x60, 0x01, 0x80, 0x03, 0x1E, 0x3F, 0xFE, 0x00, 0x00, 0x00, 
+	0x07, 0xFF, 0x3C, 0x30, 0xFF, 0xFC, 0x00, 0x01, 0xF8, 0xF9, 0xF8, 0x00, 0x60, 0x01, 0x80, 0x07, 0x1E, 0x3F, 0xFF, 0x00, 0x00, 0x00, 
+	0x07, 0xDF, 0xF8, 0x70, 0xFF, 0xFE, 0x00, 0x01, 0xF8, 0xF8, 0xF8, 0x00, 0x60, 0x01, 0xC0, 0x07, 0x1E, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 
+	0x0F, 0xCF, 0xF8, 0xE1, 0xBF, 0xFF, 0xF3, 0xF9, 0xFC, 0x78, 0xF8, 0x00, 0x20, 0x03, 0xC0, 0x07, 0x1E, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 
+	0x0F, 0xCF, 0xF1, 0xC3, 0x1F, 0xFF, 0xFF, 0xF9, 0xFC, 0x78, 0xF8, 0x00, 0x20, 0x03, 0xC0, 0x07, 0x0E, 0x3F, 0xE7, 0xF0, 0x00, 0x00, 
+	0x1F, 0xC7, 0xF1, 0xC6, 0x1F, 0xFF, 0xFF, 0xFB, 0xFC, 0x78, 0xF8, 0x00, 0x70, 0x03, 0xC0, 0x0F, 0x0E, 0x3F, 0xE3, 0xF0, 0x00, 0x00, 
+	0x1F, 0xC7, 0xF1, 0x86, 0x3F, 0x7F, 0xFF, 0xFF, 0xFC, 0x78, 0xF8, 0x00, 0x78, 0x01, 0xC0, 0x0F, 0x8E, 0x3F, 0x21, 0xFC, 0x00, 0x00, 
+	0x3F, 0x83, 0xFF, 0x8C, 0x7E, 0x0F, 0xFF, 0xFF, 0xFC, 0x78, 0x78, 0x00, 0x78, 0x01, 0x80, 0x0F, 0x8E, 0x3F, 0x11, 0xFE, 0x00, 0x00, 
+	0xFF, 0x11, 0xFF, 0x9C, 0x7E, 0x00, 0xFF, 0xFF, 0xFC, 0x78, 0x78, 0x00, 0xF8, 0x01, 0x80, 0x1F, 0x8E, 0x3F, 0x18, 0xFF, 0x00, 0x00, 
+	0xFE, 0x18, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFC, 0x78, 0x78, 0x00, 0xF8, 0x00, 0x80, 0x1F, 0x8C, 0x3F, 0x80, 0x3F, 0x80, 0x00, 
+	0xFC, 0x38, 0x7F, 0xFF, 0xF8, 0x00, 0x00, 0x1F, 0xFC, 0x78, 0x7C, 0x00, 0x70, 0x00, 0x80, 0x1F, 0x0C, 0x7F, 0x00, 0x0F, 0xE0, 0x00, 
+	0xFC, 0xF0, 0x3F, 0xFF, 0xF8, 0x00, 0x00, 0x0F, 0xFC, 0x78, 0x78, 0x00, 0x70, 0x00, 0x00, 0x1F, 0x1C, 0x7E, 0x00, 0x0F, 0xE0, 0x00, 
+	0xFF, 0xE3, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x07, 0xFC, 0x78, 0x78, 0x00, 0x70, 0x00, 0x00, 0x3F, 0x1C, 0x7E, 0x1F, 0xFF, 0xF0, 0x00, 
+	0xFF, 0xC3, 0x00, 0x00, 0x38, 0x00, 0x00, 0x07, 0xFC, 0x78, 0x7C, 0x00, 0x20, 0x00, 0x00, 0x37, 0x18, 0x7E, 0x7F, 0xFF, 0xF0, 0x00, 
+	0xFF, 0xCF, 0x18, 0x00, 0x78, 0x00, 0x00, 0x03, 0xFC, 0x78, 0xFE, 0x00, 0x20, 0x00, 0x00, 0x37, 0x18, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 
+	0xFF, 0x8E, 0x38, 0x03, 0xF8, 0x00, 0x00, 0x03, 0xFC, 0x78, 0xFF, 0x00, 0x20, 0x00, 0x00, 0x67, 0x18, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 
+	0x3F, 0xDC, 0x31, 0xC7, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0x78, 0xFF, 0x00, 0x20, 0x40, 0x00, 0x67, 0x18, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 
+	0x3F, 0xFC, 0x71, 0x0F, 0xE0, 0x00, 0x00, 0x03, 0xFC, 0x78, 0xFF, 0x00, 0x00, 0x40, 0x00, 0x47, 0x38, 0xFF, 0xFC, 0x1F, 0xE0, 0x00, 
+	0x1F, 0xF8, 0xE3, 0x1F, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0xF8, 0xFF, 0x00, 0x00, 0x40, 0x00, 0xC6, 0x30, 0xFF, 0xE0, 0x03, 0xF0, 0x00, 
+	0x0F, 0xFF, 0xE3, 0x9F, 0x80, 0x00, 0x00, 0x07, 0xF8, 0xF8, 0xFF, 0x00, 0x00, 0x40, 0x00, 0xCE, 0x31, 0xFF, 0x80, 0x01, 0xF0, 0x00, 
+	0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xF8, 0xF8, 0xFF, 0x80, 0x00, 0xC0, 0x01, 0x8E, 0x31, 0xFF, 0x18, 0x00, 0xF0, 0x00, 
+	0x07, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xF8, 0xF9, 0xFF, 0x80, 0x00, 0xC0, 0x01, 0x8C, 0x3F, 0xFF, 0x30, 0x00, 0xF8, 0x00, 
+	0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xF1, 0xF1, 0xF7, 0x80, 0x00, 0xC0, 0x01, 0x8C, 0x7F, 0xFE, 0x70, 0x00, 0x78, 0x00, 
+	0x07, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xF1, 0xF1, 0xF7, 0x80, 0x01, 0xE0, 0x03, 0x8C, 0x7F, 0xFE, 0x60, 0x00, 0x78, 0x00, 
+	0x07, 0xFF, 0xF8, 0x01, 0xE0, 0x00, 0x00, 0x3F, 0xF1, 0xF1, 0xE3, 0x80, 0x01, 0xFF, 0xFF, 0x9C, 0x7F, 0xFE, 0xE0, 0x00, 0x7C, 0x00, 
+	0x0F, 0xFF, 0xE0, 0x00, 0xF0, 0x00, 0x07, 0xFF, 0xF3, 0xE1, 0xE3, 0x80, 0x0F, 0xFF, 0xFF, 0x18, 0x7F, 0xFC, 0xE0, 0x00, 0x7C, 0x00, 
+	0x0F, 0xFF, 0x00, 0x00, 0x78, 0x00, 0x1F, 0xFF, 0xE3, 0xE3, 0xE3, 0x80, 0x3F, 0xFF, 0xFF, 0x18, 0xFF, 0xFC, 0xE0, 0x00, 0x3E, 0x00, 
+	0x0F, 0xFE, 0x0E, 0x00, 0x38, 0x00, 0x1F, 0xFF, 0xC3, 0xE3, 0xE3, 0xC0, 0xFF, 0xFF, 0xFF, 0x10, 0xFF, 0xFC, 0xE0, 0x80, 0x1E, 0x00, 
+	0x0F, 0xFE, 0x78, 0x00, 0x3C, 0x00, 0x3F, 0xFF, 0xC7, 0xE3, 0xC7, 0xC3, 0xFF, 0x87, 0x1E, 0x19, 0xFF, 0xFE, 0xE0, 0x80, 0x1F, 0x00, 
+	0x0F, 0xFF, 0xF0, 0x00, 0x1E, 0x00, 0x3F, 0xFF, 0xC7, 0xC7, 0xC7, 0xC7, 0xEF, 0x8F, 0x1E, 0x1F, 0xFF, 0xFE, 0x60, 0xD8, 0x0F, 0x80, 
+	0x0F, 0xFF, 0xE7, 0x00, 0x1E, 0x00, 0x7E, 0x7F, 0x8F, 0xC7, 0xC7, 0xCF, 0x87, 0x8F, 0x1E, 0x3F, 0xFF, 0xFE, 0x70, 0xF0, 0x07, 0x80, 
+	0x0F, 0xFF, 0xDE, 0x00, 0x0F, 0x00, 0xFE, 0x7F, 0x0F, 0x87, 0x87, 0xDF, 0x8F, 0x8F, 0x3E, 0x7F, 0xFC, 0xFF, 0x30, 0xE0, 0x07, 0xE0, 
+	0x07, 0xFF, 0xFE, 0x00, 0x07, 0x03, 0xFE, 0x7F, 0x1F, 0x8F, 0x8F, 0xFF, 0x8F, 0x9E, 0x3C, 0x7F, 0xF8, 0xFF, 0x90, 0xF8, 0x03, 0xE0, 
+	0x07, 0xFF, 0xFC, 0x00, 0x07, 0x03, 0xFE, 0x3F, 0x1F, 0x1F, 0x8F, 0xFF, 0x1F, 0x1E, 0x38, 0x7F, 0xF8, 0xFF, 0x10, 0xFF, 0x03, 0xE0, 
+	0x07, 0xFF, 0xFC, 0x10, 0x07, 0x07, 0xFF, 0x3F, 0x3F, 0x1F, 0x1F, 0xFF, 0x1F, 0x1C, 0x38, 0xFF, 0xF0, 0xFF, 0x3C, 0xFF, 0x01, 0xE0, 
+	0x07, 0xFF, 0xF8, 0x38, 0x07, 0x0F, 0xFE, 0x1F, 0xFE, 0x1F, 0x1F, 0xDE, 0x1E, 0x1C, 0x78, 0xFF, 0xE0, 0x7F, 0x7C, 0xF8, 0x01, 0xE0, 
+	0x03, 0xFF, 0xF8, 0x1C, 0x07, 0x0F, 0xFC, 0x1F, 0xFE, 0x3E, 0x1F, 0x9E, 0x3E, 0x3C, 0x7F, 0xFF, 0x80, 0x3E, 0x7D, 0xF8, 0x01, 0xE0, 
+	0x03, 0xFF, 0xE0, 0x1C, 0x0F, 0x1F, 0xF0, 0x0F, 0xFC, 0x3E, 0x3F, 0x1E, 0x3C, 0x38, 0xFF, 0xFF, 0x00, 0x3E, 0x79, 0xBC, 0x01, 0xE0, 
+	0x03, 0xFF, 0xC0, 0x1C, 0x0E, 0x1F, 0xE0, 0xC7, 0xFE, 0x7E, 0x3E, 0x3C, 0x7C, 0x78, 0xFF, 0xFE, 0x00, 0x7F, 0x7B, 0x0C, 0x03, 0xE0, 
+	0x01, 0xFF, 0x80, 0x7C, 0x0E, 0x1F, 0xC3, 0xE3, 0xFF, 0xFE, 0x7E, 0x7C, 0x7E, 0x7F, 0xFF, 0xF8, 0x00, 0x7F, 0x73, 0x04, 0x07, 0xC0, 
+	0x01, 0xFF, 0x80, 0x3C, 0x0E, 0x1F, 0xC7, 0xC1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0x33, 0x00, 0x0F, 0x80, 
+	0x00, 0xFF, 0xE0, 0x3E, 0x0E, 0x1F, 0xCF, 0x88, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0x86, 0x00, 0x3F, 0x00, 
+	0x00, 0xFF, 0xF0, 0x37, 0x1E, 0x0F, 0xFF, 0x0C, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xCE, 0x00, 0x3E, 0x00, 
+	0x00, 0xFF, 0xF0, 0x03, 0xFE, 0x0F, 0xFE, 0x1E, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x7C, 0x00, 
+	0x00, 0x7F, 0xE0, 0x01, 0xFE, 0x07, 0xFC, 0x3E, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xE1, 0xFC, 0x00, 
+	0x00, 0x7F, 0xF0, 0x00, 0xF8, 0x07, 0xF8, 0xFC, 0x70, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0xE0, 0x00, 0x00, 0x3F, 0xF7, 0xFF, 0xF0, 0x00, 
+	0x00, 0x7F, 0xF0, 0x01, 0xE0, 0x03, 0xFD, 0xFC, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x1F, 0xF3, 0xFF, 0xE0, 0x00, 
+	0x00, 0x3F, 0xF8, 0x01, 0xC0, 0x03, 0xFF, 0xF8, 0xFC, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x1F, 0xF8, 0xFF, 0xC0, 0x00, 
+	0x00, 0x3F, 0xFF, 0x03, 0xC0, 0x03, 0xFF, 0xF1, 0xF8, 0xF1, 0xE3, 0xCF, 0x1C, 0x7F, 0xC0, 0x00, 0x00, 0x07, 0xFE, 0x7F, 0x80, 0x00, 
+	0x00, 0x3F, 0xFF, 0xEF, 0x80, 0x07, 0xFF, 0xE3, 0xF1, 0xF3, 0xE3, 0x8F, 0x1C, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 
+	0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x07, 0xBF, 0xE7, 0xF3, 0xE3, 0xC7, 0x8E, 0x38, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 
+	0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x07, 0x3F, 0xFF, 0xE3, 0xE3, 0xC7, 0x9E, 0x38, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 
+	0x00, 0x07, 0xFF, 0xFE, 0x00, 0x0F, 0x1F, 0xFF, 0xC7, 0xC7, 0xC7, 0x1E, 0x38, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 
+	0x00, 0x01, 0xFF, 0xF8, 0x00, 0x0E, 0x07, 0xFF, 0xC7, 0xC7, 0x8F, 0x1C, 0x71, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x7F, 0xE0, 0x00, 0x0E, 0x03, 0xFF, 0xFF, 0xCF, 0x8F, 0x3C, 0x79, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0xFF, 0xFF, 0xCF, 0x9F, 0x3C, 0x79, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x7F, 0xFF, 0xFF, 0xDF, 0x3F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x0F, 0xBC, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x0F, 0x1C, 0x00, 0x0F, 0xFF, 0xE0, 0x07, 0xC0, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x1E, 0x1F, 0x80, 0x0F, 0xFF, 0xE0, 0x03, 0x80, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x1E, 0x1F, 0x00, 0x0F, 0xFF, 0xE0, 0x07, 0x80, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x1C, 0x1F, 0x00, 0x0B, 0xFF, 0xE0, 0x07, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x1C, 0x1F, 0x00, 0x01, 0xFF, 0xE0, 0x07, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x1C, 0x1F, 0x00, 0x01, 0xFF, 0xC0, 0x07, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x1C, 0x1F, 0x80, 0x01, 0xFF, 0xC0, 0x07, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x1C, 0x03, 0x80, 0x01, 0xFF, 0xC0, 0x0E, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x1C, 0x03, 0x80, 0x01, 0xFF, 0xC0, 0x0E, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x1C, 0x03, 0x80, 0x00, 0xFF, 0xC0, 0x0E, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x1C, 0x03, 0xD0, 0x00, 0xFF, 0xC0, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x1C, 0x01, 0xF8, 0x00, 0x7F, 0xC0, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0xF8, 0x00, 0x1F, 0xC0, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0xFC, 0x00, 0x1F, 0xC0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x38, 0x01, 0xFE, 0x00, 0x0F, 0xE0, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x38, 0x03, 0xFE, 0x00, 0x0F, 0xE0, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x38, 0x07, 0xFF, 0x30, 0x0F, 0xE0, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x78, 0x07, 0xFF, 0xF8, 0x07, 0xE0, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x70, 0x07, 0xFF, 0xF8, 0x03, 0xE0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x70, 0x0F, 0xE3, 0xFC, 0x03, 0xE0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x70, 0x0F, 0x00, 0xFE, 0x01, 0xE0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x70, 0x18, 0x00, 0x7E, 0x00, 0xF0, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x0F, 0x00, 0xF0, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x07, 0x00, 0x70, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x07, 0x80, 0x38, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x03, 0x80, 0x18, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x01, 0xC0, 0x08, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x08, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x1C, 0x7C, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x3E, 0xF8, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x3F, 0xF0, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x7F, 0xE0, 0x70, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x73, 0xFC, 0x70, 0x00, 0x00, 0x01, 0xFE, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0xF1, 0xFF, 0xF0, 0x00, 0x00, 0x01, 0xFE, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE1, 0xFF, 0xF0, 0x00, 0x00, 0x73, 0xFC, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xBE, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xE3, 0xF0, 0x00, 0x10, 0xFF, 0x9F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x78, 0x00, 0x3D, 0xFF, 0x87, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x38, 0x00, 0x7F, 0xC7, 0x83, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x3C, 0x00, 0x7F, 0xC3, 0x83, 0xC3, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x1E, 0x00, 0xF3, 0xC1, 0xC1, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0xE3, 0xC1, 0xE1, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE1, 0xE1, 0xE0, 0xE0, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF9, 0xE0, 0xF0, 0xF8, 0xF7, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x7E, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+};
+
+
+/* Bitmap sizes for imagefull */
+const uint8_t imageWidthPixels = 171;
+const uint8_t imageHeightPixels = 221;
+
+
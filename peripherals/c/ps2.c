@@ -1,85 +1,113 @@
-// Copyright (c) 2014-16, Joe Krachey
-// All rights reserved.
-//
-// Redistribution and use in binary form, with or without modification, 
-// are permitted provided that the following conditions are met:
-//
-// 1. Redistributions in binary form must reproduce the above copyright 
-//    notice, this list of conditions and the following disclaimer in 
-//    the documentation and/or other materials provided with the distribution.
-//
-// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" 
-// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
-// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR 
-// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR 
-// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, 
-// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, 
-// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; 
-// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
-// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING 
-// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, 
-// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
-
-#include "ps2.h"
-
-
-/*******************************************************************************
-* Function Name: initialize_adc_gpio_pins
-********************************************************************************
-* Used to initialize the PS2 joystick GPIO pins for both the analog inputs
-*
-* Configuration Info
-*		Fill out relevant information in ps2.h.  ps2.h defines 
-*		how various peripherals are physically connected to the board.
-*******************************************************************************/
-static void initialize_adc_gpio_pins(void)
-{
-	gpio_enable_port(PS2_GPIO_BASE);
-	
-	gpio_config_analog_enable(PS2_GPIO_BASE, PS2_X_DIR_MASK);
-	gpio_config_analog_enable(PS2_GPIO_BASE, PS2_Y_DIR_MASK);
-	
-	gpio_config_alternate_function(PS2_GPIO_BASE, PS2_X_DIR_MASK);
-	gpio_config_alternate_function(PS2_GPIO_BASE, PS2_Y_DIR_MASK);
-	
-	gpio_config_enable_input(PS2_GPIO_BASE, PS2_Y_DIR_MASK);
-}
-
-/*******************************************************************************
-* Function Name: ps2_initialize
-********************************************************************************
-* Initializes the GPIO pins connected to the PS2 Joystick.  It also configures
-* ADC0 to use Sample Sequencer #3 to convert a programmable channel number.
-*******************************************************************************/
-void ps2_initialize(void)
-{
-	initialize_adc_gpio_pins();
-	initialize_adc(PS2_ADC_BASE);
-}
-
-/*******************************************************************************
-* Function Name: ps2_get_x
-********************************************************************************
-*Returns the most current reading of the X direction  Only the lower 12-bits
-* contain data.
-********************************************************************************/
-uint16_t ps2_get_x(void)
-{
-  uint16_t adc_val = get_adc_value(PS2_ADC_BASE, PS2_X_ADC_CHANNEL);
-	
-  return adc_val;
-}
-
-/*******************************************************************************
-* Function Name: ps2_get_y
-********************************************************************************
-* Returns the most current reading of the Y direction.  Only the lower 12-bits
-*  contain data.
-********************************************************************************/
-uint16_t ps2_get_y(void)
-{
-  uint16_t adc_val = get_adc_value(PS2_ADC_BASE, PS2_Y_ADC_CHANNEL);
-  
-  return adc_val;
-}
-
+// Copyright (c) 2014-16, Joe Krachey
+// All rights reserved.
+//
+// Redistribution and use in binary form, with or without modification, 
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions in binary form must reproduce the above copyright 
+//    notice, this list of conditions and the following disclaimer in 
+//    the documentation and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" 
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR 
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR 
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, 
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, 
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; 
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING 
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, 
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "ps2.h"
+
+static const uint8_t ps2Channels[PS2_NUM_AXES] = { PS2_X_ADC_CHANNEL, PS2_Y_ADC_CHANNEL };
+
+
+/*******************************************************************************
+* Function Name: initialize_adc_gpio_pins
+********************************************************************************
+* Used to initialize the PS2 joystick GPIO pins for both the analog inputs
+*
+* Configuration Info
+*		Fill out relevant information in ps2.h.  ps2.h defines 
+*		how various peripherals are physically connected to the board.
+*******************************************************************************/
+static void initialize_adc_gpio_pins(void)
+{
+	gpio_enable_port(PS2_GPIO_BASE);
+	
+	gpio_config_analog_enable(PS2_GPIO_BASE, PS2_X_DIR_MASK);
+	gpio_config_analog_enable(PS2_GPIO_BASE, PS2_Y_DIR_MASK);
+	
+	gpio_config_alternate_function(PS2_GPIO_BASE, PS2_X_DIR_MASK);
+	gpio_config_alternate_function(PS2_GPIO_BASE, PS2_Y_DIR_MASK);
+	
+	gpio_config_enable_input(PS2_GPIO_BASE, PS2_Y_DIR_MASK);
+}
+
+/*******************************************************************************
+* Function Name: ps2_initialize
+********************************************************************************
+* Initializes the GPIO pins connected to the PS2 Joystick.  It also configures
+* ADC0 to use Sample Sequencer #3 to convert a programmable channel number,
+* and starts converting both axes in the background with Sample Sequencer #2.
+*******************************************************************************/
+void ps2_initialize(void)
+{
+	adc_sample_t sample;
+	
+	initialize_adc_gpio_pins();
+	initialize_adc(PS2_ADC_BASE);
+	adc_service_start(
+		PS2_ADC_BASE, 
+		PS2_TIMER_BASE, 
+		ps2Channels, 
+		PS2_NUM_AXES, 
+		PS2_SAMPLE_RATE_HZ, 
+		PS2_ADC_AVERAGING
+	);
+	
+	// one sample period, so the readings below are always valid
+	while (!adc_service_read(&sample)) {}
+}
+
+/*******************************************************************************
+* Function Name: ps2_get_sample
+********************************************************************************
+* Copies the latest background conversion of both axes.
+*******************************************************************************/
+void ps2_get_sample(adc_sample_t *sample)
+{
+	adc_service_read(sample);
+}
+
+/*******************************************************************************
+* Function Name: ps2_get_x
+********************************************************************************
+*Returns the most current reading of the X direction  Only the lower 12-bits
+* contain data.
+********************************************************************************/
+uint16_t ps2_get_x(void)
+{
+  adc_sample_t sample;
+	
+  adc_service_read(&sample);
+  return sample.value[PS2_X_AXIS];
+}
+
+/*******************************************************************************
+* Function Name: ps2_get_y
+********************************************************************************
+* Returns the most current reading of the Y direction.  Only the lower 12-bits
+*  contain data.
+********************************************************************************/
+uint16_t ps2_get_y(void)
+{
+  adc_sample_t sample;
+  
+  adc_service_read(&sample);
+  return sample.value[PS2_Y_AXIS];
+}
+
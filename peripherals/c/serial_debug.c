@@ -1,270 +1,344 @@
-//    notice, this list of conditions and the following disclaimer in 
-//    the documentation and/or other materials provided with the distribution.
-//
-// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" 
-// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
-// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR 
-// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR 
-// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, 
-// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, 
-// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; 
-// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
-// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING 
-// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, 
-// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
-
-#include "serial_debug.h"
-
-static bool Rx_Interrupts_Enabled = false;
-static bool Tx_Interrupts_Enabled = false;
-
-
-PC_Buffer UART0_Tx_Buffer;
-PC_Buffer UART0_Rx_Buffer;
-
-
-//************************************************************************
-// Configures the serial debug interface at 115200.
-// UART IRQs can be anbled using the two paramters to the function.
-//************************************************************************
-bool init_serial_debug(bool enable_rx_irq, bool enable_tx_irq)
-{
-  
-  // Initialize the GPIO pins used for the serial debug interface
-  gpio_enable_port(SERIAL_DBG_GPIO_BASE);
-	gpio_config_digital_enable(SERIAL_DBG_GPIO_BASE, SERIAL_DBG_RX_PIN);
-	gpio_config_digital_enable(SERIAL_DBG_GPIO_BASE, SERIAL_DBG_TX_PIN);
-	gpio_config_alternate_function(SERIAL_DBG_GPIO_BASE, SERIAL_DBG_RX_PIN);
-	gpio_config_alternate_function(SERIAL_DBG_GPIO_BASE, SERIAL_DBG_TX_PIN);
-	gpio_config_port_control(SERIAL_DBG_GPIO_BASE, SERIAL_DBG_RX_PCTL_M, SERIAL_DBG_RX_PCTL);
-	gpio_config_port_control(SERIAL_DBG_GPIO_BASE, SERIAL_DBG_TX_PCTL_M, SERIAL_DBG_TX_PCTL);
-	
-	
-  Rx_Interrupts_Enabled = enable_rx_irq;
-  Tx_Interrupts_Enabled = enable_tx_irq;
-  
-  // Initialize the circular buffer(s)
-  pc_buffer_init(&UART0_Tx_Buffer, UART_BUFFER_SIZE);
-  pc_buffer_init(&UART0_Rx_Buffer, UART_BUFFER_SIZE); 
-  
-  
-  if( uart_init(UART0_BASE,enable_rx_irq, enable_tx_irq) == false)
-  { 
-    return false;
-  }
-  
-  return true;
-}
-
-/****************************************************************************
- *
- ****************************************************************************/
-int serial_debug_rx(PC_Buffer *rx_buffer, bool block)
-{
-   int c;
-
-   while (pc_buffer_empty(rx_buffer))
-   {
-      if (!block)
-         return -1;
-   }
-
-   // Remove data from the circular buffer.  Make sure this is an
-   // atomic operation.  Disable ALL interrupts when modifying the circular 
-   // buffer.  See main.c to determine how to enable/disable interrupts.
-   DisableInterrupts();
-	 pc_buffer_remove(rx_buffer, (char *) &c);
-	 EnableInterrupts();
-   return c;
-}
-
-/****************************************************************************
- *
- ****************************************************************************/
-void serial_debug_tx(uint32_t uart_base, PC_Buffer *tx_buffer, int data)
-{
-  UART0_Type *uart = (UART0_Type *)(uart_base);
-  bool  tx_buffer_full;
-  bool  tx_buffer_empty;
-  bool  fifo_full;
-  
-  // Determine if the hardware fifo is full
-  fifo_full = (uart->FR & UART_FR_TXFF); 
-  
-  // Determine if the pc_buffer is empty
-  tx_buffer_empty = pc_buffer_empty(tx_buffer); 
-  
-  // If there is space in the hardwere FIFO, and the circular
-  // buffer is empty, send the data to the FIFO.
-  if( !fifo_full && tx_buffer_empty )
-  {
-    // write data to HW FIFO
-		uart->DR = data; 
-  }
-  else
-  {
-    // Test to see if the circular buffer is full
-    // If it is, we wait until there is space.
-    do
-    {
-        // determine if the tx circular buffer is full
-        tx_buffer_full = pc_buffer_full(tx_buffer); 
-    } while(tx_buffer_full);
-
-    // Add the character to the circular buffer.   Make sure this is an
-    // atomic operation.  Disable ALL interrupts when modifying the circular 
-    // buffer. See main.c to determine how to enable/disable interrupts.
-		DisableInterrupts();
-		pc_buffer_add(tx_buffer, data);
-		EnableInterrupts();
-    
-  }
-  
-  // If you're in this function, you want to send data
-  // so enable TX interrupts in the UART IM register even if they 
-  // are already enabled.
-	uart->IM |= UART_IM_TXIM;
-
-  return;
-}
-
-
-//****************************************************************************
-//  This function is called from MicroLIB's stdio library.  By implementing
-//  this function, MicroLIB's getchar(), scanf(), etc will now work.
-// ****************************************************************************/
-int fgetc(FILE* stream)
-{
-   char c;
-   if ( Rx_Interrupts_Enabled)
-   {
-    c = serial_debug_rx(&UART0_Rx_Buffer, true);
-   }
-   else
-   {
-     c = uart_rx_poll(UART0_BASE,true);
-   }
-
-   if (c == '\r')
-      c = '\n';
-
-   fputc(c, stdout);
-
-   return c;
-}
-
-//****************************************************************************
-// This function is called from MicroLIB's stdio library.  By implementing
-// this function, MicroLIB's putchar(), puts(), printf(), etc will now work.
-// ****************************************************************************/
-int fputc(int c, FILE* stream)
-{
-   if ( Tx_Interrupts_Enabled)
-   {
-      serial_debug_tx(UART0_BASE, &UART0_Tx_Buffer, c);
-   }
-   else
-   {
-      uart_tx_poll(UART0_BASE, c);
-   }
-
-   if (c == '\n')
-   {
-      if ( Tx_Interrupts_Enabled)
-      {
-        serial_debug_tx(UART0_BASE, &UART0_Tx_Buffer,'\r');
-      }
-      else
-      {
-         uart_tx_poll(UART0_BASE, '\r');
-      }
-   }
-
-   return c;
-}
-
-//*****************************************************************************
-//*****************************************************************************
-// UART ISR Handler
-//*****************************************************************************
-//*****************************************************************************
-
-//*****************************************************************************
-// Rx Portion of the UART ISR Handler
-//*****************************************************************************
-__INLINE static void UART_Rx_Flow(uint32_t uart_base, PC_Buffer *rx_buffer)
-{
-  UART0_Type *uart = (UART0_Type *)(uart_base);
-  
-  
-  // Remove entries from the RX FIFO and place them in the circular buffer.  Return
-  // once the RX FIFO is empty.
-	while (!(uart->FR & UART_FR_RXFE))
-		pc_buffer_add(rx_buffer, uart->DR);
-  // Clear the RX interrupts so it can trigger again when the hardware 
-  // FIFO becomes full
-  uart->ICR = UART_IM_RXIM | UART_IM_RTIM;
-}
-
-//*****************************************************************************
-// Tx Portion of the UART ISR Handler
-//*****************************************************************************
-__INLINE static void UART_Tx_Flow(uint32_t uart_base, PC_Buffer *tx_buffer)
-{
-    UART0_Type *uart = (UART0_Type *)(uart_base);    
-    char c;
-    bool tx_buffer_empty;
-  
-   // Check to see if we have any data in the circular buffer
-    tx_buffer_empty = pc_buffer_empty(tx_buffer); /*modify*/
-  
-    if(!tx_buffer_empty)
-    {
-        // Move data from the circular queue to the hardware FIFO
-        // until the hardware FIFO is full OR the circular buffer
-        // becomes empty.
-				while (!((uart->FR & UART_FR_TXFF) || tx_buffer_empty))
-				{
-						pc_buffer_remove(tx_buffer, &c);
-						uart->DR = c;
-					  tx_buffer_empty = pc_buffer_empty(tx_buffer); /*modify*/
-				} 
-    }
-    else
-    {
-        // Disable the TX interrupts.
-				uart->IM &= ~UART_IM_TXIM;
-    }
-    
-    // Clear the TX interrupt so it can trigger again when the hardware
-    // FIFO is empty
-		uart->ICR = UART_ICR_TXIC;
-}
-
-//*****************************************************************************
-// UART0 Interrupt Service handler
-//*****************************************************************************
-void UART0_Handler(void)
-{
-    uint32_t  status;
-    uint32_t  rx_mask   = 0 ;
-    uint32_t  tx_mask   = 0 ;
-
-    // Read the interrupt status of the UART
-    status = UART0->MIS; /*modify*/
-
-    // set rx_mask to detect both Rx related interrupts.
-    rx_mask = UART_MIS_RXMIS | UART_MIS_RTMIS; /*modify*/
-		tx_mask = UART_MIS_TXMIS;
-	
-    if ( status & rx_mask)
-    {
-       UART_Rx_Flow(UART0_BASE, &UART0_Rx_Buffer);
-    }
-    if ( status & tx_mask) 
-		{
-			UART_Tx_Flow(UART0_BASE, &UART0_Tx_Buffer);
-		}
-		
-    return;
-}
+//    notice, this list of conditions and the following disclaimer in 
+//    the documentation and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" 
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+// THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR 
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR 
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, 
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, 
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; 
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING 
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, 
+// EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "serial_debug.h"
+#include "udma.h"
+
+static bool Rx_Interrupts_Enabled = false;
+static bool Tx_Interrupts_Enabled = false;
+
+
+SPSC_RING_STORAGE(UART0_Rx_Buffer, UART_BUFFER_SIZE);
+spsc_ring_t UART0_Rx_Buffer = SPSC_RING_INIT(UART0_Rx_Buffer);
+
+// Transmit double buffer.  The caller fills txChunk[txFill] while the uDMA
+// sends the other one.  Both are only changed with interrupts masked or 
+// from UART0_Handler.
+static uint8_t txChunk[2][SERIAL_DMA_CHUNK];
+static volatile uint8_t txFill;
+static volatile uint16_t txFillLen;
+static volatile bool txDmaBusy;
+static volatile uint32_t txDroppedUnreported;
+static serial_debug_stats_t txStats;
+
+
+//************************************************************************
+// Configures the serial debug interface at 115200.
+// UART IRQs can be anbled using the two paramters to the function.
+//************************************************************************
+bool init_serial_debug(bool enable_rx_irq, bool enable_tx_irq)
+{
+  
+  // Initialize the GPIO pins used for the serial debug interface
+  gpio_enable_port(SERIAL_DBG_GPIO_BASE);
+	gpio_config_digital_enable(SERIAL_DBG_GPIO_BASE, SERIAL_DBG_RX_PIN);
+	gpio_config_digital_enable(SERIAL_DBG_GPIO_BASE, SERIAL_DBG_TX_PIN);
+	gpio_config_alternate_function(SERIAL_DBG_GPIO_BASE, SERIAL_DBG_RX_PIN);
+	gpio_config_alternate_function(SERIAL_DBG_GPIO_BASE, SERIAL_DBG_TX_PIN);
+	gpio_config_port_control(SERIAL_DBG_GPIO_BASE, SERIAL_DBG_RX_PCTL_M, SERIAL_DBG_RX_PCTL);
+	gpio_config_port_control(SERIAL_DBG_GPIO_BASE, SERIAL_DBG_TX_PCTL_M, SERIAL_DBG_TX_PCTL);
+	
+	
+  Rx_Interrupts_Enabled = enable_rx_irq;
+  Tx_Interrupts_Enabled = enable_tx_irq;
+  
+  // Transmit is done by the uDMA, the UART TX interrupt is never used
+  if( uart_init(UART0_BASE,enable_rx_irq, false) == false)
+  { 
+    return false;
+  }
+  
+  if ( enable_tx_irq)
+  {
+    udma_init();
+    udma_channel_assign(SERIAL_DMA_CHANNEL, SERIAL_DMA_ENCODING);
+    UART0->DMACTL |= UART_DMACTL_TXDMAE;
+    
+    // uDMA completion is signaled on the UART0 vector
+    NVIC_SetPriority(UART0_IRQn, 0);
+    NVIC_EnableIRQ(UART0_IRQn);
+  }
+  
+  return true;
+}
+
+/****************************************************************************
+ * Sends the buffer being filled and switches to the other one.  Called with
+ * interrupts masked or from UART0_Handler, only when the uDMA is idle.
+ ****************************************************************************/
+static void serial_debug_dma_start(void)
+{
+  uint8_t sending = txFill;
+  
+  udma_setup(SERIAL_DMA_CHANNEL, false, txChunk[sending], &UART0->DR, txFillLen,
+             SERIAL_DMA_CONTROL);
+  
+  txStats.chunks++;
+  if ( txFillLen > txStats.maxChunk)
+  {
+    txStats.maxChunk = txFillLen;
+  }
+  
+  txFill = sending ^ 1;
+  txFillLen = 0;
+  txDmaBusy = true;
+  udma_enable(SERIAL_DMA_CHANNEL, false);
+}
+
+/****************************************************************************
+ * Copies bytes into the buffer being filled.  Called with interrupts masked.
+ ****************************************************************************/
+static __INLINE void serial_debug_stage(const uint8_t *data, uint32_t num_bytes)
+{
+  uint8_t *chunk = &txChunk[txFill][txFillLen];
+  uint32_t i;
+  
+  for ( i = 0; i < num_bytes; i++)
+  {
+    chunk[i] = data[i];
+  }
+  txFillLen += num_bytes;
+  txStats.bytesQueued += num_bytes;
+}
+
+#define SERIAL_DROP_NOTE    "\r\n[serial dropped "
+
+/****************************************************************************
+ * Stages a note with the number of bytes dropped since the last note, once
+ * there is room for it.  Called with interrupts masked.
+ ****************************************************************************/
+static void serial_debug_report_drops(void)
+{
+  char note[32] = SERIAL_DROP_NOTE;
+  uint32_t length = sizeof(SERIAL_DROP_NOTE) - 1;
+  uint32_t count = txDroppedUnreported;
+  char digits[10];
+  int n = 0;
+  
+  if ( SERIAL_DMA_CHUNK - txFillLen < sizeof(note))
+  {
+    return;
+  }
+  
+  do
+  {
+    digits[n++] = '0' + (count % 10);
+    count /= 10;
+  } while ( count > 0);
+  while ( n > 0)
+  {
+    note[length++] = digits[--n];
+  }
+  note[length++] = ']';
+  note[length++] = '\r';
+  note[length++] = '\n';
+  
+  serial_debug_stage((uint8_t *)note, length);
+  txDroppedUnreported = 0;
+}
+
+/****************************************************************************
+ * Queues a block of bytes for the uDMA, all or none of them.
+ ****************************************************************************/
+bool serial_debug_write(const uint8_t *data, uint32_t num_bytes)
+{
+  uint32_t primask = __get_PRIMASK();
+  bool queued = false;
+  
+  __disable_irq();
+  
+  if ( txDroppedUnreported > 0)
+  {
+    serial_debug_report_drops();
+  }
+  
+  if ( num_bytes <= SERIAL_DMA_CHUNK - txFillLen)
+  {
+    serial_debug_stage(data, num_bytes);
+    queued = true;
+  }
+  else
+  {
+    txStats.droppedBytes += num_bytes;
+    txDroppedUnreported += num_bytes;
+  }
+  
+  if ( !txDmaBusy && txFillLen > 0)
+  {
+    serial_debug_dma_start();
+  }
+  
+  __set_PRIMASK(primask);
+  return queued;
+}
+
+/****************************************************************************
+ * Returns the transmit statistics
+ ****************************************************************************/
+void serial_debug_get_stats(serial_debug_stats_t *stats)
+{
+  uint32_t primask = __get_PRIMASK();
+  
+  __disable_irq();
+  *stats = txStats;
+  __set_PRIMASK(primask);
+}
+
+/****************************************************************************
+ *
+ ****************************************************************************/
+int serial_debug_rx(spsc_ring_t *rx_buffer, bool block)
+{
+   uint8_t c;
+
+   // Only this function removes data from the ring and only the UART 
+   // handler adds it, so no interrupts need to be disabled.
+   while (!spsc_ring_pop(rx_buffer, &c))
+   {
+      if (!block)
+         return -1;
+   }
+
+   return c;
+}
+
+/****************************************************************************
+ * Queues one byte for the uDMA.  Never waits, the byte is counted as 
+ * dropped if both buffers are full.
+ ****************************************************************************/
+void serial_debug_tx(int data)
+{
+  uint8_t c = data;
+  
+  serial_debug_write(&c, 1);
+}
+
+
+//****************************************************************************
+//  This function is called from MicroLIB's stdio library.  By implementing
+//  this function, MicroLIB's getchar(), scanf(), etc will now work.
+// ****************************************************************************/
+int fgetc(FILE* stream)
+{
+   char c;
+   if ( Rx_Interrupts_Enabled)
+   {
+    c = serial_debug_rx(&UART0_Rx_Buffer, true);
+   }
+   else
+   {
+     c = uart_rx_poll(UART0_BASE,true);
+   }
+
+   if (c == '\r')
+      c = '\n';
+
+   fputc(c, stdout);
+
+   return c;
+}
+
+//****************************************************************************
+// This function is called from MicroLIB's stdio library.  By implementing
+// this function, MicroLIB's putchar(), puts(), printf(), etc will now work.
+// ****************************************************************************/
+int fputc(int c, FILE* stream)
+{
+   if ( Tx_Interrupts_Enabled)
+   {
+      serial_debug_tx(c);
+   }
+   else
+   {
+      uart_tx_poll(UART0_BASE, c);
+   }
+
+   if (c == '\n')
+   {
+      if ( Tx_Interrupts_Enabled)
+      {
+        serial_debug_tx('\r');
+      }
+      else
+      {
+         uart_tx_poll(UART0_BASE, '\r');
+      }
+   }
+
+   return c;
+}
+
+//*****************************************************************************
+//*****************************************************************************
+// UART ISR Handler
+//*****************************************************************************
+//*****************************************************************************
+
+//*****************************************************************************
+// Rx Portion of the UART ISR Handler
+//*****************************************************************************
+__INLINE static void UART_Rx_Flow(uint32_t uart_base, spsc_ring_t *rx_buffer)
+{
+  UART0_Type *uart = (UART0_Type *)(uart_base);
+  
+  
+  // Remove entries from the RX FIFO and place them in the circular buffer.  Return
+  // once the RX FIFO is empty.
+  // Bytes that do not fit in a full ring are dropped.
+	while (!(uart->FR & UART_FR_RXFE))
+		spsc_ring_push(rx_buffer, uart->DR);
+  // Clear the RX interrupts so it can trigger again when the hardware 
+  // FIFO becomes full
+  uart->ICR = UART_IM_RXIM | UART_IM_RTIM;
+}
+
+//*****************************************************************************
+// Tx Portion of the UART ISR Handler.  When the uDMA has moved the last byte
+// of a chunk into the TX FIFO, the buffer filled in the meantime is sent.
+//*****************************************************************************
+__INLINE static void UART_Tx_Dma_Flow(void)
+{
+  if ( udma_done(SERIAL_DMA_CHANNEL))
+  {
+    txDmaBusy = false;
+    if ( txFillLen > 0)
+    {
+      serial_debug_dma_start();
+    }
+  }
+}
+
+//*****************************************************************************
+// UART0 Interrupt Service handler
+//*****************************************************************************
+void UART0_Handler(void)
+{
+    uint32_t  status;
+    uint32_t  rx_mask   = 0 ;
+
+    // Read the interrupt status of the UART
+    status = UART0->MIS; /*modify*/
+
+    // set rx_mask to detect both Rx related interrupts.
+    rx_mask = UART_MIS_RXMIS | UART_MIS_RTMIS; /*modify*/
+	
+    if ( status & rx_mask)
+    {
+       UART_Rx_Flow(UART0_BASE, &UART0_Rx_Buffer);
+    }
+    UART_Tx_Dma_Flow();
+		
+    return;
+}
@@ -0,0 +1,569 @@
+#include "wireless.h"
+#include "cycle_counter.h"
+
+const char *wireless_error_messages[] = {
+  "Tx Success",
+  "Tx FIFO Full",
+  "Tx Packet Lost",
+  "Rx Success",
+  "Rx FIFO Empty",
+  "Error"
+};
+
+// Queued packets.  The main loop adds to txQueue and the interrupt handler
+// removes from it, rxQueue is the other way around.
+static wireless_packet_t txQueue[WIRELESS_QUEUE_LEN];
+static volatile uint8_t txHead;
+static volatile uint8_t txTail;
+static wireless_packet_t rxQueue[WIRELESS_QUEUE_LEN];
+static volatile uint8_t rxHead;
+static volatile uint8_t rxTail;
+
+// Set while a packet is in the radio waiting for its acknowledge
+static volatile bool txBusy;
+static uint32_t txStartCycles;
+
+static wireless_stats_t wirelessStats;
+
+// PD3 interrupt mask saved while CS is low
+static uint32_t wirelessIrqSaved;
+
+//*****************************************************************************
+// Manually sets the SPI chip select line low.  The radio interrupt is masked
+// while CS is low so the handler cannot start a transfer in the middle of
+// one issued from the main loop.
+//*****************************************************************************
+static __INLINE void wireless_CSN_low(void)
+{
+  wirelessIrqSaved = RF_IRQ_PORT->IM & RF_IRQ_PIN;
+  RF_IRQ_PORT->IM &= ~RF_IRQ_PIN;
+  RF_CS_PORT->DATA &= ~RF_CS_PIN;
+}
+
+//*****************************************************************************
+// Manually sets the SPI chip select line high
+//*****************************************************************************
+static __INLINE void wireless_CSN_high(void)
+{
+  RF_CS_PORT->DATA |= RF_CS_PIN;
+  RF_IRQ_PORT->IM |= wirelessIrqSaved;
+}
+
+static __INLINE void wireless_CE_low(void)
+{
+  RF_CE_PORT->DATA &= ~RF_CE_PIN;
+}
+
+static __INLINE void wireless_CE_high(void)
+{
+  RF_CE_PORT->DATA |= RF_CE_PIN;
+}
+
+//*****************************************************************************
+// Sends a command followed by num_bytes of tx, NULL sends NOPs, and copies
+// what comes back into rx if it is not NULL.  Returns the STATUS register,
+// which the radio clocks out with the command byte.
+//*****************************************************************************
+static uint8_t wireless_command(uint8_t command, const uint8_t *tx, uint8_t *rx, uint8_t num_bytes)
+{
+  uint8_t buffer[1 + WIRELESS_MAX_PAYLOAD];
+  uint8_t i;
+
+  buffer[0] = command;
+  for ( i = 0; i < num_bytes; i++)
+  {
+    buffer[i + 1] = tx ? tx[i] : NRF24L01_CMD_NOP;
+  }
+
+  wireless_CSN_low();
+  spiTx(RF_SPI_BASE, buffer, num_bytes + 1, buffer);
+  wireless_CSN_high();
+
+  if ( rx)
+  {
+    for ( i = 0; i < num_bytes; i++)
+    {
+      rx[i] = buffer[i + 1];
+    }
+  }
+  return buffer[0];
+}
+
+static __INLINE uint8_t wireless_reg_read(uint8_t reg)
+{
+  uint8_t data;
+
+  wireless_command(NRF24L01_CMD_R_REGISTER | reg, NULL, &data, 1);
+  return data;
+}
+
+static __INLINE void wireless_reg_write(uint8_t reg, uint8_t data)
+{
+  wireless_command(NRF24L01_CMD_W_REGISTER | reg, &data, NULL, 1);
+}
+
+// CONFIG with every interrupt enabled, 2 byte CRC and powered up
+#define WIRELESS_CONFIG   (NRF24L01_CONFIG_EN_CRC | NRF24L01_CONFIG_CRCO_2BYTES | NRF24L01_CONFIG_PWR_UP)
+
+//*****************************************************************************
+// Loads the next queued packet and starts sending it.  Called with the
+// radio interrupt masked or from the handler, only while txBusy is false.
+// With nothing queued the radio goes back to listening.
+//*****************************************************************************
+static void wireless_tx_next(void)
+{
+  wireless_packet_t *packet;
+
+  wireless_CE_low();
+
+  if ( txHead == txTail)
+  {
+    wireless_reg_write(NRF24L01_CONFIG_R, WIRELESS_CONFIG | NRF24L01_CONFIG_PRIM_RX_PRX);
+    wireless_CE_high();
+    return;
+  }
+
+  packet = &txQueue[txTail & (WIRELESS_QUEUE_LEN - 1)];
+  wireless_reg_write(NRF24L01_CONFIG_R, WIRELESS_CONFIG | NRF24L01_CONFIG_PRIM_RX_PTX);
+  wireless_command(NRF24L01_CMD_W_TX_PAYLOAD, packet->data, NULL, packet->length);
+  txTail++;
+
+  txBusy = true;
+  txStartCycles = cycle_counter_read();
+  wirelessStats.sent++;
+
+  // CE stays high, the radio sends and then waits in standby for more
+  wireless_CE_high();
+}
+
+//*****************************************************************************
+// Moves every packet in the RX FIFO into rxQueue
+//*****************************************************************************
+static void wireless_rx_drain(void)
+{
+  wireless_packet_t *packet;
+  uint8_t length;
+
+  while ( (wireless_reg_read(NRF24L01_FIFO_STATUS_R) & NRF24L01_FIFO_STATUS_RX_EMPTY_M) == 0)
+  {
+    wireless_command(NRF24L01_CMD_R_RX_PL_WID, NULL, &length, 1);
+
+    // a corrupt width can only be cleared by flushing the whole FIFO
+    if ( length == 0 || length > WIRELESS_MAX_PAYLOAD)
+    {
+      wireless_command(NRF24L01_CMD_FLUSH_RX, NULL, NULL, 0);
+      return;
+    }
+
+    if ( (uint8_t)(rxHead - rxTail) >= WIRELESS_QUEUE_LEN)
+    {
+      // read it anyway so the FIFO keeps moving
+      uint8_t discard[WIRELESS_MAX_PAYLOAD];
+
+      wireless_command(NRF24L01_CMD_R_RX_PAYLOAD, NULL, discard, length);
+      wirelessStats.rxQueueFull++;
+      continue;
+    }
+
+    packet = &rxQueue[rxHead & (WIRELESS_QUEUE_LEN - 1)];
+    wireless_command(NRF24L01_CMD_R_RX_PAYLOAD, NULL, packet->data, length);
+    packet->length = length;
+    rxHead++;
+    wirelessStats.received++;
+  }
+}
+
+//*****************************************************************************
+// Finishes the packet in flight
+//*****************************************************************************
+static void wireless_tx_done(bool acked)
+{
+  uint8_t retries = wireless_reg_read(NRF24L01_OBSERVE_TX_R) & NRF24L01_OBSERVE_TX_ARC_CNT_M;
+  uint32_t rtt;
+
+  wirelessStats.retransmits += retries;
+
+  if ( acked)
+  {
+    rtt = (cycle_counter_read() - txStartCycles) / (SystemCoreClock / 1000000);
+    wirelessStats.acked++;
+    wirelessStats.rttLastUs = rtt;
+    wirelessStats.rttTotalUs += rtt;
+    if ( wirelessStats.acked == 1 || rtt < wirelessStats.rttMinUs)
+    {
+      wirelessStats.rttMinUs = rtt;
+    }
+    if ( rtt > wirelessStats.rttMaxUs)
+    {
+      wirelessStats.rttMaxUs = rtt;
+    }
+  }
+  else
+  {
+    // the payload stays in the TX FIFO after MAX_RT
+    wireless_command(NRF24L01_CMD_FLUSH_TX, NULL, NULL, 0);
+    wirelessStats.lost++;
+  }
+
+  txBusy = false;
+}
+
+//*****************************************************************************
+// Radio IRQ, called by GPIOD_Handler while the radio is selected.  The IRQ
+// pin stays low until every flag is cleared, so the flags are handled
+// until none are left.
+//*****************************************************************************
+static void wireless_irq(void)
+{
+  uint8_t status;
+
+  RF_IRQ_PORT->ICR = RF_IRQ_PIN;
+
+  status = wireless_command(NRF24L01_CMD_NOP, NULL, NULL, 0);
+  while ( status & (NRF24L01_STATUS_RX_DR_M | NRF24L01_STATUS_TX_DS_M | NRF24L01_STATUS_MAX_RT_M))
+  {
+    wireless_reg_write(NRF24L01_STATUS_R, status);
+
+    if ( status & NRF24L01_STATUS_RX_DR_M)
+    {
+      wireless_rx_drain();
+    }
+
+    if ( status & (NRF24L01_STATUS_TX_DS_M | NRF24L01_STATUS_MAX_RT_M))
+    {
+      wireless_tx_done((status & NRF24L01_STATUS_TX_DS_M) != 0);
+      wireless_tx_next();
+    }
+
+    status = wireless_command(NRF24L01_CMD_NOP, NULL, NULL, 0);
+  }
+}
+
+//*****************************************************************************
+// Queues a packet of 1 to WIRELESS_MAX_PAYLOAD bytes.  Returns false if the
+// queue is full or the length is invalid.
+//*****************************************************************************
+bool wireless_link_send(const uint8_t *data, uint8_t length)
+{
+  wireless_packet_t *packet;
+  uint32_t irqSaved;
+  uint8_t i;
+
+  if ( length == 0 || length > WIRELESS_MAX_PAYLOAD)
+  {
+    return false;
+  }
+
+  if ( (uint8_t)(txHead - txTail) >= WIRELESS_QUEUE_LEN)
+  {
+    wirelessStats.txQueueFull++;
+    return false;
+  }
+
+  packet = &txQueue[txHead & (WIRELESS_QUEUE_LEN - 1)];
+  for ( i = 0; i < length; i++)
+  {
+    packet->data[i] = data[i];
+  }
+  packet->length = length;
+  txHead++;
+
+  // an idle radio is started here, otherwise the handler sends it once
+  // the packet ahead of it is done
+  irqSaved = RF_IRQ_PORT->IM & RF_IRQ_PIN;
+  RF_IRQ_PORT->IM &= ~RF_IRQ_PIN;
+  if ( !txBusy)
+  {
+    wireless_tx_next();
+  }
+  RF_IRQ_PORT->IM |= irqSaved;
+
+  return true;
+}
+
+//*****************************************************************************
+// Takes the oldest received packet.  data must hold WIRELESS_MAX_PAYLOAD
+// bytes.  Returns false if nothing has been received.
+//*****************************************************************************
+bool wireless_link_receive(uint8_t *data, uint8_t *length)
+{
+  wireless_packet_t *packet;
+  uint8_t i;
+
+  if ( rxHead == rxTail)
+  {
+    return false;
+  }
+
+  packet = &rxQueue[rxTail & (WIRELESS_QUEUE_LEN - 1)];
+  for ( i = 0; i < packet->length; i++)
+  {
+    data[i] = packet->data[i];
+  }
+  *length = packet->length;
+  rxTail++;
+
+  return true;
+}
+
+//*****************************************************************************
+// Returns true while packets are queued or being sent.
+//*****************************************************************************
+bool wireless_link_busy(void)
+{
+  return txBusy || txHead != txTail;
+}
+
+//*****************************************************************************
+// Returns the link statistics.
+//*****************************************************************************
+void wireless_link_get_stats(wireless_stats_t *stats)
+{
+  uint32_t irqSaved = RF_IRQ_PORT->IM & RF_IRQ_PIN;
+
+  RF_IRQ_PORT->IM &= ~RF_IRQ_PIN;
+  *stats = wirelessStats;
+  RF_IRQ_PORT->IM |= irqSaved;
+}
+
+//*****************************************************************************
+// Sets up the link between the local board, my_id, and the remote one,
+// dest_id.  Both ids are 5 bytes.  Returns false if the radio does not
+// respond.
+//*****************************************************************************
+bool wireless_link_init(const uint8_t *my_id, const uint8_t *dest_id)
+{
+  wireless_initialize();
+  return wireless_configure_device((uint8_t *)my_id, (uint8_t *)dest_id);
+}
+
+//*****************************************************************************
+// Ends the link.  The radio interrupt is masked and its handler removed 
+// before anything else so nothing of the radio runs once the accelerometer
+// has SSI0 and PD3 back.  PD3 also loses the pull-up the radio's open 
+// drain IRQ needed.
+//*****************************************************************************
+void wireless_link_release(void)
+{
+  RF_IRQ_PORT->IM &= ~RF_IRQ_PIN;
+  spi_select_set_irq_handler(NORDIC, NULL);
+
+  // the radio is only reachable while it is still selected
+  if ( spi_select_current() == NORDIC)
+  {
+    wireless_CE_low();
+    wireless_reg_write(NRF24L01_CONFIG_R, WIRELESS_CONFIG & ~NRF24L01_CONFIG_PWR_UP);
+  }
+
+  RF_IRQ_PORT->PUR &= ~RF_IRQ_PIN;
+  RF_IRQ_PORT->ICR = RF_IRQ_PIN;
+
+  txHead = txTail = 0;
+  rxHead = rxTail = 0;
+  txBusy = false;
+}
+
+//*****************************************************************************
+// Configures the Nordic nRF24L01+ for Enhanced ShockBurst with the local
+// board listening on pipe 1 and pipe 0 receiving the acknowledges from
+// dest_id.  Payloads are dynamic, up to WIRELESS_MAX_PAYLOAD bytes.
+//*****************************************************************************
+bool wireless_configure_device(
+  uint8_t           *my_id,
+  uint8_t           *dest_id
+)
+{
+  int i;
+
+  // nothing may interrupt the setup
+  RF_IRQ_PORT->IM &= ~RF_IRQ_PIN;
+  wireless_CE_low();
+
+  wireless_reg_write(NRF24L01_CONFIG_R, WIRELESS_CONFIG | NRF24L01_CONFIG_PRIM_RX_PRX);
+
+  // the radio takes 1.5ms to power up, checking a register written above
+  // also confirms it is there
+  for ( i = 0; i < 100000; i++) {};
+  if ( wireless_reg_read(NRF24L01_CONFIG_R) != (WIRELESS_CONFIG | NRF24L01_CONFIG_PRIM_RX_PRX))
+  {
+    return false;
+  }
+
+  wireless_reg_write(NRF24L01_SETUP_AW_R, NRF24L01_SETUP_AW_5_BYTES);
+  wireless_reg_write(NRF24L01_SETUP_RETR_R, NRF24L01_SETUP_RETR_ARD_0500_US | WIRELESS_RETRANSMITS);
+  wireless_reg_write(NRF24L01_RF_CH_R, RF_CHANNEL);
+  wireless_reg_write(NRF24L01_RF_SETUP_R, NRF24L01_RF_SETUP_2_MBPS | NRF24L01_RF_SETUP_RF_PWR_0DB);
+
+  wireless_command(NRF24L01_CMD_W_REGISTER | NRF24L01_TX_ADDR_R, dest_id, NULL, RF_ADDR_WIDTH);
+  wireless_command(NRF24L01_CMD_W_REGISTER | NRF24L01_RX_ADDR_P0_R, dest_id, NULL, RF_ADDR_WIDTH);
+  wireless_command(NRF24L01_CMD_W_REGISTER | NRF24L01_RX_ADDR_P1_R, my_id, NULL, RF_ADDR_WIDTH);
+
+  wireless_reg_write(NRF24L01_EN_AA_R, NRF24L01_ENAA_P0 | NRF24L01_ENAA_P1);
+  wireless_reg_write(NRF24L01_EN_RXADDR_R, NRF24L01_RXADDR_ERX_P0 | NRF24L01_RXADDR_ERX_P1);
+  wireless_reg_write(NRF24L01_FEATURE_R, NRF24L01_FEATURE_EN_DPL);
+  wireless_reg_write(NRF24L01_DYNPD_R, NRF24L01_DYNPD_P0 | NRF24L01_DYNPD_P1);
+
+  wireless_command(NRF24L01_CMD_FLUSH_TX, NULL, NULL, 0);
+  wireless_command(NRF24L01_CMD_FLUSH_RX, NULL, NULL, 0);
+  wireless_reg_write(NRF24L01_STATUS_R, NRF24L01_STATUS_CLEAR_ALL);
+
+  txHead = txTail = 0;
+  rxHead = rxTail = 0;
+  txBusy = false;
+  memset(&wirelessStats, 0, sizeof(wirelessStats));
+
+  // listen
+  wireless_CE_high();
+
+  RF_IRQ_PORT->ICR = RF_IRQ_PIN;
+  RF_IRQ_PORT->IM |= RF_IRQ_PIN;
+  return true;
+}
+
+//*****************************************************************************
+// Configures the GPIO pins and SPI interface for the radio.  The radio
+// shares SSI0 and PD3 with the accelerometer through the SPI select mux,
+// this takes both over for the radio.
+//*****************************************************************************
+void wireless_initialize(void)
+{
+  spi_select_init();
+  spi_select(NORDIC);
+  spi_select_set_irq_handler(NORDIC, wireless_irq);
+
+  gpio_enable_port(RF_GPIO_BASE);
+
+  // Configure SPI CLK
+  gpio_config_digital_enable(RF_GPIO_BASE, RF_CLK_PIN);
+  gpio_config_alternate_function(RF_GPIO_BASE, RF_CLK_PIN);
+  gpio_config_port_control(RF_GPIO_BASE, RF_SPI_CLK_PCTL_M, RF_CLK_PIN_PCTL);
+
+  // Configure SPI MISO
+  gpio_config_digital_enable(RF_GPIO_BASE, RF_MISO_PIN);
+  gpio_config_alternate_function(RF_GPIO_BASE, RF_MISO_PIN);
+  gpio_config_port_control(RF_GPIO_BASE, RF_SPI_MISO_PCTL_M, RF_MISO_PIN_PCTL);
+
+  // Configure SPI MOSI
+  gpio_config_digital_enable(RF_GPIO_BASE, RF_MOSI_PIN);
+  gpio_config_alternate_function(RF_GPIO_BASE, RF_MOSI_PIN);
+  gpio_config_port_control(RF_GPIO_BASE, RF_SPI_MOSI_PCTL_M, RF_MOSI_PIN_PCTL);
+
+  // CS and CE are driven by software
+  gpio_enable_port(RF_CS_BASE);
+  gpio_config_digital_enable(RF_CS_BASE, RF_CS_PIN);
+  gpio_config_enable_output(RF_CS_BASE, RF_CS_PIN);
+  RF_CS_PORT->DATA |= RF_CS_PIN;
+
+  gpio_enable_port(RF_CE_GPIO_BASE);
+  gpio_config_digital_enable(RF_CE_GPIO_BASE, RF_CE_PIN);
+  gpio_config_enable_output(RF_CE_GPIO_BASE, RF_CE_PIN);
+  wireless_CE_low();
+
+  // IRQ is active low
+  gpio_enable_port(RF_IRQ_GPIO_BASE);
+  gpio_config_digital_enable(RF_IRQ_GPIO_BASE, RF_IRQ_PIN);
+  gpio_config_enable_input(RF_IRQ_GPIO_BASE, RF_IRQ_PIN);
+  gpio_config_enable_pullup(RF_IRQ_GPIO_BASE, RF_IRQ_PIN);
+  gpio_config_falling_edge_irq(RF_IRQ_GPIO_BASE, RF_IRQ_PIN);
+  RF_IRQ_PORT->IM &= ~RF_IRQ_PIN;
+  NVIC_SetPriority(RF_IRQ_NUM, RF_IRQ_PRIORITY);
+  NVIC_EnableIRQ(RF_IRQ_NUM);
+
+  // RTT is measured with the cycle counter
+  cycle_counter_init();
+
+  initialize_spi(RF_SPI_BASE, RF_SPI_MODE, RF_SPI_CPSR);
+}
+
+//*****************************************************************************
+// Transmits 4 bytes of data to the remote device.  With block set this
+// waits until the packet is acknowledged or lost, and with retry set a lost
+// packet is sent again until it gets through.
+//*****************************************************************************
+wireless_com_status_t
+wireless_send_32(
+  bool      block,
+  bool      retry,
+  uint32_t   data
+  )
+{
+  uint32_t lost;
+
+  do
+  {
+    lost = wirelessStats.lost;
+
+    if ( !wireless_link_send((uint8_t *)&data, sizeof(data)))
+    {
+      if ( !block)
+      {
+        return NRF24L01_TX_FIFO_FULL;
+      }
+      continue;
+    }
+
+    if ( !block)
+    {
+      return NRF24L01_TX_SUCCESS;
+    }
+
+    while ( wireless_link_busy()) {};
+
+    if ( wirelessStats.lost == lost)
+    {
+      return NRF24L01_TX_SUCCESS;
+    }
+  } while ( retry);
+
+  return NRF24L01_TX_PCK_LOST;
+}
+
+//*****************************************************************************
+// Receives 4 bytes of data from the remote board.  The user can optionally
+// block until data arrives.
+//*****************************************************************************
+wireless_com_status_t
+  wireless_get_32(
+  bool      blockOnEmpty,
+  uint32_t  *data
+  )
+{
+  uint8_t packet[WIRELESS_MAX_PAYLOAD];
+  uint8_t length;
+
+  while ( !wireless_link_receive(packet, &length))
+  {
+    if ( !blockOnEmpty)
+    {
+      return NRF24L01_RX_FIFO_EMPTY;
+    }
+  }
+
+  if ( length != sizeof(*data))
+  {
+    return NRF24L01_ERR;
+  }
+  memcpy(data, packet, sizeof(*data));
+  return NRF24L01_RX_SUCCESS;
+}
+
+//*****************************************************************************
+// Test Rx and Tx of the wireless radio.  Sends counter, throws away 
+// whatever has come back and copies the link statistics.  Nothing is 
+// printed, the caller reports the result.
+//*****************************************************************************
+wireless_com_status_t wireless_test(uint32_t counter, wireless_stats_t *stats)
+{
+  wireless_com_status_t status;
+  uint32_t data;
+
+  status = wireless_send_32(true, false, counter);
+
+  while ( wireless_get_32(false, &data) == NRF24L01_RX_SUCCESS) {};
+
+  if ( stats != NULL)
+  {
+    wireless_link_get_stats(stats);
+  }
+  return status;
+}
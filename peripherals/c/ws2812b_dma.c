@@ -0,0 +1,115 @@
+#include "ws2812b_dma.h"
+#include "cycle_counter.h"
+
+static uint32_t ws2812bTiming[WS2812B_ENCODED_LEN(WS2812B_DMA_MAX_LEDS)];
+
+// Set while the uDMA is feeding the timer
+static volatile bool ws2812bSending;
+
+// Cycle counter when the uDMA wrote the last match value
+static volatile uint32_t ws2812bDoneCycles;
+
+// Cycles the line has to stay low after the last bit.  The uDMA finishes
+// while the last bit is still going out, so two more periods are added.
+static uint32_t ws2812bLatchCycles;
+
+//*****************************************************************************
+// Configures PD7, WTIMER5B and its uDMA channel.  WTIMER5B counts down in
+// PWM mode, its output goes high when it reloads and low at the match
+// value.  The rising edge requests the uDMA, and the match register is only
+// updated at the next reload, so the value written during one bit is used
+// for the next.
+//*****************************************************************************
+bool ws2812b_dma_init(void)
+{
+  // Port D is unlocked when it is enabled, PD7 is the NMI pin by default
+  if ( !gpio_enable_port(GPIOD_BASE))
+  {
+    return false;
+  }
+  gpio_config_digital_enable(GPIOD_BASE, WS2812B_DMA_PIN);
+  gpio_config_alternate_function(GPIOD_BASE, WS2812B_DMA_PIN);
+  gpio_config_port_control(GPIOD_BASE, WS2812B_DMA_PCTL_M, WS2812B_DMA_PCTL);
+
+  SYSCTL->RCGCWTIMER |= SYSCTL_RCGCWTIMER_R5;
+  while( (SYSCTL->PRWTIMER & SYSCTL_PRWTIMER_R5) == 0) {};
+
+  WTIMER5->CTL &= ~TIMER_CTL_TBEN;
+  WTIMER5->CFG = TIMER_CFG_16_BIT;    // two 32-bit halves on a wide timer
+  WTIMER5->TBMR = TIMER_TBMR_TBAMS | TIMER_TBMR_TBMR_PERIOD |
+                  TIMER_TBMR_TBPWMIE | TIMER_TBMR_TBMRSU;
+  WTIMER5->CTL = (WTIMER5->CTL & ~(TIMER_CTL_TBEVENT_M | TIMER_CTL_TBPWML)) |
+                 TIMER_CTL_TBEVENT_POS;
+  WTIMER5->TBPR = 0;
+  WTIMER5->TBILR = WS2812B_PERIOD_CYCLES - 1;
+  WTIMER5->TBMATCHR = WS2812B_MATCH_LOW;
+
+  // The edges only request the uDMA, the one interrupt is its completion
+  WTIMER5->IMR &= ~(TIMER_IMR_CBEIM | TIMER_IMR_CBMIM | TIMER_IMR_TBTOIM);
+
+  udma_init();
+  udma_channel_assign(WS2812B_DMA_CHANNEL, WS2812B_DMA_ENCODING);
+  NVIC_SetPriority(WTIMER5B_IRQn, WS2812B_DMA_IRQ_PRIORITY);
+  NVIC_EnableIRQ(WTIMER5B_IRQn);
+
+  cycle_counter_init();
+  ws2812bLatchCycles = (SystemCoreClock / 1000000) * WS2812B_LATCH_US + 2 * WS2812B_PERIOD_CYCLES;
+  ws2812bSending = false;
+  ws2812bDoneCycles = cycle_counter_read() - ws2812bLatchCycles;
+
+  return true;
+}
+
+//*****************************************************************************
+// Returns true until the last colors have been sent and latched
+//*****************************************************************************
+bool ws2812b_dma_busy(void)
+{
+  return ws2812bSending ||
+         (uint32_t)(cycle_counter_read() - ws2812bDoneCycles) < ws2812bLatchCycles;
+}
+
+//*****************************************************************************
+// Encodes the colors and starts the timer.  The first match value is
+// written before the timer is enabled, enabling it raises the output for
+// the first bit and requests the second.
+//*****************************************************************************
+bool ws2812b_dma_show(const WS2812B_t *leds, uint8_t num_leds)
+{
+  uint16_t count;
+
+  if ( num_leds == 0 || num_leds > WS2812B_DMA_MAX_LEDS || ws2812b_dma_busy())
+  {
+    return false;
+  }
+
+  count = ws2812b_encode((const uint8_t *)leds, num_leds, ws2812bTiming);
+
+  WTIMER5->CTL &= ~TIMER_CTL_TBEN;
+  WTIMER5->TBV = WS2812B_PERIOD_CYCLES - 1;
+  WTIMER5->TBMATCHR = ws2812bTiming[0];
+
+  udma_setup(WS2812B_DMA_CHANNEL, false, &ws2812bTiming[1], &WTIMER5->TBMATCHR, count - 1,
+             UDMA_CHCTL_DSTINC_NONE | UDMA_CHCTL_DSTSIZE_32 | UDMA_CHCTL_SRCINC_32 |
+             UDMA_CHCTL_SRCSIZE_32 | UDMA_CHCTL_ARBSIZE_1 | UDMA_CHCTL_XFERMODE_BASIC);
+
+  ws2812bSending = true;
+  udma_enable(WS2812B_DMA_CHANNEL, true);
+  WTIMER5->CTL |= TIMER_CTL_TBEN;
+
+  return true;
+}
+
+//*****************************************************************************
+// uDMA completion.  The last value written is the low period, the timer is
+// left running with its output low and no more edges to request the uDMA.
+//*****************************************************************************
+void WTIMER5B_Handler(void)
+{
+  if ( udma_done(WS2812B_DMA_CHANNEL))
+  {
+    ws2812bDoneCycles = cycle_counter_read();
+    ws2812bSending = false;
+  }
+  WTIMER5->ICR = TIMER_ICR_CBECINT;
+}
@@ -0,0 +1,27 @@
+#include "ws2812b_encode.h"
+
+//*****************************************************************************
+// Encodes the colors of a strip into a timing buffer, most significant bit
+// of each byte first
+//*****************************************************************************
+uint16_t ws2812b_encode(const uint8_t *grb, uint16_t num_leds, uint32_t *timing)
+{
+  uint32_t *start = timing;
+  uint16_t bytes = num_leds * 3;
+  uint8_t value;
+  uint8_t mask;
+
+  while ( bytes-- > 0)
+  {
+    value = *grb++;
+    for ( mask = 0x80; mask != 0; mask >>= 1)
+    {
+      *timing++ = (value & mask) ? WS2812B_MATCH_1 : WS2812B_MATCH_0;
+    }
+  }
+
+  // Leaves the line low once the last bit is out
+  *timing++ = WS2812B_MATCH_LOW;
+
+  return timing - start;
+}
@@ -1,99 +1,213 @@
-#ifndef __ACCEL_H__
-#define __ACCEL_H__
-
-#include <stdint.h>
-#include <stdio.h>
-#include "TM4C123GH6PM.h"
-
-#include "gpio_port.h"
-#include "spi.h"
-#include "spi_select.h"
-
-
-//*****************************************************************************
-// Fill out the #defines below to configure which pins are connected to
-// LSM6DS3HTR
-//*****************************************************************************
-#define   ACCEL_GPIO_BASE       	GPIOA_BASE
-#define   ACCEL_SPI_BASE        	SSI0_BASE
-
-#define   ACCEL_CLK_PIN         	PA2
-#define   ACCEL_MISO_PIN        	PA4
-#define   ACCEL_MOSI_PIN        	PA5
-
-#define   ACCEL_SPI_CLK_PCTL_M  	GPIO_PCTL_PA2_M
-#define   ACCEL_SPI_MISO_PCTL_M  	GPIO_PCTL_PA4_M
-#define   ACCEL_SPI_MOSI_PCTL_M  	GPIO_PCTL_PA5_M
-
-#define   ACCEL_CLK_PIN_PCTL    	GPIO_PCTL_PA2_SSI0CLK
-#define   ACCEL_MISO_PIN_PCTL   	GPIO_PCTL_PA4_SSI0RX
-#define   ACCEL_MOSI_PIN_PCTL   	GPIO_PCTL_PA5_SSI0TX
-
-#define   ACCEL_CS_BASE        		GPIOA_BASE
-#define   ACCEL_CS_PIN          	PA3
-#define   ACCEL_CS_PORT         	GPIOA
-
-#define   ACCEL_IRQ_GPIO_BASE    GPIOD_BASE
-#define   ACCEL_IRQ_PIN          PD3
-
-
-#define ACCEL_INT1_CTRL_R                     0x0D
-#define ACCEL_WHO_AM_I_R											0x0F
-#define ACCEL_CTRL1_XL_R											0x10
-#define ACCEL_CTRL2_G_R												0x11
-#define ACCEL_CTRL5_C_R												0x14
-#define ACCEL_OUTX_L_XL												0x28
-#define ACCEL_OUTX_H_XL												0x29
-#define ACCEL_OUTY_L_XL												0x2A
-#define ACCEL_OUTY_H_XL												0x2B
-#define ACCEL_OUTZ_L_XL												0x2C
-#define ACCEL_OUTZ_H_XL												0x2D
-
-// ADD CODE
-#define ACCEL_SPI_MODE												3
-
-#define ACCEL_SPI_READ												( 1 << 7)
-#define ACCEL_SPI_WRITE_N											( 0 << 7)
-
-
-#define ACCEL_INT1_CTRL_INT1_STEP_DETECTOR		(1 << 7)
-#define ACCEL_INT1_CTRL_INT1_SIGN_MOT					(1 << 6)
-#define ACCEL_INT1_CTRL_INT1_FULL_FLAG				(1 << 5)
-#define ACCEL_INT1_CTRL_INT1_FIFO_OVR					(1 << 4)
-#define ACCEL_INT1_CTRL_INT1_FTH							(1 << 3)
-#define ACCEL_INT1_CTRL_INT1_BOOT							(1 << 2)
-#define ACCEL_INT1_CTRL_INT1_DRDY_G						(1 << 1)
-#define ACCEL_INT1_CTRL_INT1_DRDY_XL					(1 << 0)
-
-#define ACCEL_CTRL1_XL_ODR_208HZ							(0x5 << 4)
-#define ACCEL_CTRL1_XL_2G											(0x0 << 2)
-#define ACCEL_CTRL1_XL_ANTI_ALIAS_50HZ				(0x3 << 0)
-
-#define ACCEL_CTRL2_G_ODR_416HZ								(0x6 << 4)
-#define ACCEL_CTRL2_G_FS_245_DPS							(0x0 << 2)
-#define ACCEL_CTRL2_G_FS_125									(0x2 << 0)
-
-#define ACCEL_CTRL5_SLEEP_G										(0x1 << 6)
-#define ACCEL_CTRL5_INT2_ON_INT1							(0x1 << 5)
-
-
-//*****************************************************************************
-//*****************************************************************************
-int16_t accel_read_x(void);
-
-//*****************************************************************************
-//*****************************************************************************
-int16_t accel_read_y(void);
-
-//*****************************************************************************
-//*****************************************************************************
-int16_t accel_read_z(void);
-
-//*****************************************************************************
-// Used to initialize the ST Micro LSM6DS3H Accelerometer.  The GPIO pins and SPI 
-// interface are both configured.
-//*****************************************************************************
-void accel_initialize(void);
-
-
-#endif
+#ifndef __ACCEL_H__
+#define __ACCEL_H__
+
+#include <stdint.h>
+#include <stdio.h>
+#include "TM4C123GH6PM.h"
+
+#include "gpio_port.h"
+#include "spi.h"
+#include "spi_select.h"
+
+
+//*****************************************************************************
+// Fill out the #defines below to configure which pins are connected to
+// LSM6DS3HTR
+//*****************************************************************************
+#define   ACCEL_GPIO_BASE       	GPIOA_BASE
+#define   ACCEL_SPI_BASE        	SSI0_BASE
+
+#define   ACCEL_CLK_PIN         	PA2
+#define   ACCEL_MISO_PIN        	PA4
+#define   ACCEL_MOSI_PIN        	PA5
+
+#define   ACCEL_SPI_CLK_PCTL_M  	GPIO_PCTL_PA2_M
+#define   ACCEL_SPI_MISO_PCTL_M  	GPIO_PCTL_PA4_M
+#define   ACCEL_SPI_MOSI_PCTL_M  	GPIO_PCTL_PA5_M
+
+#define   ACCEL_CLK_PIN_PCTL    	GPIO_PCTL_PA2_SSI0CLK
+#define   ACCEL_MISO_PIN_PCTL   	GPIO_PCTL_PA4_SSI0RX
+#define   ACCEL_MOSI_PIN_PCTL   	GPIO_PCTL_PA5_SSI0TX
+
+#define   ACCEL_CS_BASE        		GPIOA_BASE
+#define   ACCEL_CS_PIN          	PA3
+#define   ACCEL_CS_PORT         	GPIOA
+
+#define   ACCEL_IRQ_GPIO_BASE    GPIOD_BASE
+#define   ACCEL_IRQ_PIN          PD3
+#define   ACCEL_IRQ_PORT         GPIOD
+#define   ACCEL_IRQ_NUM          GPIOD_IRQn
+#define   ACCEL_IRQ_PRIORITY     2
+
+
+#define ACCEL_FIFO_CTRL1_R										0x06
+#define ACCEL_FIFO_CTRL2_R										0x07
+#define ACCEL_FIFO_CTRL3_R										0x08
+#define ACCEL_FIFO_CTRL4_R										0x09
+#define ACCEL_FIFO_CTRL5_R										0x0A
+#define ACCEL_INT1_CTRL_R                     0x0D
+#define ACCEL_WHO_AM_I_R											0x0F
+#define ACCEL_CTRL1_XL_R											0x10
+#define ACCEL_CTRL2_G_R												0x11
+#define ACCEL_CTRL3_C_R												0x12
+#define ACCEL_CTRL5_C_R												0x14
+#define ACCEL_OUTX_L_G												0x22
+#define ACCEL_OUTX_L_XL												0x28
+#define ACCEL_OUTX_H_XL												0x29
+#define ACCEL_OUTY_L_XL												0x2A
+#define ACCEL_OUTY_H_XL												0x2B
+#define ACCEL_OUTZ_L_XL												0x2C
+#define ACCEL_OUTZ_H_XL												0x2D
+#define ACCEL_FIFO_STATUS1_R									0x3A
+#define ACCEL_FIFO_STATUS2_R									0x3B
+#define ACCEL_FIFO_STATUS3_R									0x3C
+#define ACCEL_FIFO_STATUS4_R									0x3D
+#define ACCEL_FIFO_DATA_OUT_L									0x3E
+#define ACCEL_FIFO_DATA_OUT_H									0x3F
+
+// ADD CODE
+#define ACCEL_SPI_MODE												3
+
+#define ACCEL_SPI_READ												( 1 << 7)
+#define ACCEL_SPI_WRITE_N											( 0 << 7)
+
+
+#define ACCEL_INT1_CTRL_INT1_STEP_DETECTOR		(1 << 7)
+#define ACCEL_INT1_CTRL_INT1_SIGN_MOT					(1 << 6)
+#define ACCEL_INT1_CTRL_INT1_FULL_FLAG				(1 << 5)
+#define ACCEL_INT1_CTRL_INT1_FIFO_OVR					(1 << 4)
+#define ACCEL_INT1_CTRL_INT1_FTH							(1 << 3)
+#define ACCEL_INT1_CTRL_INT1_BOOT							(1 << 2)
+#define ACCEL_INT1_CTRL_INT1_DRDY_G						(1 << 1)
+#define ACCEL_INT1_CTRL_INT1_DRDY_XL					(1 << 0)
+
+#define ACCEL_CTRL1_XL_ODR_208HZ							(0x5 << 4)
+#define ACCEL_CTRL1_XL_2G											(0x0 << 2)
+#define ACCEL_CTRL1_XL_ANTI_ALIAS_50HZ				(0x3 << 0)
+
+#define ACCEL_CTRL2_G_ODR_416HZ								(0x6 << 4)
+#define ACCEL_CTRL2_G_FS_245_DPS							(0x0 << 2)
+#define ACCEL_CTRL2_G_FS_125									(0x2 << 0)
+
+#define ACCEL_CTRL3_C_BDU											(0x1 << 6)
+#define ACCEL_CTRL3_C_IF_INC									(0x1 << 2)
+
+#define ACCEL_CTRL5_SLEEP_G										(0x1 << 6)
+#define ACCEL_CTRL5_INT2_ON_INT1							(0x1 << 5)
+
+#define ACCEL_FIFO_CTRL2_FTH_H_M							(0x0F)
+
+#define ACCEL_FIFO_CTRL3_DEC_G_NONE						(0x1 << 3)
+#define ACCEL_FIFO_CTRL3_DEC_XL_NONE					(0x1 << 0)
+
+#define ACCEL_FIFO_CTRL5_ODR_208HZ						(0x5 << 3)
+#define ACCEL_FIFO_CTRL5_BYPASS								(0x0 << 0)
+#define ACCEL_FIFO_CTRL5_CONTINUOUS						(0x6 << 0)
+
+#define ACCEL_FIFO_STATUS2_WATERM							(1 << 7)
+#define ACCEL_FIFO_STATUS2_OVER_RUN						(1 << 6)
+#define ACCEL_FIFO_STATUS2_FULL								(1 << 5)
+#define ACCEL_FIFO_STATUS2_EMPTY							(1 << 4)
+#define ACCEL_FIFO_STATUS2_DIFF_H_M						(0x0F)
+
+#define ACCEL_FIFO_STATUS4_PATTERN_H_M				(0x03)
+
+
+//*****************************************************************************
+//*****************************************************************************
+// The FIFO holds gyro X,Y,Z then accelerometer X,Y,Z for every sample, both
+// at the 208 Hz FIFO rate.  INT1 fires once ACCEL_FIFO_WATERMARK samples 
+// (about 19 ms) are queued, roughly once per game tick.
+#define ACCEL_FIFO_WORDS_PER_SAMPLE						6
+#define ACCEL_FIFO_WATERMARK									4
+#define ACCEL_FIFO_MAX_DRAIN									8         // samples per SPI burst
+#define ACCEL_FIFO_RING_SIZE									32        // power of two
+
+// Longest register burst, ACCEL_FIFO_MAX_DRAIN samples of FIFO data
+#define ACCEL_MAX_BURST												(ACCEL_FIFO_MAX_DRAIN * ACCEL_FIFO_WORDS_PER_SAMPLE * 2)
+
+typedef struct {
+	int16_t x;
+	int16_t y;
+	int16_t z;
+} accel_xyz_t;
+
+typedef struct {
+	accel_xyz_t gyro;
+	accel_xyz_t accel;
+} accel_sample_t;
+
+typedef struct {
+	uint32_t samples;       // burst reads done
+	uint32_t lastCycles;    // SPI time of the last read, CS low to CS high
+	uint32_t maxCycles;
+	uint64_t totalCycles;
+	uint32_t fifoIrqs;      // watermark interrupts serviced
+	uint32_t fifoSamples;   // samples moved from the sensor FIFO to the ring
+	uint32_t fifoDropped;   // samples lost because the ring was full
+	uint32_t fifoOverruns;  // sensor FIFO overran before it was drained
+} accel_stats_t;
+
+int16_t accel_read_x(void);
+
+//*****************************************************************************
+//*****************************************************************************
+int16_t accel_read_y(void);
+
+//*****************************************************************************
+//*****************************************************************************
+int16_t accel_read_z(void);
+
+//*****************************************************************************
+// Used to initialize the ST Micro LSM6DS3H Accelerometer.  The GPIO pins and SPI 
+// interface are both configured.
+//*****************************************************************************
+// All three acceleration axes in one SPI transaction
+void accel_read_xyz(accel_xyz_t *accel);
+
+// Gyro and acceleration axes in one SPI transaction
+void accel_read_imu(accel_xyz_t *gyro, accel_xyz_t *accel);
+
+// SPI time spent reading samples, in core clock cycles
+void accel_get_stats(accel_stats_t *stats);
+
+//*****************************************************************************
+// Copies up to max samples, oldest first, out of the FIFO ring.  Returns the 
+// number of samples copied.
+//*****************************************************************************
+uint16_t accel_fifo_get(accel_sample_t *samples, uint16_t max);
+
+//*****************************************************************************
+// Drains the FIFO ring and returns the mean of every sample queued since the
+// last call in avg.  Averaging filters and decimates the 208 Hz stream down 
+// to one value per game tick.  Returns the number of samples averaged; avg is
+// not modified when the ring is empty.
+//*****************************************************************************
+uint16_t accel_fifo_average(accel_sample_t *avg);
+
+//*****************************************************************************
+// Moves every complete sample in the sensor FIFO into the ring.  Called from
+// the INT1 watermark interrupt.
+//*****************************************************************************
+void accel_fifo_service(void);
+
+//*****************************************************************************
+// Runs spiBenchmark() on the accelerometer's SSI with ACCEL_MAX_BURST bytes,
+// the longest transfer the driver makes.  Returns false while another 
+// device (the radio) is selected on the SSI.
+//*****************************************************************************
+bool accel_spi_benchmark(spi_benchmark_t *result);
+
+void accel_initialize(void);
+
+//*****************************************************************************
+// Gives the accelerometer SSI0 and PD3 back after wireless_link_release().
+// The radio shares both through the SPI select mux and reprograms them, so
+// the SPI mode, the INT1 rising edge interrupt and the FIFO handler are 
+// set up again and the sensor FIFO is drained once.  Call from the main 
+// loop.
+//*****************************************************************************
+void accel_resume(void);
+
+
+#endif
@@ -0,0 +1,74 @@
+#ifndef __ACCEL_TILT_H__
+#define __ACCEL_TILT_H__
+
+#include <stdint.h>
+#include "accel.h"
+
+//*****************************************************************************
+// Fixed-point complementary filter for the board tilt about the sensor Y 
+// axis.  The gyro rate is integrated at the 208 Hz FIFO rate and the result 
+// is pulled toward the accelerometer tilt with a time constant of 
+// 2^ACCEL_TILT_ALPHA_SHIFT samples (about 0.3 s).  Vibration on the 
+// accelerometer is rejected and the gyro drift is removed.
+//
+// Angles are binary angles, 32768 = 180 degrees.  The filter is intended for
+// tilts within +/-90 degrees of level, face up.
+//
+// tools/accel_tilt_check.c replays made up IMU streams through the filter
+// on the PC.
+//*****************************************************************************
+
+#define ACCEL_TILT_DEGREES(d)         (((d) * 32768) / 180)
+
+// Fractional bits kept in the filter state
+#define ACCEL_TILT_FRAC_BITS          14
+
+// One gyro LSB for one sample period in filter state units:
+// 4.375 mdps/LSB at 125 dps full scale / 208 Hz * 32768/180 * 2^14 = 62.7
+#define ACCEL_TILT_GYRO_SCALE         63
+
+#define ACCEL_TILT_ALPHA_SHIFT        6
+
+// Samples averaged for the gyro zero-rate offset after accel_tilt_init().
+// The board should be still for this long (about 0.3 s).
+#define ACCEL_TILT_BIAS_SAMPLES       64
+
+// Cycle budget of one filter step.  At 208 Hz this is 52k cycles per 
+// second, about 0.1% of a 50 MHz core.
+#define ACCEL_TILT_BUDGET_CYCLES      250
+
+typedef struct {
+	uint32_t samples;       // filter steps run
+	uint32_t lastCycles;    // cycles spent in the last step
+	uint32_t maxCycles;
+	uint32_t overBudget;    // steps longer than ACCEL_TILT_BUDGET_CYCLES
+} accel_tilt_stats_t;
+
+//*****************************************************************************
+// Resets the filter and starts measuring the gyro offset
+//*****************************************************************************
+void accel_tilt_init(void);
+
+//*****************************************************************************
+// Runs the filter on one sample
+//*****************************************************************************
+void accel_tilt_sample(const accel_sample_t *sample);
+
+//*****************************************************************************
+// Runs the filter on every sample waiting in the accelerometer FIFO ring and
+// returns the new tilt.  Call once per main loop pass.
+//*****************************************************************************
+int16_t accel_tilt_update(void);
+
+//*****************************************************************************
+// Returns the filtered tilt.  Positive when the board is rotated about +Y, 
+// which lowers the +X edge.
+//*****************************************************************************
+int16_t accel_tilt_angle(void);
+
+//*****************************************************************************
+// Returns the time spent in the filter
+//*****************************************************************************
+void accel_tilt_get_stats(accel_tilt_stats_t *stats);
+
+#endif
@@ -1,73 +1,148 @@
-#ifndef __EEPROM_H__
-#define __EEPROM_H__
-
-
-#include <stdint.h>
-#include "i2c.h"
-#include "gpio_port.h"
-
-#define MCP24LC32AT_DEV_ID			0x50
-#define EEPROM_TEST_NUM_BYTES    20
-
-//*****************************************************************************
-// Fill out the #defines below to configure which pins are connected to
-// the I2C Bus
-//*****************************************************************************
-#define   EEPROM_GPIO_BASE         	GPIOA_BASE
-#define   EEPROM_I2C_BASE          	I2C1_BASE
-#define   EEPROM_I2C_SCL_PIN       	PA6
-#define   EEPROM_I2C_SDA_PIN       	PA7
-#define   EEPROM_I2C_SCL_PCTL_M     GPIO_PCTL_PA6_M
-#define   EEPROM_I2C_SCL_PIN_PCTL 	GPIO_PCTL_PA6_I2C1SCL
-#define   EEPROM_I2C_SDA_PCTL_M     GPIO_PCTL_PA7_M
-#define   EEPROM_I2C_SDA_PIN_PCTL  	GPIO_PCTL_PA7_I2C1SDA
-
-//*****************************************************************************
-// Writes a single byte of data out to the  MCP24LC32AT EEPROM.  
-//
-// Paramters
-//    i2c_base:   a valid base address of an I2C peripheral
-//
-//    address:    16-bit address of the byte being written.  Only the lower
-//                12 bits is used by the EEPROM
-//
-//    data:       Data written to the EEPROM.
-//
-// Returns
-// I2C_OK if the byte was written to the EEPROM.
-//*****************************************************************************
-i2c_status_t eeprom_byte_write
-( 
-  uint32_t  i2c_base,
-  uint16_t  eepromDataAddress,
-  uint8_t   data
-);
-
-//*****************************************************************************
-// Reads a single byte of data from the  MCP24LC32AT EEPROM.  
-//
-// Paramters
-//    i2c_base:   a valid base address of an I2C peripheral
-//
-//    address:    16-bit address of the byte being read.  Only the lower
-//                12 bits is used by the EEPROM
-//
-//    data:       data read from the EEPROM is returned to a uint8_t pointer.
-//
-// Returns
-// I2C_OK if the byte was read from the EEPROM.
-//*****************************************************************************
-i2c_status_t eeprom_byte_read
-( 
-  uint32_t  i2c_base,
-  uint16_t  address,
-  uint8_t   *data
-);
-
-//*****************************************************************************
-// Initialize the EEPROM peripheral
-//*****************************************************************************
-bool eeprom_init(void);
-
-
-#endif
+#ifndef __EEPROM_H__
+#define __EEPROM_H__
+
+
+#include <stdint.h>
+#include "i2c.h"
+#include "gpio_port.h"
+
+#define MCP24LC32AT_DEV_ID			0x50
+// fastest SCL rate of the MCP24LC32AT at 2.5V and above
+#define MCP24LC32AT_MAX_SCL_HZ    I2C_SCL_FAST
+#define EEPROM_TEST_NUM_BYTES    20
+
+// The MCP24LC32AT is 4K bytes organized as 128 pages of 32 bytes.  A single
+// write cycle can program up to one full page.
+#define EEPROM_SIZE_BYTES        4096
+#define EEPROM_PAGE_SIZE         32
+
+// Longest sequential read done without giving other I2C bus clients a turn
+#define EEPROM_READ_CHUNK        32
+
+//*****************************************************************************
+// Fill out the #defines below to configure which pins are connected to
+// the I2C Bus
+//*****************************************************************************
+#define   EEPROM_GPIO_BASE         	GPIOA_BASE
+#define   EEPROM_I2C_BASE          	I2C1_BASE
+#define   EEPROM_I2C_SCL_PIN       	PA6
+#define   EEPROM_I2C_SDA_PIN       	PA7
+#define   EEPROM_I2C_SCL_PCTL_M     GPIO_PCTL_PA6_M
+#define   EEPROM_I2C_SCL_PIN_PCTL 	GPIO_PCTL_PA6_I2C1SCL
+#define   EEPROM_I2C_SDA_PCTL_M     GPIO_PCTL_PA7_M
+#define   EEPROM_I2C_SDA_PIN_PCTL  	GPIO_PCTL_PA7_I2C1SDA
+
+//*****************************************************************************
+// Writes a single byte of data out to the  MCP24LC32AT EEPROM.  
+//
+// Paramters
+//    i2c_base:   a valid base address of an I2C peripheral
+//
+//    address:    16-bit address of the byte being written.  Only the lower
+//                12 bits is used by the EEPROM
+//
+//    data:       Data written to the EEPROM.
+//
+// Returns
+// I2C_OK if the byte was written to the EEPROM.
+//*****************************************************************************
+i2c_status_t eeprom_byte_write
+( 
+  uint32_t  i2c_base,
+  uint16_t  eepromDataAddress,
+  uint8_t   data
+);
+
+//*****************************************************************************
+// Reads a single byte of data from the  MCP24LC32AT EEPROM.  
+//
+// Paramters
+//    i2c_base:   a valid base address of an I2C peripheral
+//
+//    address:    16-bit address of the byte being read.  Only the lower
+//                12 bits is used by the EEPROM
+//
+//    data:       data read from the EEPROM is returned to a uint8_t pointer.
+//
+// Returns
+// I2C_OK if the byte was read from the EEPROM.
+//*****************************************************************************
+i2c_status_t eeprom_byte_read
+( 
+  uint32_t  i2c_base,
+  uint16_t  address,
+  uint8_t   *data
+);
+
+//*****************************************************************************
+// Writes a block of data out to the MCP24LC32AT EEPROM.  The block is split 
+// on 32-byte page boundaries and each piece is written using a single page
+// write, so a block that fits inside one page costs one write cycle.
+//
+// Paramters
+//    i2c_base:   a valid base address of an I2C peripheral
+//
+//    address:    16-bit address of the first byte being written.  Only the 
+//                lower 12 bits is used by the EEPROM
+//
+//    data:       Data written to the EEPROM.
+//
+//    num_bytes:  Number of bytes to write.
+//
+// Returns
+// I2C_OK if the block was written to the EEPROM.
+//*****************************************************************************
+i2c_status_t eeprom_write_block
+( 
+  uint32_t  i2c_base,
+  uint16_t  address,
+  uint8_t   *data,
+  uint16_t  num_bytes
+);
+
+//*****************************************************************************
+// Reads a block of data from the MCP24LC32AT EEPROM using sequential reads
+// of at most EEPROM_READ_CHUNK bytes.  Higher priority I2C bus clients can 
+// use the bus between chunks.
+//
+// Paramters
+//    i2c_base:   a valid base address of an I2C peripheral
+//
+//    address:    16-bit address of the first byte being read.  Only the 
+//                lower 12 bits is used by the EEPROM
+//
+//    data:       data read from the EEPROM is returned to a uint8_t array.
+//
+//    num_bytes:  Number of bytes to read.
+//
+// Returns
+// I2C_OK if the block was read from the EEPROM.
+//*****************************************************************************
+i2c_status_t eeprom_read_block
+( 
+  uint32_t  i2c_base,
+  uint16_t  address,
+  uint8_t   *data,
+  uint16_t  num_bytes
+);
+
+//*****************************************************************************
+// Checks once if the MCP24LC32AT is still busy with an internal write cycle.
+// Unlike the read and write functions this never waits for the write cycle 
+// to finish.
+//
+// Paramters
+//    i2c_base:   a valid base address of an I2C peripheral
+//
+// Returns
+// true if the EEPROM did not acknowledge its address.
+//*****************************************************************************
+bool eeprom_busy(uint32_t i2c_base);
+
+//*****************************************************************************
+// Initialize the EEPROM peripheral
+//*****************************************************************************
+bool eeprom_init(void);
+
+
+#endif
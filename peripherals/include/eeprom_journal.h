@@ -0,0 +1,88 @@
+#ifndef __EEPROM_JOURNAL_H__
+#define __EEPROM_JOURNAL_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "eeprom.h"
+
+//*****************************************************************************
+// A log structured record store kept in a region of the MCP24LC32AT.
+//
+// The region is divided into page sized slots.  Every update appends a new 
+// record to the next slot, wrapping around at the end of the region, so 
+// the writes are spread over all of the slots instead of wearing out one
+// address.  Each record holds a sequence number and a CRC.  At boot the 
+// slots are scanned once and the valid record with the highest sequence
+// number is the current one.  A record that was only partially written
+// when power was lost fails its CRC and the previous record is used.
+//
+// Slot layout
+//    byte 0        EEPROM_JOURNAL_MAGIC
+//    byte 1        record version, chosen by the owner of the journal
+//    bytes 2-5     sequence number, little endian
+//    bytes 6-      payload
+//    last 2 bytes  CRC-16/CCITT of everything before it
+//*****************************************************************************
+
+#define EEPROM_JOURNAL_MAGIC          0xA5
+#define EEPROM_JOURNAL_OVERHEAD       8
+#define EEPROM_JOURNAL_MAX_PAYLOAD    (EEPROM_PAGE_SIZE - EEPROM_JOURNAL_OVERHEAD)
+
+typedef struct {
+  uint32_t  i2c_base;
+  uint16_t  start_addr;     // first byte of the region, page aligned
+  uint16_t  num_slots;      // number of pages in the region
+  uint8_t   payload_size;   // bytes of payload in every record
+  uint32_t  sequence;       // sequence number of the newest record, 0 if none
+  uint16_t  next_slot;      // slot the next record is appended to
+} eeprom_journal_t;
+
+//*****************************************************************************
+// Configures a journal over a region of the EEPROM and scans the region for
+// the newest valid record.  The scan reads every slot once, so the time it
+// takes is fixed by num_slots.
+//
+// Paramters
+//    journal:      journal being initialized
+//    i2c_base:     a valid base address of an I2C peripheral
+//    start_addr:   first byte of the region.  Must be page aligned.
+//    num_slots:    number of pages in the region
+//    payload_size: size of the payload of each record.  At most
+//                  EEPROM_JOURNAL_MAX_PAYLOAD
+//    payload:      the payload of the newest record is copied here
+//    version:      the version of the newest record is copied here
+//
+// Returns
+// true if a valid record was found.  payload and version are not modified
+// if the region holds no valid record or the parameters are invalid.
+//*****************************************************************************
+bool eeprom_journal_init
+(
+  eeprom_journal_t  *journal,
+  uint32_t          i2c_base,
+  uint16_t          start_addr,
+  uint16_t          num_slots,
+  uint8_t           payload_size,
+  void              *payload,
+  uint8_t           *version
+);
+
+//*****************************************************************************
+// Appends a new record to the journal.  This is a single page write.
+//
+// Paramters
+//    journal:      an initialized journal
+//    version:      version stored with the record
+//    payload:      payload_size bytes of data to store
+//
+// Returns
+// I2C_OK if the record was written.
+//*****************************************************************************
+i2c_status_t eeprom_journal_append
+(
+  eeprom_journal_t  *journal,
+  uint8_t           version,
+  const void        *payload
+);
+
+#endif
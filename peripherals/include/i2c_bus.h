@@ -0,0 +1,101 @@
+#ifndef __I2C_BUS_H__
+#define __I2C_BUS_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "i2c.h"
+
+//*****************************************************************************
+// Arbitration of the shared I2C1 bus (PA6/PA7).  The FT6x06, the 24LC32 and
+// the MCP23017 all sit on it.
+//
+// Drivers hold the bus for one operation at a time with i2c_bus_acquire()
+// and i2c_bus_release().  Code running in the main loop cannot be
+// interrupted by itself, so the only contention comes from interrupt 
+// handlers.  Handlers must never wait for the bus.  They hand their work to
+// i2c_bus_post(), which runs it right away if the bus is free and otherwise
+// queues it until the bus is released.  Queued work runs highest priority 
+// first.  A handler that calls a driver function directly does not hang,
+// i2c_bus_acquire() refuses it the bus if the bus is held and the driver
+// returns I2C_BUS_BUSY.
+//
+// Long operations call i2c_bus_yield() at safe points (between EEPROM 
+// pages, between acknowledge polls) so queued higher priority work does not
+// wait for the whole operation.
+//*****************************************************************************
+
+#define I2C_BUS_BASE            I2C1_BASE
+
+// log2 buckets of the wait time histograms.  Bucket n counts waits of 
+// 2^(n-1) to 2^n - 1 core clock cycles, bucket 0 counts waits of 0 cycles
+// and the last bucket counts everything longer.
+#define I2C_BUS_HIST_BUCKETS    24
+
+// Clients of the bus, highest priority first
+typedef enum {
+  I2C_BUS_TOUCH   = 0,    // FT6x06 touch input
+  I2C_BUS_LED     = 1,    // MCP23017 LEDs and buttons
+  I2C_BUS_PERSIST = 2,    // 24LC32 EEPROM
+  I2C_BUS_NUM_CLIENTS
+} i2c_bus_client_t;
+
+typedef void (*i2c_bus_job_t)(void);
+
+typedef struct {
+  uint32_t acquisitions;        // times the client took the bus
+  uint32_t maxWaitCycles;       // longest wait in i2c_bus_acquire()
+  uint32_t refused;             // handler acquisitions that found the bus held
+  uint32_t waitHistogram[I2C_BUS_HIST_BUCKETS];
+  uint32_t jobs;                // posted jobs that ran
+  uint32_t deferred;            // posted jobs that had to be queued
+  uint32_t dropped;             // posted jobs replaced before they ran
+  uint32_t maxLatencyCycles;    // longest time from posting a job to running it
+  uint32_t latencyHistogram[I2C_BUS_HIST_BUCKETS];
+} i2c_bus_stats_t;
+
+//*****************************************************************************
+// Takes the bus if it is free.  Never waits, so it is safe to call from an 
+// interrupt handler.
+//
+// Returns true if the bus was taken.
+//*****************************************************************************
+bool i2c_bus_try_acquire(i2c_bus_client_t client);
+
+//*****************************************************************************
+// Takes the bus, waiting if it is held.  From an interrupt handler it 
+// cannot wait, the code holding the bus is what the handler interrupted, so
+// it gives up at once.
+//
+// Returns true if the bus was taken, always in the main loop.
+//*****************************************************************************
+bool i2c_bus_acquire(i2c_bus_client_t client);
+
+//*****************************************************************************
+// Gives up the bus and runs any queued jobs, highest priority first.
+//*****************************************************************************
+void i2c_bus_release(i2c_bus_client_t client);
+
+//*****************************************************************************
+// Lets queued jobs run in the middle of a long operation.  The bus is 
+// released, the queued jobs run and the bus is taken again.  Only call 
+// between complete I2C transactions.
+//*****************************************************************************
+void i2c_bus_yield(i2c_bus_client_t client);
+
+//*****************************************************************************
+// Runs a job on the bus from an interrupt handler.  If the bus is free the
+// job runs immediately, otherwise it is queued and runs when the bus is 
+// released.  Each client has one queue slot, posting again before the job
+// ran replaces it.  The job uses the normal driver functions, which take 
+// and release the bus themselves.
+//
+// Returns true if the job ran immediately.
+//*****************************************************************************
+bool i2c_bus_post(i2c_bus_client_t client, i2c_bus_job_t job);
+
+//*****************************************************************************
+// Returns the wait time and job latency statistics of a client.
+//*****************************************************************************
+void i2c_bus_get_stats(i2c_bus_client_t client, i2c_bus_stats_t *stats);
+
+#endif
@@ -0,0 +1,80 @@
+#ifndef __WIRELESS_LINK_H__
+#define __WIRELESS_LINK_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+//*****************************************************************************
+// Packet link between two boards.  On the board it is the nRF24L01+ driver
+// in wireless.c, on a PC tools/wireless_host.c provides the same
+// functions over UDP so two simulated boards can talk.
+//
+// Packets are queued, so none of these functions wait for the radio.  The
+// radio acknowledges every packet and retransmits it until it is
+// acknowledged or WIRELESS_RETRANSMITS retries have failed, then it is
+// counted as lost.
+//*****************************************************************************
+
+#define WIRELESS_MAX_PAYLOAD      32
+
+// Packets held in each direction, must be a power of two
+#define WIRELESS_QUEUE_LEN        8
+
+#define WIRELESS_RETRANSMITS      10
+
+typedef struct {
+  uint8_t length;
+  uint8_t data[WIRELESS_MAX_PAYLOAD];
+} wireless_packet_t;
+
+typedef struct {
+  uint32_t sent;            // packets handed to the radio
+  uint32_t acked;           // packets the other board acknowledged
+  uint32_t lost;            // packets given up on after every retransmit
+  uint32_t retransmits;     // retries over all sent packets
+  uint32_t received;        // packets received
+  uint32_t txQueueFull;     // sends refused because the queue was full
+  uint32_t rxQueueFull;     // received packets dropped, queue full
+  uint32_t rttLastUs;       // send to acknowledge of the last packet
+  uint32_t rttMinUs;
+  uint32_t rttMaxUs;
+  uint32_t rttTotalUs;      // divide by acked for the average
+} wireless_stats_t;
+
+//*****************************************************************************
+// Sets up the link between the local board, my_id, and the remote one,
+// dest_id.  Both ids are 5 bytes.  Returns false if the radio does not
+// respond.
+//*****************************************************************************
+bool wireless_link_init(const uint8_t *my_id, const uint8_t *dest_id);
+
+//*****************************************************************************
+// Ends the link, anything still queued is dropped.  On the board the radio
+// is powered down and the SSI and interrupt pin it shares with the 
+// accelerometer are left for accel_resume().
+//*****************************************************************************
+void wireless_link_release(void);
+
+//*****************************************************************************
+// Queues a packet of 1 to WIRELESS_MAX_PAYLOAD bytes.  Returns false if the
+// queue is full or the length is invalid.
+//*****************************************************************************
+bool wireless_link_send(const uint8_t *data, uint8_t length);
+
+//*****************************************************************************
+// Takes the oldest received packet.  data must hold WIRELESS_MAX_PAYLOAD
+// bytes.  Returns false if nothing has been received.
+//*****************************************************************************
+bool wireless_link_receive(uint8_t *data, uint8_t *length);
+
+//*****************************************************************************
+// Returns true while packets are queued or being sent.
+//*****************************************************************************
+bool wireless_link_busy(void);
+
+//*****************************************************************************
+// Returns the link statistics.
+//*****************************************************************************
+void wireless_link_get_stats(wireless_stats_t *stats);
+
+#endif
@@ -0,0 +1,57 @@
+#ifndef __WS2812B_DMA_H__
+#define __WS2812B_DMA_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "TM4C123GH6PM.h"
+
+#include "gpio_port.h"
+#include "udma.h"
+#include "ws2812b.h"
+#include "ws2812b_encode.h"
+
+//*****************************************************************************
+// WS2812B strip driven without the CPU.  ws2812b_dma_show() encodes the
+// colors into a timing buffer, then WTIMER5B generates one PWM period per
+// bit on PD7 (WT5CCP1) while the uDMA copies the next match value from the
+// buffer into the timer on every rising edge.  Interrupts stay enabled the
+// whole time, the only interrupt is the uDMA completion at the end.
+//
+// WS2812B_write() in ws2812b.s does the same with interrupts disabled for
+// the whole strip.
+//*****************************************************************************
+
+#define WS2812B_DMA_PIN           PD7
+#define WS2812B_DMA_PCTL_M        GPIO_PCTL_PD7_M
+#define WS2812B_DMA_PCTL          GPIO_PCTL_PD7_WT5CCP1
+
+// WTIMER5B request, uDMA channel assignments table of the data sheet
+#define WS2812B_DMA_CHANNEL       29
+#define WS2812B_DMA_ENCODING      3
+
+#define WS2812B_DMA_IRQ_PRIORITY  3
+
+// LEDs on the board
+#define WS2812B_DMA_MAX_LEDS      8
+
+//*****************************************************************************
+// Configures PD7, WTIMER5B and its uDMA channel.  The line is left low.
+//*****************************************************************************
+bool ws2812b_dma_init(void);
+
+//*****************************************************************************
+// Starts sending colors to the strip and returns without waiting.  leds can
+// be changed as soon as this returns, it has already been encoded.
+//
+// Returns
+//    false if the previous colors are still being sent or latched, or
+//    num_leds is 0 or more than WS2812B_DMA_MAX_LEDS
+//*****************************************************************************
+bool ws2812b_dma_show(const WS2812B_t *leds, uint8_t num_leds);
+
+//*****************************************************************************
+// Returns true until the last colors have been sent and latched
+//*****************************************************************************
+bool ws2812b_dma_busy(void);
+
+#endif
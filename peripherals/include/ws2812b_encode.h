@@ -0,0 +1,53 @@
+#ifndef __WS2812B_ENCODE_H__
+#define __WS2812B_ENCODE_H__
+
+#include <stdint.h>
+
+//*****************************************************************************
+// Timing buffer for the WS2812B driver in ws2812b_dma.c.  Every bit sent to
+// the strip is one period of a PWM output and one word of the buffer, the
+// value the timer match register holds for that period.  The timer counts
+// down from WS2812B_PERIOD_CYCLES - 1, the output goes high when it reloads
+// and low when it reaches the match value.
+//
+// Nothing here touches hardware, the same file builds on the PC for
+// tools/ws2812b_timing.c.
+//*****************************************************************************
+
+// System clock cycles, 50MHz
+#define WS2812B_PERIOD_CYCLES     62      // 1.24us per bit
+#define WS2812B_T0H_CYCLES        20      // 0.40us high for a 0
+#define WS2812B_T1H_CYCLES        40      // 0.80us high for a 1
+
+// Match value that keeps the output high for high cycles of a period
+#define WS2812B_MATCH(high)       (WS2812B_PERIOD_CYCLES - 1 - (high))
+
+#define WS2812B_MATCH_0           WS2812B_MATCH(WS2812B_T0H_CYCLES)
+#define WS2812B_MATCH_1           WS2812B_MATCH(WS2812B_T1H_CYCLES)
+
+// Match equal to the reload value, the output stays low
+#define WS2812B_MATCH_LOW         WS2812B_MATCH(0)
+
+// The line must stay low this long before the LEDs latch the new colors.
+// Older parts need 50us, newer ones 280us.
+#define WS2812B_LATCH_US          300
+
+// Words of timing buffer for a strip, 24 bits per LED and one low period
+// at the end
+#define WS2812B_ENCODED_LEN(leds) ((leds) * 24 + 1)
+
+//*****************************************************************************
+// Encodes the colors of a strip into a timing buffer.
+//
+// Paramters
+//    grb:        green, red and blue byte of each LED, in strip order.  An
+//                array of WS2812B_t can be passed as is.
+//    num_leds:   number of LEDs
+//    timing:     WS2812B_ENCODED_LEN(num_leds) words
+//
+// Returns
+//    the number of words written
+//*****************************************************************************
+uint16_t ws2812b_encode(const uint8_t *grb, uint16_t num_leds, uint32_t *timing);
+
+#endif
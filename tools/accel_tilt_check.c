@@ -0,0 +1,216 @@
+//*****************************************************************************
+// Checks peripherals/c/accel_tilt.c on the PC by replaying made up IMU
+// streams through accel_tilt_sample() at the 208 Hz FIFO rate.  Samples
+// are scaled like the LSM6DS3H set up by accel_initialize(), 2 g and 
+// 125 dps full scale.  The checks:
+//
+//    - a still board at a fixed tilt settles on that tilt
+//    - the gyro zero-rate offset measured after init is removed
+//    - a steady rotation is followed with little lag
+//    - heavy vibration on the accelerometer barely moves the angle
+//    - a run of bad gyro samples saturates instead of wrapping
+//    - accel_tilt_update() filters everything in the FIFO ring
+//
+// Build: cc -O2 -Ihost -I../peripherals/include -o accel_tilt_check
+//          accel_tilt_check.c ../peripherals/c/accel_tilt.c -lm
+//*****************************************************************************
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "accel_tilt.h"
+#include "check.h"
+
+#define RATE_HZ       208
+#define G_LSB         16393.0       // 1 g at 0.061 mg/LSB
+#define DPS_LSB       (1000.0 / 4.375)
+#define PI            3.14159265358979
+
+static uint32_t fakeCycles;
+
+void cycle_counter_init(void)
+{
+}
+
+uint32_t cycle_counter_read(void)
+{
+  return fakeCycles += 100;
+}
+
+// FIFO ring for accel_tilt_update(), filled by the checks
+static accel_sample_t ring[64];
+static uint16_t ringCount;
+static uint16_t ringTail;
+
+uint16_t accel_fifo_get(accel_sample_t *samples, uint16_t max)
+{
+  uint16_t count = 0;
+
+  while (count < max && ringTail < ringCount)
+    samples[count++] = ring[ringTail++];
+  return count;
+}
+
+// Sample of a board tilted deg about +Y, turning at dps, with a gyro 
+// offset of bias LSB and up to noise g of vibration on each accelerometer
+// axis
+static double shake(double noise)
+{
+  return noise * ((rand() % 2001) - 1000) / 1000.0;
+}
+
+static accel_sample_t make_sample(double deg, double dps, int bias, double noise)
+{
+  accel_sample_t sample;
+  double theta = deg * PI / 180.0;
+
+  sample.accel.x = (int16_t)lround(-G_LSB * (sin(theta) + shake(noise)));
+  sample.accel.y = 0;
+  sample.accel.z = (int16_t)lround(G_LSB * (cos(theta) + shake(noise)));
+  sample.gyro.x = 0;
+  sample.gyro.y = (int16_t)lround(dps * DPS_LSB) + bias;
+  sample.gyro.z = 0;
+  return sample;
+}
+
+static double degrees(int16_t angle)
+{
+  return angle * 180.0 / 32768.0;
+}
+
+// Holds the board at deg for seconds
+static void hold(double deg, int bias, double noise, double seconds)
+{
+  accel_sample_t sample;
+  int i;
+
+  for (i = 0; i < seconds * RATE_HZ; i++) {
+    sample = make_sample(deg, 0, bias, noise);
+    accel_tilt_sample(&sample);
+  }
+}
+
+static void check_still(void)
+{
+  static const double tilts[] = { 0, 10, -10, 30, -45, 60, -80 };
+  uint32_t i;
+
+  for (i = 0; i < sizeof(tilts) / sizeof(tilts[0]); i++) {
+    accel_tilt_init();
+    hold(tilts[i], 0, 0, 2);
+    CHECK(fabs(degrees(accel_tilt_angle()) - tilts[i]) < 0.5);
+  }
+}
+
+// A gyro offset of 5 dps would drift 50 degrees in 10 seconds
+static void check_bias(void)
+{
+  int bias = (int)(5 * DPS_LSB);
+
+  accel_tilt_init();
+  hold(0, bias, 0, 10);
+  CHECK(fabs(degrees(accel_tilt_angle())) < 0.5);
+}
+
+// 0 to 40 degrees at 40 dps, the gyro carries the angle between corrections
+static void check_rotation(void)
+{
+  accel_sample_t sample;
+  double worst = 0;
+  double deg;
+  int i;
+
+  accel_tilt_init();
+  hold(0, 100, 0, 1);
+  for (i = 1; i <= RATE_HZ; i++) {
+    deg = 40.0 * i / RATE_HZ;
+    sample = make_sample(deg, 40, 100, 0);
+    accel_tilt_sample(&sample);
+    if (fabs(degrees(accel_tilt_angle()) - deg) > worst)
+      worst = fabs(degrees(accel_tilt_angle()) - deg);
+  }
+  CHECK(worst < 1.5);
+  hold(40, 100, 0, 1);
+  CHECK(fabs(degrees(accel_tilt_angle()) - 40) < 0.5);
+}
+
+// +/-0.3 g of shaking swings the accelerometer angle by more than 20
+// degrees from one sample to the next, the filtered angle stays within 3
+static void check_vibration(void)
+{
+  accel_sample_t sample;
+  double worst = 0;
+  double raw = 0;
+  double deg;
+  int i;
+
+  srand(353);
+  accel_tilt_init();
+  hold(20, 0, 0, 1);
+  for (i = 0; i < 5 * RATE_HZ; i++) {
+    sample = make_sample(20, 0, 0, 0.3);
+    accel_tilt_sample(&sample);
+    deg = atan2(-sample.accel.x, sample.accel.z) * 180.0 / PI;
+    if (fabs(deg - 20) > raw)
+      raw = fabs(deg - 20);
+    if (fabs(degrees(accel_tilt_angle()) - 20) > worst)
+      worst = fabs(degrees(accel_tilt_angle()) - 20);
+  }
+  CHECK(raw > 20);
+  CHECK(worst < 3);
+}
+
+// A stuck gyro at full scale must not wrap the angle to the other side
+static void check_saturation(void)
+{
+  accel_sample_t sample;
+  int16_t angle;
+  int wrapped = 0;
+  int i;
+
+  accel_tilt_init();
+  hold(0, 0, 0, 1);
+  for (i = 0; i < 20 * RATE_HZ; i++) {
+    sample = make_sample(0, 0, 0, 0);
+    sample.gyro.y = INT16_MAX;
+    accel_tilt_sample(&sample);
+    angle = accel_tilt_angle();
+    if (angle < 0)
+      wrapped++;
+  }
+  CHECK(wrapped == 0);
+
+  // and it comes back once the gyro does
+  hold(0, 0, 0, 10);
+  CHECK(fabs(degrees(accel_tilt_angle())) < 1);
+}
+
+static void check_update(void)
+{
+  accel_tilt_stats_t before;
+  accel_tilt_stats_t after;
+  int i;
+
+  accel_tilt_init();
+  for (i = 0; i < 64; i++)
+    ring[i] = make_sample(15, 0, 0, 0);
+  ringCount = 64;
+  ringTail = 0;
+  accel_tilt_get_stats(&before);
+  accel_tilt_update();
+  accel_tilt_get_stats(&after);
+  CHECK(ringTail == 64);
+  CHECK(after.samples - before.samples == 64);
+  CHECK(after.lastCycles > 0 && after.maxCycles >= after.lastCycles);
+}
+
+int main(void)
+{
+  check_still();
+  check_bias();
+  check_rotation();
+  check_vibration();
+  check_saturation();
+  check_update();
+
+  return check_done();
+}
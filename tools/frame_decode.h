@@ -0,0 +1,148 @@
+//*****************************************************************************
+// Frame reader shared by the host tools.  The target sends every frame as
+// payload + CRC-16/CCITT (low byte first), COBS encoded and ended with a
+// zero byte, see Project/telemetry.h.  The first payload byte is the record
+// type.
+//*****************************************************************************
+#ifndef __FRAME_DECODE_H__
+#define __FRAME_DECODE_H__
+
+#include <stdint.h>
+#include <stdio.h>
+#include <termios.h>
+#include <unistd.h>
+
+// Must match TELEMETRY_RECORD_ and TELEMETRY_MAX_PAYLOAD
+#define FRAME_RECORD_TICK     0x01
+#define FRAME_RECORD_LOG      0x02
+#define FRAME_MAX_PAYLOAD     250
+#define FRAME_MAX_ENCODED     (FRAME_MAX_PAYLOAD + 3)
+
+typedef struct {
+  uint8_t encoded[FRAME_MAX_ENCODED];
+  int encodedLen;
+  int overflow;
+  unsigned long good;
+  unsigned long bad;
+} frame_reader_t;
+
+// Same CRC-16/CCITT as drivers/c/crc.c: polynomial 0x1021, start 0xFFFF
+static uint16_t frame_crc16(const uint8_t *data, int num_bytes)
+{
+  uint16_t crc = 0xFFFF;
+  int bit;
+
+  while ( num_bytes-- > 0 )
+  {
+    crc ^= (uint16_t)(*data++) << 8;
+    for ( bit = 0; bit < 8; bit++ )
+    {
+      crc = (crc & 0x8000) ? (uint16_t)((crc << 1) ^ 0x1021) : (uint16_t)(crc << 1);
+    }
+  }
+  return crc;
+}
+
+// Decodes one COBS frame without its delimiter.  Returns the decoded
+// length, or -1 if the frame is malformed or does not fit.
+static int frame_cobs_decode(const uint8_t *in, int length, uint8_t *out, int max)
+{
+  int i = 0;
+  int n = 0;
+
+  while ( i < length )
+  {
+    int code = in[i++];
+    int k;
+
+    if ( code == 0 || i + code - 1 > length )
+    {
+      return -1;
+    }
+    for ( k = 1; k < code; k++ )
+    {
+      if ( n >= max )
+      {
+        return -1;
+      }
+      out[n++] = in[i++];
+    }
+    if ( code != 0xFF && i < length )
+    {
+      if ( n >= max )
+      {
+        return -1;
+      }
+      out[n++] = 0;
+    }
+  }
+  return n;
+}
+
+static uint16_t frame_u16(const uint8_t *p)
+{
+  return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+static uint32_t frame_u32(const uint8_t *p)
+{
+  return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+// Feeds one byte of the stream.  Returns the payload length, CRC removed,
+// when byte completes a valid frame and 0 otherwise.
+static int frame_feed(frame_reader_t *reader, uint8_t byte, uint8_t payload[FRAME_MAX_PAYLOAD + 2])
+{
+  int length;
+
+  if ( byte != 0 )
+  {
+    if ( reader->encodedLen < FRAME_MAX_ENCODED )
+    {
+      reader->encoded[reader->encodedLen++] = byte;
+    }
+    else
+    {
+      reader->overflow = 1;
+    }
+    return 0;
+  }
+
+  // an empty frame is only the start marker
+  if ( reader->encodedLen == 0 && !reader->overflow )
+  {
+    return 0;
+  }
+  length = reader->overflow ? -1 :
+           frame_cobs_decode(reader->encoded, reader->encodedLen, payload, FRAME_MAX_PAYLOAD + 2);
+  reader->encodedLen = 0;
+  reader->overflow = 0;
+
+  if ( length < 3 || frame_crc16(payload, length - 2) != frame_u16(&payload[length - 2]) )
+  {
+    reader->bad++;
+    return 0;
+  }
+  reader->good++;
+  return length - 2;
+}
+
+// Puts a serial device in raw 115200 8N1, anything else is left alone
+static void frame_configure_tty(int fd)
+{
+  struct termios tio;
+
+  if ( !isatty(fd) || tcgetattr(fd, &tio) != 0 )
+  {
+    return;
+  }
+  cfmakeraw(&tio);
+  cfsetispeed(&tio, B115200);
+  cfsetospeed(&tio, B115200);
+  tio.c_cflag |= CLOCAL | CREAD;
+  tio.c_cc[VMIN] = 1;
+  tio.c_cc[VTIME] = 0;
+  tcsetattr(fd, TCSANOW, &tio);
+}
+
+#endif
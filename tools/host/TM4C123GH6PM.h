@@ -0,0 +1,35 @@
+#ifndef __TM4C123GH6PM_H__
+#define __TM4C123GH6PM_H__
+
+//*****************************************************************************
+// Stand-in for the device header when code that only needs the CMSIS 
+// intrinsics is built on the PC.  No registers are defined, so anything
+// that touches the hardware fails to compile.
+//*****************************************************************************
+#include <stdint.h>
+
+#define __INLINE              inline
+
+// Saturating signed add
+static inline int32_t __QADD(int32_t a, int32_t b)
+{
+  int64_t sum = (int64_t)a + b;
+
+  if (sum > INT32_MAX)
+    return INT32_MAX;
+  if (sum < INT32_MIN)
+    return INT32_MIN;
+  return (int32_t)sum;
+}
+
+// Saturate to a signed bits wide value
+#define __SSAT(value, bits) \
+  ((value) > (1 << ((bits) - 1)) - 1 ? (1 << ((bits) - 1)) - 1 : \
+   (value) < -(1 << ((bits) - 1)) ? -(1 << ((bits) - 1)) : (value))
+
+#define __CLZ(value)          __builtin_clz(value)
+
+// Full barrier, the PC's stand-in for the Cortex-M data memory barrier
+#define __DMB()               __atomic_thread_fence(__ATOMIC_SEQ_CST)
+
+#endif
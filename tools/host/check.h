@@ -0,0 +1,24 @@
+#ifndef __CHECK_H__
+#define __CHECK_H__
+
+//*****************************************************************************
+// Failure reporting for the check programs under tools/.  CHECK() prints
+// the file, line and condition of a check that fails and counts it.
+// check_done() prints the count and gives the exit status of main(), 1 if
+// any check failed.  Each check program is a single file that includes
+// this once.
+//*****************************************************************************
+#include <stdio.h>
+
+static int failures;
+
+#define CHECK(cond) \
+  do { if (!(cond)) { printf("%s:%d: %s\n", __FILE__, __LINE__, #cond); failures++; } } while (0)
+
+static inline int check_done(void)
+{
+  printf("%d failed\n", failures);
+  return failures != 0;
+}
+
+#endif
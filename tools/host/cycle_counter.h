@@ -0,0 +1,13 @@
+#ifndef __CYCLE_COUNTER_H__
+#define __CYCLE_COUNTER_H__
+
+//*****************************************************************************
+// Stand-in for drivers/include/cycle_counter.h on the PC.  The check 
+// program provides both functions.
+//*****************************************************************************
+#include <stdint.h>
+
+void cycle_counter_init(void);
+uint32_t cycle_counter_read(void);
+
+#endif
@@ -0,0 +1,52 @@
+#ifndef __EEPROM_H__
+#define __EEPROM_H__
+
+//*****************************************************************************
+// Stand-in for peripherals/include/eeprom.h when Project files that keep
+// data in the EEPROM are built on the PC.  The check program defines the
+// block functions and eeprom_busy() over a RAM image of the MCP24LC32AT.  Put this
+// directory first on the include path.
+//*****************************************************************************
+#include <stdint.h>
+#include <stdbool.h>
+
+// Keil's packed qualifier.  GCC lays the structs out with padding, which
+// only moves where the PC image keeps them.
+#define __packed
+
+typedef enum {
+  I2C_OK,
+  I2C_NULL_PTR,
+  I2C_BUS_ERROR,
+  I2C_ARBLST,
+  I2C_ACK_RXED,
+  I2C_NO_ACK,
+  I2C_INVALID_BASE,
+  I2C_INVALID_PARAM,
+  I2C_BUS_BUSY
+} i2c_status_t;
+
+#define EEPROM_SIZE_BYTES        4096
+#define EEPROM_PAGE_SIZE         32
+#define EEPROM_I2C_BASE          0x40021000
+
+i2c_status_t eeprom_write_block
+(
+  uint32_t  i2c_base,
+  uint16_t  address,
+  uint8_t   *data,
+  uint16_t  num_bytes
+);
+
+i2c_status_t eeprom_read_block
+(
+  uint32_t  i2c_base,
+  uint16_t  address,
+  uint8_t   *data,
+  uint16_t  num_bytes
+);
+
+// true while the part is in a write cycle
+bool eeprom_busy(uint32_t i2c_base);
+
+#endif
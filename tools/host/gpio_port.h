@@ -0,0 +1,11 @@
+#ifndef __GPIO_PORT_F_H__
+#define __GPIO_PORT_F_H__
+
+//*****************************************************************************
+// Stand-in for drivers/include/gpio_port.h on the PC.  Headers that pull
+// it in for their pin names build, nothing can be configured.
+//*****************************************************************************
+#include <stdint.h>
+#include <stdbool.h>
+
+#endif
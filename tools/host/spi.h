@@ -0,0 +1,17 @@
+#ifndef __ECE453_SPI_H__
+#define __ECE453_SPI_H__
+
+//*****************************************************************************
+// Stand-in for drivers/include/spi.h on the PC.  Headers that pull it in
+// for their SPI settings build, nothing can be transferred.
+//*****************************************************************************
+#include <stdint.h>
+#include <stdbool.h>
+
+typedef struct {
+  uint32_t bytes;
+  uint32_t polledCycles;
+  uint32_t dmaCycles;
+} spi_benchmark_t;
+
+#endif
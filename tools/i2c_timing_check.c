@@ -0,0 +1,120 @@
+//*****************************************************************************
+// Checks drivers/c/i2c_timing.c on the PC.  The TPR table is worked out by
+// hand from the MTPR formula at the system clocks the board can run at,
+// then every rate from 1KHz up to high-speed mode is checked to give the
+// fastest SCL at or below the request.
+//
+// Build: cc -O2 -Ihost -I../drivers/include -o i2c_timing_check
+//          i2c_timing_check.c ../drivers/c/i2c_timing.c
+//*****************************************************************************
+#include <stdio.h>
+#include "i2c_timing.h"
+#include "check.h"
+
+typedef struct {
+  uint32_t sys_clk;
+  uint32_t request;
+  uint8_t tpr;
+  bool high_speed;
+  uint32_t scl_hz;
+} timing_row_t;
+
+static const timing_row_t table[] = {
+  { 16000000, I2C_SCL_STANDARD,    7,  false, 100000 },
+  { 16000000, I2C_SCL_FAST,        1,  false, 400000 },
+  { 16000000, I2C_SCL_FAST_PLUS,   0,  false, 800000 },
+  { 16000000, I2C_SCL_HIGH_SPEED,  0,  true,  2666666 },
+  { 50000000, I2C_SCL_STANDARD,    24, false, 100000 },
+  { 50000000, I2C_SCL_FAST,        6,  false, 357142 },
+  { 50000000, I2C_SCL_FAST_PLUS,   2,  false, 833333 },
+  { 50000000, 1700000,             4,  true,  1666666 },
+  { 50000000, I2C_SCL_HIGH_SPEED,  2,  true,  2777777 },
+  { 80000000, I2C_SCL_STANDARD,    39, false, 100000 },
+  { 80000000, I2C_SCL_FAST,        9,  false, 400000 },
+  { 80000000, I2C_SCL_FAST_PLUS,   3,  false, 1000000 },
+  { 80000000, I2C_SCL_HIGH_SPEED,  4,  true,  2666666 },
+};
+
+static void check_table(void)
+{
+  i2c_timing_t timing;
+  uint32_t i;
+
+  for (i = 0; i < sizeof(table) / sizeof(table[0]); i++) {
+    CHECK(i2cCalcTiming(table[i].sys_clk, table[i].request, &timing));
+    if (timing.tpr != table[i].tpr || timing.high_speed != table[i].high_speed ||
+        timing.scl_hz != table[i].scl_hz)
+      printf("%u Hz at %u: tpr %u hs %d scl %u\n", table[i].request, table[i].sys_clk,
+             timing.tpr, timing.high_speed, timing.scl_hz);
+    CHECK(timing.tpr == table[i].tpr);
+    CHECK(timing.high_speed == table[i].high_speed);
+    CHECK(timing.scl_hz == table[i].scl_hz);
+  }
+}
+
+// SCL for a TPR value, as the peripheral produces it
+static uint32_t scl_of(uint32_t sys_clk, uint32_t tpr, bool high_speed)
+{
+  return sys_clk / (2 * (high_speed ? 3 : 10) * (tpr + 1));
+}
+
+// Never above the request, and one less TPR would be
+static void check_sweep(uint32_t sys_clk)
+{
+  i2c_timing_t timing;
+  uint32_t request;
+  uint32_t exact;
+
+  for (request = 1000; request <= I2C_SCL_HIGH_SPEED; request += 1000) {
+    if (!i2cCalcTiming(sys_clk, request, &timing)) {
+      // only too slow for the 7 bit TPR field
+      CHECK(scl_of(sys_clk, I2C_TPR_MAX, false) > request);
+      continue;
+    }
+    CHECK(timing.tpr <= I2C_TPR_MAX);
+    CHECK(timing.high_speed == (request > I2C_SCL_FAST_PLUS));
+    CHECK(timing.scl_hz == scl_of(sys_clk, timing.tpr, timing.high_speed));
+    CHECK(timing.scl_hz <= request);
+    // exact rate of one less TPR, before the division rounds down
+    exact = (timing.tpr == 0) ? 0 : scl_of(sys_clk, timing.tpr - 1, timing.high_speed);
+    CHECK(timing.tpr == 0 || exact >= request);
+  }
+}
+
+static void check_invalid(void)
+{
+  i2c_timing_t timing;
+
+  CHECK(!i2cCalcTiming(50000000, 0, &timing));
+  CHECK(!i2cCalcTiming(50000000, I2C_SCL_HIGH_SPEED + 1, &timing));
+  CHECK(!i2cCalcTiming(80000000, 1000, &timing));
+  CHECK(!i2cCalcTiming(50000000, I2C_SCL_FAST, NULL));
+}
+
+// The rate a bus is run at
+static void check_bus_rate(void)
+{
+  // no devices, no request
+  CHECK(i2cBusRate(0, 0) == I2C_SCL_STANDARD);
+  // the slowest device, not 100KHz, when nothing is asked for
+  CHECK(i2cBusRate(0, I2C_SCL_FAST) == I2C_SCL_FAST);
+  // I2C1 with only the 1.7MHz MCP23017 stays out of high-speed mode
+  CHECK(i2cBusRate(0, 1700000) == I2C_SCL_FAST_PLUS);
+  // a request is capped at the slowest device but may ask for high speed
+  CHECK(i2cBusRate(I2C_SCL_FAST_PLUS, I2C_SCL_FAST) == I2C_SCL_FAST);
+  CHECK(i2cBusRate(I2C_SCL_STANDARD, I2C_SCL_FAST) == I2C_SCL_STANDARD);
+  CHECK(i2cBusRate(1700000, 1700000) == 1700000);
+  CHECK(i2cBusRate(I2C_SCL_HIGH_SPEED, 0) == I2C_SCL_HIGH_SPEED);
+}
+
+int main(void)
+{
+  check_table();
+  check_sweep(16000000);
+  check_sweep(50000000);
+  check_sweep(80000000);
+  check_invalid();
+  check_bus_rate();
+
+  return check_done();
+}
@@ -0,0 +1,115 @@
+//*****************************************************************************
+// Cost of one frame of Project/led_effects.c.
+//
+// Composes frames 20ms apart with no layer showing, each layer on its own,
+// and all four together, the most a frame can cost.  Prints the average
+// and 99.9th percentile time per frame, in TSC cycles on x86 and
+// nanoseconds elsewhere.  The maximum on a PC only shows when the process
+// was preempted.  The firmware logs
+// the same figure in cycles of the board at the end of every match.
+//
+//    ./led_effects_bench [frames]
+//
+// Build: cc -O2 -Wall -Wextra -I../Project -o led_effects_bench led_effects_bench.c
+//          ../Project/led_effects.c
+//*****************************************************************************
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "led_effects.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define BENCH_UNITS   "cycles"
+static uint64_t bench_now(void)
+{
+  return __rdtsc();
+}
+#else
+#define BENCH_UNITS   "ns"
+static uint64_t bench_now(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000u + ts.tv_nsec;
+}
+#endif
+
+#define LAYER_METER   (1 << 0)
+#define LAYER_STROBE  (1 << 1)
+#define LAYER_FLASH   (1 << 2)
+#define LAYER_WIN     (1 << 3)
+
+#define BENCH_MAX_FRAMES  1000000
+
+static const char *layerNames[] = { "meter", "strobe", "flash", "win" };
+
+static uint64_t times[BENCH_MAX_FRAMES];
+
+static int compare_times(const void *a, const void *b)
+{
+  uint64_t x = *(const uint64_t *)a;
+  uint64_t y = *(const uint64_t *)b;
+
+  return x < y ? -1 : x > y;
+}
+
+// Keeps the chosen layers showing for every frame
+static void bench_layers(uint8_t layers, uint32_t frames)
+{
+  uint8_t grb[LED_EFFECTS_BYTES];
+  char name[32];
+  uint64_t start, total = 0;
+  uint32_t now = 0, i, checksum = 0;
+  uint8_t b;
+
+  led_effects_init(255);
+  if (layers & LAYER_STROBE)
+    led_effects_strobe(LED_EFFECTS_FRAME_MS, now);
+  if (layers & LAYER_WIN)
+    led_effects_win(0, now);
+
+  for (i = 0; i < frames; i++, now += LED_EFFECTS_FRAME_MS) {
+    if (layers & LAYER_METER)
+      led_effects_rally(LED_EFFECTS_RALLY_FULL / 2 + i % LED_EFFECTS_RALLY_FULL);
+    if (layers & LAYER_FLASH)
+      led_effects_point(i & 1, now);
+
+    start = bench_now();
+    led_effects_compose(now, grb);
+    times[i] = bench_now() - start;
+    total += times[i];
+    for (b = 0; b < LED_EFFECTS_BYTES; b++)
+      checksum += grb[b];
+  }
+
+  qsort(times, frames, sizeof(times[0]), compare_times);
+  name[0] = '\0';
+  for (b = 0; b < 4; b++) {
+    if (layers & (1 << b)) {
+      strcat(name, " ");
+      strcat(name, layerNames[b]);
+    }
+  }
+  printf("  %-26s %5.0f avg %5llu 99.9%% %s  (checksum %u)\n", layers ? name + 1 : "none",
+         (double)total / frames, (unsigned long long)times[frames - 1 - frames / 1000],
+         BENCH_UNITS, checksum);
+}
+
+int main(int argc, char **argv)
+{
+  uint32_t frames = argc > 1 ? strtoul(argv[1], NULL, 0) : 100000;
+  uint8_t layer;
+
+  if (frames == 0 || frames > BENCH_MAX_FRAMES)
+    frames = BENCH_MAX_FRAMES;
+
+  printf("%u frames, %u LEDs\n", frames, LED_EFFECTS_LEDS);
+  bench_layers(0, frames);
+  for (layer = 0; layer < 4; layer++)
+    bench_layers(1 << layer, frames);
+  bench_layers(LAYER_METER | LAYER_STROBE | LAYER_FLASH | LAYER_WIN, frames);
+  return 0;
+}
@@ -0,0 +1,181 @@
+//*****************************************************************************
+// Host side decoder for the tokenized log records sent by
+// Project/debug_log.c.
+//
+// Reads the serial stream from a device (set to 115200 8N1 raw) or from a
+// capture file, or stdin with "-", and prints one line per record with the
+// cycle counter when it was logged and the text rebuilt from the formats in
+// Project/log_messages.h.  Telemetry frames in the same stream are skipped.
+//
+// Rebuild this whenever log_messages.h changes.
+//
+// Build: cc -O2 -o log_decode log_decode.c
+//*****************************************************************************
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include "frame_decode.h"
+#include "../Project/log_messages.h"
+
+// Must match debug_log.h
+#define LOG_HEADER_BYTES  8
+#define LOG_ARGS_SHIFT    16
+
+typedef struct {
+  const char *name;
+  const char *format;
+} log_message_t;
+
+static const log_message_t messages[] = {
+#define LOG_MESSAGE_TEXT(id, format)  { #id, format },
+  LOG_MESSAGES(LOG_MESSAGE_TEXT)
+#undef LOG_MESSAGE_TEXT
+};
+
+#define NUM_MESSAGES      (int)(sizeof(messages) / sizeof(messages[0]))
+
+// Prints format with the argument words, one conversion per word
+static void print_message(const char *format, const uint8_t *args, int num_args)
+{
+  char spec[16];
+  int used = 0;
+
+  while ( *format )
+  {
+    const char *start = format;
+    int length;
+
+    if ( *format != '%' )
+    {
+      putchar(*format++);
+      continue;
+    }
+    format++;
+    if ( *format == '%' )
+    {
+      putchar('%');
+      format++;
+      continue;
+    }
+
+    // flags and width, then the conversion
+    while ( *format && strchr("-+ #0123456789", *format) )
+    {
+      format++;
+    }
+    if ( *format == '\0' )
+    {
+      break;
+    }
+    length = (int)(format - start) + 1;
+    format++;
+    if ( length >= (int)sizeof(spec) || used >= num_args )
+    {
+      printf("<?>");
+      continue;
+    }
+    memcpy(spec, start, length);
+    spec[length] = '\0';
+
+    switch ( spec[length - 1] )
+    {
+      case 'd':
+      case 'i':
+      case 'c':
+        printf(spec, (int32_t)frame_u32(&args[4 * used]));
+        break;
+      case 'u':
+      case 'x':
+      case 'X':
+        printf(spec, frame_u32(&args[4 * used]));
+        break;
+      default:
+        printf("<?>");
+        break;
+    }
+    used++;
+  }
+}
+
+// Prints every record in a log frame, returns false if the frame is cut short
+static int print_records(const uint8_t *payload, int length)
+{
+  int offset = 1;
+
+  while ( offset + LOG_HEADER_BYTES <= length )
+  {
+    uint32_t header = frame_u32(&payload[offset]);
+    uint32_t cycles = frame_u32(&payload[offset + 4]);
+    int id = header & 0xFFFF;
+    int num_args = header >> LOG_ARGS_SHIFT;
+
+    if ( offset + LOG_HEADER_BYTES + 4 * num_args > length )
+    {
+      return 0;
+    }
+    printf("%10u  ", cycles);
+    if ( id < NUM_MESSAGES )
+    {
+      print_message(messages[id].format, &payload[offset + LOG_HEADER_BYTES], num_args);
+    }
+    else
+    {
+      int i;
+
+      printf("unknown message %d", id);
+      for ( i = 0; i < num_args; i++ )
+      {
+        printf(" 0x%08X", frame_u32(&payload[offset + LOG_HEADER_BYTES + 4 * i]));
+      }
+    }
+    printf("\n");
+    offset += LOG_HEADER_BYTES + 4 * num_args;
+  }
+  fflush(stdout);
+  return offset == length;
+}
+
+int main(int argc, char **argv)
+{
+  frame_reader_t reader;
+  uint8_t payload[FRAME_MAX_PAYLOAD + 2];
+  uint8_t buf[512];
+  unsigned long truncated = 0;
+  ssize_t n;
+  int fd;
+
+  if ( argc != 2 )
+  {
+    fprintf(stderr, "usage: %s <serial device | capture file | ->\n", argv[0]);
+    return 2;
+  }
+  fd = strcmp(argv[1], "-") == 0 ? STDIN_FILENO : open(argv[1], O_RDONLY | O_NOCTTY);
+  if ( fd < 0 )
+  {
+    perror(argv[1]);
+    return 1;
+  }
+  frame_configure_tty(fd);
+  memset(&reader, 0, sizeof(reader));
+
+  while ( (n = read(fd, buf, sizeof(buf))) > 0 )
+  {
+    ssize_t i;
+
+    for ( i = 0; i < n; i++ )
+    {
+      int length = frame_feed(&reader, buf[i], payload);
+
+      if ( length > 0 && payload[0] == FRAME_RECORD_LOG && !print_records(payload, length) )
+      {
+        truncated++;
+      }
+    }
+  }
+
+  fprintf(stderr, "%lu frames, %lu bad, %lu truncated\n", reader.good, reader.bad, truncated);
+  return 0;
+}
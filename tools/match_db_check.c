@@ -0,0 +1,303 @@
+//*****************************************************************************
+// Checks Project/match_db.c on the PC against a RAM image of the 4K
+// MCP24LC32AT.  The image starts erased (all 0xFF) like a new part.  Every
+// read and write is bounds checked and counted.  The checks:
+//
+//    - records pack and unpack every field, newest first, across the wrap
+//      of the circular history
+//    - the per-mode leaderboard and total survive a reboot
+//    - a corrupt header is rebuilt from the history
+//    - all zero, out of range and impossible records are ignored
+//    - the newest record is found across the wrap of the match number
+//    - failed writes stay pending and are retried, records before the
+//      header, and matches past the pending limit are dropped
+//    - nothing outside the database region is written
+//    - the history comes back in at most two sequential reads
+//
+// Build: cc -O2 -Ihost -I../Project -I../drivers/include
+//          -o match_db_check match_db_check.c ../Project/match_db.c
+//          ../drivers/c/crc.c
+//*****************************************************************************
+#include <stdio.h>
+#include <string.h>
+#include "match_db.h"
+#include "check.h"
+
+#define DB_START    MATCH_DB_HEADER_ADDR
+#define DB_END      (MATCH_DB_HISTORY_ADDR + MATCH_DB_HISTORY_LEN * MATCH_DB_RECORD_SIZE)
+
+static uint8_t image[EEPROM_SIZE_BYTES];
+static uint32_t reads;
+static uint32_t writes;
+static uint32_t failWrites;     // writes to refuse before taking any
+
+i2c_status_t eeprom_write_block(uint32_t i2c_base, uint16_t address, uint8_t *data, uint16_t num_bytes)
+{
+  CHECK(i2c_base == EEPROM_I2C_BASE);
+  if ((uint32_t)address + num_bytes > EEPROM_SIZE_BYTES)
+    return I2C_INVALID_PARAM;
+  if (failWrites > 0) {
+    failWrites--;
+    return I2C_NO_ACK;
+  }
+  memcpy(&image[address], data, num_bytes);
+  writes++;
+  return I2C_OK;
+}
+
+i2c_status_t eeprom_read_block(uint32_t i2c_base, uint16_t address, uint8_t *data, uint16_t num_bytes)
+{
+  CHECK(i2c_base == EEPROM_I2C_BASE);
+  if ((uint32_t)address + num_bytes > EEPROM_SIZE_BYTES)
+    return I2C_INVALID_PARAM;
+  memcpy(data, &image[address], num_bytes);
+  reads++;
+  return I2C_OK;
+}
+
+bool eeprom_busy(uint32_t i2c_base)
+{
+  CHECK(i2c_base == EEPROM_I2C_BASE);
+  return false;
+}
+
+// Number match_db_record() gives the n'th match, 1 to MATCH_DB_NUMBER_MASK
+static uint16_t number_of(uint32_t n)
+{
+  return (n - 1) % MATCH_DB_NUMBER_MASK + 1;
+}
+
+// A made up match, different for every n.  Player 2 wins every third one.
+static match_record_t make_match(uint32_t n)
+{
+  match_record_t match;
+
+  memset(&match, 0, sizeof(match));
+  match.mode = n % MATCH_DB_NUM_MODES;
+  match.winner = (n % 3) == 0;
+  match.score1 = match.winner ? n % 10 : 10;
+  match.score2 = match.winner ? 10 : n % 10;
+  match.rally = (n * 37) % (MATCH_DB_MAX_RALLY + 1);
+  match.duration = 100 + (n * 997) % 60000;
+  match.seed = n * 13;
+  return match;
+}
+
+static int same_match(const match_record_t *a, const match_record_t *b)
+{
+  return a->mode == b->mode && a->winner == b->winner && a->score1 == b->score1 &&
+         a->score2 == b->score2 && a->rally == b->rally && a->duration == b->duration &&
+         a->seed == b->seed && a->number == b->number;
+}
+
+// Leaderboard of matches first..last worked out here, for comparison
+static void expected_stats(uint32_t first, uint32_t last, match_db_mode_stats_t *modes)
+{
+  match_record_t match;
+  match_db_mode_stats_t *stats;
+  uint32_t n;
+
+  memset(modes, 0, sizeof(match_db_mode_stats_t) * MATCH_DB_NUM_MODES);
+  for (n = first; n <= last; n++) {
+    match = make_match(n);
+    stats = &modes[match.mode];
+    if (match.winner)
+      stats->p2Wins++;
+    else
+      stats->p1Wins++;
+    if (match.rally > stats->bestRally)
+      stats->bestRally = match.rally;
+    if (stats->fastestWin == 0 || match.duration < stats->fastestWin)
+      stats->fastestWin = match.duration;
+  }
+}
+
+static void check_stats(uint32_t first, uint32_t last)
+{
+  match_db_mode_stats_t modes[MATCH_DB_NUM_MODES];
+  const match_db_mode_stats_t *stats;
+  uint8_t mode;
+
+  expected_stats(first, last, modes);
+  for (mode = 0; mode < MATCH_DB_NUM_MODES; mode++) {
+    stats = match_db_mode_stats(mode);
+    CHECK(stats != NULL && memcmp(stats, &modes[mode], sizeof(*stats)) == 0);
+  }
+  CHECK(match_db_mode_stats(MATCH_DB_NUM_MODES) == NULL);
+}
+
+// The newest count matches must be last, last - 1, ...
+static void check_history(uint32_t last, uint8_t count)
+{
+  match_record_t records[MATCH_DB_HISTORY_LEN];
+  match_record_t match;
+  uint8_t n;
+  uint8_t i;
+
+  reads = 0;
+  n = match_db_history(records, MATCH_DB_HISTORY_LEN);
+  CHECK(n == count);
+  CHECK(reads <= 2);
+  for (i = 0; i < n; i++) {
+    match = make_match(last - i);
+    match.number = number_of(last - i);
+    CHECK(same_match(&records[i], &match));
+  }
+}
+
+static void record_matches(uint32_t first, uint32_t last)
+{
+  match_record_t match;
+  uint32_t n;
+
+  for (n = first; n <= last; n++) {
+    match = make_match(n);
+    match_db_record(&match);
+    CHECK(match.number == number_of(n));
+  }
+}
+
+static void put_record(uint8_t slot, uint64_t bits)
+{
+  int i;
+
+  for (i = 0; i < MATCH_DB_RECORD_SIZE; i++)
+    image[MATCH_DB_HISTORY_ADDR + slot * MATCH_DB_RECORD_SIZE + i] = bits >> (8 * i);
+}
+
+int main(void)
+{
+  match_record_t records[MATCH_DB_HISTORY_LEN];
+  uint8_t saved[MATCH_DB_HEADER_SIZE];
+  match_db_stats_t stats;
+  uint32_t i;
+
+  memset(image, 0xFF, sizeof(image));
+
+  // a new part, the header is built and written
+  match_db_init();
+  CHECK(match_db_total() == 0);
+  CHECK(match_db_history(records, MATCH_DB_HISTORY_LEN) == 0);
+  check_stats(1, 0);
+
+  // fewer matches than the history holds, then enough to wrap it twice
+  record_matches(1, 10);
+  CHECK(match_db_total() == 10);
+  check_history(10, 10);
+  check_stats(1, 10);
+  record_matches(11, 150);
+  CHECK(match_db_total() == 150);
+  check_history(150, MATCH_DB_HISTORY_LEN);
+  check_stats(1, 150);
+
+  // nothing outside the database was touched
+  for (i = 0; i < EEPROM_SIZE_BYTES; i++)
+    if (i < DB_START || i >= DB_END)
+      CHECK(image[i] == 0xFF);
+
+  // reboot with the header intact
+  writes = 0;
+  match_db_init();
+  CHECK(writes == 0);
+  CHECK(match_db_total() == 150);
+  check_stats(1, 150);
+
+  // reboot with a corrupt header, the stats come back from the matches
+  // still in the history, 87 to 150, and recording carries on after them
+  image[MATCH_DB_HEADER_ADDR + 8] ^= 0x01;
+  match_db_init();
+  CHECK(match_db_total() == 150);
+  check_stats(150 - MATCH_DB_HISTORY_LEN + 1, 150);
+  record_matches(151, 151);
+  check_history(151, MATCH_DB_HISTORY_LEN);
+
+  // garbage in the history: an all zero record, mode 7, a winner with the
+  // lower score, match number 0.  Only valid records count.
+  memset(image, 0xFF, sizeof(image));
+  match_db_init();
+  record_matches(1, 4);
+  put_record(4, 0);
+  put_record(5, (6ull << 50) | (10ull << 4) | 7);        // mode 7
+  put_record(6, (5ull << 50) | (3ull << 4) | (9ull << 9)); // p1 wins 3-9
+  put_record(7, (10ull << 4));                            // match 0
+  image[MATCH_DB_HEADER_ADDR] = 0;
+  match_db_init();
+  CHECK(match_db_total() == 4);
+  check_stats(1, 4);
+  check_history(4, 4);
+
+  // an all zero image rebuilds to an empty database
+  memset(image, 0, sizeof(image));
+  match_db_init();
+  CHECK(match_db_total() == 0);
+  check_stats(1, 0);
+
+  // the match number wraps from MATCH_DB_NUMBER_MASK to 1.  A rebuild
+  // must still find the newest record past the wrap, with the older
+  // numbers near the top of the range beside it in the history.
+  memset(image, 0xFF, sizeof(image));
+  match_db_init();
+  record_matches(1, MATCH_DB_NUMBER_MASK + 20);
+  check_history(MATCH_DB_NUMBER_MASK + 20, MATCH_DB_HISTORY_LEN);
+  image[MATCH_DB_HEADER_ADDR + 8] ^= 0x01;
+  match_db_init();
+  CHECK(match_db_total() == MATCH_DB_NUMBER_MASK + 20);
+  check_history(MATCH_DB_NUMBER_MASK + 20, MATCH_DB_HISTORY_LEN);
+  record_matches(MATCH_DB_NUMBER_MASK + 21, MATCH_DB_NUMBER_MASK + 21);
+  check_history(MATCH_DB_NUMBER_MASK + 21, MATCH_DB_HISTORY_LEN);
+
+  // a refused record write keeps the match and the header pending, the
+  // EEPROM header still describes the matches before it
+  memset(image, 0xFF, sizeof(image));
+  match_db_init();
+  record_matches(1, 5);
+  memcpy(saved, &image[MATCH_DB_HEADER_ADDR], MATCH_DB_HEADER_SIZE);
+  failWrites = 1;
+  record_matches(6, 6);
+  match_db_get_stats(&stats);
+  CHECK(stats.pending == 1 && stats.headerDirty && stats.failedCount == 1);
+  CHECK(memcmp(saved, &image[MATCH_DB_HEADER_ADDR], MATCH_DB_HEADER_SIZE) == 0);
+  check_history(6, 6);
+  CHECK(match_db_flush(false));
+  match_db_get_stats(&stats);
+  CHECK(stats.pending == 0 && !stats.headerDirty);
+  match_db_init();
+  CHECK(match_db_total() == 6);
+  check_history(6, 6);
+
+  // every write refused: MATCH_DB_PENDING_LEN matches are kept, the next
+  // one is dropped and gets number 0, and all kept ones reach the EEPROM
+  memset(image, 0xFF, sizeof(image));
+  match_db_init();
+  record_matches(1, 3);
+  failWrites = 1000;
+  record_matches(4, 3 + MATCH_DB_PENDING_LEN);
+  records[0] = make_match(100);
+  match_db_record(&records[0]);
+  CHECK(records[0].number == 0);
+  match_db_get_stats(&stats);
+  CHECK(stats.pending == MATCH_DB_PENDING_LEN && stats.droppedCount == 1);
+  CHECK(match_db_total() == 3 + MATCH_DB_PENDING_LEN);
+  CHECK(!match_db_flush(true));
+  failWrites = 0;
+  CHECK(match_db_flush(true));
+  image[MATCH_DB_HEADER_ADDR + 8] ^= 0x01;
+  match_db_init();
+  CHECK(match_db_total() == 3 + MATCH_DB_PENDING_LEN);
+  check_stats(1, 3 + MATCH_DB_PENDING_LEN);
+  check_history(3 + MATCH_DB_PENDING_LEN, 3 + MATCH_DB_PENDING_LEN);
+
+  // field limits survive packing
+  records[0] = make_match(1);
+  records[0].mode = MATCH_DB_NUM_MODES - 1;
+  records[0].winner = 0;
+  records[0].score1 = MATCH_DB_MAX_SCORE;
+  records[0].score2 = MATCH_DB_MAX_SCORE - 1;
+  records[0].rally = MATCH_DB_MAX_RALLY;
+  records[0].duration = MATCH_DB_MAX_DURATION;
+  records[0].seed = 0xFF;
+  match_db_record(&records[0]);
+  CHECK(match_db_history(&records[1], 1) == 1 && same_match(&records[0], &records[1]));
+
+  return check_done();
+}
@@ -0,0 +1,117 @@
+//*****************************************************************************
+// Runs one side of a network match on the PC with Project/netplay.c and
+// Project/pong_sim.c, over the simulated radio in wireless_host.c.  Start
+// two copies, one per player, with the ports swapped:
+//
+//    ./netplay_sim 0 5001 5002 20 40 &
+//    ./netplay_sim 1 5002 5001 20 40
+//
+// The arguments are the player, the UDP ports, the chance in percent that
+// a transmission or acknowledge is lost, and the one way latency in ms.
+// Each copy moves its paddle toward the ball as drawn, predictions
+// included, with some noise so the other side keeps mispredicting.  The
+// match runs at 50 ticks a second until someone wins, then both copies
+// print the rollback statistics and the checksum of the final state, which
+// must be the same.
+//
+// Build: cc -O2 -I../Project -I../drivers/include -I../peripherals/include
+//          -o netplay_sim netplay_sim.c wireless_host.c ../Project/netplay.c
+//          ../Project/pong_sim.c ../drivers/c/crc.c
+//*****************************************************************************
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include "wireless_host.h"
+#include "netplay.h"
+
+#define SIM_TICK_US       20000
+#define SIM_WIN_SCORE     3
+// Gives up on a match that stalls this long
+#define SIM_TIMEOUT_US    120000000ull
+
+static const char *const statusNames[] = {
+  "syncing", "running", "stalled", "desync", "config mismatch"
+};
+
+// Slower than the ball, so points get scored
+#define SIM_PADDLE_SPEED  2
+
+// Paddle step toward the ball, wrong now and then
+static int8_t sim_input(const pong_sim_state_t *state, uint8_t player)
+{
+  int16_t x = player == 0 ? state->player1x : state->player2x;
+  int16_t step = state->ballx - x;
+
+  if (rand() % 4 == 0)
+    step = (rand() % (2 * SIM_PADDLE_SPEED + 1)) - SIM_PADDLE_SPEED;
+  if (step > SIM_PADDLE_SPEED)
+    step = SIM_PADDLE_SPEED;
+  if (step < -SIM_PADDLE_SPEED)
+    step = -SIM_PADDLE_SPEED;
+  return step;
+}
+
+int main(int argc, char **argv)
+{
+  static const uint8_t id[5] = { 1, 2, 3, 4, 5 };
+  pong_sim_config_t config = { 40, 10, 10, 10, 10, 5, 10, SIM_WIN_SCORE };
+  const pong_sim_state_t *state;
+  netplay_status_t status = NETPLAY_SYNCING;
+  netplay_stats_t stats;
+  wireless_stats_t link;
+  uint64_t next, start, finishedAt = 0;
+  uint32_t ticks;
+  uint16_t checksum;
+  uint8_t player, winner;
+
+  if (argc != 6) {
+    fprintf(stderr, "usage: %s player local_port remote_port loss_percent latency_ms\n", argv[0]);
+    return 1;
+  }
+
+  player = atoi(argv[1]);
+  wireless_host_configure(atoi(argv[2]), atoi(argv[3]), atoi(argv[4]), atoi(argv[5]));
+  if (!wireless_link_init(id, id)) {
+    perror("wireless_link_init");
+    return 1;
+  }
+  srand(player * 7919 + 1);
+  netplay_init(player, 0x5EED, &config);
+
+  start = next = wireless_host_now_us();
+  while (1) {
+    while (wireless_host_now_us() < next)
+      usleep(200);
+    next += SIM_TICK_US;
+
+    state = netplay_state();
+    status = netplay_tick(status == NETPLAY_SYNCING ? 0 : sim_input(state, player));
+    if (status == NETPLAY_DESYNC || status == NETPLAY_CONFIG_MISMATCH)
+      break;
+
+    // keep acknowledging for a second so the other side can finish too
+    if (finishedAt == 0 && netplay_finished(&winner))
+      finishedAt = next;
+    if (finishedAt != 0 && next - finishedAt > 1000000)
+      break;
+    if (next - start > SIM_TIMEOUT_US)
+      break;
+  }
+
+  netplay_get_stats(&stats);
+  wireless_link_get_stats(&link);
+  ticks = netplay_confirmed_tick(&checksum);
+  state = netplay_state();
+
+  printf("player %u: %s", player, statusNames[status]);
+  if (finishedAt != 0)
+    printf(", player %u won %u-%u", winner + 1, state->player1score, state->player2score);
+  printf("\n");
+  printf("  confirmed %u ticks, checksum %04X, %u matched\n", ticks, checksum, stats.checksumsMatched);
+  printf("  ticks %u stalls %u rollbacks %u resimulated %u max rollback %u\n",
+         stats.ticks, stats.stalls, stats.rollbacks, stats.resimulated, stats.maxRollback);
+  printf("  packets sent %u received %u failed %u, radio lost %u retransmits %u\n",
+         stats.packetsSent, stats.packetsReceived, stats.sendFailed, link.lost, link.retransmits);
+
+  return status == NETPLAY_DESYNC || status == NETPLAY_CONFIG_MISMATCH || finishedAt == 0;
+}
@@ -0,0 +1,234 @@
+//*****************************************************************************
+// Checks drivers/c/profile_zones.c on the PC.  The cycle counter is a
+// variable the checks move forward by hand, so every zone time, self time
+// and histogram bucket is known exactly.
+//
+// Build it both ways, the second checks that the zones compile out:
+//
+//    cc -O2 -Wall -Wextra -DPROFILE_ZONES_HOST -I../drivers/include -Ihost
+//       -o profile_zones_check profile_zones_check.c
+//       ../drivers/c/profile_zones.c
+//    cc -O2 -Wall -Wextra -DPROFILE_ZONES_HOST -DPROFILE_ZONES_ENABLED=0
+//       -I../drivers/include -Ihost -o profile_zones_off
+//       profile_zones_check.c ../drivers/c/profile_zones.c
+//*****************************************************************************
+#include <stdio.h>
+#include <string.h>
+#include "profile_zones.h"
+#include "check.h"
+
+static uint32_t fakeCycles;
+
+uint32_t profile_zones_host_clock(void)
+{
+  return fakeCycles;
+}
+
+// One zone lasting cycles, starting at the current time
+static void zone(profile_zone_t id, uint32_t cycles)
+{
+  PROFILE_BEGIN(id);
+  fakeCycles += cycles;
+  PROFILE_END(id);
+}
+
+#if PROFILE_ZONES_ENABLED
+
+static profile_zone_stats_t get(profile_zone_t zone)
+{
+  profile_zone_stats_t stats;
+
+  memset(&stats, 0xA5, sizeof(stats));
+  CHECK(profile_zones_get(zone, &stats));
+  return stats;
+}
+
+static void check_single(void)
+{
+  profile_zone_stats_t stats;
+  uint32_t samples[] = { 100, 40, 250, 90 };
+  uint32_t i;
+
+  profile_zones_init();
+  for (i = 0; i < 4; i++)
+    zone(PROFILE_ZONE_LCD, samples[i]);
+
+  stats = get(PROFILE_ZONE_LCD);
+  CHECK(stats.count == 4);
+  CHECK(stats.min == 40);
+  CHECK(stats.max == 250);
+  CHECK(stats.total == 480);
+  CHECK(stats.self == 480);
+  CHECK(stats.total / stats.count == 120);
+  CHECK(stats.histogram[5] == 1);     // 40
+  CHECK(stats.histogram[6] == 2);     // 100, 90
+  CHECK(stats.histogram[7] == 1);     // 250
+  CHECK(get(PROFILE_ZONE_TICK).count == 0);
+  CHECK(profile_zones_errors() == 0);
+}
+
+static void check_nesting(void)
+{
+  profile_zone_stats_t tick;
+  profile_zone_stats_t lcd;
+  profile_zone_stats_t eeprom;
+  profile_zone_stats_t adc;
+
+  profile_zones_init();
+  PROFILE_BEGIN(PROFILE_ZONE_TICK);
+  fakeCycles += 10;
+  PROFILE_BEGIN(PROFILE_ZONE_LCD);
+  fakeCycles += 1000;
+  zone(PROFILE_ZONE_ADC, 300);        // an interrupt during the draw
+  fakeCycles += 700;
+  PROFILE_END(PROFILE_ZONE_LCD);
+  fakeCycles += 20;
+  zone(PROFILE_ZONE_EEPROM, 5000);
+  fakeCycles += 5;
+  PROFILE_END(PROFILE_ZONE_TICK);
+
+  tick = get(PROFILE_ZONE_TICK);
+  lcd = get(PROFILE_ZONE_LCD);
+  eeprom = get(PROFILE_ZONE_EEPROM);
+  adc = get(PROFILE_ZONE_ADC);
+  CHECK(tick.total == 7035 && tick.self == 35);
+  CHECK(lcd.total == 2000 && lcd.self == 1700);
+  CHECK(adc.total == 300 && adc.self == 300);
+  CHECK(eeprom.total == 5000 && eeprom.self == 5000);
+  CHECK(tick.self + lcd.self + adc.self + eeprom.self == tick.total);
+  CHECK(profile_zones_errors() == 0);
+}
+
+static void check_buckets(void)
+{
+  profile_zone_stats_t stats;
+
+  profile_zones_init();
+  zone(PROFILE_ZONE_TOUCH, 0);
+  zone(PROFILE_ZONE_TOUCH, 1);
+  zone(PROFILE_ZONE_TOUCH, 2);
+  zone(PROFILE_ZONE_TOUCH, 3);
+  zone(PROFILE_ZONE_TOUCH, 4);
+  zone(PROFILE_ZONE_TOUCH, (1u << 22) - 1);
+  zone(PROFILE_ZONE_TOUCH, 1u << 23);
+  zone(PROFILE_ZONE_TOUCH, 0xFFFFFFFF);
+
+  stats = get(PROFILE_ZONE_TOUCH);
+  CHECK(stats.histogram[0] == 2);
+  CHECK(stats.histogram[1] == 2);
+  CHECK(stats.histogram[2] == 1);
+  CHECK(stats.histogram[21] == 1);
+  CHECK(stats.histogram[22] == 0);
+  CHECK(stats.histogram[PROFILE_ZONES_BUCKETS - 1] == 2);
+  CHECK(stats.min == 0 && stats.max == 0xFFFFFFFF);
+  CHECK(stats.total == 0xFFFFFFFFull + (1u << 23) + (1u << 22) - 1 + 10);
+}
+
+// The counter wraps every 2^32 cycles
+static void check_wrap(void)
+{
+  profile_zone_stats_t stats;
+
+  profile_zones_init();
+  fakeCycles = 0xFFFFFF00;
+  zone(PROFILE_ZONE_ACCEL, 0x200);
+  stats = get(PROFILE_ZONE_ACCEL);
+  CHECK(stats.count == 1 && stats.min == 0x200 && stats.total == 0x200);
+}
+
+static void check_errors(void)
+{
+  profile_zone_stats_t stats;
+  int i;
+
+  // an end with no begin is ignored
+  profile_zones_init();
+  PROFILE_END(PROFILE_ZONE_LCD);
+  CHECK(profile_zones_errors() == 1);
+  CHECK(get(PROFILE_ZONE_LCD).count == 0);
+
+  // a zone left open is dropped when the zone around it ends
+  profile_zones_init();
+  PROFILE_BEGIN(PROFILE_ZONE_TICK);
+  PROFILE_BEGIN(PROFILE_ZONE_TOUCH);
+  fakeCycles += 50;
+  PROFILE_END(PROFILE_ZONE_TICK);
+  CHECK(profile_zones_errors() == 1);
+  CHECK(get(PROFILE_ZONE_TOUCH).count == 0);
+  stats = get(PROFILE_ZONE_TICK);
+  CHECK(stats.count == 1 && stats.total == 50 && stats.self == 50);
+
+  // and the stack is empty again
+  zone(PROFILE_ZONE_ADC, 7);
+  CHECK(get(PROFILE_ZONE_ADC).total == 7);
+  PROFILE_BEGIN(PROFILE_ZONE_TICK);
+  fakeCycles += 3;
+  PROFILE_END(PROFILE_ZONE_TICK);
+  stats = get(PROFILE_ZONE_TICK);
+  CHECK(stats.count == 2 && stats.self == 53);
+
+  // two zones past the deepest nesting are not timed, the rest are
+  profile_zones_init();
+  for (i = 0; i < PROFILE_ZONES_DEPTH + 2; i++) {
+    PROFILE_BEGIN(PROFILE_ZONE_LCD);
+    fakeCycles += 1;
+  }
+  for (i = 0; i < PROFILE_ZONES_DEPTH + 2; i++)
+    PROFILE_END(PROFILE_ZONE_LCD);
+  stats = get(PROFILE_ZONE_LCD);
+  CHECK(profile_zones_errors() == 2);
+  CHECK(stats.count == PROFILE_ZONES_DEPTH);
+  CHECK(stats.max == PROFILE_ZONES_DEPTH + 2 && stats.min == 3);
+  CHECK(stats.self == PROFILE_ZONES_DEPTH + 2);
+}
+
+static void check_reset(void)
+{
+  profile_zone_stats_t stats;
+
+  profile_zones_init();
+  zone(PROFILE_ZONE_LCD, 10);
+  PROFILE_END(PROFILE_ZONE_ADC);
+  PROFILE_BEGIN(PROFILE_ZONE_TICK);
+  fakeCycles += 4;
+  profile_zones_reset();
+  CHECK(get(PROFILE_ZONE_LCD).count == 0);
+  CHECK(profile_zones_errors() == 0);
+
+  // the open zone is recorded when it closes
+  fakeCycles += 6;
+  PROFILE_END(PROFILE_ZONE_TICK);
+  stats = get(PROFILE_ZONE_TICK);
+  CHECK(stats.count == 1 && stats.total == 10);
+}
+
+#endif
+
+int main(void)
+{
+  profile_zone_t id;
+
+  for (id = 0; id < PROFILE_NUM_ZONES; id++)
+    CHECK(strcmp(profile_zones_name(id), "?") != 0);
+  CHECK(strcmp(profile_zones_name(PROFILE_NUM_ZONES), "?") == 0);
+
+#if PROFILE_ZONES_ENABLED
+  check_single();
+  check_nesting();
+  check_buckets();
+  check_wrap();
+  check_errors();
+  check_reset();
+  printf("zones enabled, ");
+#else
+  profile_zone_stats_t stats;
+
+  profile_zones_init();
+  zone(PROFILE_ZONE_LCD, 100);
+  CHECK(!profile_zones_get(PROFILE_ZONE_LCD, &stats));
+  CHECK(profile_zones_errors() == 0);
+  printf("zones compiled out, ");
+#endif
+
+  return check_done();
+}
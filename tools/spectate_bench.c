@@ -0,0 +1,122 @@
+//*****************************************************************************
+// Round trip and size benchmark for Project/spectate.c.
+//
+// Plays matches with Project/pong_sim.c and random paddles, encodes every
+// tick, drops packets with the given chance and decodes the rest.  Every
+// decoded view must equal the state of its tick.  Prints the bytes per tick
+// of each packet type and the time per encode and decode, in TSC cycles on
+// x86 and nanoseconds elsewhere.
+//
+//    ./spectate_bench [ticks] [loss_percent]
+//
+// Build: cc -O2 -I../Project -I../drivers/include -I../peripherals/include
+//          -o spectate_bench spectate_bench.c ../Project/spectate.c
+//          ../Project/pong_sim.c ../drivers/c/crc.c
+//*****************************************************************************
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "spectate.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define BENCH_UNITS   "cycles"
+static uint64_t bench_now(void)
+{
+  return __rdtsc();
+}
+#else
+#define BENCH_UNITS   "ns"
+static uint64_t bench_now(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000u + ts.tv_nsec;
+}
+#endif
+
+#define BENCH_HISTORY   65536
+
+// Truth for every tick, indexed by the low 16 bits the packets carry
+static spectate_view_t sent[BENCH_HISTORY];
+
+int main(int argc, char **argv)
+{
+  pong_sim_config_t config = { 40, 10, 10, 10, 10, 5, 10, 10 };
+  uint32_t ticks = argc > 1 ? strtoul(argv[1], NULL, 0) : 100000;
+  int loss = argc > 2 ? atoi(argv[2]) : 10;
+  pong_sim_state_t state;
+  spectate_encoder_t encoder;
+  spectate_decoder_t decoder;
+  spectate_view_t view, decoded;
+  uint8_t packet[SPECTATE_MAX_PACKET];
+  uint8_t length, maxLength = 0;
+  uint64_t start, encodeTime = 0, decodeTime = 0, encodeMax = 0, decodeMax = 0, t;
+  uint32_t i, errors = 0, matches = 1, delivered = 0;
+  uint32_t sizes[SPECTATE_MAX_PACKET + 1] = { 0 };
+
+  srand(1);
+  pong_sim_init(&state, &config, 1);
+  spectate_encoder_init(&encoder);
+  spectate_decoder_init(&decoder);
+
+  for (i = 0; i < ticks; i++) {
+    pong_sim_step(&state, &config, (rand() % 21) - 10, (rand() % 21) - 10);
+    if (state.winner != PONG_SIM_NO_WINNER) {
+      // next match, the tick count carries on like a long session
+      uint32_t tick = state.tick;
+
+      pong_sim_init(&state, &config, rand());
+      state.tick = tick;
+      matches++;
+    }
+
+    spectate_view(&view, &state);
+    sent[view.tick] = view;
+
+    start = bench_now();
+    length = spectate_encode(&encoder, &view, packet);
+    t = bench_now() - start;
+    encodeTime += t;
+    if (t > encodeMax)
+      encodeMax = t;
+    sizes[length]++;
+    if (length > maxLength)
+      maxLength = length;
+
+    if (rand() % 100 < loss)
+      continue;
+    delivered++;
+
+    start = bench_now();
+    if (spectate_decode(&decoder, packet, length, &decoded)) {
+      t = bench_now() - start;
+      decodeTime += t;
+      if (t > decodeMax)
+        decodeMax = t;
+      if (memcmp(&decoded, &sent[decoded.tick], sizeof(decoded)) != 0) {
+        if (errors++ < 10)
+          printf("tick %u decoded wrong\n", decoded.tick);
+      }
+    }
+  }
+
+  printf("%u ticks, %u matches, %d%% loss\n", ticks, matches, loss);
+  printf("  keyframes %u deltas %u, %.2f bytes per tick, largest %u\n",
+         encoder.keyframes, encoder.deltas, (double)encoder.bytes / ticks, maxLength);
+  printf("  packet sizes:");
+  for (i = 0; i <= SPECTATE_MAX_PACKET; i++) {
+    if (sizes[i])
+      printf(" %u:%u", i, sizes[i]);
+  }
+  printf("\n");
+  printf("  delivered %u, decoded %u, lost %u, waiting for keyframe %u, stale %u, invalid %u\n",
+         delivered, decoder.decoded, decoder.lost, decoder.noKeyframe, decoder.stale, decoder.invalid);
+  printf("  encode %.0f avg %llu max %s, decode %.0f avg %llu max %s\n",
+         (double)encodeTime / ticks, (unsigned long long)encodeMax, BENCH_UNITS,
+         (double)decodeTime / (decoder.decoded ? decoder.decoded : 1),
+         (unsigned long long)decodeMax, BENCH_UNITS);
+  printf("  %s\n", errors ? "MISMATCH" : "every decoded view matches");
+  return errors != 0;
+}
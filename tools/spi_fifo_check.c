@@ -0,0 +1,235 @@
+//*****************************************************************************
+// Checks spiTx() of drivers/c/spi.c on the PC against a model of the SSI.
+// The model has the 8 entry transmit and receive FIFOs and the shift
+// register between them.  Every register access spiTx() makes moves the
+// bus on by one step, and a byte takes a set number of steps to shift, so
+// fast and slow SPI clocks relative to the CPU are both covered.  The
+// device answers every byte with its complement.
+//
+// Each transfer must receive every answer in order, never write a full
+// transmit FIFO, never read an empty receive FIFO and never let the
+// receive FIFO overrun.
+//
+// Build with:
+//
+//    cc -O2 -Wall -Wextra -DSPI_HOST -I../drivers/include -Ihost
+//       -o spi_fifo_check spi_fifo_check.c ../drivers/c/spi.c
+//*****************************************************************************
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "spi.h"
+#include "check.h"
+
+#define MODEL_BASE          0x40008000
+#define MODEL_MAX_STEPS     10000000
+
+typedef struct {
+  uint8_t  tx[SPI_FIFO_DEPTH];
+  uint8_t  txCount;
+  uint8_t  rx[SPI_FIFO_DEPTH];
+  uint8_t  rxCount;
+  bool     shifting;
+  uint8_t  shiftByte;
+  uint32_t shiftLeft;
+  uint32_t stepsPerByte;
+  uint32_t steps;
+  uint32_t sent;            // bytes shifted out
+  uint32_t maxInFlight;     // most bytes in the FIFOs and shift register
+  uint32_t txOverflows;     // DR written with the transmit FIFO full
+  uint32_t rxUnderflows;    // DR read with the receive FIFO empty
+  uint32_t rxOverruns;      // bytes lost to a full receive FIFO
+  uint32_t badBase;
+} ssi_model_t;
+
+static ssi_model_t ssi;
+
+static void model_reset(uint32_t steps_per_byte)
+{
+  memset(&ssi, 0, sizeof(ssi));
+  ssi.stepsPerByte = steps_per_byte;
+}
+
+//*****************************************************************************
+// One step of the bus.  The byte in the shift register finishes and its
+// answer goes to the receive FIFO, then the next byte is loaded from the
+// transmit FIFO.
+//*****************************************************************************
+static void model_step(uint32_t base)
+{
+  uint32_t inFlight;
+
+  if ( base != MODEL_BASE)
+  {
+    ssi.badBase++;
+  }
+
+  if ( ++ssi.steps > MODEL_MAX_STEPS)
+  {
+    printf("spiTx() did not finish in %d steps\n", MODEL_MAX_STEPS);
+    exit(1);
+  }
+
+  if ( ssi.shifting && --ssi.shiftLeft == 0)
+  {
+    ssi.shifting = false;
+    ssi.sent++;
+    if ( ssi.rxCount == SPI_FIFO_DEPTH)
+    {
+      ssi.rxOverruns++;
+    }
+    else
+    {
+      ssi.rx[ssi.rxCount++] = (uint8_t)~ssi.shiftByte;
+    }
+  }
+
+  if ( !ssi.shifting && ssi.txCount > 0)
+  {
+    ssi.shiftByte = ssi.tx[0];
+    memmove(ssi.tx, ssi.tx + 1, --ssi.txCount);
+    ssi.shiftLeft = ssi.stepsPerByte;
+    ssi.shifting = true;
+  }
+
+  inFlight = ssi.txCount + ssi.rxCount + (ssi.shifting ? 1 : 0);
+  if ( inFlight > ssi.maxInFlight)
+  {
+    ssi.maxInFlight = inFlight;
+  }
+}
+
+uint32_t spi_host_sr(uint32_t base)
+{
+  uint32_t sr = 0;
+
+  model_step(base);
+  if ( ssi.txCount == 0)
+  {
+    sr |= SSI_SR_TFE;
+  }
+  if ( ssi.txCount < SPI_FIFO_DEPTH)
+  {
+    sr |= SSI_SR_TNF;
+  }
+  if ( ssi.rxCount > 0)
+  {
+    sr |= SSI_SR_RNE;
+  }
+  if ( ssi.rxCount == SPI_FIFO_DEPTH)
+  {
+    sr |= SSI_SR_RFF;
+  }
+  if ( ssi.shifting || ssi.txCount > 0)
+  {
+    sr |= SSI_SR_BSY;
+  }
+  return sr;
+}
+
+uint8_t spi_host_dr_read(uint32_t base)
+{
+  uint8_t data;
+
+  model_step(base);
+  if ( ssi.rxCount == 0)
+  {
+    ssi.rxUnderflows++;
+    return 0;
+  }
+  data = ssi.rx[0];
+  memmove(ssi.rx, ssi.rx + 1, --ssi.rxCount);
+  return data;
+}
+
+void spi_host_dr_write(uint32_t base, uint8_t data)
+{
+  model_step(base);
+  if ( ssi.txCount == SPI_FIFO_DEPTH)
+  {
+    ssi.txOverflows++;
+    return;
+  }
+  ssi.tx[ssi.txCount++] = data;
+}
+
+//*****************************************************************************
+// One transfer of num_bytes with stale bytes left in the receive FIFO,
+// in place (rx == tx) like wireless.c or into a separate buffer
+//*****************************************************************************
+static void transfer(uint32_t num_bytes, uint32_t steps_per_byte, uint8_t stale, bool in_place)
+{
+  static uint8_t tx[4096];
+  static uint8_t rx[4096];
+  uint8_t *rxBuffer = in_place ? tx : rx;
+  uint32_t i;
+  bool ordered = true;
+
+  model_reset(steps_per_byte);
+  for ( i = 0; i < stale; i++)
+  {
+    ssi.rx[ssi.rxCount++] = 0xEE;
+  }
+  for ( i = 0; i < num_bytes; i++)
+  {
+    tx[i] = (uint8_t)(i * 7 + 3);
+  }
+  memset(rx, 0x55, sizeof(rx));
+
+  spiTx(MODEL_BASE, tx, num_bytes, rxBuffer);
+
+  for ( i = 0; i < num_bytes; i++)
+  {
+    if ( rxBuffer[i] != (uint8_t)~(uint8_t)(i * 7 + 3))
+    {
+      ordered = false;
+    }
+  }
+
+  CHECK(ordered);
+  CHECK(ssi.sent == num_bytes);
+  CHECK(ssi.txCount == 0 && !ssi.shifting && ssi.rxCount == 0);
+  CHECK(ssi.txOverflows == 0);
+  CHECK(ssi.rxUnderflows == 0);
+  CHECK(ssi.rxOverruns == 0);
+  CHECK(ssi.badBase == 0);
+  CHECK(ssi.maxInFlight <= SPI_FIFO_DEPTH || num_bytes == 0);
+  if ( !ordered || ssi.rxOverruns || ssi.txOverflows || ssi.rxUnderflows)
+  {
+    printf("  %u bytes, %u steps per byte, %u stale\n",
+           (unsigned)num_bytes, (unsigned)steps_per_byte, (unsigned)stale);
+  }
+}
+
+int main(void)
+{
+  static const uint32_t lengths[] = { 0, 1, 2, 7, 8, 9, 16, 96, 255, 256, 257, 1000, 4096 };
+  static const uint32_t speeds[] = { 1, 2, 5, 40 };
+  static uint8_t tx[512];
+  uint32_t l;
+  uint32_t s;
+
+  for ( l = 0; l < sizeof(lengths) / sizeof(lengths[0]); l++)
+  {
+    for ( s = 0; s < sizeof(speeds) / sizeof(speeds[0]); s++)
+    {
+      transfer(lengths[l], speeds[s], 0, false);
+      transfer(lengths[l], speeds[s], 3, false);
+      transfer(lengths[l], speeds[s], SPI_FIFO_DEPTH, true);
+    }
+  }
+
+  // With a slow bus the FIFOs are kept full, not one byte at a time
+  transfer(256, 40, 0, false);
+  CHECK(ssi.maxInFlight == SPI_FIFO_DEPTH);
+
+  // Received bytes may be thrown away
+  model_reset(3);
+  memset(tx, 0xA5, sizeof(tx));
+  spiTx(MODEL_BASE, tx, sizeof(tx), NULL);
+  CHECK(ssi.sent == sizeof(tx));
+  CHECK(ssi.rxCount == 0 && ssi.txCount == 0);
+  CHECK(ssi.rxOverruns == 0 && ssi.rxUnderflows == 0 && ssi.txOverflows == 0);
+
+  return check_done();
+}
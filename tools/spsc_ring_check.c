@@ -0,0 +1,212 @@
+//*****************************************************************************
+// Stress test of drivers/c/spsc_ring.c on the PC.  A producer thread and a
+// consumer thread stand in for an interrupt handler and the main loop and
+// move a known byte sequence through the ring as fast as they can.  Each
+// side cycles through every one of its calls, the single byte, the copy
+// and the zero copy span, with chunk sizes that keep landing across the
+// end of the storage.  The consumer checks every byte it gets, and that
+// count and space stay within the capacity.
+//
+// Each ring size runs twice, once from empty and once with head and tail
+// just below 2^32 so the free running counters wrap during the run.
+//
+// Build: cc -O2 -Wall -Wextra -pthread -Ihost -I../drivers/include
+//          -o spsc_ring_check spsc_ring_check.c ../drivers/c/spsc_ring.c
+//*****************************************************************************
+#include <stdio.h>
+#include <string.h>
+#include <pthread.h>
+#include <sched.h>
+#include "spsc_ring.h"
+#include "check.h"
+
+#define STRESS_BYTES      (8u * 1000u * 1000u)
+#define STRESS_MAX_CHUNK  23
+
+SPSC_RING_STORAGE(ring8, 8);
+SPSC_RING_STORAGE(ring64, 64);
+SPSC_RING_STORAGE(ring1k, 1024);
+
+typedef struct {
+  spsc_ring_t *ring;
+  uint32_t bytes;
+  uint32_t mismatches;      // bytes out of sequence
+  uint32_t firstMismatch;
+  uint32_t badCounts;       // count or space above the capacity
+} stress_t;
+
+// Byte number i of the sequence, not periodic in any power of two
+static uint8_t sequence(uint32_t i)
+{
+  return (uint8_t)(i * 131u + (i >> 7) + (i >> 15));
+}
+
+//*****************************************************************************
+// Adds the sequence, one call of each kind in turn
+//*****************************************************************************
+static void *producer(void *arg)
+{
+  stress_t *stress = arg;
+  spsc_ring_t *ring = stress->ring;
+  uint8_t chunk[STRESS_MAX_CHUNK];
+  uint8_t *span;
+  uint32_t sent = 0;
+  uint32_t call = 0;
+  uint32_t want;
+  uint32_t added;
+  uint32_t i;
+
+  while ( sent < stress->bytes)
+  {
+    want = 1 + call % STRESS_MAX_CHUNK;
+    if ( want > stress->bytes - sent)
+    {
+      want = stress->bytes - sent;
+    }
+
+    switch ( call % 3)
+    {
+      case 0:
+        added = spsc_ring_push(ring, sequence(sent)) ? 1 : 0;
+        break;
+      case 1:
+        for ( i = 0; i < want; i++)
+        {
+          chunk[i] = sequence(sent + i);
+        }
+        added = spsc_ring_write(ring, chunk, want);
+        break;
+      default:
+        added = spsc_ring_write_span(ring, &span);
+        if ( added > want)
+        {
+          added = want;
+        }
+        for ( i = 0; i < added; i++)
+        {
+          span[i] = sequence(sent + i);
+        }
+        spsc_ring_commit(ring, added);
+        break;
+    }
+
+    sent += added;
+    call++;
+    if ( added == 0)
+    {
+      sched_yield();
+    }
+  }
+  return NULL;
+}
+
+//*****************************************************************************
+// Removes and checks the sequence, one call of each kind in turn
+//*****************************************************************************
+static void consumer(stress_t *stress)
+{
+  spsc_ring_t *ring = stress->ring;
+  uint32_t capacity = ring->mask + 1;
+  uint8_t chunk[STRESS_MAX_CHUNK];
+  uint8_t *span;
+  uint8_t *got;
+  uint32_t received = 0;
+  uint32_t call = 0;
+  uint32_t want;
+  uint32_t removed;
+  uint32_t i;
+
+  while ( received < stress->bytes)
+  {
+    if ( spsc_ring_count(ring) > capacity || spsc_ring_space(ring) > capacity)
+    {
+      stress->badCounts++;
+    }
+
+    want = 1 + (call * 7) % STRESS_MAX_CHUNK;
+    got = chunk;
+    switch ( call % 3)
+    {
+      case 0:
+        removed = spsc_ring_pop(ring, chunk) ? 1 : 0;
+        break;
+      case 1:
+        removed = spsc_ring_read(ring, chunk, want);
+        break;
+      default:
+        removed = spsc_ring_read_span(ring, &span);
+        if ( removed > want)
+        {
+          removed = want;
+        }
+        got = span;
+        break;
+    }
+
+    for ( i = 0; i < removed; i++)
+    {
+      if ( got[i] != sequence(received + i))
+      {
+        if ( stress->mismatches++ == 0)
+        {
+          stress->firstMismatch = received + i;
+        }
+      }
+    }
+    if ( call % 3 == 2)
+    {
+      spsc_ring_release(ring, removed);
+    }
+
+    received += removed;
+    call++;
+    if ( removed == 0)
+    {
+      sched_yield();
+    }
+  }
+}
+
+static void stress(spsc_ring_t *ring, uint32_t start)
+{
+  stress_t run;
+  pthread_t thread;
+
+  ring->head = start;
+  ring->tail = start;
+  memset(&run, 0, sizeof(run));
+  run.ring = ring;
+  run.bytes = STRESS_BYTES;
+
+  CHECK(pthread_create(&thread, NULL, producer, &run) == 0);
+  consumer(&run);
+  pthread_join(thread, NULL);
+
+  CHECK(run.mismatches == 0);
+  CHECK(run.badCounts == 0);
+  CHECK(spsc_ring_empty(ring));
+  CHECK(ring->head == start + STRESS_BYTES);
+  if ( run.mismatches != 0)
+  {
+    printf("  capacity %u from %08x: %u bytes wrong, first at %u\n",
+           (unsigned)(ring->mask + 1), (unsigned)start,
+           (unsigned)run.mismatches, (unsigned)run.firstMismatch);
+  }
+}
+
+int main(void)
+{
+  static spsc_ring_t r8 = SPSC_RING_INIT(ring8);
+  static spsc_ring_t r64 = SPSC_RING_INIT(ring64);
+  static spsc_ring_t r1k = SPSC_RING_INIT(ring1k);
+  spsc_ring_t *rings[] = { &r8, &r64, &r1k };
+  uint32_t i;
+
+  for ( i = 0; i < sizeof(rings) / sizeof(rings[0]); i++)
+  {
+    stress(rings[i], 0);
+    stress(rings[i], 0u - STRESS_BYTES / 2);
+  }
+
+  return check_done();
+}
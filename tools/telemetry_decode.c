@@ -0,0 +1,125 @@
+//*****************************************************************************
+// Host side decoder for the telemetry frames sent by Project/telemetry.c.
+//
+// Reads the serial stream from a device (set to 115200 8N1 raw) or from a
+// capture file, or stdin with "-", and writes one CSV line per valid frame
+// to stdout.  Lines are flushed as they are decoded, so the output can be
+// piped straight into a plotting tool, for example
+//
+//    telemetry_decode /dev/ttyACM0 | feedgnuplot --stream --domain ...
+//
+// Frames with a bad CRC or length are skipped, and gaps in the sequence
+// numbers are counted as lost frames.  Log frames are left to log_decode.
+// The totals go to stderr at the end.
+//
+// Build: cc -O2 -o telemetry_decode telemetry_decode.c
+//*****************************************************************************
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include "frame_decode.h"
+
+// Must match telemetry_record_t
+#define RECORD_BYTES      53
+#define NUM_PHASES        5
+
+static const char *phaseNames[NUM_PHASES] = {
+  "input", "physics", "render", "persist", "idle"
+};
+
+static void print_header(void)
+{
+  int i;
+
+  printf("sequence,gamemode,tick,player1x,player1y,player2x,player2y,ballx,bally,"
+         "ballChangex,ballChangey,player1dx,player1dy,player2dx,player2dy,"
+         "joystickX,joystickY,tilt,buttonLeft,buttonRight,player1score,player2score");
+  for ( i = 0; i < NUM_PHASES; i++ )
+  {
+    printf(",%sCycles", phaseNames[i]);
+  }
+  printf("\n");
+}
+
+static void print_record(const uint8_t *r)
+{
+  int i;
+
+  printf("%u,%u,%u,%d,%d,%d,%d,%d,%d,%d,%d,%d,%d,%d,%d,%d,%d,%d,%u,%u,%u,%u",
+         frame_u16(&r[2]), r[1], frame_u32(&r[4]),
+         (int16_t)frame_u16(&r[8]), (int16_t)frame_u16(&r[10]),
+         (int16_t)frame_u16(&r[12]), (int16_t)frame_u16(&r[14]),
+         (int16_t)frame_u16(&r[16]), (int16_t)frame_u16(&r[18]),
+         (int8_t)r[20], (int8_t)r[21], (int8_t)r[22], (int8_t)r[23],
+         (int8_t)r[24], (int8_t)r[25], (int8_t)r[26], (int8_t)r[27],
+         (int16_t)frame_u16(&r[28]),
+         r[30] & 1, (r[30] >> 1) & 1, r[31], r[32]);
+  for ( i = 0; i < NUM_PHASES; i++ )
+  {
+    printf(",%u", frame_u32(&r[33 + 4 * i]));
+  }
+  printf("\n");
+  fflush(stdout);
+}
+
+int main(int argc, char **argv)
+{
+  frame_reader_t reader;
+  uint8_t payload[FRAME_MAX_PAYLOAD + 2];
+  uint8_t buf[512];
+  int haveSequence = 0;
+  uint16_t nextSequence = 0;
+  unsigned long wrongSize = 0, lost = 0;
+  ssize_t n;
+  int fd;
+
+  if ( argc != 2 )
+  {
+    fprintf(stderr, "usage: %s <serial device | capture file | ->\n", argv[0]);
+    return 2;
+  }
+  fd = strcmp(argv[1], "-") == 0 ? STDIN_FILENO : open(argv[1], O_RDONLY | O_NOCTTY);
+  if ( fd < 0 )
+  {
+    perror(argv[1]);
+    return 1;
+  }
+  frame_configure_tty(fd);
+  memset(&reader, 0, sizeof(reader));
+  print_header();
+
+  while ( (n = read(fd, buf, sizeof(buf))) > 0 )
+  {
+    ssize_t i;
+
+    for ( i = 0; i < n; i++ )
+    {
+      int length = frame_feed(&reader, buf[i], payload);
+
+      if ( length == 0 || payload[0] != FRAME_RECORD_TICK )
+      {
+        continue;
+      }
+      if ( length != RECORD_BYTES )
+      {
+        wrongSize++;
+        continue;
+      }
+
+      if ( haveSequence )
+      {
+        lost += (uint16_t)(frame_u16(&payload[2]) - nextSequence);
+      }
+      nextSequence = frame_u16(&payload[2]) + 1;
+      haveSequence = 1;
+      print_record(payload);
+    }
+  }
+
+  fprintf(stderr, "%lu frames, %lu bad, %lu wrong size, %lu lost\n",
+          reader.good, reader.bad, wrongSize, lost);
+  return 0;
+}
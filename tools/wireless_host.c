@@ -0,0 +1,250 @@
+//*****************************************************************************
+// Host side implementation of peripherals/include/wireless_link.h.
+//
+// Two processes on the same PC, each built with this file instead of
+// peripherals/c/wireless.c, talk over UDP on 127.0.0.1 the way two boards
+// talk over the radio.  Enhanced ShockBurst is simulated when a packet is
+// sent: every attempt is lost with the configured chance, and so is its
+// acknowledge, up to WIRELESS_RETRANSMITS retries spaced by the 500us
+// auto retransmit delay the board uses.  A packet whose data got through is
+// delivered once, even if every acknowledge was lost, like the radio
+// discarding duplicates.  Packets carry the time they may be received, so
+// the receiver sees the configured latency.  The latency stands for a
+// slower link than the radio, so it only adds to the round trip times,
+// the next packet still goes out as soon as the retries of the last one
+// are done.
+//
+// Build with: cc -O2 -o app app.c wireless_host.c
+//*****************************************************************************
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <arpa/inet.h>
+#include <sys/socket.h>
+#include "wireless_host.h"
+
+// ARD set by wireless_configure_device(), and roughly the air time of a
+// short packet plus its acknowledge at 2Mbps
+#define HOST_RETRANSMIT_DELAY_US  500
+#define HOST_AIR_TIME_US          200
+
+// Packets received but not due yet
+#define HOST_PENDING_MAX          64
+
+typedef struct {
+  uint64_t due;
+  uint8_t  length;
+  uint8_t  data[WIRELESS_MAX_PAYLOAD];
+} host_datagram_t;
+
+static int hostSocket = -1;
+static struct sockaddr_in hostRemote;
+static uint16_t hostLocalPort;
+static uint16_t hostRemotePort;
+static uint8_t hostLoss;
+static uint32_t hostLatencyUs;
+
+// When the radio is done with each queued packet, oldest first
+static uint64_t txDone[WIRELESS_QUEUE_LEN];
+static uint8_t txCount;
+
+static host_datagram_t pending[HOST_PENDING_MAX];
+static uint8_t pendingCount;
+
+static wireless_stats_t hostStats;
+
+uint64_t wireless_host_now_us(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000u + ts.tv_nsec / 1000;
+}
+
+void wireless_host_configure(
+  uint16_t local_port,
+  uint16_t remote_port,
+  uint8_t  loss_percent,
+  uint32_t latency_ms
+)
+{
+  hostLocalPort = local_port;
+  hostRemotePort = remote_port;
+  hostLoss = loss_percent > 100 ? 100 : loss_percent;
+  hostLatencyUs = latency_ms * 1000;
+}
+
+static int host_survives(void)
+{
+  return (rand() % 100) >= hostLoss;
+}
+
+// Forgets the packets that are finished
+static void host_retire(uint64_t now)
+{
+  uint8_t done = 0;
+
+  while (done < txCount && txDone[done] <= now)
+    done++;
+  memmove(txDone, txDone + done, (txCount - done) * sizeof(txDone[0]));
+  txCount -= done;
+}
+
+bool wireless_link_init(const uint8_t *my_id, const uint8_t *dest_id)
+{
+  struct sockaddr_in local;
+
+  (void)my_id;
+  (void)dest_id;
+
+  hostSocket = socket(AF_INET, SOCK_DGRAM, 0);
+  if (hostSocket < 0)
+    return false;
+
+  memset(&local, 0, sizeof(local));
+  local.sin_family = AF_INET;
+  local.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  local.sin_port = htons(hostLocalPort);
+  if (bind(hostSocket, (struct sockaddr *)&local, sizeof(local)) < 0) {
+    close(hostSocket);
+    hostSocket = -1;
+    return false;
+  }
+  fcntl(hostSocket, F_SETFL, fcntl(hostSocket, F_GETFL) | O_NONBLOCK);
+
+  memset(&hostRemote, 0, sizeof(hostRemote));
+  hostRemote.sin_family = AF_INET;
+  hostRemote.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  hostRemote.sin_port = htons(hostRemotePort);
+
+  srand((unsigned)wireless_host_now_us() ^ hostLocalPort);
+  txCount = 0;
+  pendingCount = 0;
+  memset(&hostStats, 0, sizeof(hostStats));
+  return true;
+}
+
+void wireless_link_release(void)
+{
+  if (hostSocket >= 0)
+    close(hostSocket);
+  hostSocket = -1;
+  txCount = 0;
+  pendingCount = 0;
+}
+
+bool wireless_link_send(const uint8_t *data, uint8_t length)
+{
+  uint8_t datagram[8 + WIRELESS_MAX_PAYLOAD];
+  uint64_t now = wireless_host_now_us();
+  uint64_t start, attemptTime, due = 0;
+  bool delivered = false, acked = false;
+  uint32_t rtt;
+  int attempt, i;
+
+  if (length == 0 || length > WIRELESS_MAX_PAYLOAD || hostSocket < 0)
+    return false;
+
+  host_retire(now);
+  if (txCount >= WIRELESS_QUEUE_LEN) {
+    hostStats.txQueueFull++;
+    return false;
+  }
+
+  // the radio starts on this packet once the ones ahead of it are done
+  start = txCount > 0 ? txDone[txCount - 1] : now;
+  hostStats.sent++;
+
+  for (attempt = 0; attempt <= WIRELESS_RETRANSMITS; attempt++) {
+    attemptTime = start + (uint64_t)attempt * (HOST_AIR_TIME_US + HOST_RETRANSMIT_DELAY_US);
+    if (!host_survives())
+      continue;
+    if (!delivered) {
+      delivered = true;
+      due = attemptTime + hostLatencyUs;
+    }
+    if (host_survives()) {
+      acked = true;
+      break;
+    }
+  }
+
+  if (attempt > WIRELESS_RETRANSMITS)
+    attempt = WIRELESS_RETRANSMITS;
+  hostStats.retransmits += attempt;
+
+  txDone[txCount++] = start + HOST_AIR_TIME_US +
+                     attempt * (HOST_AIR_TIME_US + HOST_RETRANSMIT_DELAY_US);
+  rtt = (uint32_t)(txDone[txCount - 1] - start) + 2 * hostLatencyUs;
+
+  if (acked) {
+    hostStats.acked++;
+    hostStats.rttLastUs = rtt;
+    hostStats.rttTotalUs += rtt;
+    if (hostStats.acked == 1 || rtt < hostStats.rttMinUs)
+      hostStats.rttMinUs = rtt;
+    if (rtt > hostStats.rttMaxUs)
+      hostStats.rttMaxUs = rtt;
+  }
+  else {
+    hostStats.lost++;
+  }
+
+  if (delivered) {
+    for (i = 0; i < 8; i++)
+      datagram[i] = (uint8_t)(due >> (8 * i));
+    memcpy(datagram + 8, data, length);
+    sendto(hostSocket, datagram, 8 + length, 0,
+           (struct sockaddr *)&hostRemote, sizeof(hostRemote));
+  }
+  return true;
+}
+
+bool wireless_link_receive(uint8_t *data, uint8_t *length)
+{
+  uint8_t datagram[8 + WIRELESS_MAX_PAYLOAD];
+  uint64_t now = wireless_host_now_us();
+  ssize_t n;
+  int i;
+
+  if (hostSocket < 0)
+    return false;
+
+  // everything sent so far, in order since the sender serializes packets
+  while ((n = recv(hostSocket, datagram, sizeof(datagram), 0)) > 8) {
+    if (pendingCount >= HOST_PENDING_MAX) {
+      hostStats.rxQueueFull++;
+      continue;
+    }
+    pending[pendingCount].due = 0;
+    for (i = 0; i < 8; i++)
+      pending[pendingCount].due |= (uint64_t)datagram[i] << (8 * i);
+    pending[pendingCount].length = (uint8_t)(n - 8);
+    memcpy(pending[pendingCount].data, datagram + 8, n - 8);
+    pendingCount++;
+  }
+
+  if (pendingCount == 0 || pending[0].due > now)
+    return false;
+
+  memcpy(data, pending[0].data, pending[0].length);
+  *length = pending[0].length;
+  pendingCount--;
+  memmove(pending, pending + 1, pendingCount * sizeof(pending[0]));
+  hostStats.received++;
+  return true;
+}
+
+bool wireless_link_busy(void)
+{
+  host_retire(wireless_host_now_us());
+  return txCount > 0;
+}
+
+void wireless_link_get_stats(wireless_stats_t *stats)
+{
+  *stats = hostStats;
+}
@@ -0,0 +1,28 @@
+//*****************************************************************************
+// PC stand-in for the nRF24L01+ link, see wireless_host.c.
+//*****************************************************************************
+#ifndef __WIRELESS_HOST_H__
+#define __WIRELESS_HOST_H__
+
+#include <stdint.h>
+#include "../peripherals/include/wireless_link.h"
+
+//*****************************************************************************
+// Sets up the simulated radio before wireless_link_init().  Packets go out
+// on UDP port remote_port of 127.0.0.1 and come in on local_port.  Each
+// transmission and each acknowledge is lost with loss_percent chance, and
+// every packet takes latency_ms to arrive.
+//*****************************************************************************
+void wireless_host_configure(
+  uint16_t local_port,
+  uint16_t remote_port,
+  uint8_t  loss_percent,
+  uint32_t latency_ms
+);
+
+//*****************************************************************************
+// Microseconds on the host monotonic clock, the time base of the simulation.
+//*****************************************************************************
+uint64_t wireless_host_now_us(void);
+
+#endif
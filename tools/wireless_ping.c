@@ -0,0 +1,67 @@
+//*****************************************************************************
+// Exercises the host wireless link.  Run two copies with the ports swapped:
+//
+//    ./wireless_ping 5001 5002 20 15 &
+//    ./wireless_ping 5002 5001 20 15
+//
+// Each sends a numbered packet every 20ms for 5 seconds, counts what the
+// other copy sent and prints the link statistics.
+//
+// Build: cc -O2 -o wireless_ping wireless_ping.c wireless_host.c
+//*****************************************************************************
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "wireless_host.h"
+
+#define PING_PERIOD_US    20000
+#define PING_COUNT        250
+
+int main(int argc, char **argv)
+{
+  static const uint8_t id[5] = { 1, 2, 3, 4, 5 };
+  uint8_t data[WIRELESS_MAX_PAYLOAD];
+  uint8_t length;
+  uint32_t sent = 0, received = 0, outOfOrder = 0, last = 0, number;
+  uint64_t next, end;
+  wireless_stats_t stats;
+
+  if (argc != 5) {
+    fprintf(stderr, "usage: %s local_port remote_port loss_percent latency_ms\n", argv[0]);
+    return 1;
+  }
+
+  wireless_host_configure(atoi(argv[1]), atoi(argv[2]), atoi(argv[3]), atoi(argv[4]));
+  if (!wireless_link_init(id, id)) {
+    perror("wireless_link_init");
+    return 1;
+  }
+
+  next = wireless_host_now_us();
+  end = next + (uint64_t)PING_COUNT * PING_PERIOD_US + 500000;
+  while (wireless_host_now_us() < end) {
+    if (sent < PING_COUNT && wireless_host_now_us() >= next) {
+      memcpy(data, &sent, sizeof(sent));
+      if (wireless_link_send(data, sizeof(sent)))
+        sent++;
+      next += PING_PERIOD_US;
+    }
+    while (wireless_link_receive(data, &length)) {
+      memcpy(&number, data, sizeof(number));
+      if (received > 0 && number <= last)
+        outOfOrder++;
+      last = number;
+      received++;
+    }
+    usleep(500);
+  }
+
+  wireless_link_get_stats(&stats);
+  printf("port %s: sent %u received %u out of order %u\n", argv[1], sent, received, outOfOrder);
+  printf("  acked %u lost %u retransmits %u queue full %u\n",
+         stats.acked, stats.lost, stats.retransmits, stats.txQueueFull);
+  printf("  rtt min %uus avg %uus max %uus\n", stats.rttMinUs,
+         stats.acked ? stats.rttTotalUs / stats.acked : 0, stats.rttMaxUs);
+  return 0;
+}
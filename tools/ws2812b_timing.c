@@ -0,0 +1,131 @@
+//*****************************************************************************
+// Checks the timing buffers of peripherals/c/ws2812b_encode.c.
+//
+// Runs the timer of ws2812b_dma.c over each buffer, one period per word:
+// the counter loads WS2812B_PERIOD_CYCLES - 1, the output is high from the
+// reload until the counter reaches the match value.  Every high and low
+// time must be inside the WS2812B data sheet limits, and the bits read back
+// from the high times must give the colors that were encoded.
+//
+//    ./ws2812b_timing [strips]
+//
+// Build: cc -O2 -I../peripherals/include -o ws2812b_timing ws2812b_timing.c
+//          ../peripherals/c/ws2812b_encode.c
+//*****************************************************************************
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "ws2812b_encode.h"
+
+#define TIMING_CLOCK_HZ   50000000u
+#define TIMING_MAX_LEDS   42      // largest strip one uDMA transfer can send
+
+// Data sheet limits in ns
+#define T0H_MIN   250
+#define T0H_MAX   550
+#define T1H_MIN   650
+#define T1H_MAX   950
+#define T0L_MIN   700
+#define T0L_MAX   1000
+#define T1L_MIN   300
+#define T1L_MAX   600
+
+static uint32_t cycles_to_ns(uint32_t cycles)
+{
+  return (uint32_t)((uint64_t)cycles * 1000000000u / TIMING_CLOCK_HZ);
+}
+
+// Cycles the output is high during a period with this match value
+static uint32_t high_cycles(uint32_t match)
+{
+  uint32_t count;
+  uint32_t high = 0;
+
+  for (count = WS2812B_PERIOD_CYCLES - 1; count > match; count--)
+    high++;
+  return high;
+}
+
+static int check_strip(const uint8_t *grb, uint16_t leds, uint32_t *timing)
+{
+  uint8_t decoded[TIMING_MAX_LEDS * 3];
+  uint16_t words = ws2812b_encode(grb, leds, timing);
+  uint32_t high, low, highNs, lowNs;
+  uint16_t i;
+  int errors = 0;
+
+  if (words != WS2812B_ENCODED_LEN(leds)) {
+    printf("%u leds: %u words, expected %u\n", leds, words, WS2812B_ENCODED_LEN(leds));
+    return 1;
+  }
+
+  memset(decoded, 0, sizeof(decoded));
+  for (i = 0; i < leds * 24; i++) {
+    if (timing[i] >= WS2812B_PERIOD_CYCLES) {
+      printf("bit %u: match %u outside the period\n", i, timing[i]);
+      errors++;
+      continue;
+    }
+    high = high_cycles(timing[i]);
+    low = WS2812B_PERIOD_CYCLES - high;
+    highNs = cycles_to_ns(high);
+    lowNs = cycles_to_ns(low);
+
+    if (highNs >= T0H_MIN && highNs <= T0H_MAX) {
+      if (lowNs < T0L_MIN || lowNs > T0L_MAX) {
+        printf("bit %u: 0 low for %uns\n", i, lowNs);
+        errors++;
+      }
+    } else if (highNs >= T1H_MIN && highNs <= T1H_MAX) {
+      if (lowNs < T1L_MIN || lowNs > T1L_MAX) {
+        printf("bit %u: 1 low for %uns\n", i, lowNs);
+        errors++;
+      }
+      decoded[i / 8] |= 0x80 >> (i % 8);
+    } else {
+      printf("bit %u: high for %uns is neither a 0 nor a 1\n", i, highNs);
+      errors++;
+    }
+  }
+
+  if (high_cycles(timing[leds * 24]) != 0) {
+    printf("%u leds: line not left low\n", leds);
+    errors++;
+  }
+  if (memcmp(decoded, grb, leds * 3) != 0) {
+    printf("%u leds: colors read back wrong\n", leds);
+    errors++;
+  }
+  return errors;
+}
+
+int main(int argc, char **argv)
+{
+  static uint32_t timing[WS2812B_ENCODED_LEN(TIMING_MAX_LEDS)];
+  uint8_t grb[TIMING_MAX_LEDS * 3];
+  uint32_t strips = argc > 1 ? strtoul(argv[1], NULL, 0) : 10000;
+  uint32_t s, errors = 0;
+  uint16_t leds, i;
+
+  printf("period %uns, 0 high %uns low %uns, 1 high %uns low %uns\n",
+         cycles_to_ns(WS2812B_PERIOD_CYCLES),
+         cycles_to_ns(WS2812B_T0H_CYCLES), cycles_to_ns(WS2812B_PERIOD_CYCLES - WS2812B_T0H_CYCLES),
+         cycles_to_ns(WS2812B_T1H_CYCLES), cycles_to_ns(WS2812B_PERIOD_CYCLES - WS2812B_T1H_CYCLES));
+
+  // all off and all on first, then random strips of every length
+  memset(grb, 0x00, sizeof(grb));
+  errors += check_strip(grb, TIMING_MAX_LEDS, timing);
+  memset(grb, 0xFF, sizeof(grb));
+  errors += check_strip(grb, TIMING_MAX_LEDS, timing);
+
+  srand(1);
+  for (s = 0; s < strips; s++) {
+    leds = 1 + s % TIMING_MAX_LEDS;
+    for (i = 0; i < leds * 3; i++)
+      grb[i] = rand();
+    errors += check_strip(grb, leds, timing);
+  }
+
+  printf("%u strips, %s\n", strips + 2, errors ? "FAILED" : "every bit inside the limits");
+  return errors != 0;
+}